@@ -31,6 +31,7 @@
 #include "Lib/BaseType.h"
 #include "Common/AsciiString.h"
 #include "Common/ArchiveFileSystem.h"
+#include "Common/FileMapping.h"
 
 class File;
 
@@ -52,6 +53,7 @@ public:
 
 	virtual Bool					getFileInfo( const AsciiString& filename, FileInfo *fileInfo) const = 0;	///< fill in the fileInfo struct with info about the file requested.
 	virtual File*					openFile( const Char *filename, Int access = 0) = 0;	///< Open the specified file within the archive file
+	virtual File*					openArchivedFile( const Char *filename, const ArchivedFileInfo *fileInfo, Int access = 0) = 0;	///< Open the file within the archive file whose directory entry is already known
 	virtual void					closeAllFiles( void ) = 0;									///< Close all file opened in this archive file
 	virtual AsciiString		getName( void ) = 0;												///< Returns the name of the archive file
 	virtual AsciiString		getPath( void ) = 0;												///< Returns full path and name of archive file
@@ -63,10 +65,16 @@ public:
 	void									getFileListInDirectory(const DetailedArchivedDirectoryInfo *dirInfo, const AsciiString& currentDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const;
 
 	void									addFile(const AsciiString& path, const ArchivedFileInfo *fileInfo); ///< add this file to our directory tree.
+	void									addFiles(const AsciiString& archiveFilename, const ArchiveIndex& index); ///< add all files of the archive index to our directory tree.
+
+	const DetailedArchivedDirectoryInfo *	getArchivedDirectoryInfo(const AsciiString& path) const;	///< return the directory from the directory tree, or NULL if it does not exist.
+	UnsignedInt							prefetchFile(const ArchivedFileInfo *fileInfo) const;	///< read the file from the mapped archive into memory. Returns the bytes read. Can be called from any thread.
 
 protected:
 	const ArchivedFileInfo *		getArchivedFileInfo(const AsciiString& filename) const;	///< return the ArchivedFileInfo from the directory tree.
+	File *										openMappedFile(const ArchivedFileInfo *fileInfo) const;	///< open the file as a view of the mapped archive, or return NULL if it cannot be mapped.
 
 	File *m_file; ///< file pointer to the archive file on disk.  Kept open so we don't have to continuously open and close the file all the time.
+	FileMapping m_mapping; ///< read only mapping of the archive file on disk, opened together with m_file.
 	DetailedArchivedDirectoryInfo m_rootDirectory;
 };
@@ -120,6 +120,39 @@ public:
 };
 
 
+// TheSuperHackers @performance The directory of an archive file, as read from its header or from
+// the archive index cache. Entries are in the order of the archive directory.
+struct ArchiveIndexEntry
+{
+	AsciiString m_path;					///< directory of the file inside the archive, with a trailing separator
+	AsciiString m_filename;			///< lower case file name
+	UnsignedInt m_offset;
+	UnsignedInt m_size;
+};
+
+typedef std::vector<ArchiveIndexEntry> ArchiveIndex;
+
+struct CachedArchiveIndex
+{
+	FileInfo m_fileInfo;				///< size and time stamp of the archive file the index was read from
+	ArchiveIndex m_index;
+	Bool m_used;								///< the archive was opened in this session
+};
+
+typedef std::map<AsciiString, CachedArchiveIndex> ArchiveIndexCache; // Lower case archive file name to cached index
+
+
+// TheSuperHackers @performance One archive that contains a file, together with the directory entry
+// of the file in that archive, which holds its offset and size.
+struct ArchivedFileLocation
+{
+	ArchiveFile *m_archive;
+	const ArchivedFileInfo *m_fileInfo;		///< NULL if the archive has no matching directory entry
+};
+
+typedef std::vector<ArchivedFileLocation> ArchivedFileLocationList;
+
+
 class ArchiveFileSystem : public SubsystemInterface
 {
 public:
@@ -150,9 +183,12 @@ public:
 	ArchiveFile* getArchiveFile(const AsciiString& filename, FileInstance instance = 0) const;
 
 	void loadMods( void );
+	void saveArchiveIndexCache( void );		///< Write the archive index cache, if archives were opened that were not in it.
 
 	ArchivedDirectoryInfo* friend_getArchivedDirectoryInfo(const Char* directory);
 
+	const ArchivedFileLocation* findFileLocation(const Char *filename, FileInstance instance);	///< return the location of the archived file, or NULL if no archive contains it.
+
 protected:
 	struct ArchivedDirectoryInfoResult
 	{
@@ -165,10 +201,43 @@ protected:
 
 	ArchivedDirectoryInfoResult getArchivedDirectoryInfo(const Char* directory);
 
+	// TheSuperHackers @performance File lookups go through a flat open addressing hash table from
+	// the normalized full path of an archived file to all of its locations, in the same override
+	// order as m_rootDirectory. The directory tree stays the primary index and is used for directory
+	// queries. The table is rebuilt from it on the next lookup after the tree could have changed.
+	struct FileLocationSlot
+	{
+		FileLocationSlot() : m_hash(0), m_firstLocation(0), m_numLocations(0) {}
+
+		AsciiString m_path;						///< normalized full path, empty if the slot is unused
+		UnsignedInt m_hash;
+		UnsignedInt m_firstLocation;	///< index into m_fileLocations
+		UnsignedInt m_numLocations;
+	};
+
+	typedef std::vector<FileLocationSlot> FileLocationSlotList;
+
+	const FileLocationSlot* findFileLocationSlot(const Char *path, UnsignedInt hash) const;
+	void buildFileLocationTable( void );
+	void addFileLocations(const ArchivedDirectoryInfo &dirInfo, FileLocationSlotList &files);
+
 	virtual void loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool overwrite = FALSE);	///< load the archive file's header information and apply it to the global archive directory tree.
 
+	const ArchiveIndex* findCachedArchiveIndex(const Char *filename);							///< return the cached index of the archive file, or NULL if it is not cached or the file changed.
+	void cacheArchiveIndex(const Char *filename, const ArchiveIndex &index);			///< remember the index that was read from the archive file header.
+	void loadArchiveIndexCache( void );
+	static AsciiString getArchiveIndexCachePath( void );
+
 	ArchiveFileMap m_archiveFileMap;
 	ArchivedDirectoryInfo m_rootDirectory;
+
+	FileLocationSlotList m_fileLocationSlots;			///< power of two sized
+	ArchivedFileLocationList m_fileLocations;
+	Bool m_fileLocationTableDirty;
+
+	ArchiveIndexCache m_archiveIndexCache;
+	Bool m_archiveIndexCacheLoaded;
+	Bool m_archiveIndexCacheDirty;
 };
 
 
@@ -0,0 +1,106 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: ArchivePrefetcher.h //////////////////////////////////////////////////////////////////////
+// Reads the archived files of a map on background threads while the map loads.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/AsciiString.h"
+#include "Common/ArchiveFileSystem.h"
+#include "mutex.h"
+
+// TheSuperHackers @performance The archive prefetcher records which archived files are opened while
+// a map loads, and writes them to a list in the user data folder. The next time the same map loads,
+// worker threads read these files from the mapped archives ahead of the main thread, so that the
+// W3D, texture, audio and INI loads find their pages in memory instead of waiting for the disk.
+// The amount of data read ahead is bounded. It is enabled with the -prefetchArchives command line
+// argument. The map load time is logged at the end of each load, to compare it with and without.
+class ArchivePrefetcher
+{
+public:
+
+	ArchivePrefetcher();
+	~ArchivePrefetcher();
+
+	void beginMapLoad(const AsciiString& mapName);	///< Starts reading the files of the map list and starts recording.
+	void endMapLoad();															///< Stops reading and recording and writes the map list.
+
+	/// Called for every archived file that is opened. Can be called from any thread.
+	void recordFile(const Char *filename);
+
+protected:
+
+	struct Job
+	{
+		ArchivedFileLocationList m_locations;
+		volatile LONG m_nextLocation;
+		volatile LONG m_bytesRead;
+		volatile LONG m_stop;
+	};
+
+	enum { MAX_THREADS = 4 };
+
+	static DWORD WINAPI threadProc(LPVOID param);
+	static AsciiString getListPath(const AsciiString& mapName);
+
+	void loadList(const AsciiString& mapName);
+	void writeList() const;
+	void stopThreads();
+
+	Job m_job;
+	HANDLE m_threads[MAX_THREADS];
+	Int m_numThreads;
+
+	AsciiString m_mapName;
+	Bool m_recording;
+	std::vector<AsciiString> m_recordedFiles;		///< in the order of the first open
+	std::set<AsciiString> m_recordedFileSet;
+	std::set<AsciiString> m_listedFileSet;			///< files in the list of the previous load
+	Int m_numListedFilesOpened;
+	Int64 m_startTicks;
+	FastCriticalSectionClass m_mutex;
+};
+
+extern ArchivePrefetcher *TheArchivePrefetcher;
+
+//-------------------------------------------------------------------------------------------------
+/** Prefetches the archived files of the map for the lifetime of this object, if the archive
+	* prefetcher is enabled. */
+//-------------------------------------------------------------------------------------------------
+class ArchivePrefetchScope
+{
+public:
+
+	ArchivePrefetchScope(const AsciiString& mapName) : m_active(TheArchivePrefetcher != NULL && mapName.isNotEmpty())
+	{
+		if (m_active)
+			TheArchivePrefetcher->beginMapLoad(mapName);
+	}
+
+	~ArchivePrefetchScope()
+	{
+		if (m_active && TheArchivePrefetcher != NULL)
+			TheArchivePrefetcher->endMapLoad();
+	}
+
+private:
+
+	Bool m_active;
+};
@@ -0,0 +1,72 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DecompressingFile.h //////////////////////////////////////////////////////////////////////
+// Read only file that decompresses another file while it is read.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/RAMFile.h"
+#include "Compression.h"
+
+// TheSuperHackers @performance A DecompressingFile reads a file that was compressed by the
+// CompressionManager, such as a map or a save game, in small pieces and decompresses it on the fly.
+// Neither the compressed nor the uncompressed data has to be held in memory as a whole. Seeking
+// backwards starts over at the beginning of the compressed file.
+class DecompressingFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(DecompressingFile, "DecompressingFile")
+
+public:
+
+	enum { INPUT_CHUNK_SIZE = 16 * 1024 };
+
+	DecompressingFile();
+	//virtual ~DecompressingFile();
+
+	/// Opens the given file if it starts with a compression header. The file then belongs to this file
+	/// and is closed with it. Otherwise returns false and rewinds the given file.
+	Bool openFromFile( File *sourceFile );
+
+	virtual void	close( void );
+	virtual Int		read( void *buffer, Int bytes );
+	virtual Int		write( const void *buffer, Int bytes );
+	virtual Int		seek( Int new_pos, seekMode mode = CURRENT );
+	virtual Int		size( void ) { return m_size; }
+
+	// Ini's should not be parsed with decompressing files, same as with streaming files.
+	virtual void	nextLine(Char *buf = NULL, Int bufSize = 0) { DEBUG_CRASH(("Should not call nextLine on a decompressing file.")); }
+	virtual Bool	scanInt(Int &newInt) { DEBUG_CRASH(("Should not call scanInt on a decompressing file."));  return FALSE; }
+	virtual Bool	scanReal(Real &newReal) { DEBUG_CRASH(("Should not call scanReal on a decompressing file.")); return FALSE; }
+	virtual Bool	scanString(AsciiString &newString) { DEBUG_CRASH(("Should not call scanString on a decompressing file.")); return FALSE; }
+	virtual Bool	copyDataToFile(File *localFile) { DEBUG_CRASH(("Are you sure you meant to copyDataToFile on a decompressing file?")); return FALSE; }
+
+	virtual char*	readEntireAndClose();
+	virtual File*	convertToRAMFile();
+	virtual const char* getView( Int &size ) { size = 0; return NULL; }
+
+protected:
+
+	Bool feedInput();
+	void closeSourceFile();
+
+	File *m_sourceFile;									///< The compressed file
+	DecompressionStream m_stream;
+	Int m_curPos;												///< Position in the uncompressed data
+};
@@ -0,0 +1,68 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: FileMapping.h ///////////////////////////////////////////////////////////////////////////
+// Read only memory mapping of a file on disk.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+
+// TheSuperHackers @performance A FileMapping maps ranges of a file into memory on request, so that
+// archive members can be read in place instead of being copied into a RAM file. Only the views
+// that are in use take address space, which matters for the large BIG archives in a 32 bit process.
+class FileMapping
+{
+public:
+
+	struct View
+	{
+		View() : m_base(NULL), m_length(0), m_data(NULL) {}
+
+		void *m_base;						///< start of the mapped pages
+		size_t m_length;				///< length of the mapped pages
+		const Char *m_data;			///< start of the requested range
+	};
+
+	FileMapping();
+	~FileMapping();
+
+	Bool open( const Char *path );	///< Returns false if the file cannot be mapped.
+	void close();
+	Bool isOpen() const;
+	Int size() const { return m_size; }
+
+	/// Maps the given range of the file. Returns false if the range cannot be mapped.
+	Bool mapView( Int offset, Int size, View &view ) const;
+	static void unmapView( View &view );
+
+private:
+
+	FileMapping(const FileMapping&);
+	FileMapping& operator=(const FileMapping&);
+
+#ifdef _WIN32
+	void *m_fileHandle;
+	void *m_mappingHandle;
+#else
+	int m_fileDescriptor;
+#endif
+	Int m_size;
+	UnsignedInt m_granularity;		///< view offsets must be a multiple of this
+};
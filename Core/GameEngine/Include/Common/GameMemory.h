@@ -800,6 +800,12 @@ extern void initMemoryManager();
 */
 extern Bool isMemoryManagerOfficiallyInited();
 
+/**
+	return the number of bytes that the memory manager currently holds from the system.
+	this is the memory of all pools and dmas, including their unused blocks, and is cheap to query.
+*/
+extern Int getMemoryManagerSystemBytes();
+
 /**
 	similar to initMemoryManager, but this should be used if the memory manager must be initialized
 	prior to main() (e.g., from a static constructor). If preMainInitMemoryManager() is called prior
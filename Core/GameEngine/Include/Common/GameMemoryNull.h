@@ -133,6 +133,12 @@ extern void initMemoryManager();
 */
 extern Bool isMemoryManagerOfficiallyInited();
 
+/**
+	return the number of bytes that the memory manager currently holds from the system.
+	always 0 for the null memory manager.
+*/
+extern Int getMemoryManagerSystemBytes();
+
 /**
 	Shut down the memory manager. Throw away TheMemoryPoolFactory and
 	TheDynamicMemoryAllocator.
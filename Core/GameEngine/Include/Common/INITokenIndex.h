@@ -0,0 +1,114 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string.h>
+#include <vector>
+
+//-------------------------------------------------------------------------------------------------
+/** Hash of a field or block token, used by INITokenIndex */
+//-------------------------------------------------------------------------------------------------
+inline UnsignedInt hashINIToken(const char* token)
+{
+	// FNV-1a
+	UnsignedInt hash = 2166136261u;
+	for (const unsigned char* c = (const unsigned char*)token; *c; ++c)
+	{
+		hash ^= *c;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Hashed lookup of the tokens of a NULL terminated parse table.
+	* The parse tables are static, so each one is indexed once on first use and the lookup finds
+	* exactly the entry that a linear strcmp scan of the table would find. */
+//-------------------------------------------------------------------------------------------------
+template <typename Entry>
+class INITokenIndex
+{
+public:
+
+	INITokenIndex() : m_table(NULL), m_terminator(NULL), m_mask(0) {}
+
+	Bool isBuilt() const { return m_table != NULL; }
+
+	void build(const Entry* table)
+	{
+		Int count = 0;
+		while (table[count].token)
+			++count;
+
+		UnsignedInt numSlots = 8;
+		while (numSlots < (UnsignedInt)count * 2)
+			numSlots <<= 1;
+
+		m_slots.assign(numSlots, Slot());
+		m_mask = numSlots - 1;
+		m_table = table;
+		m_terminator = table + count;
+
+		for (Int i = 0; i < count; ++i)
+		{
+			const UnsignedInt hash = hashINIToken(table[i].token);
+			UnsignedInt slot = hash & m_mask;
+			for (; m_slots[slot].index >= 0; slot = (slot + 1) & m_mask)
+			{
+				// a duplicate token keeps its first entry, like the linear scan does
+				if (m_slots[slot].hash == hash && strcmp(table[m_slots[slot].index].token, table[i].token) == 0)
+					break;
+			}
+			if (m_slots[slot].index < 0)
+			{
+				m_slots[slot].hash = hash;
+				m_slots[slot].index = i;
+			}
+		}
+	}
+
+	/// Returns the entry with this token, or NULL if there is none.
+	const Entry* find(const char* token, UnsignedInt hash) const
+	{
+		for (UnsignedInt slot = hash & m_mask; m_slots[slot].index >= 0; slot = (slot + 1) & m_mask)
+		{
+			const Slot& s = m_slots[slot];
+			if (s.hash == hash && strcmp(m_table[s.index].token, token) == 0)
+				return &m_table[s.index];
+		}
+		return NULL;
+	}
+
+	/// Returns the terminating entry of the table, which has a NULL token.
+	const Entry* getTerminator() const { return m_terminator; }
+
+private:
+
+	struct Slot
+	{
+		Slot() : hash(0), index(-1) {}
+		UnsignedInt hash;
+		Int index;		///< index of the entry in the table, or -1 if the slot is empty
+	};
+
+	std::vector<Slot> m_slots;
+	const Entry* m_table;
+	const Entry* m_terminator;
+	UnsignedInt m_mask;
+};
@@ -0,0 +1,51 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: MappedArchiveFile.h /////////////////////////////////////////////////////////////////////
+// Read only file that points straight into a memory mapped archive.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/FileMapping.h"
+#include "Common/RAMFile.h"
+
+// TheSuperHackers @performance A MappedArchiveFile behaves like a RAMFile, but its data is a view of
+// the mapped archive instead of a copy. Opening a file from a BIG archive therefore costs no
+// allocation and no read, and pages are only loaded from disk when they are touched.
+class MappedArchiveFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(MappedArchiveFile, "MappedArchiveFile")
+
+public:
+
+	MappedArchiveFile();
+	//virtual ~MappedArchiveFile();
+
+	/// Maps the given range of the archive. Returns false if the range cannot be mapped.
+	Bool openFromMapping(const FileMapping& mapping, const AsciiString& filename, Int offset, Int size);
+
+	virtual void	close( void );
+	virtual char*	readEntireAndClose();
+
+protected:
+
+	void unmap();
+
+	FileMapping::View m_view;
+};
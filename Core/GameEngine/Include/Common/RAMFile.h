@@ -113,6 +113,7 @@ class RAMFile : public File
 		*/
 		virtual char* readEntireAndClose();
 		virtual File* convertToRAMFile();
+		virtual const char* getView( Int &size ) { size = m_size; return m_data; }
 
 	protected:
 
@@ -0,0 +1,106 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: StartupProfiler.h ////////////////////////////////////////////////////////////////////////
+// Records the wall time and memory use of the startup and map load phases into a Chrome trace.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/AsciiString.h"
+
+// TheSuperHackers @feature The startup profiler records nested events for engine initialization,
+// subsystems, INI files, BIG archives and map load phases. It is enabled with the -startupTrace
+// command line argument. The events are written once, when the profiler is destroyed at shutdown,
+// to the given file in the Chrome trace event format, which can be opened with chrome://tracing or
+// https://ui.perfetto.dev. The memory values are the growth of the memory that the game memory
+// manager holds from the system during each event.
+class StartupProfiler
+{
+public:
+
+	StartupProfiler(const AsciiString& tracePath);
+	~StartupProfiler();
+
+	/// Begins a nested event. Events that are not roots are only recorded inside a root event.
+	void beginEvent(const char *category, const char *name, Bool isRoot);
+	void endEvent();
+
+	/// Writes all finished events to the trace file. Returns false if the file could not be written.
+	Bool writeTrace() const;
+
+protected:
+
+	struct Event
+	{
+		AsciiString m_name;
+		const char *m_category;
+		Int64 m_startTicks;
+		Int64 m_endTicks;		///< -1 while the event is open
+		Int m_startMemoryKB;
+		Int m_memoryKB;			///< memory manager growth during the event
+	};
+
+	static Int64 getTicks();
+	static Int getMemoryKB();
+
+	std::vector<Event> m_events;
+	std::vector<Int> m_openEvents;		///< indices of the open events, -1 for events that are not recorded
+	AsciiString m_tracePath;
+	Int64 m_frequency;
+	Int64 m_startTicks;
+};
+
+extern StartupProfiler *TheStartupProfiler;
+
+//-------------------------------------------------------------------------------------------------
+/** Records an event for the lifetime of this object, if the startup profiler is enabled.
+	* next() ends the current event and begins a new one, for consecutive phases of a function. */
+//-------------------------------------------------------------------------------------------------
+class StartupProfilerScope
+{
+public:
+
+	StartupProfilerScope(const char *category, const char *name, Bool isRoot = FALSE)
+		: m_category(category), m_isRoot(isRoot), m_active(TheStartupProfiler != NULL)
+	{
+		if (m_active)
+			TheStartupProfiler->beginEvent(m_category, name, m_isRoot);
+	}
+
+	~StartupProfilerScope()
+	{
+		if (m_active && TheStartupProfiler != NULL)
+			TheStartupProfiler->endEvent();
+	}
+
+	void next(const char *name)
+	{
+		if (m_active && TheStartupProfiler != NULL)
+		{
+			TheStartupProfiler->endEvent();
+			TheStartupProfiler->beginEvent(m_category, name, m_isRoot);
+		}
+	}
+
+private:
+
+	const char *m_category;
+	Bool m_isRoot;
+	Bool m_active;
+};
@@ -209,6 +209,14 @@ class File : public MemoryPoolObject
 		*/
 		virtual char* readEntireAndClose() = 0;
 		virtual File* convertToRAMFile() = 0;
+
+		/**
+			TheSuperHackers @performance Returns the entire file contents if they are
+			already in memory, or NULL otherwise. Parsers can use this to read the
+			file in place instead of copying it. The data is read only and stays
+			valid until the file is closed.
+		*/
+		virtual const char* getView( Int &size ) { size = 0; return NULL; }
 };
 
 
@@ -73,6 +73,12 @@ public:
 
 	void clearCommandsExceptFrom( Int playerIndex );
 
+	NetGameCommandDictionary *getReceivedGameCommands() { return &m_receivedGameCommands; }
+	void processCompactGameCommandsSupport(NetPacket::CompactSupport support, Bool usedCompactGameCommands);
+
+	Real getAverageLatency( void ) const { return m_averageLatency; }
+	UnsignedInt getTotalRetries( void ) const { return m_totalRetries; }
+
 	void setQuitting( void );
 	Bool isQuitting( void ) { return m_isQuitting; }
 
@@ -83,6 +89,41 @@ public:
 protected:
 	void doRetryMetrics();
 
+	static UnsignedInt getPendingCommandKey(UnsignedShort commandID, UnsignedByte playerID) { return ((UnsignedInt)playerID << 16) | commandID; }
+	void addPendingCommand(NetCommandRef *ref);
+	void removePendingCommand(NetCommandRef *ref);
+	void removeCommand(NetCommandRef *ref);
+	void clearPendingCommands();
+	void addRetryTime(NetCommandRef *ref, time_t timeLastSent);
+	Bool hasCommandsToSend(time_t curtime);
+	time_t getChunkRetryTime() const;
+	void removeChunkInFlight(NetCommandRef *ref);
+	void resetCompactGameCommands();
+
+	// TheSuperHackers @performance The commands that wait for an ack are indexed by player and command id,
+	// so that an ack does not walk the command list. Their send times are kept in min heaps, so that a send
+	// tick only walks the command list when a command was never sent or its retry time has passed. Chunks
+	// have their own heap, because their retry time is shorter than the one of the other commands.
+	struct RetryTime
+	{
+		time_t m_timeLastSent;
+		UnsignedInt m_key;
+
+		bool operator<(const RetryTime& other) const { return m_timeLastSent > other.m_timeLastSent; } // earliest on top
+	};
+
+	// TheSuperHackers @performance The chunks of a command that is too big for a packet, such as a transferred
+	// map file, are sent through a sliding window. At most MaxChunksInFlight chunks wait for their ack, so that
+	// a big transfer does not flood the send queue and the other commands keep going through. A chunk whose ack
+	// is late is resent after a few average round trips instead of the full retry time.
+	enum { MaxChunksInFlight = 64 };
+	enum { MinChunkRetryTime = 500 };
+
+	typedef std::hash_map<UnsignedInt, NetCommandRef *, rts::hash<UnsignedInt>, rts::equal_to<UnsignedInt> > PendingCommandMap;
+	typedef std::vector<RetryTime> RetryTimeHeap;
+
+	Bool isRetryDue(RetryTimeHeap &retryTimes, time_t retryTime, time_t curtime);
+
 	Bool m_isQuitting;
 	UnsignedInt m_quitTime;
 
@@ -90,12 +131,33 @@ protected:
 	User *m_user;
 
 	NetCommandList *m_netCommandList;
+	NetPacket *m_sendPacket;							///< Reused by doSend for every packet.
+	PendingCommandMap m_pendingCommands;	///< Commands in m_netCommandList that wait for an ack.
+	RetryTimeHeap m_retryTimes;						///< Send times of the pending commands. Entries of acked or resent commands are skipped lazily.
+	RetryTimeHeap m_chunkRetryTimes;			///< Send times of the pending chunks, like m_retryTimes.
+	Bool m_hasUnsentCommands;							///< Commands were added since the last complete pass over m_netCommandList.
+	Int m_numChunksInFlight;							///< Chunks of big commands that were sent and wait for an ack.
+	Bool m_hasChunksWaitingForWindow;			///< Chunks were never sent, because the window was full.
 	time_t m_retryTime;						///< The time between sending retry packets for this connection.  Time is in milliseconds.
 	Real m_averageLatency;			///< The average time between sending a command and receiving an ACK.
 	Real m_latencies[CONNECTION_LATENCY_HISTORY_LENGTH];	///< List of the last 100 latencies.
 
+	NetPacket::CompactSupport getCompactSupportToAnnounce() const;
+
+	// TheSuperHackers @performance Game commands are sent in the compact encoding once the other side
+	// announced that it reads it. Both sides announce it in their packets until they heard each other.
+	// The original game never announces it, so it is always sent the plain encoding. A side that announces
+	// the compact encoding also reads the checksums of chunks.
+	Bool m_peerReadsCompactGameCommands;			///< The other side announced the compact encoding.
+	Bool m_peerKnowsCompactGameCommands;			///< The other side heard our announcement, so it keeps a dictionary of our game commands.
+	Bool m_peerAnnouncesCompactGameCommands;	///< The other side has not heard our announcement yet.
+	Bool m_peerIsOriginalGame;								///< The other side never announced the compact encoding.
+	NetGameCommandDictionary m_sentGameCommands;
+	NetGameCommandDictionary m_receivedGameCommands;
+
 	time_t m_frameGrouping;				///< The minimum time between packet sends.
 	time_t m_lastTimeSent;				///< The time of the last packet send.
 	Int m_numRetries;							///< The number of retries for the last second.
 	time_t m_retryMetricsTime;		///< The start time of the current retry metrics thing.
+	UnsignedInt m_totalRetries;		///< The number of retries since init.
 };
@@ -39,6 +39,7 @@
 
 class GameInfo;
 class NetCommandWrapperList;
+struct NetworkTelemetryFrame;
 
 typedef std::map<UnsignedShort, AsciiString> FileCommandMap;
 typedef std::map<UnsignedShort, UnsignedByte> FileMaskMap;
@@ -80,7 +81,7 @@ public:
 	void processFrameTick(UnsignedInt frame);
 	void handleLocalPlayerLeaving(UnsignedInt frame);
 
-	void sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID);
+	Int sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID);
 	UnsignedShort sendFileAnnounce(AsciiString path, UnsignedByte playerMask);
 	Int getFileTransferProgress(Int playerID, AsciiString path);
 	Bool areAllQueuesEmpty(void);
@@ -137,6 +138,8 @@ public:
 	Int getAverageFPS( void );
 	Int getSlotAverageFPS(Int slot);
 
+	void getTelemetry(NetworkTelemetryFrame &frame);		///< Fills in the connection statistics of a telemetry frame.
+
 #if defined(RTS_DEBUG)
 	void debugPrintConnectionCommands();
 #endif
@@ -148,6 +151,7 @@ public:
 
 private:
 	void doRelay();
+	Connection * findConnection(UnsignedInt addr, UnsignedShort port);
 	void doKeepAlive();
 	void sendRemoteCommand(NetCommandRef *msg);
 	void ackCommand(NetCommandRef *ref, UnsignedInt localSlot);
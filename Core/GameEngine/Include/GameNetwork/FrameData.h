@@ -45,7 +45,6 @@ public:
 	UnsignedInt getFrame();
 	void setFrame(UnsignedInt frame);
 	FrameDataReturnType allCommandsReady(Bool debugSpewage);
-	NetCommandList * getCommandList();
 	void setFrameCommandCount(UnsignedInt totalCommandCount);
 	UnsignedInt getFrameCommandCount();
 	void addCommand(NetCommandMsg *msg);
@@ -53,11 +52,20 @@ public:
 	void zeroFrame();
 	void destroyGameMessages();
 
+	/// The commands of this frame in the order of a NetCommandList.
+	Int getNumCommands() const { return (Int)m_commands.size(); }
+	NetCommandMsg * getCommand(Int index) const { return m_commands[index]; }
+
 protected:
+	Bool hasCommand(NetCommandMsg *msg, Int index);
+	void clearCommands();
+
 	UnsignedInt m_frame;
 	UnsignedInt m_frameCommandCount;
 	UnsignedInt m_commandCount;
-	NetCommandList *m_commandList;
+	// TheSuperHackers @performance The commands are kept in a flat sorted array instead of a
+	// NetCommandList. Its storage is kept across frames, so adding a command does not allocate.
+	std::vector<NetCommandMsg *> m_commands;
 	UnsignedInt m_lastFailedCC;
 	UnsignedInt m_lastFailedFrameCC;
 };
@@ -41,7 +41,7 @@ public:
 	void addNetCommandMsg(NetCommandMsg *msg);
 	void setIsLocal(Bool isLocal);
 	FrameDataReturnType allCommandsReady(UnsignedInt frame, Bool debugSpewage);
-	NetCommandList * getFrameCommandList(UnsignedInt frame);
+	FrameData * getFrameData(UnsignedInt frame);
 	UnsignedInt getCommandCount(UnsignedInt frame);
 	void setFrameCommandCount(UnsignedInt frame, UnsignedInt commandCount);
 	UnsignedInt getFrameCommandCount(UnsignedInt frame);
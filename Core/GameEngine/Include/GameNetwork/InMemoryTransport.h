@@ -0,0 +1,138 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: InMemoryTransport.h //////////////////////////////////////////////////////////////////////
+// Transport that exchanges packets with other transports in the same process.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GameNetwork/Transport.h"
+
+class InMemoryTransport;
+
+// TheSuperHackers @feature The InMemoryNetwork connects InMemoryTransports in one process, so that
+// several ConnectionManagers can talk to each other without sockets. Packets are delivered after a
+// latency with random jitter, can be lost, and can be reordered by an extra delay. All randomness
+// comes from a seeded generator and packets are delivered by the network's own clock, which only
+// moves when advanceTime is called, so a run with the same seed and calls is always the same.
+class InMemoryNetwork
+{
+public:
+
+	struct Settings
+	{
+		Settings() : m_latency(0), m_jitter(0), m_lossPercent(0), m_reorderPercent(0), m_reorderDelay(0) {}
+
+		UnsignedInt m_latency;				///< Milliseconds until a packet arrives
+		UnsignedInt m_jitter;					///< Up to this many milliseconds are added to the latency
+		Int m_lossPercent;						///< Chance that a packet is lost
+		Int m_reorderPercent;					///< Chance that a packet is held back by m_reorderDelay
+		UnsignedInt m_reorderDelay;		///< Extra milliseconds for held back packets
+	};
+
+	struct Statistics
+	{
+		Statistics() : m_sentPackets(0), m_sentBytes(0), m_lostPackets(0), m_deliveredPackets(0), m_deliveredBytes(0), m_totalLatency(0) {}
+
+		UnsignedInt m_sentPackets;
+		UnsignedInt m_sentBytes;
+		UnsignedInt m_lostPackets;
+		UnsignedInt m_deliveredPackets;
+		UnsignedInt m_deliveredBytes;
+		UnsignedInt m_totalLatency;		///< Sum of the milliseconds between sending and reading the delivered packets
+	};
+
+	InMemoryNetwork( UnsignedInt seed );
+	~InMemoryNetwork();
+
+	void setSettings( const Settings& settings ) { m_settings = settings; }
+	const Settings& getSettings( void ) const { return m_settings; }
+
+	void advanceTime( UnsignedInt milliseconds ) { m_time += milliseconds; }
+	UnsignedInt getTime( void ) const { return m_time; }
+
+	const Statistics& getStatistics( void ) const { return m_statistics; }
+	void resetStatistics( void ) { m_statistics = Statistics(); }
+
+protected:
+
+	friend class InMemoryTransport;
+
+	struct Packet
+	{
+		UnsignedInt m_fromAddr;
+		UnsignedShort m_fromPort;
+		UnsignedInt m_sendTime;
+		std::vector<unsigned char> m_data;
+	};
+
+	typedef std::multimap<UnsignedInt, Packet> PacketQueue;	///< Packets by delivery time, in send order for the same time
+
+	struct Endpoint
+	{
+		InMemoryTransport *m_transport;
+		UnsignedInt m_addr;
+		UnsignedShort m_port;
+		PacketQueue m_packets;
+	};
+
+	typedef std::list<Endpoint> EndpointList;
+
+	Bool attach( InMemoryTransport *transport, UnsignedInt addr, UnsignedShort port );
+	void detach( InMemoryTransport *transport );
+	Int send( InMemoryTransport *transport, const unsigned char *buf, Int len, UnsignedInt addr, UnsignedShort port );
+	Int receive( InMemoryTransport *transport, unsigned char *buf, Int len, UnsignedInt *fromAddr, UnsignedShort *fromPort );
+
+	Endpoint *findEndpoint( InMemoryTransport *transport );
+	void deliver( Endpoint& from, Endpoint& to, const unsigned char *buf, Int len );
+	UnsignedInt getRandomValue( UnsignedInt range );
+
+	EndpointList m_endpoints;
+	Settings m_settings;
+	Statistics m_statistics;
+	UnsignedInt m_time;
+	UnsignedInt m_seed;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** A Transport that sends its packets through an InMemoryNetwork instead of a UDP socket. It can be
+	* given to ConnectionManager::attachTransport. The address passed to init identifies it on the
+	* network, and packets sent to 255.255.255.255 reach every other transport with the same port. */
+//-------------------------------------------------------------------------------------------------
+class InMemoryTransport : public Transport
+{
+public:
+
+	InMemoryTransport( InMemoryNetwork *network );
+	virtual ~InMemoryTransport();
+
+	virtual Bool allowBroadcasts( Bool val ) { return true; }
+
+protected:
+
+	virtual Bool openSocket( UnsignedInt ip, UnsignedShort port );
+	virtual void closeSocket( void );
+	virtual Bool isSocketOpen( void ) const { return m_isOpen; }
+	virtual Bool isSocketAddressUnavailable( void ) { return false; }
+	virtual void writeSocket( UDP::Datagram *datagrams, Int count );
+	virtual Int readSocket( UDP::Datagram *datagrams, Int count );
+
+	InMemoryNetwork *m_network;
+	Bool m_isOpen;
+};
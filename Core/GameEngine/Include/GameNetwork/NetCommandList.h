@@ -50,7 +50,9 @@ public:
 	void init();									///< Initialize the list
 	void reset();									///< Reset the list to the initial state.
 	NetCommandRef * addMessage(NetCommandMsg *cmdMsg);	///< Add message to the list in its properly ordered place.
-	Bool isEqualCommandMsg(NetCommandMsg *msg1, NetCommandMsg *msg2);
+	NetCommandRef * appendMessage(NetCommandMsg *cmdMsg);	///< Add a message that is not ordered before the last message to the end of the list.
+	static Bool isEqualCommandMsg(NetCommandMsg *msg1, NetCommandMsg *msg2);
+	static Int compareCommandMsg(NetCommandMsg *msg1, NetCommandMsg *msg2);	///< Compares two messages by the order of the list.
 	NetCommandRef * getFirstMessage();				///< Get the first message on the list.
 	NetCommandRef * findMessage(NetCommandMsg *msg);	///< Find and return a reference to the given message if one exists.
 	NetCommandRef * findMessage(UnsignedShort commandID, UnsignedByte playerID);	///< Find and return a reference to the
@@ -79,12 +79,21 @@ public:
 	GameMessage *constructGameMessage();
 	void addArgument(const GameMessageArgumentDataType type, GameMessageArgumentType arg);
 	void setGameMessageType(GameMessage::Type type);
+	GameMessage::Type getGameMessageType() { return m_type; }
+	Int getArgumentCount() const { return m_numArgs; }
+	const GameMessageArgument *getArguments() const { return m_args; }	///< The arguments in order, getArgumentCount() of them
+
+	// TheSuperHackers @performance The arguments are stored in an array like the ones of GameMessage. Most
+	// commands fit into the array inside the command, larger ones move their arguments to the heap.
+	// -measureNetEncoding reports how many commands of a replay fit.
+	enum { INLINE_ARGUMENT_COUNT = 8 };
 
 protected:
 	Int m_numArgs;
-	Int m_argSize;
+	Int m_argCapacity;											///< The number of arguments that fit into m_args
 	GameMessage::Type m_type;
-	GameMessageArgument *m_argList, *m_argTail;
+	GameMessageArgument *m_args;						///< m_inlineArgs or an array on the heap
+	GameMessageArgument m_inlineArgs[INLINE_ARGUMENT_COUNT];
 };
 
 //-----------------------------------------------------------------------------
@@ -391,6 +400,10 @@ public:
 	UnsignedShort getWrappedCommandID();
 	void setWrappedCommandID(UnsignedShort wrappedCommandID);
 
+	Bool hasWrappedDataChecksum();
+	UnsignedInt getWrappedDataChecksum();
+	void setWrappedDataChecksum(UnsignedInt checksum);
+
 private:
 	UnsignedByte *m_data;
 	// using UnsignedInt's so we can send around files of effectively unlimited size easily
@@ -400,6 +413,8 @@ private:
 	UnsignedInt m_chunkNumber;
 	UnsignedInt m_numChunks;
 	UnsignedShort m_wrappedCommandID;
+	UnsignedInt m_wrappedDataChecksum;		///< The checksum of the wrapped data after the first chunk
+	Bool m_hasWrappedDataChecksum;				///< Only peers that read the compact encoding send the checksum
 };
 
 //-----------------------------------------------------------------------------
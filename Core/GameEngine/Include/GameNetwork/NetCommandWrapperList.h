@@ -29,6 +29,21 @@
 
 #include "GameNetwork/NetCommandList.h"
 
+// TheSuperHackers @feature The chunks of a big command that did not complete, such as a map transfer that
+// timed out, kept by NetCommandWrapperList for a later transfer of the same command.
+struct NetCommandWrapperResumeData
+{
+	void init();
+	void release();
+
+	UnsignedByte *m_data;
+	Bool *m_chunksPresent;
+	UnsignedInt m_totalDataLength;
+	UnsignedInt m_numChunks;
+	UnsignedInt m_chunkSize;
+	UnsignedInt m_wrappedDataChecksum;		///< See NetWrapperCommandMsg::getWrappedDataChecksum
+};
+
 class NetCommandWrapperListNode : public MemoryPoolObject
 {
 	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(NetCommandWrapperListNode, "NetCommandWrapperListNode")
@@ -39,20 +54,34 @@ public:
 	Bool isComplete();
 	UnsignedShort getCommandID();
 	UnsignedInt getRawDataLength();
-	void copyChunkData(NetWrapperCommandMsg *msg);
+	void copyChunkData(NetWrapperCommandMsg *msg, std::vector<UnsignedShort> *resumedChunkIDs = NULL);
 	UnsignedByte * getRawData();
 
 	Int getPercentComplete(void);
+	UnsignedInt getNumChunksPresent() const { return m_numChunksPresent; }
+
+	Bool isDataValid();
+
+	void takeResumeData(NetCommandWrapperResumeData &resumeData, UnsignedInt wrappedDataChecksum);
+	Bool canKeepForResume() const;
+	void keepForResume(NetCommandWrapperResumeData &resumeData);
 
 	NetCommandWrapperListNode *m_next;
 
 protected:
+	void resume(NetWrapperCommandMsg *msg, std::vector<UnsignedShort> *resumedChunkIDs);
+
 	UnsignedShort m_commandID;
 	UnsignedByte *m_data;
 	UnsignedInt m_totalDataLength;
 	Bool *m_chunksPresent;
 	UnsignedInt m_numChunks;
 	UnsignedInt m_numChunksPresent;
+	UnsignedInt m_chunkSize;					///< The size of all but the last chunk, 0 until it is known
+	UnsignedInt m_wrappedDataChecksum;
+	Bool m_hasWrappedDataChecksum;
+
+	NetCommandWrapperResumeData m_resumeData;	///< The chunks of an earlier transfer of the same command
 
 };
 
@@ -66,13 +95,15 @@ public:
 	void init();
 	void reset();
 
-	void processWrapper(NetCommandRef *ref);
+	void processWrapper(NetCommandRef *ref, std::vector<UnsignedShort> *resumedChunkIDs = NULL);
 	NetCommandList * getReadyCommands();
 
 	Int getPercentComplete(UnsignedShort wrappedCommandID);
 
 protected:
 	void removeFromList(NetCommandWrapperListNode *node);
+	void keepForResume();
 
 	NetCommandWrapperListNode *m_list;
+	NetCommandWrapperResumeData m_resumeData;	///< Kept when the list is reset, see keepForResume
 };
@@ -0,0 +1,81 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: NetEncodingStats.h ///////////////////////////////////////////////////////////////////////
+// Measures how many bytes the game commands of a replay take in network packets.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/MessageStream.h"
+#include "GameNetwork/NetPacket.h"
+
+// TheSuperHackers @feature The network encoding statistics pack the game commands of a replay into
+// network packets the way a multiplayer game sends them, once in the plain and once in the compact
+// game command encoding, and print the bytes and packets of both when the playback ends. The compact
+// encoding refers to earlier commands as a connection does, with the acks arriving AckDelayFrames
+// frames after a command. They also
+// count the arguments of the commands, which the inline argument arrays of GameMessage and
+// NetGameCommandMsg are sized for. They are enabled with the -measureNetEncoding command line argument.
+class NetEncodingStats
+{
+public:
+
+	NetEncodingStats();
+	~NetEncodingStats();
+
+	void addGameMessage(GameMessage *msg, UnsignedInt frame);	///< Adds a message of a player, in the order of the frames
+	void print();
+
+protected:
+
+	enum Encoding
+	{
+		ENCODING_PLAIN,
+		ENCODING_COMPACT,
+		ENCODING_COUNT
+	};
+
+	enum { ARGUMENT_COUNT_BUCKETS = 17 };	///< The last bucket counts all commands with more arguments
+	enum { AckDelayFrames = 6 };						///< About a round trip of 200 milliseconds
+
+	struct SentCommand
+	{
+		UnsignedInt m_frame;
+		UnsignedShort m_commandID;
+		UnsignedByte m_playerID;
+	};
+	typedef std::list<SentCommand> SentCommandList;
+
+	void flush();
+	void startPacket(Int encoding);
+	void finishPacket(Int encoding);
+	void confirmCommands(UnsignedInt frame);
+
+	NetPacket *m_packets[ENCODING_COUNT];
+	NetGameCommandDictionary m_sentGameCommands;	///< The game commands of the compact encoding
+	SentCommandList m_unackedCommands;
+	UnsignedInt m_bytes[ENCODING_COUNT];
+	UnsignedInt m_numPackets[ENCODING_COUNT];
+	UnsignedInt m_numCommands;
+	UnsignedInt m_argumentCounts[ARGUMENT_COUNT_BUCKETS];	///< Number of commands by their number of arguments
+	UnsignedInt m_maxArgumentCount;
+	UnsignedInt m_frame;					///< frame of the commands in the packets
+	Int m_playerIndex;						///< player of the commands in the packets
+	UnsignedShort m_commandID;
+};
@@ -32,11 +32,14 @@ for the data, but at least that wouldn't be repeating code, that would
 be specialized code.
 */
 
+// TheSuperHackers @refactor The command types are now described by a table in NetPacket.cpp.
+
 #pragma once
 
 #include "NetworkDefs.h"
 
 #include "GameNetwork/NetCommandList.h"
+#include "Common/GameType.h"
 #include "Common/MessageStream.h"
 #include "Common/GameMemory.h"
 
@@ -45,10 +48,63 @@ class NetPacket;
 typedef std::list<NetPacket *> NetPacketList;
 typedef std::list<NetPacket *>::iterator NetPacketListIter;
 
+class NetGameCommandMsg;
+
+/**
+ * TheSuperHackers @performance The game commands that went over one direction of a connection. In the
+ * compact encoding a game command can refer to an earlier game command of the same connection, so that
+ * the object IDs and the location it shares with that command take a byte or less. The sender only
+ * refers to a command after the receiver acked it, and every entry is made from the arguments of its
+ * command alone, so the dictionaries of both sides hold the same entries no matter how the commands
+ * were encoded, lost or resent.
+ */
+class NetGameCommandDictionary
+{
+public:
+
+	enum { MaxEntries = 64 };
+	enum { MaxObjectIDs = 16 };	///< The object IDs of a command that can be referred to
+
+	struct Entry
+	{
+		void set(NetGameCommandMsg *msg);
+
+		UnsignedInt m_sequence;		///< Number of the entry in the dictionary, to tell how old it is
+		UnsignedShort m_commandID;
+		UnsignedByte m_playerID;
+		UnsignedByte m_numObjectIDs;
+		ObjectID m_objectIDs[MaxObjectIDs];
+		Coord3D m_location;				///< The last location argument of the command, or zero
+	};
+
+	NetGameCommandDictionary();
+
+	void reset();
+	void add(NetGameCommandMsg *msg);																///< Adds a game command that was sent or received
+	const Entry * find(UnsignedShort commandID, UnsignedByte playerID) const;
+	void confirm(UnsignedShort commandID, UnsignedByte playerID);					///< The receiver acked the given command
+	const Entry * getConfirmed() const;																		///< Returns the command to refer to, or NULL
+
+protected:
+
+	Entry m_entries[MaxEntries];	///< Ring of the latest commands
+	Entry m_confirmed;						///< Copy of the last acked command, so that it can leave the ring
+	UnsignedInt m_sequence;				///< Number of commands added so far
+	Bool m_hasConfirmed;
+};
+
 class NetPacket : public MemoryPoolObject
 {
 	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(NetPacket, "NetPacket")
 public:
+	/// What a packet tells about the compact game command encoding.
+	enum CompactSupport CPP_11(: Int)
+	{
+		COMPACT_SUPPORT_NONE,				///< Nothing, the sender either heard our announcement or is the original game
+		COMPACT_SUPPORT_ANNOUNCED,	///< The sender reads the compact encoding
+		COMPACT_SUPPORT_CONFIRMED		///< The sender reads the compact encoding and heard that we do
+	};
+
 	NetPacket();
 	NetPacket(TransportMessage *msg);
 	//virtual ~NetPacket();
@@ -56,10 +112,16 @@ public:
 	void init();
 	void reset();
 	void setAddress(Int addr, Int port);
-	Bool addCommand(NetCommandRef *msg);
+	void setBuffer(UnsignedByte *buffer);	///< Builds the packet in the given buffer of at least MAX_PACKET_SIZE bytes until the next init.
+	void setCompactGameCommands(Bool compact) { m_compactGameCommands = compact; }	///< Chooses the encoding of the game commands that are added until the next init.
+	void setChunkChecksums(Bool checksums) { m_chunkChecksums = checksums; }	///< Adds the checksums to the chunks that are added until the next init.
+	Bool addCommand(NetCommandRef *msg, const NetGameCommandDictionary::Entry *reference = NULL);
+	void announceCompactGameCommands(CompactSupport support);	///< Ends the packet with the given announcement, if it has room.
 	Int getNumCommands();
 
-	NetCommandList *getCommandList();
+	NetCommandList *getCommandList(NetGameCommandDictionary *dictionary = NULL);
+	CompactSupport getCompactSupport() const { return m_readCompactSupport; }	///< Valid after getCommandList
+	Bool hasCompactGameCommands() const { return m_readCompactGameCommands; }	///< Valid after getCommandList
 
 	static NetCommandRef * ConstructNetCommandMsgFromRawData(UnsignedByte *data, UnsignedShort dataLength);
 	static NetPacketList ConstructBigCommandPacketList(NetCommandRef *ref);
@@ -71,114 +133,9 @@ public:
 
 protected:
 	static UnsignedInt GetBufferSizeNeededForCommand(NetCommandMsg *msg);
-	static void FillBufferWithCommand(UnsignedByte *buffer, NetCommandRef *msg);
-
-	// These functions return the size of the command without any compression, repetition, etc.
-	// i.e. All of the required fields are taken into account when returning the size.
-	static UnsignedInt GetGameCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetAckCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetFrameCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetPlayerLeaveCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetRunAheadMetricsCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetRunAheadCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDestroyPlayerCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetKeepAliveCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDisconnectKeepAliveCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDisconnectPlayerCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetPacketRouterQueryCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetPacketRouterAckCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDisconnectChatCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDisconnectVoteCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetChatCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetProgressMessageSize(NetCommandMsg *msg);
-	static UnsignedInt GetLoadCompleteMessageSize(NetCommandMsg *msg);
-	static UnsignedInt GetTimeOutGameStartMessageSize(NetCommandMsg *msg);
-	static UnsignedInt GetWrapperCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetFileCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetFileAnnounceCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetFileProgressCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDisconnectFrameCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetDisconnectScreenOffCommandSize(NetCommandMsg *msg);
-	static UnsignedInt GetFrameResendRequestCommandSize(NetCommandMsg *msg);
-
-	static void FillBufferWithGameCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithAckCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithFrameCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithPlayerLeaveCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithRunAheadMetricsCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithRunAheadCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDestroyPlayerCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithKeepAliveCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDisconnectKeepAliveCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDisconnectPlayerCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithPacketRouterQueryCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithPacketRouterAckCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDisconnectChatCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDisconnectVoteCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithChatCommand(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithProgressMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithLoadCompleteMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithTimeOutGameStartMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithFileMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithFileProgressMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithFileAnnounceMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDisconnectFrameMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithDisconnectScreenOffMessage(UnsignedByte *buffer, NetCommandRef *msg);
-	static void FillBufferWithFrameResendRequestMessage(UnsignedByte *buffer, NetCommandRef *msg);
-
-	Bool addFrameCommand(NetCommandRef *msg);
-	Bool isRoomForFrameMessage(NetCommandRef *msg);
-	Bool addAckCommand(NetCommandRef *msg, UnsignedShort commandID, UnsignedByte originalPlayerID);
-	Bool addAckStage1Command(NetCommandRef *msg);
-	Bool addAckStage2Command(NetCommandRef *msg);
-	Bool addAckBothCommand(NetCommandRef *msg);
-	Bool isRoomForAckMessage(NetCommandRef *msg);
-	Bool addGameCommand(NetCommandRef *msg);
-	Bool isRoomForGameMessage(NetCommandRef *msg, GameMessage *gmsg);
-	Bool addPlayerLeaveCommand(NetCommandRef *msg);
-	Bool isRoomForPlayerLeaveMessage(NetCommandRef *msg);
-	Bool addRunAheadMetricsCommand(NetCommandRef *msg);
-	Bool isRoomForRunAheadMetricsMessage(NetCommandRef *msg);
-	Bool addRunAheadCommand(NetCommandRef *msg);
-	Bool isRoomForRunAheadMessage(NetCommandRef *msg);
-	Bool addDestroyPlayerCommand(NetCommandRef *msg);
-	Bool isRoomForDestroyPlayerMessage(NetCommandRef *msg);
-	Bool addKeepAliveCommand(NetCommandRef *msg);
-	Bool isRoomForKeepAliveMessage(NetCommandRef *msg);
-	Bool addDisconnectKeepAliveCommand(NetCommandRef *msg);
-	Bool isRoomForDisconnectKeepAliveMessage(NetCommandRef *msg);
-	Bool addDisconnectPlayerCommand(NetCommandRef *msg);
-	Bool isRoomForDisconnectPlayerMessage(NetCommandRef *msg);
-	Bool addPacketRouterQueryCommand(NetCommandRef *msg);
-	Bool isRoomForPacketRouterQueryMessage(NetCommandRef *msg);
-	Bool addPacketRouterAckCommand(NetCommandRef *msg);
-	Bool isRoomForPacketRouterAckMessage(NetCommandRef *msg);
-	Bool addDisconnectChatCommand(NetCommandRef *msg);
-	Bool isRoomForDisconnectChatMessage(NetCommandRef *msg);
-	Bool addChatCommand(NetCommandRef *msg);
-	Bool isRoomForChatMessage(NetCommandRef *msg);
-	Bool addDisconnectVoteCommand(NetCommandRef *msg);
-	Bool isRoomForDisconnectVoteMessage(NetCommandRef *msg);
-	Bool addProgressMessage( NetCommandRef *msg );
-	Bool isRoomForProgressMessage( NetCommandRef *msg );
-	Bool addLoadCompleteMessage( NetCommandRef *msg );
-	Bool isRoomForLoadCompleteMessage( NetCommandRef *msg );
-	Bool addTimeOutGameStartMessage( NetCommandRef *msg );
-	Bool isRoomForTimeOutGameStartMessage( NetCommandRef *msg );
-	Bool addWrapperCommand(NetCommandRef *msg);
-	Bool isRoomForWrapperMessage(NetCommandRef *msg);
-	Bool addFileCommand(NetCommandRef *msg);
-	Bool isRoomForFileMessage(NetCommandRef *msg);
-	Bool addFileAnnounceCommand(NetCommandRef *msg);
-	Bool isRoomForFileAnnounceMessage(NetCommandRef *msg);
-	Bool addFileProgressCommand(NetCommandRef *msg);
-	Bool isRoomForFileProgressMessage(NetCommandRef *msg);
-	Bool addDisconnectFrameCommand(NetCommandRef *msg);
-	Bool isRoomForDisconnectFrameMessage(NetCommandRef *msg);
-	Bool addDisconnectScreenOffCommand(NetCommandRef *msg);
-	Bool isRoomForDisconnectScreenOffMessage(NetCommandRef *msg);
-	Bool addFrameResendRequestCommand(NetCommandRef *msg);
-	Bool isRoomForFrameResendRequestMessage(NetCommandRef *msg);
+	static void FillBufferWithCommand(UnsignedByte *buffer, UnsignedInt bufferSize, NetCommandRef *ref);
+
+	void setLastCommand(NetCommandRef *ref);
 
 	Bool isAckRepeat(NetCommandRef *msg);
 	Bool isAckBothRepeat(NetCommandRef *msg);
@@ -186,41 +143,11 @@ protected:
 	Bool isAckStage2Repeat(NetCommandRef *msg);
 	Bool isFrameRepeat(NetCommandRef *msg);
 
-	static NetCommandMsg * readGameMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readAckBothMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readAckStage1Message(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readAckStage2Message(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readFrameMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readPlayerLeaveMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readRunAheadMetricsMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readRunAheadMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDestroyPlayerMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readKeepAliveMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDisconnectKeepAliveMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDisconnectPlayerMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readPacketRouterQueryMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readPacketRouterAckMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDisconnectChatMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDisconnectVoteMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readChatMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readProgressMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readLoadCompleteMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readTimeOutGameStartMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readWrapperMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readFileMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readFileAnnounceMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readFileProgressMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDisconnectFrameMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readDisconnectScreenOffMessage(UnsignedByte *data, Int &i);
-	static NetCommandMsg * readFrameResendRequestMessage(UnsignedByte *data, Int &i);
-
-	void writeGameMessageArgumentToPacket(GameMessageArgumentDataType type, GameMessageArgumentType arg);
-	static void readGameMessageArgumentFromPacket(GameMessageArgumentDataType type, NetGameCommandMsg *msg, UnsignedByte *data, Int &i);
-
 	void dumpPacketToLog();
 
 protected:
-	UnsignedByte		m_packet[MAX_PACKET_SIZE];
+	UnsignedByte*		m_packet;					///< Points to m_packetBuffer, or to the buffer given to setBuffer
+	UnsignedByte		m_packetBuffer[MAX_PACKET_SIZE];
 	Int							m_packetLen;
 	UnsignedInt			m_addr;
 	Int							m_numCommands;
@@ -231,4 +158,8 @@ protected:
 	UnsignedByte		m_lastPlayerID;
 	UnsignedByte		m_lastCommandType;
 	UnsignedByte		m_lastRelay;
+	Bool						m_compactGameCommands;
+	Bool						m_chunkChecksums;
+	CompactSupport	m_readCompactSupport;
+	Bool						m_readCompactGameCommands;
 };
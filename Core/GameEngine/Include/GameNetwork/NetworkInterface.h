@@ -76,7 +76,7 @@ public:
 	virtual void sendChat(UnicodeString text, Int playerMask) = 0;		///< Send a chat line using the normal system.
 	virtual void sendDisconnectChat(UnicodeString text) = 0;					///< Send a chat line using the disconnect manager.
 
-	virtual void sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID) = 0;
+	virtual Int sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID) = 0;	///< Returns the number of bytes sent, 0 if the file was not sent.
 	virtual UnsignedShort sendFileAnnounce(AsciiString path, UnsignedByte playerMask) = 0;
 	virtual Int getFileTransferProgress(Int playerID, AsciiString path) = 0;
 	virtual Bool areAllQueuesEmpty(void) = 0;
@@ -0,0 +1,78 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// FILE: NetworkTelemetry.h ///////////////////////////////////////////////////////////////////////
+// Writes the network statistics of every executed game logic frame to a CSV file.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/AsciiString.h"
+#include "GameNetwork/NetworkDefs.h"
+
+//-------------------------------------------------------------------------------------------------
+/** The network statistics of one frame. The byte, packet and retry values are running totals,
+	* the telemetry writes how much they grew since the previous frame. */
+//-------------------------------------------------------------------------------------------------
+struct NetworkTelemetryFrame
+{
+	UnsignedInt m_frame;
+	Int m_runAhead;
+	Int m_frameRate;
+	Int m_averageFps;
+	Int m_minimumCushion;							///< packet arrival cushion used for the run ahead, in frames
+	Real m_routerLatency;							///< average round trip to the packet router, in seconds
+	Int m_numCommands;								///< commands executed on this frame
+	Int m_numGameCommands;
+	UnsignedInt m_incomingBytes;
+	UnsignedInt m_incomingPackets;
+	UnsignedInt m_outgoingBytes;
+	UnsignedInt m_outgoingPackets;
+	Bool m_isConnected[MAX_SLOTS];
+	Real m_latency[MAX_SLOTS];				///< average time until a command to the slot is acked, in milliseconds
+	Int m_fps[MAX_SLOTS];							///< frame rate reported by the slot, -1 if not known
+	UnsignedInt m_retries[MAX_SLOTS];
+};
+
+// TheSuperHackers @feature The network telemetry writes one CSV row per executed game logic frame with
+// the run ahead, the packet arrival cushion, the latency, frame rate and resends of every slot, the
+// bytes and packets sent and received, and the number of executed commands. It is enabled with the
+// -netTelemetry command line argument in all build configurations. Every game appends to the given
+// file, so that the data of many matches is collected in one place. The nettelemetry tool in
+// Core/Tools summarizes the file per game.
+class NetworkTelemetry
+{
+public:
+
+	NetworkTelemetry(const AsciiString& path);
+	~NetworkTelemetry();
+
+	Bool isOpen() const { return m_file != NULL; }
+
+	void writeFrame(const NetworkTelemetryFrame& frame);
+
+protected:
+
+	void writeHeader();
+
+	FILE *m_file;
+	UnsignedInt m_lastTime;
+	NetworkTelemetryFrame m_last;		///< running totals of the previous frame
+	Bool m_hasLast;
+};
@@ -43,7 +43,7 @@ class Transport //: public MemoryPoolObject
 public:
 
 	Transport();
-	~Transport();
+	virtual ~Transport();
 
 	Bool init( AsciiString ip, UnsignedShort port );
 	Bool init( UnsignedInt ip, UnsignedShort port );
@@ -56,7 +56,13 @@ public:
 	Bool queueSend(UnsignedInt addr, UnsignedShort port, const UnsignedByte *buf, Int len /*,
 		NetMessageFlags flags, Int id */);				///< Queue a packet for sending to the specified address and port.  This will be sent on the next update() call.
 
-	Bool allowBroadcasts(Bool val) { if (!m_udpsock) return false; return (m_udpsock->AllowBroadcasts(val))?true:false; }
+	// TheSuperHackers @performance A packet can be built directly in a send slot, which saves the copy of
+	// queueSend. beginSend reserves a slot, the packet is written to its data, and endSend checksums and
+	// encrypts it in place and queues it.
+	TransportMessage *beginSend(UnsignedInt addr, UnsignedShort port);	///< Returns NULL if the send queue is full.
+	Bool endSend(TransportMessage *msg, Int len);												///< A len of 0 gives the slot back unsent.
+
+	virtual Bool allowBroadcasts(Bool val) { if (!m_udpsock) return false; return (m_udpsock->AllowBroadcasts(val))?true:false; }
 
 	// Latency insertion and packet loss
 	void setLatency( Bool val ) { m_useLatency = val; }
@@ -70,6 +76,16 @@ public:
 	Real getUnknownBytesPerSecond( void );
 	Real getUnknownPacketsPerSecond( void );
 
+	/// Running totals of the bytes and packets of the game, since init.
+	struct Totals
+	{
+		UnsignedInt m_incomingBytes;
+		UnsignedInt m_incomingPackets;
+		UnsignedInt m_outgoingBytes;
+		UnsignedInt m_outgoingPackets;
+	};
+	const Totals& getTotals( void ) const { return m_totals; }
+
 	TransportMessage m_outBuffer[MAX_MESSAGES];
 	TransportMessage m_inBuffer[MAX_MESSAGES];
 
@@ -78,10 +94,34 @@ public:
 #endif
 
 	UnsignedShort m_port;
+
+protected:
+	void resetSendSlots( void );
+	void resetTotals( void );
+
+	// TheSuperHackers @feature The socket operations are virtual, so that a derived transport can send its
+	// packets somewhere other than a UDP socket, such as the InMemoryTransport. The queues, the packet
+	// checks, the encryption and the statistics stay the same.
+	virtual Bool openSocket( UnsignedInt ip, UnsignedShort port );	///< Opens and binds the socket.
+	virtual void closeSocket( void );
+	virtual Bool isSocketOpen( void ) const { return m_udpsock != NULL; }
+	virtual Bool isSocketAddressUnavailable( void );								///< True if the last socket error says the local address is gone.
+	/// Sends the packets. The result of each is the number of bytes sent, or a value <= 0 on failure.
+	virtual void writeSocket( UDP::Datagram *datagrams, Int count );
+	/// Reads up to count packets. Returns the number read, 0 if there are none and -1 on a socket error.
+	virtual Int readSocket( UDP::Datagram *datagrams, Int count );
+
 private:
 	Bool m_winsockInit;
 	UDP *m_udpsock;
 
+	// Send slots of m_outBuffer, so that sending does not look at every slot
+	Int m_freeSendSlots[MAX_MESSAGES];		///< Stack of the empty slots
+	Int m_numFreeSendSlots;
+	Int m_sendQueue[MAX_MESSAGES];				///< Ring of the queued slots in the order they were queued
+	Int m_sendQueueHead;
+	Int m_sendQueueLength;
+
 	// Latency insertion and packet loss
 	Bool m_useLatency;
 	Bool m_usePacketLoss;
@@ -95,6 +135,7 @@ private:
 	UnsignedInt m_outgoingPackets[MAX_TRANSPORT_STATISTICS_SECONDS];
 	Int m_statisticsSlot;
 	UnsignedInt m_lastSecond;
+	Totals m_totals;
 
 	Bool isGeneralsPacket( TransportMessage *msg );
 };
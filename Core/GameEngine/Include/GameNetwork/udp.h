@@ -34,6 +34,7 @@
 //#define close _close
 //#define read  _read
 //#define write _write
+typedef int socklen_t;  // as in ws2tcpip.h
 
 #else  //UNIX
 #include <netdb.h>
@@ -45,6 +46,7 @@
 #include <sys/time.h>
 #include <fcntl.h>
 #include <limits.h>
+#define closesocket close
 #endif
 
 #ifdef AIX
@@ -92,6 +94,16 @@ class UDP
     TIMEDOUT     =-15      // Timeout
   };
 
+  // TheSuperHackers @performance A datagram for ReadBatch and WriteBatch.
+  struct Datagram
+  {
+    unsigned char *buf;    ///< Buffer to read into, or data to send
+    UnsignedInt    len;    ///< Size of the buffer, or length of the data
+    UnsignedInt    ip;     ///< Sender or receiver, in host order
+    UnsignedShort  port;   ///< Sender or receiver, in host order
+    Int            result; ///< Bytes read or sent, or -1 on failure
+  };
+
 // CODE
  private:
   Int           SetBlocking(Int block);
@@ -105,6 +117,10 @@ class UDP
   Int           Bind(const char *Host,UnsignedShort port);
   Int           Write(const unsigned char *msg,UnsignedInt len,UnsignedInt IP,UnsignedShort port);
   Int           Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from);
+  // Batched versions of Read and Write, with one system call for many datagrams where the system
+  // supports it (recvmmsg and sendmmsg on Linux), and a loop of single calls elsewhere.
+  Int           ReadBatch(Datagram *datagrams,Int count);   ///< Returns the number read, or -1 on an error before the first one.
+  Int           WriteBatch(Datagram *datagrams,Int count);  ///< Sends all, returns the number sent. Each result says how it went.
   sockStat         GetStatus(void);
   void             ClearStatus(void);
   //int              Wait(Int sec,Int usec,fd_set &returnSet);
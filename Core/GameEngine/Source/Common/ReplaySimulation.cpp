@@ -171,10 +171,12 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 			UnicodeString filenameWide;
 			filenameWide.translate(filenames[filenamePositionStarted]);
 			UnicodeString command;
-			command.format(L"\"%s\"%s%s -replay \"%s\"",
+			command.format(L"\"%s\"%s%s%s%s -replay \"%s\"",
 				exePath,
 				TheGlobalData->m_windowed ? L" -win" : L"",
 				TheGlobalData->m_headless ? L" -headless" : L"",
+				TheGlobalData->m_profileScripts ? L" -profileScripts" : L"",
+				TheGlobalData->m_measureNetEncoding ? L" -measureNetEncoding" : L"",
 				filenameWide.str());
 
 			processes.push_back(WorkerProcess());
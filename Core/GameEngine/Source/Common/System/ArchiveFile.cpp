@@ -31,6 +31,7 @@
 #include "Common/ArchiveFile.h"
 #include "Common/ArchiveFileSystem.h"
 #include "Common/file.h"
+#include "Common/MappedArchiveFile.h"
 #include "Common/PerfTimer.h"
 
 
@@ -122,6 +123,20 @@ void ArchiveFile::addFile(const AsciiString& path, const ArchivedFileInfo *fileI
 	dirInfo->m_files[fileInfo->m_filename] = *fileInfo;
 }
 
+void ArchiveFile::addFiles(const AsciiString& archiveFilename, const ArchiveIndex& index)
+{
+	ArchivedFileInfo fileInfo;
+	fileInfo.m_archiveFilename = archiveFilename;
+
+	for (ArchiveIndex::const_iterator it = index.begin(); it != index.end(); ++it)
+	{
+		fileInfo.m_filename = it->m_filename;
+		fileInfo.m_offset = it->m_offset;
+		fileInfo.m_size = it->m_size;
+		addFile(it->m_path, &fileInfo);
+	}
+}
+
 void ArchiveFile::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
 {
 	const DetailedArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
@@ -190,6 +205,70 @@ void ArchiveFile::attachFile(File *file)
 		m_file = NULL;
 	}
 	m_file = file;
+
+	// TheSuperHackers @performance Map the archive so that its files can be read in place.
+	// If this fails, the files are copied out of m_file as before.
+	m_mapping.close();
+	if (m_file != NULL) {
+		m_mapping.open(m_file->getName());
+	}
+}
+
+File * ArchiveFile::openMappedFile(const ArchivedFileInfo *fileInfo) const
+{
+	if (!m_mapping.isOpen() || fileInfo->m_size <= 0) {
+		return NULL;
+	}
+
+	MappedArchiveFile *mappedFile = newInstance( MappedArchiveFile );
+	mappedFile->deleteOnClose();
+	if (mappedFile->openFromMapping(m_mapping, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
+		mappedFile->close();
+		return NULL;
+	}
+
+	return mappedFile;
+}
+
+UnsignedInt ArchiveFile::prefetchFile(const ArchivedFileInfo *fileInfo) const
+{
+	FileMapping::View view;
+	if (!m_mapping.isOpen() || fileInfo->m_size <= 0 || !m_mapping.mapView(fileInfo->m_offset, fileInfo->m_size, view)) {
+		return 0;
+	}
+
+	// touch every page, so that the later open finds it in memory
+	const UnsignedInt pageSize = 4096;
+	volatile Char sum = 0;
+	for (UnsignedInt i = 0; i < fileInfo->m_size; i += pageSize) {
+		sum += view.m_data[i];
+	}
+	sum += view.m_data[fileInfo->m_size - 1];
+
+	FileMapping::unmapView(view);
+	return fileInfo->m_size;
+}
+
+const DetailedArchivedDirectoryInfo * ArchiveFile::getArchivedDirectoryInfo(const AsciiString& path) const
+{
+	const DetailedArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
+
+	AsciiString token;
+	AsciiString tokenizer = path;
+	tokenizer.toLower();
+
+	while (tokenizer.nextToken(&token, "\\/"))
+	{
+		DetailedArchivedDirectoryInfoMap::const_iterator it = dirInfo->m_directories.find(token);
+		if (it == dirInfo->m_directories.end())
+		{
+			return NULL;
+		}
+
+		dirInfo = &it->second;
+	}
+
+	return dirInfo;
 }
 
 const ArchivedFileInfo * ArchiveFile::getArchivedFileInfo(const AsciiString& filename) const
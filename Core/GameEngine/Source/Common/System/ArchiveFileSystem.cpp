@@ -48,7 +48,10 @@
 #include "PreRTS.h"
 #include "Common/ArchiveFile.h"
 #include "Common/ArchiveFileSystem.h"
+#include "Common/ArchivePrefetcher.h"
 #include "Common/AsciiString.h"
+#include "Common/GlobalData.h"
+#include "Common/LocalFileSystem.h"
 #include "Common/PerfTimer.h"
 
 
@@ -73,6 +76,9 @@
 //         Private Data
 //----------------------------------------------------------------------------
 
+static const UnsignedInt ARCHIVE_INDEX_CACHE_ID = 0x49474942; // 'BIGI'
+static const UnsignedInt ARCHIVE_INDEX_CACHE_VERSION = 1;
+
 
 
 //----------------------------------------------------------------------------
@@ -92,6 +98,123 @@ ArchiveFileSystem *TheArchiveFileSystem = NULL;
 //         Private Functions
 //----------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------
+// Reads the values of the archive index cache and fails for good on the first
+// value that does not fit into the remaining data.
+//----------------------------------------------------------------------------
+class ArchiveIndexCacheReader
+{
+public:
+	ArchiveIndexCacheReader(const char *data, size_t size) : m_data(data), m_size(size), m_pos(0), m_ok(TRUE) {}
+
+	Bool ok() const { return m_ok; }
+	Bool atEnd() const { return m_pos == m_size; }
+
+	UnsignedInt readUnsignedInt()
+	{
+		UnsignedInt value = 0;
+		if (m_ok && m_size - m_pos >= sizeof(value)) {
+			memcpy(&value, m_data + m_pos, sizeof(value));
+			m_pos += sizeof(value);
+		} else {
+			m_ok = FALSE;
+		}
+		return value;
+	}
+
+	void readString(AsciiString &str)
+	{
+		const UnsignedInt length = readUnsignedInt();
+		if (m_ok && length < _MAX_PATH && m_size - m_pos >= length) {
+			str.set(m_data + m_pos, length);
+			m_pos += length;
+		} else {
+			m_ok = FALSE;
+		}
+	}
+
+private:
+	const char *m_data;
+	size_t m_size;
+	size_t m_pos;
+	Bool m_ok;
+};
+
+static void writeCacheUnsignedInt(std::vector<char> &data, UnsignedInt value)
+{
+	const char *bytes = (const char *)&value;
+	data.insert(data.end(), bytes, bytes + sizeof(value));
+}
+
+static void writeCacheString(std::vector<char> &data, const AsciiString &str)
+{
+	writeCacheUnsignedInt(data, str.getLength());
+	data.insert(data.end(), str.str(), str.str() + str.getLength());
+}
+
+//----------------------------------------------------------------------------
+// Writes the path the way the archive directory tree keys it: in lower case,
+// with single backslashes between the components, and ending with the last
+// component that contains a dot, which is the file name. Returns the length,
+// or -1 if there is no such component or the path does not fit.
+//----------------------------------------------------------------------------
+static Int normalizeArchivedPath(const Char *path, Char *buffer, Int bufferSize)
+{
+	Int length = 0;
+	Int fileEnd = -1;
+	Bool hasDot = FALSE;
+
+	for (const Char *c = path; ; ++c)
+	{
+		if (*c == '\\' || *c == '/' || *c == '\0')
+		{
+			// a component ends here, unless there were only separators so far
+			if (length > 0 && buffer[length - 1] != '\\')
+			{
+				if (hasDot)
+					fileEnd = length;
+				hasDot = FALSE;
+
+				if (*c != '\0')
+				{
+					if (length >= bufferSize - 1)
+						return -1;
+					buffer[length++] = '\\';
+				}
+			}
+
+			if (*c == '\0')
+				break;
+		}
+		else
+		{
+			if (length >= bufferSize - 1)
+				return -1;
+			if (*c == '.')
+				hasDot = TRUE;
+			buffer[length++] = (Char)tolower((unsigned char)*c);
+		}
+	}
+
+	if (fileEnd >= 0)
+		buffer[fileEnd] = '\0';
+	return fileEnd;
+}
+
+//----------------------------------------------------------------------------
+// FNV-1a hash of a normalized path.
+//----------------------------------------------------------------------------
+static UnsignedInt hashArchivedPath(const Char *path)
+{
+	UnsignedInt hash = 2166136261u;
+	for (const Char *c = path; *c; ++c)
+	{
+		hash ^= (UnsignedByte)*c;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
 
 
 //----------------------------------------------------------------------------
@@ -102,6 +225,9 @@ ArchiveFileSystem *TheArchiveFileSystem = NULL;
 // ArchivedFileInfo
 //------------------------------------------------------
 ArchiveFileSystem::ArchiveFileSystem()
+	: m_fileLocationTableDirty(TRUE)
+	, m_archiveIndexCacheLoaded(FALSE)
+	, m_archiveIndexCacheDirty(FALSE)
 {
 }
 
@@ -117,6 +243,7 @@ ArchiveFileSystem::~ArchiveFileSystem()
 
 void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool overwrite)
 {
+	m_fileLocationTableDirty = TRUE;
 
 	FilenameList filenameList;
 
@@ -240,23 +367,314 @@ void ArchiveFileSystem::loadMods()
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
-
-	if (!result.valid())
-		return false;
-
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
-
-	return range.valid();
+	return const_cast<ArchiveFileSystem*>(this)->findFileLocation(filename, instance) != NULL;
 }
 
 ArchivedDirectoryInfo* ArchiveFileSystem::friend_getArchivedDirectoryInfo(const Char* directory)
 {
 	ArchivedDirectoryInfoResult result = getArchivedDirectoryInfo(directory);
 
+	// the caller may reorder the file locations of the directory
+	m_fileLocationTableDirty = TRUE;
+
 	return result.dirInfo;
 }
 
+const ArchivedFileLocation* ArchiveFileSystem::findFileLocation(const Char *filename, FileInstance instance)
+{
+	if (m_fileLocationTableDirty)
+		buildFileLocationTable();
+
+	const FileLocationSlot *slot = NULL;
+	Char path[_MAX_PATH];
+
+	if (normalizeArchivedPath(filename, path, ARRAY_SIZE(path)) >= 0)
+	{
+		slot = findFileLocationSlot(path, hashArchivedPath(path));
+	}
+	else
+	{
+		// Paths without a file name resolve through the directory tree, so that they still
+		// find the same entries as before.
+		ArchivedDirectoryInfoResult result = getArchivedDirectoryInfo(filename);
+
+		if (!result.valid())
+			return NULL;
+
+		AsciiString fullPath = result.dirInfo->m_path;
+		fullPath.concat(result.lastToken);
+		slot = findFileLocationSlot(fullPath.str(), hashArchivedPath(fullPath.str()));
+	}
+
+	if (slot == NULL || instance >= slot->m_numLocations)
+		return NULL;
+
+	return &m_fileLocations[slot->m_firstLocation + instance];
+}
+
+const ArchiveFileSystem::FileLocationSlot* ArchiveFileSystem::findFileLocationSlot(const Char *path, UnsignedInt hash) const
+{
+	// the table is never more than half full, so the probing always reaches an unused slot
+	const UnsignedInt mask = m_fileLocationSlots.size() - 1;
+
+	for (UnsignedInt i = hash & mask; ; i = (i + 1) & mask)
+	{
+		const FileLocationSlot &slot = m_fileLocationSlots[i];
+
+		if (slot.m_numLocations == 0)
+			return NULL;
+
+		if (slot.m_hash == hash && strcmp(slot.m_path.str(), path) == 0)
+			return &slot;
+	}
+}
+
+void ArchiveFileSystem::buildFileLocationTable()
+{
+	m_fileLocationTableDirty = FALSE;
+	m_fileLocations.clear();
+
+	FileLocationSlotList files;
+	addFileLocations(m_rootDirectory, files);
+
+	size_t numSlots = 16;
+	while (numSlots < files.size() * 2)
+		numSlots *= 2;
+
+	m_fileLocationSlots.clear();
+	m_fileLocationSlots.resize(numSlots);
+
+	const UnsignedInt mask = numSlots - 1;
+
+	for (FileLocationSlotList::const_iterator it = files.begin(); it != files.end(); ++it)
+	{
+		UnsignedInt i = it->m_hash & mask;
+		while (m_fileLocationSlots[i].m_numLocations != 0)
+			i = (i + 1) & mask;
+
+		m_fileLocationSlots[i] = *it;
+	}
+}
+
+void ArchiveFileSystem::addFileLocations(const ArchivedDirectoryInfo &dirInfo, FileLocationSlotList &files)
+{
+	// look up the directory of each archive only once per directory
+	typedef std::map<ArchiveFile *, const DetailedArchivedDirectoryInfo *> ArchiveDirectoryMap;
+	ArchiveDirectoryMap archiveDirectories;
+
+	ArchivedFileLocationMap::const_iterator it = dirInfo.m_files.begin();
+	while (it != dirInfo.m_files.end())
+	{
+		const AsciiString &name = it->first;
+
+		FileLocationSlot file;
+		file.m_path = dirInfo.m_path;
+		file.m_path.concat(name);
+		file.m_hash = hashArchivedPath(file.m_path.str());
+		file.m_firstLocation = m_fileLocations.size();
+
+		// the locations of one file are adjacent in the multimap and already in override order
+		for (; it != dirInfo.m_files.end() && it->first == name; ++it)
+		{
+			ArchiveDirectoryMap::iterator dirIt = archiveDirectories.find(it->second);
+			if (dirIt == archiveDirectories.end())
+				dirIt = archiveDirectories.insert(std::make_pair(it->second, it->second->getArchivedDirectoryInfo(dirInfo.m_path))).first;
+
+			ArchivedFileLocation location;
+			location.m_archive = it->second;
+			location.m_fileInfo = NULL;
+
+			if (dirIt->second != NULL)
+			{
+				ArchivedFileInfoMap::const_iterator infoIt = dirIt->second->m_files.find(name);
+				if (infoIt != dirIt->second->m_files.end())
+					location.m_fileInfo = &infoIt->second;
+			}
+
+			m_fileLocations.push_back(location);
+			++file.m_numLocations;
+		}
+
+		files.push_back(file);
+	}
+
+	for (ArchivedDirectoryInfoMap::const_iterator dirIt = dirInfo.m_directories.begin(); dirIt != dirInfo.m_directories.end(); ++dirIt)
+	{
+		addFileLocations(dirIt->second, files);
+	}
+}
+
+//----------------------------------------------------------------------------
+// TheSuperHackers @performance The archive index cache keeps the directories of all archive files
+// in one file in the user data folder. An entry is used when the size and the time stamp of its
+// archive file did not change, so the archive header does not need to be read at all.
+//----------------------------------------------------------------------------
+AsciiString ArchiveFileSystem::getArchiveIndexCachePath()
+{
+	AsciiString path = TheGlobalData->getPath_UserData();
+	path.concat("BIGIndex.cache");
+	return path;
+}
+
+void ArchiveFileSystem::loadArchiveIndexCache()
+{
+	m_archiveIndexCacheLoaded = TRUE;
+
+	FILE *fp = fopen(getArchiveIndexCachePath().str(), "rb");
+	if (fp == NULL)
+		return;
+
+	std::vector<char> data;
+	if (fseek(fp, 0, SEEK_END) == 0) {
+		const long size = ftell(fp);
+		if (size > 0) {
+			data.resize(size);
+			fseek(fp, 0, SEEK_SET);
+			if (fread(&data[0], size, 1, fp) != 1)
+				data.clear();
+		}
+	}
+	fclose(fp);
+
+	if (data.empty())
+		return;
+
+	ArchiveIndexCacheReader reader(&data[0], data.size());
+	if (reader.readUnsignedInt() != ARCHIVE_INDEX_CACHE_ID || reader.readUnsignedInt() != ARCHIVE_INDEX_CACHE_VERSION)
+		return;
+
+	const UnsignedInt numArchives = reader.readUnsignedInt();
+	for (UnsignedInt i = 0; i < numArchives && reader.ok(); ++i)
+	{
+		AsciiString archiveName;
+		reader.readString(archiveName);
+
+		CachedArchiveIndex &cached = m_archiveIndexCache[archiveName];
+		cached.m_used = FALSE;
+		cached.m_fileInfo.sizeHigh = reader.readUnsignedInt();
+		cached.m_fileInfo.sizeLow = reader.readUnsignedInt();
+		cached.m_fileInfo.timestampHigh = reader.readUnsignedInt();
+		cached.m_fileInfo.timestampLow = reader.readUnsignedInt();
+
+		const UnsignedInt numEntries = reader.readUnsignedInt();
+		if (!reader.ok() || numEntries > data.size())
+			break;
+
+		cached.m_index.resize(numEntries);
+		for (UnsignedInt j = 0; j < numEntries && reader.ok(); ++j)
+		{
+			ArchiveIndexEntry &entry = cached.m_index[j];
+			reader.readString(entry.m_path);
+			reader.readString(entry.m_filename);
+			entry.m_offset = reader.readUnsignedInt();
+			entry.m_size = reader.readUnsignedInt();
+		}
+	}
+
+	// a damaged cache is dropped as a whole and rewritten
+	if (!reader.ok() || !reader.atEnd()) {
+		DEBUG_LOG(("ArchiveFileSystem::loadArchiveIndexCache - ignoring damaged cache %s", getArchiveIndexCachePath().str()));
+		m_archiveIndexCache.clear();
+	}
+}
+
+const ArchiveIndex* ArchiveFileSystem::findCachedArchiveIndex(const Char *filename)
+{
+	if (!TheGlobalData->m_useArchiveIndexCache)
+		return NULL;
+
+	if (!m_archiveIndexCacheLoaded)
+		loadArchiveIndexCache();
+
+	AsciiString archiveName = filename;
+	archiveName.toLower();
+
+	ArchiveIndexCache::iterator it = m_archiveIndexCache.find(archiveName);
+	if (it == m_archiveIndexCache.end())
+		return NULL;
+
+	FileInfo fileInfo;
+	if (!TheLocalFileSystem->getFileInfo(AsciiString(filename), &fileInfo)
+		|| fileInfo.size() != it->second.m_fileInfo.size()
+		|| fileInfo.timestamp() != it->second.m_fileInfo.timestamp())
+	{
+		return NULL;
+	}
+
+	it->second.m_used = TRUE;
+	return &it->second.m_index;
+}
+
+void ArchiveFileSystem::cacheArchiveIndex(const Char *filename, const ArchiveIndex &index)
+{
+	if (!TheGlobalData->m_useArchiveIndexCache)
+		return;
+
+	FileInfo fileInfo;
+	if (!TheLocalFileSystem->getFileInfo(AsciiString(filename), &fileInfo))
+		return;
+
+	AsciiString archiveName = filename;
+	archiveName.toLower();
+
+	CachedArchiveIndex &cached = m_archiveIndexCache[archiveName];
+	cached.m_fileInfo = fileInfo;
+	cached.m_index = index;
+	cached.m_used = TRUE;
+	m_archiveIndexCacheDirty = TRUE;
+}
+
+void ArchiveFileSystem::saveArchiveIndexCache()
+{
+	if (!m_archiveIndexCacheDirty)
+		return;
+
+	m_archiveIndexCacheDirty = FALSE;
+
+	// only keep the archives of this session, so that the cache does not grow forever
+	std::vector<char> data;
+	UnsignedInt numArchives = 0;
+	writeCacheUnsignedInt(data, ARCHIVE_INDEX_CACHE_ID);
+	writeCacheUnsignedInt(data, ARCHIVE_INDEX_CACHE_VERSION);
+	writeCacheUnsignedInt(data, numArchives);
+
+	for (ArchiveIndexCache::const_iterator it = m_archiveIndexCache.begin(); it != m_archiveIndexCache.end(); ++it)
+	{
+		const CachedArchiveIndex &cached = it->second;
+		if (!cached.m_used)
+			continue;
+
+		writeCacheString(data, it->first);
+		writeCacheUnsignedInt(data, cached.m_fileInfo.sizeHigh);
+		writeCacheUnsignedInt(data, cached.m_fileInfo.sizeLow);
+		writeCacheUnsignedInt(data, cached.m_fileInfo.timestampHigh);
+		writeCacheUnsignedInt(data, cached.m_fileInfo.timestampLow);
+		writeCacheUnsignedInt(data, cached.m_index.size());
+
+		for (ArchiveIndex::const_iterator entry = cached.m_index.begin(); entry != cached.m_index.end(); ++entry)
+		{
+			writeCacheString(data, entry->m_path);
+			writeCacheString(data, entry->m_filename);
+			writeCacheUnsignedInt(data, entry->m_offset);
+			writeCacheUnsignedInt(data, entry->m_size);
+		}
+		++numArchives;
+	}
+	memcpy(&data[2 * sizeof(UnsignedInt)], &numArchives, sizeof(numArchives));
+
+	const AsciiString path = getArchiveIndexCachePath();
+	FILE *fp = fopen(path.str(), "wb");
+	if (fp == NULL)
+		return;
+
+	const Bool ok = fwrite(&data[0], data.size(), 1, fp) == 1;
+	fclose(fp);
+
+	// never leave a partial cache behind
+	if (!ok)
+		remove(path.str());
+}
+
 ArchiveFileSystem::ArchivedDirectoryInfoResult ArchiveFileSystem::getArchivedDirectoryInfo(const Char* directory)
 {
 	ArchivedDirectoryInfoResult result;
@@ -291,12 +709,18 @@ ArchiveFileSystem::ArchivedDirectoryInfoResult ArchiveFileSystem::getArchivedDir
 
 File * ArchiveFileSystem::openFile(const Char *filename, Int access, FileInstance instance)
 {
-	ArchiveFile* archive = getArchiveFile(filename, instance);
+	const ArchivedFileLocation* location = findFileLocation(filename, instance);
 
-	if (archive == NULL)
+	if (location == NULL)
 		return NULL;
 
-	return archive->openFile(filename, access);
+	if (TheArchivePrefetcher != NULL)
+		TheArchivePrefetcher->recordFile(filename);
+
+	if (location->m_fileInfo != NULL)
+		return location->m_archive->openArchivedFile(filename, location->m_fileInfo, access);
+
+	return location->m_archive->openFile(filename, access);
 }
 
 Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileInfo, FileInstance instance) const
@@ -319,17 +743,12 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 ArchiveFile* ArchiveFileSystem::getArchiveFile(const AsciiString& filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename.str());
+	const ArchivedFileLocation* location = const_cast<ArchiveFileSystem*>(this)->findFileLocation(filename.str(), instance);
 
-	if (!result.valid())
+	if (location == NULL)
 		return NULL;
 
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
-
-	if (!range.valid())
-		return NULL;
-	
-	return range.get()->second;
+	return location->m_archive;
 }
 
 void ArchiveFileSystem::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
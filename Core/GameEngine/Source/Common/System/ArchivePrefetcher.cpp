@@ -0,0 +1,230 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: ArchivePrefetcher.cpp ////////////////////////////////////////////////////////////////////
+// Reads the archived files of a map on background threads while the map loads.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ArchiveFile.h"
+#include "Common/ArchivePrefetcher.h"
+#include "Common/GlobalData.h"
+
+ArchivePrefetcher *TheArchivePrefetcher = NULL;
+
+// the most data that is read ahead for one map load
+static const LONG PREFETCH_BYTE_LIMIT = 256 * 1024 * 1024;
+
+//-------------------------------------------------------------------------------------------------
+ArchivePrefetcher::ArchivePrefetcher()
+	: m_numThreads(0)
+	, m_recording(FALSE)
+	, m_numListedFilesOpened(0)
+	, m_startTicks(0)
+{
+	m_job.m_nextLocation = 0;
+	m_job.m_bytesRead = 0;
+	m_job.m_stop = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+ArchivePrefetcher::~ArchivePrefetcher()
+{
+	stopThreads();
+}
+
+//-------------------------------------------------------------------------------------------------
+AsciiString ArchivePrefetcher::getListPath(const AsciiString& mapName)
+{
+	// Name the list after the map, like the script profile reports.
+	AsciiString baseName = mapName;
+	const char *leaf = mapName.reverseFind('\\');
+	if (leaf != NULL)
+		baseName = leaf + 1;
+	if (baseName.endsWithNoCase(".map"))
+		baseName.truncateBy(4);
+	if (baseName.isEmpty())
+		baseName = "Unknown";
+
+	AsciiString path;
+	path.format("%sPrefetch_%s.txt", TheGlobalData->getPath_UserData().str(), baseName.str());
+	return path;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ArchivePrefetcher::loadList(const AsciiString& mapName)
+{
+	m_job.m_locations.clear();
+	m_listedFileSet.clear();
+
+	FILE *fp = fopen(getListPath(mapName).str(), "r");
+	if (fp == NULL)
+		return;
+
+	char line[_MAX_PATH + 2];
+	while (fgets(line, sizeof(line), fp) != NULL)
+	{
+		AsciiString filename = line;
+		filename.trim();
+		if (filename.isEmpty() || !m_listedFileSet.insert(filename).second)
+			continue;
+
+		// the locations are resolved here, because the file location table must not be used by the workers
+		const ArchivedFileLocation *location = TheArchiveFileSystem->findFileLocation(filename.str(), 0);
+		if (location != NULL && location->m_fileInfo != NULL)
+			m_job.m_locations.push_back(*location);
+	}
+
+	fclose(fp);
+}
+
+//-------------------------------------------------------------------------------------------------
+void ArchivePrefetcher::writeList() const
+{
+	// keep the previous list if this load opened nothing, for example because it failed early
+	if (m_recordedFiles.empty())
+		return;
+
+	FILE *fp = fopen(getListPath(m_mapName).str(), "w");
+	if (fp == NULL)
+		return;
+
+	for (std::vector<AsciiString>::const_iterator it = m_recordedFiles.begin(); it != m_recordedFiles.end(); ++it)
+		fprintf(fp, "%s\n", it->str());
+
+	fclose(fp);
+}
+
+//-------------------------------------------------------------------------------------------------
+DWORD WINAPI ArchivePrefetcher::threadProc(LPVOID param)
+{
+	Job *job = (Job *)param;
+
+	while (!job->m_stop && job->m_bytesRead < PREFETCH_BYTE_LIMIT)
+	{
+		const LONG index = InterlockedIncrement(&job->m_nextLocation) - 1;
+		if (index >= (LONG)job->m_locations.size())
+			break;
+
+		const ArchivedFileLocation &location = job->m_locations[index];
+		const UnsignedInt bytes = location.m_archive->prefetchFile(location.m_fileInfo);
+		InterlockedExchangeAdd(&job->m_bytesRead, (LONG)bytes);
+	}
+
+	return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ArchivePrefetcher::stopThreads()
+{
+	if (m_numThreads == 0)
+		return;
+
+	InterlockedExchange(&m_job.m_stop, 1);
+	WaitForMultipleObjects(m_numThreads, m_threads, TRUE, INFINITE);
+	for (Int i = 0; i < m_numThreads; ++i)
+		CloseHandle(m_threads[i]);
+	m_numThreads = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ArchivePrefetcher::beginMapLoad(const AsciiString& mapName)
+{
+	stopThreads();
+
+	LARGE_INTEGER tick;
+	QueryPerformanceCounter(&tick);
+	m_startTicks = tick.QuadPart;
+
+	m_mapName = mapName;
+	loadList(mapName);
+
+	m_job.m_nextLocation = 0;
+	m_job.m_bytesRead = 0;
+	m_job.m_stop = 0;
+
+	if (!m_job.m_locations.empty())
+	{
+		// the reads wait for the disk most of the time, so a few threads are enough
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo(&systemInfo);
+		const Int numThreads = min((Int)systemInfo.dwNumberOfProcessors, (Int)MAX_THREADS);
+
+		for (Int i = 0; i < numThreads; ++i)
+		{
+			HANDLE thread = CreateThread(NULL, 0, threadProc, &m_job, 0, NULL);
+			if (thread != NULL)
+			{
+				SetThreadPriority(thread, THREAD_PRIORITY_BELOW_NORMAL);
+				m_threads[m_numThreads++] = thread;
+			}
+		}
+	}
+
+	FastCriticalSectionClass::LockClass lock(m_mutex);
+	m_recordedFiles.clear();
+	m_recordedFileSet.clear();
+	m_numListedFilesOpened = 0;
+	m_recording = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ArchivePrefetcher::endMapLoad()
+{
+	stopThreads();
+
+	{
+		FastCriticalSectionClass::LockClass lock(m_mutex);
+		m_recording = FALSE;
+	}
+
+	LARGE_INTEGER tick;
+	LARGE_INTEGER freq;
+	QueryPerformanceCounter(&tick);
+	QueryPerformanceFrequency(&freq);
+
+	DEBUG_LOG(("ArchivePrefetcher - loaded map %s in %.1f ms, prefetched %d of %d listed files (%d KB), %d of %d opened files were listed",
+		m_mapName.str(),
+		(double)(tick.QuadPart - m_startTicks) * 1000.0 / (double)freq.QuadPart,
+		min((Int)m_job.m_nextLocation, (Int)m_job.m_locations.size()),
+		(Int)m_job.m_locations.size(),
+		(Int)(m_job.m_bytesRead / 1024),
+		m_numListedFilesOpened,
+		(Int)m_recordedFiles.size()));
+
+	writeList();
+}
+
+//-------------------------------------------------------------------------------------------------
+void ArchivePrefetcher::recordFile(const Char *filename)
+{
+	if (!m_recording)
+		return;
+
+	AsciiString name = filename;
+	name.toLower();
+
+	FastCriticalSectionClass::LockClass lock(m_mutex);
+	if (!m_recording || !m_recordedFileSet.insert(name).second)
+		return;
+
+	m_recordedFiles.push_back(name);
+	if (m_listedFileSet.find(name) != m_listedFileSet.end())
+		++m_numListedFilesOpened;
+}
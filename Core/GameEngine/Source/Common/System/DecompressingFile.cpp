@@ -0,0 +1,244 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DecompressingFile.cpp ////////////////////////////////////////////////////////////////////
+// Read only file that decompresses another file while it is read.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/DecompressingFile.h"
+
+//-------------------------------------------------------------------------------------------------
+DecompressingFile::DecompressingFile()
+	: m_sourceFile(NULL)
+	, m_curPos(0)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+DecompressingFile::~DecompressingFile()
+{
+	closeSourceFile();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool DecompressingFile::openFromFile( File *sourceFile )
+{
+	if (sourceFile == NULL)
+		return FALSE;
+
+	char header[8];
+	const Int headerLen = sourceFile->read(header, sizeof(header));
+
+	if (headerLen < (Int)sizeof(header) || !CompressionManager::isDataCompressed(header, headerLen))
+	{
+		sourceFile->seek(0, File::START);
+		return FALSE;
+	}
+
+	if (File::open(sourceFile->getName(), File::READ | File::BINARY | File::STREAMING) == FALSE)
+	{
+		sourceFile->seek(0, File::START);
+		return FALSE;
+	}
+
+	m_sourceFile = sourceFile;
+	m_stream.reset();
+	m_stream.feed(header, headerLen);
+	m_size = CompressionManager::getUncompressedSize(header, headerLen);
+	m_curPos = 0;
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DecompressingFile::closeSourceFile()
+{
+	if (m_sourceFile != NULL)
+	{
+		m_sourceFile->close();
+		m_sourceFile = NULL;
+	}
+	m_stream.reset();
+}
+
+//-------------------------------------------------------------------------------------------------
+void DecompressingFile::close( void )
+{
+	closeSourceFile();
+	RAMFile::close();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Hands the next piece of the compressed file to the stream. Returns false at its end. */
+//-------------------------------------------------------------------------------------------------
+Bool DecompressingFile::feedInput()
+{
+	if (m_stream.isFinished())
+		return FALSE;
+
+	char chunk[INPUT_CHUNK_SIZE];
+	const Int len = m_sourceFile->read(chunk, sizeof(chunk));
+
+	if (len > 0)
+		m_stream.feed(chunk, len);
+	else
+		m_stream.finish();
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+// if buffer is null, just advance the current position by 'bytes'
+Int DecompressingFile::read( void *buffer, Int bytes )
+{
+	if (m_sourceFile == NULL)
+		return -1;
+
+	if (bytes > m_size - m_curPos)
+		bytes = m_size - m_curPos;
+
+	char skipBuffer[INPUT_CHUNK_SIZE];
+	Int done = 0;
+
+	while (done < bytes)
+	{
+		Int len;
+		if (buffer != NULL)
+		{
+			len = m_stream.pull((char *)buffer + done, bytes - done);
+		}
+		else
+		{
+			const Int skipLen = bytes - done;
+			len = m_stream.pull(skipBuffer, skipLen < (Int)sizeof(skipBuffer) ? skipLen : (Int)sizeof(skipBuffer));
+		}
+
+		if (len < 0)
+		{
+			DEBUG_CRASH(("DecompressingFile::read - %s is damaged", getName()));
+			break;
+		}
+
+		if (len == 0)
+		{
+			if (m_stream.isDone() || !feedInput())
+				break;
+			continue;
+		}
+
+		done += len;
+	}
+
+	m_curPos += done;
+	return done;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int DecompressingFile::write( const void *buffer, Int bytes )
+{
+	DEBUG_CRASH(("Cannot write to decompressing files."));
+	return -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int DecompressingFile::seek( Int pos, seekMode mode )
+{
+	Int newPos;
+
+	switch( mode )
+	{
+		case START:
+			newPos = pos;
+			break;
+		case CURRENT:
+			newPos = m_curPos + pos;
+			break;
+		case END:
+			DEBUG_ASSERTCRASH(pos <= 0, ("DecompressingFile::seek - position should be <= 0 for a seek starting from the end."));
+			newPos = m_size + pos;
+			break;
+		default:
+			// bad seek mode
+			return -1;
+	}
+
+	if ( newPos < 0 )
+	{
+		newPos = 0;
+	}
+	else if ( newPos > m_size )
+	{
+		newPos = m_size;
+	}
+
+	if (m_sourceFile == NULL)
+		return -1;
+
+	// the stream cannot go back, so start over
+	if (newPos < m_curPos)
+	{
+		m_sourceFile->seek(0, File::START);
+		m_stream.reset();
+		m_curPos = 0;
+	}
+
+	if (newPos > m_curPos)
+		read(NULL, newPos - m_curPos);
+
+	return m_curPos;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Decompresses the rest of the file straight into the returned buffer. */
+//-------------------------------------------------------------------------------------------------
+char* DecompressingFile::readEntireAndClose()
+{
+	char *buffer = NEW char[m_size > 0 ? m_size : 1];
+
+	const Int len = read(buffer, m_size - m_curPos);
+	DEBUG_ASSERTCRASH(len == m_size, ("DecompressingFile::readEntireAndClose - %s ended early", getName()));
+	if (len >= 0 && len < m_size)
+		memset(buffer + len, 0, m_size - len);
+
+	close();
+
+	return buffer;
+}
+
+//-------------------------------------------------------------------------------------------------
+File* DecompressingFile::convertToRAMFile()
+{
+	RAMFile *ramFile = newInstance( RAMFile );
+	if (ramFile->open(this))
+	{
+		if (this->m_deleteOnClose)
+		{
+			ramFile->deleteOnClose();
+		}
+		closeSourceFile();
+		deleteInstance(this);
+		return ramFile;
+	}
+	else
+	{
+		deleteInstance(ramFile);
+		return this;
+	}
+}
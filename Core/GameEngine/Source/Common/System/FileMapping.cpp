@@ -0,0 +1,173 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: FileMapping.cpp /////////////////////////////////////////////////////////////////////////
+// Read only memory mapping of a file on disk.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/FileMapping.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------------------------
+FileMapping::FileMapping()
+#ifdef _WIN32
+	: m_fileHandle(INVALID_HANDLE_VALUE)
+	, m_mappingHandle(NULL)
+#else
+	: m_fileDescriptor(-1)
+#endif
+	, m_size(0)
+	, m_granularity(1)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+FileMapping::~FileMapping()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool FileMapping::open( const Char *path )
+{
+	close();
+
+#ifdef _WIN32
+	m_fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_fileHandle == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	DWORD sizeHigh = 0;
+	const DWORD sizeLow = GetFileSize(m_fileHandle, &sizeHigh);
+	if (sizeHigh != 0 || sizeLow == 0 || sizeLow > 0x7fffffff)
+	{
+		close();
+		return FALSE;
+	}
+
+	m_mappingHandle = CreateFileMappingA(m_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m_mappingHandle == NULL)
+	{
+		close();
+		return FALSE;
+	}
+
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	m_granularity = systemInfo.dwAllocationGranularity;
+	m_size = (Int)sizeLow;
+#else
+	m_fileDescriptor = ::open(path, O_RDONLY);
+	if (m_fileDescriptor < 0)
+		return FALSE;
+
+	struct stat fileStat;
+	if (fstat(m_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0 || fileStat.st_size > 0x7fffffff)
+	{
+		close();
+		return FALSE;
+	}
+
+	m_granularity = (UnsignedInt)sysconf(_SC_PAGESIZE);
+	m_size = (Int)fileStat.st_size;
+#endif
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void FileMapping::close()
+{
+#ifdef _WIN32
+	if (m_mappingHandle != NULL)
+	{
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = NULL;
+	}
+	if (m_fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(m_fileHandle);
+		m_fileHandle = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (m_fileDescriptor >= 0)
+	{
+		::close(m_fileDescriptor);
+		m_fileDescriptor = -1;
+	}
+#endif
+	m_size = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool FileMapping::isOpen() const
+{
+#ifdef _WIN32
+	return m_mappingHandle != NULL;
+#else
+	return m_fileDescriptor >= 0;
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool FileMapping::mapView( Int offset, Int size, View &view ) const
+{
+	if (!isOpen() || offset < 0 || size <= 0 || offset > m_size - size)
+		return FALSE;
+
+	const UnsignedInt alignedOffset = (UnsignedInt)offset - ((UnsignedInt)offset % m_granularity);
+	const size_t length = (size_t)(offset - alignedOffset) + (size_t)size;
+
+#ifdef _WIN32
+	void *base = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, alignedOffset, length);
+	if (base == NULL)
+		return FALSE;
+#else
+	void *base = mmap(NULL, length, PROT_READ, MAP_SHARED, m_fileDescriptor, (off_t)alignedOffset);
+	if (base == MAP_FAILED)
+		return FALSE;
+#endif
+
+	view.m_base = base;
+	view.m_length = length;
+	view.m_data = (const Char *)base + (offset - alignedOffset);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void FileMapping::unmapView( View &view )
+{
+	if (view.m_base == NULL)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(view.m_base);
+#else
+	munmap(view.m_base, view.m_length);
+#endif
+
+	view = View();
+}
@@ -192,6 +192,9 @@ DECLARE_PERF_TIMER(MemoryPoolInitFilling)
 
 #endif
 
+// TheSuperHackers @info Kept in all builds, so that the startup profiler can report the memory growth.
+static volatile LONG theSystemAllocationInBytes = 0;
+
 static Bool thePreMainInitFlag = false;
 static Bool theMainInitFlag = false;
 
@@ -236,6 +239,7 @@ static void* sysAllocateDoNotZero(Int numBytes)
 	void* p = ::GlobalAlloc(GMEM_FIXED, numBytes);
 	if (!p)
 		throw ERROR_OUT_OF_MEMORY;
+	::InterlockedExchangeAdd(&theSystemAllocationInBytes, (LONG)::GlobalSize(p));
 #ifdef MEMORYPOOL_DEBUG
 	{
 		USE_PERF_TIMER(MemoryPoolDebugging)
@@ -262,6 +266,7 @@ static void sysFree(void* p)
 {
 	if (p)
 	{
+		::InterlockedExchangeAdd(&theSystemAllocationInBytes, -(LONG)::GlobalSize(p));
 #ifdef MEMORYPOOL_DEBUG
 		{
 			USE_PERF_TIMER(MemoryPoolDebugging)
@@ -3474,6 +3479,12 @@ Bool isMemoryManagerOfficiallyInited()
 	return theMainInitFlag;
 }
 
+//-----------------------------------------------------------------------------
+Int getMemoryManagerSystemBytes()
+{
+	return (Int)theSystemAllocationInBytes;
+}
+
 //-----------------------------------------------------------------------------
 /**
 	Initialize the memory manager, and create TheMemoryPoolFactory and TheDynamicMemoryAllocator.
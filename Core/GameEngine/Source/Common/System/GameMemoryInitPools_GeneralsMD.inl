@@ -492,6 +492,8 @@ static PoolSizeRec PoolSizes[] =
 	{ "Win32LocalFile", 1024, 256 },
 	{ "StdLocalFile", 1024, 256 },
 	{ "RAMFile", 32, 32 },
+	{ "MappedArchiveFile", 32, 32 },
+	{ "DecompressingFile", 8, 8 },
 	{ "BattlePlanBonuses", 32, 32 },
 	{ "KindOfPercentProductionChange", 32, 32 },
 	{ "UserParser", 4096, 256 },
@@ -511,7 +513,6 @@ static PoolSizeRec PoolSizes[] =
 	{ "AnimateWindow", 32, 32 },
 	{ "GameFont", 32, 32 },
 	{ "NetCommandRef", 256, 32 },
-	{ "GameMessageArgument", 1024, 256 },
 	{ "GameMessageParserArgumentType", 32, 32 },
 	{ "GameMessageParser", 32, 32 },
 	{ "WeaponBonusSet", 96, 32 },
@@ -129,6 +129,13 @@ Bool isMemoryManagerOfficiallyInited()
 	return theMainInitFlag;
 }
 
+//-----------------------------------------------------------------------------
+Int getMemoryManagerSystemBytes()
+{
+	// the null memory manager leaves all allocations to the C runtime and does not count them
+	return 0;
+}
+
 //-----------------------------------------------------------------------------
 /**
 	shutdown the memory manager and discard all memory. Note: if preMainInitMemoryManager()
@@ -0,0 +1,88 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: MappedArchiveFile.cpp ///////////////////////////////////////////////////////////////////
+// Read only file that points straight into a memory mapped archive.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/MappedArchiveFile.h"
+
+//-------------------------------------------------------------------------------------------------
+MappedArchiveFile::MappedArchiveFile()
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+MappedArchiveFile::~MappedArchiveFile()
+{
+	unmap();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool MappedArchiveFile::openFromMapping(const FileMapping& mapping, const AsciiString& filename, Int offset, Int size)
+{
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE)
+		return FALSE;
+
+	if (!mapping.mapView(offset, size, m_view))
+		return FALSE;
+
+	// RAMFile never writes to m_data, so the read only view can stand in for the copy.
+	m_data = const_cast<Char *>(m_view.m_data);
+	m_size = size;
+	m_pos = 0;
+	m_nameStr = filename;
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void MappedArchiveFile::unmap()
+{
+	// m_data is not ours, so it must not reach RAMFile::closeFile
+	m_data = NULL;
+	FileMapping::unmapView(m_view);
+}
+
+//-------------------------------------------------------------------------------------------------
+void MappedArchiveFile::close( void )
+{
+	unmap();
+	RAMFile::close();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The caller owns the returned buffer, so the view is copied once here. */
+//-------------------------------------------------------------------------------------------------
+char* MappedArchiveFile::readEntireAndClose()
+{
+	if (m_data == NULL)
+	{
+		DEBUG_CRASH(("m_data is NULL in MappedArchiveFile::readEntireAndClose -- should not happen!"));
+		return NEW char[1];	// just to avoid crashing...
+	}
+
+	char *buffer = MSGNEW("RAMFILE") char[m_size];
+	memcpy(buffer, m_data, m_size);
+
+	close();
+
+	return buffer;
+}
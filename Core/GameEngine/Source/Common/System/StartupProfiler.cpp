@@ -0,0 +1,153 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: StartupProfiler.cpp //////////////////////////////////////////////////////////////////////
+// Records the wall time and memory use of the startup and map load phases into a Chrome trace.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/StartupProfiler.h"
+
+StartupProfiler *TheStartupProfiler = NULL;
+
+//-------------------------------------------------------------------------------------------------
+static void writeJsonString(FILE *fp, const char *str)
+{
+	fputc('"', fp);
+	for (const char *c = str; *c; ++c)
+	{
+		if (*c == '"' || *c == '\\')
+			fputc('\\', fp);
+		if ((unsigned char)*c >= 32)
+			fputc(*c, fp);
+	}
+	fputc('"', fp);
+}
+
+//-------------------------------------------------------------------------------------------------
+StartupProfiler::StartupProfiler(const AsciiString& tracePath)
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	m_frequency = freq.QuadPart;
+	m_startTicks = getTicks();
+	m_tracePath = tracePath;
+}
+
+//-------------------------------------------------------------------------------------------------
+StartupProfiler::~StartupProfiler()
+{
+	if (!writeTrace())
+		DEBUG_LOG(("StartupProfiler - could not write trace file '%s'", m_tracePath.str()));
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 StartupProfiler::getTicks()
+{
+	LARGE_INTEGER tick;
+	QueryPerformanceCounter(&tick);
+	return tick.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int StartupProfiler::getMemoryKB()
+{
+	return getMemoryManagerSystemBytes() / 1024;
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupProfiler::beginEvent(const char *category, const char *name, Bool isRoot)
+{
+	if (!isRoot && m_openEvents.empty())
+	{
+		m_openEvents.push_back(-1);
+		return;
+	}
+
+	// an event inside an event that is not recorded is not recorded either
+	if (!m_openEvents.empty() && m_openEvents.back() < 0)
+	{
+		m_openEvents.push_back(-1);
+		return;
+	}
+
+	Event event;
+	event.m_name = name;
+	event.m_category = category;
+	event.m_startMemoryKB = getMemoryKB();
+	event.m_memoryKB = 0;
+	event.m_startTicks = getTicks();
+	event.m_endTicks = -1;
+
+	m_openEvents.push_back((Int)m_events.size());
+	m_events.push_back(event);
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupProfiler::endEvent()
+{
+	DEBUG_ASSERTCRASH(!m_openEvents.empty(), ("StartupProfiler::endEvent without beginEvent"));
+	if (m_openEvents.empty())
+		return;
+
+	const Int index = m_openEvents.back();
+	m_openEvents.pop_back();
+	if (index < 0)
+		return;
+
+	Event &event = m_events[index];
+	event.m_endTicks = getTicks();
+	event.m_memoryKB = getMemoryKB() - event.m_startMemoryKB;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool StartupProfiler::writeTrace() const
+{
+	FILE *fp = fopen(m_tracePath.str(), "w");
+	if (fp == NULL)
+		return FALSE;
+
+	const double ticksPerMicrosecond = (double)m_frequency / 1000000.0;
+	const DWORD processId = GetCurrentProcessId();
+
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	Bool first = TRUE;
+	for (std::vector<Event>::const_iterator it = m_events.begin(); it != m_events.end(); ++it)
+	{
+		// skip events that are still open
+		if (it->m_endTicks < 0)
+			continue;
+
+		const double ts = (double)(it->m_startTicks - m_startTicks) / ticksPerMicrosecond;
+		const double dur = (double)(it->m_endTicks - it->m_startTicks) / ticksPerMicrosecond;
+
+		fprintf(fp, first ? "{\"name\":" : ",\n{\"name\":");
+		writeJsonString(fp, it->m_name.str());
+		fprintf(fp, ",\"cat\":");
+		writeJsonString(fp, it->m_category);
+		fprintf(fp, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%u,\"tid\":1,\"args\":{\"memoryKB\":%d}}",
+			ts, dur, (UnsignedInt)processId, it->m_memoryKB);
+		first = FALSE;
+	}
+
+	fprintf(fp, "\n]}\n");
+	fclose(fp);
+	return TRUE;
+}
@@ -38,12 +38,18 @@ Connection::Connection() {
 	m_transport = NULL;
 	m_user = NULL;
 	m_netCommandList = NULL;
+	m_sendPacket = NULL;
+	m_hasUnsentCommands = FALSE;
+	m_numChunksInFlight = 0;
+	m_hasChunksWaitingForWindow = FALSE;
+	resetCompactGameCommands();
 	m_retryTime = 2000; // set retry time to 2 seconds.
 	m_lastTimeSent = 0;
 	m_frameGrouping = 1;
 	m_isQuitting = false;
 	m_quitTime = 0;
 	m_averageLatency = 0.0f;
+	m_totalRetries = 0;
 	Int i;
 	for(i = 0; i < CONNECTION_LATENCY_HISTORY_LENGTH; i++)
 	{
@@ -60,6 +66,9 @@ Connection::~Connection() {
 
 	deleteInstance(m_netCommandList);
 	m_netCommandList = NULL;
+
+	deleteInstance(m_sendPacket);
+	m_sendPacket = NULL;
 }
 
 /**
@@ -76,11 +85,15 @@ void Connection::init() {
 		m_netCommandList->init();
 	}
 	m_netCommandList->reset();
+	clearPendingCommands();
+
+	resetCompactGameCommands();
 
 	m_lastTimeSent = 0;
 	m_frameGrouping = 1;
 	m_numRetries = 0;
 	m_retryMetricsTime = 0;
+	m_totalRetries = 0;
 
 	for (Int i = 0; i < CONNECTION_LATENCY_HISTORY_LENGTH; ++i) {
 		m_latencies[i] = 0;
@@ -170,6 +183,7 @@ void Connection::sendNetCommandMsg(NetCommandMsg *msg, UnsignedByte relay) {
 				while (ref1 != NULL) {
 					NetCommandRef *ref2 = m_netCommandList->addMessage(ref1->getCommand());
 					ref2->setRelay(relay);
+					addPendingCommand(ref2);
 
 					ref1 = ref1->getNext();
 				}
@@ -205,10 +219,132 @@ void Connection::sendNetCommandMsg(NetCommandMsg *msg, UnsignedByte relay) {
 */
 
 			ref->setRelay(relay);
+			addPendingCommand(ref);
+		}
+	}
+}
+
+/**
+ * Remember a command that was added to the command list, so that doSend sends it and processAck finds it.
+ */
+void Connection::addPendingCommand(NetCommandRef *ref) {
+	if (ref == NULL) {
+		return;
+	}
+
+	m_hasUnsentCommands = TRUE;
+
+	if (CommandRequiresAck(ref->getCommand())) {
+		// The command list does not hold two commands with the same player and command id. Should it
+		// happen anyway, the first one stays in the index and acks find it as before.
+		UnsignedInt key = getPendingCommandKey(ref->getCommand()->getID(), ref->getCommand()->getPlayerID());
+		m_pendingCommands.insert(PendingCommandMap::value_type(key, ref));
+	}
+}
+
+/**
+ * Forget a command that is about to be removed from the command list.
+ */
+void Connection::removePendingCommand(NetCommandRef *ref) {
+	if (!CommandRequiresAck(ref->getCommand())) {
+		return;
+	}
+
+	UnsignedInt key = getPendingCommandKey(ref->getCommand()->getID(), ref->getCommand()->getPlayerID());
+	PendingCommandMap::iterator it = m_pendingCommands.find(key);
+	if (it != m_pendingCommands.end() && it->second == ref) {
+		m_pendingCommands.erase(it);
+	}
+}
+
+/**
+ * Remove a command from the command list and the pending command index.
+ */
+void Connection::removeCommand(NetCommandRef *ref) {
+	removeChunkInFlight(ref);
+	removePendingCommand(ref);
+	m_netCommandList->removeMessage(ref);
+}
+
+void Connection::clearPendingCommands() {
+	m_pendingCommands.clear();
+	m_retryTimes.clear();
+	m_chunkRetryTimes.clear();
+	m_hasUnsentCommands = FALSE;
+	m_numChunksInFlight = 0;
+	m_hasChunksWaitingForWindow = FALSE;
+}
+
+/**
+ * A chunk that was sent does not wait for its ack anymore, so the window can take the next one.
+ */
+void Connection::removeChunkInFlight(NetCommandRef *ref) {
+	if (ref->getCommand()->getNetCommandType() == NETCOMMANDTYPE_WRAPPER && ref->getTimeLastSent() != -1) {
+		DEBUG_ASSERTCRASH(m_numChunksInFlight > 0, ("Connection::removeChunkInFlight - no chunk is in flight"));
+		if (m_numChunksInFlight > 0) {
+			--m_numChunksInFlight;
 		}
 	}
 }
 
+/**
+ * Returns the time after which an unacked chunk is sent again. It follows the measured ack latency, so
+ * that lost chunks are resent quickly on good links without resending every chunk on slow ones.
+ */
+time_t Connection::getChunkRetryTime() const {
+	time_t retryTime = (time_t)(m_averageLatency * 3.0f);
+	return max((time_t)MinChunkRetryTime, min(retryTime, m_retryTime));
+}
+
+/**
+ * Remember when a pending command was sent, so that hasCommandsToSend knows when it is due again.
+ */
+void Connection::addRetryTime(NetCommandRef *ref, time_t timeLastSent) {
+	RetryTime retryTime;
+	retryTime.m_timeLastSent = timeLastSent;
+	retryTime.m_key = getPendingCommandKey(ref->getCommand()->getID(), ref->getCommand()->getPlayerID());
+	RetryTimeHeap &retryTimes = (ref->getCommand()->getNetCommandType() == NETCOMMANDTYPE_WRAPPER) ? m_chunkRetryTimes : m_retryTimes;
+	retryTimes.push_back(retryTime);
+	std::push_heap(retryTimes.begin(), retryTimes.end());
+}
+
+/**
+ * Returns true if the earliest sent command of the heap is due again. All of its commands share the retry time.
+ */
+Bool Connection::isRetryDue(RetryTimeHeap &retryTimes, time_t retryTime, time_t curtime) {
+	while (!retryTimes.empty()) {
+		const RetryTime &entry = retryTimes.front();
+
+		// Skip entries of commands that were acked or sent again since.
+		PendingCommandMap::const_iterator it = m_pendingCommands.find(entry.m_key);
+		if (it == m_pendingCommands.end() || it->second->getTimeLastSent() != entry.m_timeLastSent) {
+			std::pop_heap(retryTimes.begin(), retryTimes.end());
+			retryTimes.pop_back();
+			continue;
+		}
+
+		return (curtime - entry.m_timeLastSent) > retryTime;
+	}
+
+	return FALSE;
+}
+
+/**
+ * Returns true if a command was never sent or its retry time has passed. A chunk that waits for the window
+ * only counts once an ack made room for it.
+ */
+Bool Connection::hasCommandsToSend(time_t curtime) {
+	if (m_hasUnsentCommands) {
+		return TRUE;
+	}
+
+	if (m_hasChunksWaitingForWindow && m_numChunksInFlight < MaxChunksInFlight) {
+		return TRUE;
+	}
+
+	return isRetryDue(m_retryTimes, m_retryTime, curtime) || isRetryDue(m_chunkRetryTimes, getChunkRetryTime(), curtime);
+}
+
 void Connection::clearCommandsExceptFrom( Int playerIndex )
 {
 	NetCommandRef *tmp = m_netCommandList->getFirstMessage();
@@ -222,7 +358,7 @@ void Connection::clearCommandsExceptFrom( Int playerIndex )
 			DEBUG_LOG(("Connection::clearCommandsExceptFrom(%d) - clearing a command from player %d for frame %d",
 				playerIndex, tmp->getCommand()->getPlayerID(), tmp->getCommand()->getExecutionFrame()));
 
-			m_netCommandList->removeMessage(tmp);
+			removeCommand(tmp);
 			deleteInstance(tmp);
 		}
 
@@ -230,6 +366,45 @@ void Connection::clearCommandsExceptFrom( Int playerIndex )
 	}
 }
 
+void Connection::resetCompactGameCommands() {
+	m_peerReadsCompactGameCommands = FALSE;
+	m_peerKnowsCompactGameCommands = FALSE;
+	m_peerAnnouncesCompactGameCommands = FALSE;
+	m_peerIsOriginalGame = FALSE;
+	m_sentGameCommands.reset();
+	m_receivedGameCommands.reset();
+}
+
+/**
+ * Takes note of what a packet from the other side tells about the compact game command encoding.
+ * A packet without an announcement comes from a side that heard ours, or from the original game
+ * when we never heard the other side.
+ */
+void Connection::processCompactGameCommandsSupport(NetPacket::CompactSupport support, Bool usedCompactGameCommands) {
+	if (support != NetPacket::COMPACT_SUPPORT_NONE || usedCompactGameCommands) {
+		m_peerReadsCompactGameCommands = TRUE;
+	}
+	if (support == NetPacket::COMPACT_SUPPORT_CONFIRMED || usedCompactGameCommands ||
+			(support == NetPacket::COMPACT_SUPPORT_NONE && m_peerReadsCompactGameCommands)) {
+		m_peerKnowsCompactGameCommands = TRUE;
+	}
+	if (support == NetPacket::COMPACT_SUPPORT_NONE && !m_peerReadsCompactGameCommands) {
+		m_peerIsOriginalGame = TRUE;
+	}
+	m_peerAnnouncesCompactGameCommands = (support == NetPacket::COMPACT_SUPPORT_ANNOUNCED);
+}
+
+/**
+ * We announce the compact encoding until we heard the other side, and then confirm it for as long as
+ * the other side has not heard us.
+ */
+NetPacket::CompactSupport Connection::getCompactSupportToAnnounce() const {
+	if (!m_peerReadsCompactGameCommands) {
+		return m_peerIsOriginalGame ? NetPacket::COMPACT_SUPPORT_NONE : NetPacket::COMPACT_SUPPORT_ANNOUNCED;
+	}
+	return m_peerAnnouncesCompactGameCommands ? NetPacket::COMPACT_SUPPORT_CONFIRMED : NetPacket::COMPACT_SUPPORT_NONE;
+}
+
 Bool Connection::isQueueEmpty() {
 	if (m_netCommandList->getFirstMessage() == NULL) {
 		return TRUE;
@@ -252,12 +427,15 @@ UnsignedInt Connection::doSend() {
 	Int numpackets = 0;
 	time_t curtime = timeGetTime();
 	Bool couldQueue = TRUE;
+	Bool skippedUnsent = FALSE;
+	Bool skippedForWindow = FALSE;
 
 	// Do this check first, since it's an important fail-safe
 	if (m_isQuitting && curtime > m_quitTime + MaxQuitFlushTime)
 	{
 		DEBUG_LOG(("Timed out a quitting connection.  Deleting all %d messages", m_netCommandList->length()));
 		m_netCommandList->reset();
+		clearPendingCommands();
 		return 0;
 	}
 
@@ -266,13 +444,31 @@ UnsignedInt Connection::doSend() {
 		return 0;
 	}
 
+	if (!hasCommandsToSend(curtime)) {
+		return 0;
+	}
+
+	if (m_sendPacket == NULL) {
+		m_sendPacket = newInstance(NetPacket);
+	}
+	NetPacket *packet = m_sendPacket;
+	const time_t chunkRetryTime = getChunkRetryTime();
+
 	// iterate through all the messages and put them into a packet(s).
 	NetCommandRef *msg = m_netCommandList->getFirstMessage();
 
 	while ((msg != NULL) && couldQueue) {
-		NetPacket *packet = newInstance(NetPacket);
-		packet->init();
+		packet->reset();
 		packet->setAddress(m_user->GetIPAddr(), m_user->GetPort());
+		packet->setCompactGameCommands(m_peerReadsCompactGameCommands);
+		packet->setChunkChecksums(m_peerReadsCompactGameCommands);
+
+		// TheSuperHackers @performance Build the packet directly in a send slot of the transport, so that it
+		// is not copied again. If the send queue is full, the packet is built as before and queueSend fails.
+		TransportMessage *slot = m_transport->beginSend(packet->getAddr(), packet->getPort());
+		if (slot != NULL) {
+			packet->setBuffer(slot->data);
+		}
 
 		Bool notDone = TRUE;
 
@@ -281,21 +477,43 @@ UnsignedInt Connection::doSend() {
 			NetCommandRef *next = msg->getNext(); // Need this since msg could be deleted
 
 			time_t timeLastSent = msg->getTimeLastSent();
-
-			if (((curtime - timeLastSent) > m_retryTime) || (timeLastSent == -1)) {
-				notDone = packet->addCommand(msg);
+			const Bool isChunk = (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_WRAPPER);
+			const Bool isGameCommand = (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_GAMECOMMAND);
+			const time_t retryTime = isChunk ? chunkRetryTime : m_retryTime;
+
+			if (isChunk && timeLastSent == -1 && m_numChunksInFlight >= MaxChunksInFlight) {
+				// the window is full, this chunk is sent once an earlier chunk is acked.
+				skippedForWindow = TRUE;
+			} else if (((curtime - timeLastSent) > retryTime) || (timeLastSent == -1)) {
+				// a game command refers to the last acked one when it is sent the first time. A resent command
+				// has no reference, so that it can always be read.
+				const NetGameCommandDictionary::Entry *reference = NULL;
+				if (isGameCommand && timeLastSent == -1 && m_peerKnowsCompactGameCommands) {
+					reference = m_sentGameCommands.getConfirmed();
+				}
+				notDone = packet->addCommand(msg, reference);
 				if (notDone) {
 					// the msg command was added to the packet.
+					if (isGameCommand && timeLastSent == -1) {
+						m_sentGameCommands.add((NetGameCommandMsg *)msg->getCommand());
+					}
 					if (CommandRequiresAck(msg->getCommand())) {
 						if (timeLastSent != -1) {
 							++m_numRetries;
+							++m_totalRetries;
+						} else if (isChunk) {
+							++m_numChunksInFlight;
 						}
 						doRetryMetrics();
 						msg->setTimeLastSent(curtime);
+						addRetryTime(msg, curtime);
 					} else {
 						m_netCommandList->removeMessage(msg);
 						deleteInstance(msg);
 					}
+				} else if (timeLastSent == -1) {
+					// the packet is full, this command is sent with the next send.
+					skippedUnsent = TRUE;
 				}
 			}
 			msg = next;
@@ -307,17 +525,30 @@ UnsignedInt Connection::doSend() {
 
 		++numpackets;
 
-		/// @todo Make the act of giving the transport object a packet to send more efficient.  Make the transport take a NetPacket object rather than the raw data, thus avoiding an extra memcpy.
 		if (packet->getNumCommands() > 0) {
+			packet->announceCompactGameCommands(getCompactSupportToAnnounce());
 			// If the packet actually has any information to give, give it to the transport object
 			// for transmission.
-			couldQueue = m_transport->queueSend(packet->getAddr(), packet->getPort(), packet->getData(), packet->getLength());
+			if (slot != NULL) {
+				couldQueue = m_transport->endSend(slot, packet->getLength());
+			} else {
+				couldQueue = m_transport->queueSend(packet->getAddr(), packet->getPort(), packet->getData(), packet->getLength());
+			}
 			m_lastTimeSent = curtime;
+		} else if (slot != NULL) {
+			m_transport->endSend(slot, 0);
 		}
-
-		deleteInstance(packet); // delete the packet now that we're done with it.
 	}
 
+	// the packet must not point into the send slot anymore.
+	packet->reset();
+
+	// new commands that did not make it into a packet must not wait for their retry time. Chunks that did
+	// not fit into the window wait for an ack instead, so that a big transfer does not make every send tick
+	// walk the command list.
+	m_hasUnsentCommands = (msg != NULL) || skippedUnsent;
+	m_hasChunksWaitingForWindow = skippedForWindow;
+
 	return numpackets;
 }
 
@@ -348,16 +579,13 @@ NetCommandRef * Connection::processAck(NetCommandMsg *msg) {
  * Take that message off the list of commands to send.
  */
 NetCommandRef * Connection::processAck(UnsignedShort commandID, UnsignedByte originalPlayerID) {
-	NetCommandRef *temp = m_netCommandList->getFirstMessage();
-	while ((temp != NULL) && ((temp->getCommand()->getID() != commandID) || (temp->getCommand()->getPlayerID() != originalPlayerID))) {
-
-		// cycle through the commands till we find the one we need to remove.
-		// Need to check for both the command ID and the player ID.
-		temp = temp->getNext();
-	}
-	if (temp == NULL) {
+	// Need to check for both the command ID and the player ID.
+	PendingCommandMap::iterator it = m_pendingCommands.find(getPendingCommandKey(commandID, originalPlayerID));
+	if (it == m_pendingCommands.end()) {
 		return NULL;
 	}
+	NetCommandRef *temp = it->second;
+	m_pendingCommands.erase(it);
 
 #if defined(RTS_DEBUG)
 	Bool doDebug = FALSE;
@@ -366,17 +594,25 @@ NetCommandRef * Connection::processAck(UnsignedShort commandID, UnsignedByte ori
 	}
 #endif
 
-	Int index = temp->getCommand()->getID() % CONNECTION_LATENCY_HISTORY_LENGTH;
-	m_averageLatency -= ((Real)(m_latencies[index])) / CONNECTION_LATENCY_HISTORY_LENGTH;
-	Real lat = timeGetTime() - temp->getTimeLastSent();
-	m_averageLatency += lat / CONNECTION_LATENCY_HISTORY_LENGTH;
-	m_latencies[index] = lat;
+	// A chunk that the receiver resumed from an earlier transfer can be acked before it was sent.
+	if (temp->getTimeLastSent() != -1) {
+		Int index = temp->getCommand()->getID() % CONNECTION_LATENCY_HISTORY_LENGTH;
+		m_averageLatency -= ((Real)(m_latencies[index])) / CONNECTION_LATENCY_HISTORY_LENGTH;
+		Real lat = timeGetTime() - temp->getTimeLastSent();
+		m_averageLatency += lat / CONNECTION_LATENCY_HISTORY_LENGTH;
+		m_latencies[index] = lat;
+	}
 
 #if defined(RTS_DEBUG)
 	if (doDebug == TRUE) {
 		DEBUG_LOG(("Connection::processAck - disconnect frame command %d found, removing from command list.", commandID));
 	}
 #endif
+	if (temp->getCommand()->getNetCommandType() == NETCOMMANDTYPE_GAMECOMMAND) {
+		m_sentGameCommands.confirm(commandID, originalPlayerID);
+	}
+
+	removeChunkInFlight(temp);
 	m_netCommandList->removeMessage(temp);
 	return temp;
 }
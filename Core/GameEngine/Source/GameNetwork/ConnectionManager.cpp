@@ -45,6 +45,7 @@
 #include "GameNetwork/LANAPICallbacks.h"
 #include "GameNetwork/NAT.h"
 #include "GameNetwork/NetCommandWrapperList.h"
+#include "GameNetwork/NetworkTelemetry.h"
 #include "GameNetwork/networkutil.h"
 #include "GameLogic/GameLogic.h"
 #include "GameLogic/ScriptActions.h"
@@ -305,6 +306,19 @@ Bool ConnectionManager::isPlayerConnected( Int playerID )
 	return ( playerID == m_localSlot || (m_connections[playerID] && !m_connections[playerID]->isQuitting()) );
 }
 
+/**
+ * Returns the connection to the user at the given address, or NULL if there is none.
+ */
+Connection * ConnectionManager::findConnection(UnsignedInt addr, UnsignedShort port) {
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		User *user = (m_connections[i] != NULL) ? m_connections[i]->getUser() : NULL;
+		if (user != NULL && user->GetIPAddr() == addr && user->GetPort() == port) {
+			return m_connections[i];
+		}
+	}
+	return NULL;
+}
+
 void ConnectionManager::attachTransport(Transport *transport) {
 	delete m_transport;
 	m_transport = transport;
@@ -359,8 +373,13 @@ void ConnectionManager::doRelay() {
 			//DEBUG_LOG(("ConnectionManager::doRelay() - got a packet with %d commands", packet->getNumCommands()));
 			//LOGBUFFER( packet->getData(), packet->getLength() );
 
-			// Get the command list from the packet.
-			NetCommandList *cmdList = packet->getCommandList();
+			// Get the command list from the packet. The game commands in the compact encoding are
+			// resolved with the dictionary of the connection that the packet came from.
+			Connection *connection = findConnection(packet->getAddr(), packet->getPort());
+			NetCommandList *cmdList = packet->getCommandList((connection != NULL) ? connection->getReceivedGameCommands() : NULL);
+			if (connection != NULL) {
+				connection->processCompactGameCommandsSupport(packet->getCompactSupport(), packet->hasCompactGameCommands());
+			}
 			NetCommandRef *cmd = cmdList->getFirstMessage();
 
 			// Iterate through the commands in this packet and send them to the proper connections.
@@ -567,7 +586,28 @@ void ConnectionManager::processWrapper(NetCommandRef *ref)
 	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("ConnectionManager::processWrapper() - origProgress[%d] == %d for command %d",
 		m_localSlot, origProgress, commandID));
 
-	m_netCommandWrapperList->processWrapper(ref);
+	// A chunk that goes on to other players is not resumed, because they would not get the resumed chunks.
+	UnsignedByte relayToOthers = ref->getRelay() & ~(1 << m_localSlot);
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if (m_connections[i] == NULL || m_connections[i]->isQuitting()) {
+			relayToOthers &= ~(1 << i);
+		}
+	}
+
+	std::vector<UnsignedShort> resumedChunkIDs;
+	m_netCommandWrapperList->processWrapper(ref, (relayToOthers == 0) ? &resumedChunkIDs : NULL);
+
+	// The chunks that were taken from an earlier transfer are acked, so that the sender does not send them.
+	for (size_t i = 0; i < resumedChunkIDs.size(); ++i) {
+		NetWrapperCommandMsg *chunkMsg = newInstance(NetWrapperCommandMsg);
+		chunkMsg->setID(resumedChunkIDs[i]);
+		chunkMsg->setPlayerID(wrapperMsg->getPlayerID());
+		NetCommandRef *chunkRef = NEW_NETCOMMANDREF(chunkMsg);
+		chunkRef->setRelay(ref->getRelay());
+		ackCommand(chunkRef, m_localSlot);
+		deleteInstance(chunkRef);
+		chunkMsg->detach();
+	}
 
 	if (fcIt != s_fileCommandMap.end())
 	{
@@ -1613,9 +1653,38 @@ NetCommandList *ConnectionManager::getFrameCommandList(UnsignedInt frame)
 	NetCommandList *retlist = newInstance(NetCommandList);
 	retlist->init();
 
-	for (Int i = 0; i < MAX_SLOTS; ++i) {
+	// TheSuperHackers @performance The sorted commands of all players are merged in one pass,
+	// which gives the same order as inserting them one by one into the list.
+	FrameData *frameData[MAX_SLOTS];
+	Int nextCommand[MAX_SLOTS];
+	Int numFrameData = 0;
+	Int i;
+	for (i = 0; i < MAX_SLOTS; ++i) {
+		if (m_frameData[i] != NULL) {
+			frameData[numFrameData] = m_frameData[i]->getFrameData(frame);
+			nextCommand[numFrameData] = 0;
+			++numFrameData;
+		}
+	}
+
+	for (;;) {
+		Int best = -1;
+		for (Int j = 0; j < numFrameData; ++j) {
+			if (nextCommand[j] < frameData[j]->getNumCommands()) {
+				if ((best == -1) || (NetCommandList::compareCommandMsg(frameData[j]->getCommand(nextCommand[j]), frameData[best]->getCommand(nextCommand[best])) < 0)) {
+					best = j;
+				}
+			}
+		}
+		if (best == -1) {
+			break;
+		}
+		retlist->appendMessage(frameData[best]->getCommand(nextCommand[best]));
+		++nextCommand[best];
+	}
+
+	for (i = 0; i < MAX_SLOTS; ++i) {
 		if (m_frameData[i] != NULL) {
-			retlist->appendList(m_frameData[i]->getFrameCommandList(frame));
 			if (frame > FRAMES_TO_KEEP) {
 				m_frameData[i]->resetFrame(frame - FRAMES_TO_KEEP);	// After getting the commands for that frame from this
 													// FrameDataManager object, we need to tell it that we're
@@ -2149,7 +2218,11 @@ UnsignedShort ConnectionManager::sendFileAnnounce(AsciiString path, UnsignedByte
 	return fileID;
 }
 
-void ConnectionManager::sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID)
+/**
+ * Sends a file to the given players. Returns the number of bytes sent, which is less than the file size
+ * when the file was compressed, or 0 if the file was not sent.
+ */
+Int ConnectionManager::sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID)
 {
 	File *theFile = TheLocalFileSystem->openFile(path.str());
 	if (!theFile || !theFile->size())
@@ -2159,7 +2232,7 @@ void ConnectionManager::sendFile(AsciiString path, UnsignedByte playerMask, Unsi
 		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("%ls", log.str()));
 		if (TheLAN)
 			TheLAN->OnChat(L"sendFile", 0, log, LANAPI::LANCHAT_SYSTEM);
-		return;
+		return 0;
 	}
 
 	Int len = theFile->size();
@@ -2212,7 +2285,10 @@ void ConnectionManager::sendFile(AsciiString path, UnsignedByte playerMask, Unsi
 
 	sendLocalCommand(fileMsg, playerMask);
 
+	Int sentLen = (Int)fileMsg->getFileLength();
 	fileMsg->detach();
+
+	return sentLen;
 }
 
 Int ConnectionManager::getFileTransferProgress(Int playerID, AsciiString path)
@@ -2317,6 +2393,37 @@ Int ConnectionManager::getSlotAverageFPS(Int slot) {
 	return m_fpsAverages[slot];
 }
 
+/**
+ * Fills in the cushion, latencies, frame rates, resends and bandwidth totals of a telemetry frame.
+ */
+void ConnectionManager::getTelemetry(NetworkTelemetryFrame &frame)
+{
+	frame.m_averageFps = m_frameMetrics.getAverageFPS();
+	frame.m_minimumCushion = m_frameMetrics.getMinimumCushion();
+	frame.m_routerLatency = m_frameMetrics.getAverageLatency();
+
+	if (m_transport != NULL) {
+		const Transport::Totals &totals = m_transport->getTotals();
+		frame.m_incomingBytes = totals.m_incomingBytes;
+		frame.m_incomingPackets = totals.m_incomingPackets;
+		frame.m_outgoingBytes = totals.m_outgoingBytes;
+		frame.m_outgoingPackets = totals.m_outgoingPackets;
+	} else {
+		frame.m_incomingBytes = 0;
+		frame.m_incomingPackets = 0;
+		frame.m_outgoingBytes = 0;
+		frame.m_outgoingPackets = 0;
+	}
+
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		Connection *connection = m_connections[i];
+		frame.m_isConnected[i] = (connection != NULL) && !connection->isQuitting();
+		frame.m_latency[i] = (connection != NULL) ? connection->getAverageLatency() : 0.0f;
+		frame.m_retries[i] = (connection != NULL) ? connection->getTotalRetries() : 0;
+		frame.m_fps[i] = getSlotAverageFPS(i);
+	}
+}
+
 #if defined(RTS_DEBUG)
 void ConnectionManager::debugPrintConnectionCommands() {
 	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("ConnectionManager::debugPrintConnectionCommands - begin commands"));
@@ -2391,14 +2498,11 @@ void ConnectionManager::sendSingleFrameToPlayer(UnsignedInt playerID, UnsignedIn
 	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("ConnectionManager::sendFrameDataToPlayer - sending data for frame %d", frame));
 	for (Int i = 0; i < MAX_SLOTS; ++i) {
 		if ((m_frameData[i] != NULL) && (i != playerID)) { // no need to send his own commands to him.
-			NetCommandList *list = m_frameData[i]->getFrameCommandList(frame);
-			if (list != NULL) {
-				NetCommandRef *ref = list->getFirstMessage();
-				while (ref != NULL) {
-					DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("ConnectionManager::sendFrameDataToPlayer - sending command %d from player %d to player %d using relay 0x%x", ref->getCommand()->getID(), i, playerID, relay));
-					sendLocalCommandDirect(ref->getCommand(), relay);
-					ref = ref->getNext();
-				}
+			FrameData *frameData = m_frameData[i]->getFrameData(frame);
+			for (Int j = 0; j < frameData->getNumCommands(); ++j) {
+				NetCommandMsg *cmdMsg = frameData->getCommand(j);
+				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("ConnectionManager::sendFrameDataToPlayer - sending command %d from player %d to player %d using relay 0x%x", cmdMsg->getID(), i, playerID, relay));
+				sendLocalCommandDirect(cmdMsg, relay);
 			}
 			UnsignedInt frameCommandCount = m_frameData[i]->getFrameCommandCount(frame);
 			NetFrameCommandMsg *msg = newInstance(NetFrameCommandMsg);
@@ -57,6 +57,8 @@ static Bool doFileTransfer( AsciiString filename, MapTransferLoadScreen *ls, Int
 
 		UnsignedShort fileCommandID = 0;
 		Bool sentFile = FALSE;
+		Int sentFileSize = 0;
+		UnsignedInt sentFileTime = 0;
 		if (TheGameInfo->amIHost())
 		{
 			Sleep(500);
@@ -73,7 +75,8 @@ static Bool doFileTransfer( AsciiString filename, MapTransferLoadScreen *ls, Int
 		{
 			if (!sentFile && TheNetwork->areAllQueuesEmpty())
 			{
-				TheNetwork->sendFile(filename, mask, fileCommandID);
+				sentFileSize = TheNetwork->sendFile(filename, mask, fileCommandID);
+				sentFileTime = timeGetTime();
 				sentFile = TRUE;
 			}
 
@@ -127,6 +130,16 @@ static Bool doFileTransfer( AsciiString filename, MapTransferLoadScreen *ls, Int
 		{
 			return FALSE;
 		}
+
+#ifdef DEBUG_LOGGING
+		// Report the throughput of the sender, for example when measuring with the latency and packet loss simulation.
+		if (sentFileSize > 0)
+		{
+			UnsignedInt elapsedTime = timeGetTime() - sentFileTime;
+			DEBUG_LOG(("File transfer of '%s' (%d bytes) took %u ms, %.1f KB/s", filename.str(), sentFileSize, elapsedTime,
+				elapsedTime > 0 ? sentFileSize / 1.024f / elapsedTime : 0.0f));
+		}
+#endif
 	}
 
 	return TRUE;
@@ -26,6 +26,7 @@
 #include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
 
 #include "GameNetwork/FrameData.h"
+#include "GameNetwork/NetCommandMsg.h"
 #include "GameNetwork/networkutil.h"
 
 /**
@@ -34,7 +35,6 @@
 FrameData::FrameData()
 {
 	m_frame = 0;
-	m_commandList = NULL;
 	m_commandCount = 0;
 	m_frameCommandCount = -1;
 	m_lastFailedCC = 0;
@@ -46,8 +46,7 @@ FrameData::FrameData()
  */
 FrameData::~FrameData()
 {
-	deleteInstance(m_commandList);
-	m_commandList = NULL;
+	clearCommands();
 }
 
 /**
@@ -56,11 +55,7 @@ FrameData::~FrameData()
 void FrameData::init()
 {
 	m_frame = 0;
-	if (m_commandList == NULL) {
-		m_commandList = newInstance(NetCommandList);
-		m_commandList->init();
-	}
-	m_commandList->reset();
+	clearCommands();
 
 	m_frameCommandCount = -1;
 	//DEBUG_LOG(("FrameData::init"));
@@ -116,15 +111,14 @@ FrameDataReturnType FrameData::allCommandsReady(Bool debugSpewage) {
 
 	if (m_commandCount > m_frameCommandCount) {
 		DEBUG_LOG(("FrameData::allCommandsReady - There are more commands than there should be (%d, should be %d).  Commands in command list are...", m_commandCount, m_frameCommandCount));
-		NetCommandRef *ref = m_commandList->getFirstMessage();
-		while (ref != NULL) {
-			DEBUG_LOG(("%s, frame = %d, id = %d", GetNetCommandTypeAsString(ref->getCommand()->getNetCommandType()), ref->getCommand()->getExecutionFrame(), ref->getCommand()->getID()));
-			ref = ref->getNext();
+		for (size_t i = 0; i < m_commands.size(); ++i) {
+			NetCommandMsg *msg = m_commands[i];
+			DEBUG_LOG(("%s, frame = %d, id = %d", GetNetCommandTypeAsString(msg->getNetCommandType()), msg->getExecutionFrame(), msg->getID()));
 		}
 		DEBUG_LOG(("FrameData::allCommandsReady - End of command list."));
 		DEBUG_LOG(("FrameData::allCommandsReady - about to clear the command list"));
 		reset();
-		DEBUG_LOG(("FrameData::allCommandsReady - command list cleared. command list length = %d, command count = %d, frame command count = %d", m_commandList->length(), m_commandCount, m_frameCommandCount));
+		DEBUG_LOG(("FrameData::allCommandsReady - command list cleared. command list length = %d, command count = %d, frame command count = %d", (Int)m_commands.size(), m_commandCount, m_frameCommandCount));
 		return FRAMEDATA_RESEND;
 	}
 	return FRAMEDATA_NOTREADY;
@@ -156,27 +150,51 @@ UnsignedInt FrameData::getCommandCount() {
  * Add a command to this frame
  */
 void FrameData::addCommand(NetCommandMsg *msg) {
-	// need to add the message in order of command ID
-	if (m_commandList == NULL) {
-		init();
+	// need to add the message in order of command ID. The commands mostly arrive in order,
+	// so the position is searched from the back.
+	Int index = (Int)m_commands.size();
+	while ((index > 0) && (NetCommandList::compareCommandMsg(m_commands[index - 1], msg) > 0)) {
+		--index;
 	}
 
-	// We don't need to worry about setting the relay since its not getting sent anywhere.
-	if (m_commandList->findMessage(msg) != NULL) {
+	if (hasCommand(msg, index)) {
 		// We don't want to add the same command twice.
 		return;
 	}
-	m_commandList->addMessage(msg);
+
+	msg->attach();
+	m_commands.insert(m_commands.begin() + index, msg);
 
 	++m_commandCount;
 	//DEBUG_LOG(("added command %d, type = %d(%s), command count = %d, frame command count = %d", msg->getID(), msg->getNetCommandType(), GetNetCommandTypeAsString(msg->getNetCommandType()), m_commandCount, m_frameCommandCount));
 }
 
 /**
- * Return the list of commands for this frame
+ * Returns true if an equal command is already in this frame. index is the position where msg
+ * would be inserted.
+ */
+Bool FrameData::hasCommand(NetCommandMsg *msg, Int index) {
+	if (DoesCommandRequireACommandID(msg->getNetCommandType())) {
+		// An equal command has the same sort key, so it can only be right in front of index.
+		return (index > 0) && NetCommandList::isEqualCommandMsg(m_commands[index - 1], msg);
+	}
+
+	for (size_t i = 0; i < m_commands.size(); ++i) {
+		if (NetCommandList::isEqualCommandMsg(m_commands[i], msg)) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Release all the commands of this frame, keeping the storage for the next frame.
  */
-NetCommandList * FrameData::getCommandList() {
-	return m_commandList;
+void FrameData::clearCommands() {
+	for (size_t i = 0; i < m_commands.size(); ++i) {
+		m_commands[i]->detach();
+	}
+	m_commands.clear();
 }
 
 /**
@@ -191,10 +209,6 @@ void FrameData::zeroFrame() {
  * destroy all the commands in this frame.
  */
 void FrameData::destroyGameMessages() {
-	if (m_commandList == NULL) {
-		return;
-	}
-
-	m_commandList->reset();
+	clearCommands();
 	m_commandCount = 0;
 }
@@ -105,11 +105,11 @@ FrameDataReturnType FrameDataManager::allCommandsReady(UnsignedInt frame, Bool d
 }
 
 /**
- * Returns the command list for the given frame.
+ * Returns the frame data holding the commands for the given frame.
  */
-NetCommandList * FrameDataManager::getFrameCommandList(UnsignedInt frame) {
+FrameData * FrameDataManager::getFrameData(UnsignedInt frame) {
 	UnsignedInt frameindex = frame % FRAME_DATA_LENGTH;
-	return m_frameData[frameindex].getCommandList();
+	return &m_frameData[frameindex];
 }
 
 /**
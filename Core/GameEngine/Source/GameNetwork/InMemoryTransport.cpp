@@ -0,0 +1,227 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: InMemoryTransport.cpp ////////////////////////////////////////////////////////////////////
+// Transport that exchanges packets with other transports in the same process.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameNetwork/InMemoryTransport.h"
+
+enum { BROADCAST_ADDR = 0xFFFFFFFF };
+
+//-------------------------------------------------------------------------------------------------
+InMemoryNetwork::InMemoryNetwork( UnsignedInt seed )
+{
+	m_time = 0;
+	m_seed = seed;
+}
+
+//-------------------------------------------------------------------------------------------------
+InMemoryNetwork::~InMemoryNetwork()
+{
+	DEBUG_ASSERTCRASH(m_endpoints.empty(), ("InMemoryNetwork - transports are still attached"));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns a value from 0 to range - 1. Uses its own generator, so that the network does not change
+	* the game's random values. */
+//-------------------------------------------------------------------------------------------------
+UnsignedInt InMemoryNetwork::getRandomValue( UnsignedInt range )
+{
+	if (range == 0)
+		return 0;
+
+	m_seed = m_seed * 1664525 + 1013904223;
+	return (m_seed >> 8) % range;
+}
+
+//-------------------------------------------------------------------------------------------------
+InMemoryNetwork::Endpoint *InMemoryNetwork::findEndpoint( InMemoryTransport *transport )
+{
+	for (EndpointList::iterator it = m_endpoints.begin(); it != m_endpoints.end(); ++it)
+	{
+		if (it->m_transport == transport)
+			return &(*it);
+	}
+	return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool InMemoryNetwork::attach( InMemoryTransport *transport, UnsignedInt addr, UnsignedShort port )
+{
+	for (EndpointList::const_iterator it = m_endpoints.begin(); it != m_endpoints.end(); ++it)
+	{
+		if (it->m_transport != transport && it->m_addr == addr && it->m_port == port)
+		{
+			DEBUG_LOG(("InMemoryNetwork::attach - 0x%8.8X:%d is already in use", addr, port));
+			return false;
+		}
+	}
+
+	detach(transport);
+
+	Endpoint endpoint;
+	endpoint.m_transport = transport;
+	endpoint.m_addr = addr;
+	endpoint.m_port = port;
+	m_endpoints.push_back(endpoint);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+void InMemoryNetwork::detach( InMemoryTransport *transport )
+{
+	for (EndpointList::iterator it = m_endpoints.begin(); it != m_endpoints.end(); ++it)
+	{
+		if (it->m_transport == transport)
+		{
+			m_endpoints.erase(it);
+			return;
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void InMemoryNetwork::deliver( Endpoint& from, Endpoint& to, const unsigned char *buf, Int len )
+{
+	++m_statistics.m_sentPackets;
+	m_statistics.m_sentBytes += len;
+
+	if (m_settings.m_lossPercent > 0 && (Int)getRandomValue(100) < m_settings.m_lossPercent)
+	{
+		++m_statistics.m_lostPackets;
+		return;
+	}
+
+	UnsignedInt deliveryTime = m_time + m_settings.m_latency + getRandomValue(m_settings.m_jitter + 1);
+	if (m_settings.m_reorderPercent > 0 && (Int)getRandomValue(100) < m_settings.m_reorderPercent)
+		deliveryTime += m_settings.m_reorderDelay;
+
+	Packet packet;
+	packet.m_fromAddr = from.m_addr;
+	packet.m_fromPort = from.m_port;
+	packet.m_sendTime = m_time;
+	packet.m_data.assign(buf, buf + len);
+
+	to.m_packets.insert(PacketQueue::value_type(deliveryTime, packet));
+}
+
+//-------------------------------------------------------------------------------------------------
+Int InMemoryNetwork::send( InMemoryTransport *transport, const unsigned char *buf, Int len, UnsignedInt addr, UnsignedShort port )
+{
+	Endpoint *from = findEndpoint(transport);
+	if (from == NULL)
+		return -1;
+
+	for (EndpointList::iterator it = m_endpoints.begin(); it != m_endpoints.end(); ++it)
+	{
+		if (&(*it) == from || it->m_port != port)
+			continue;
+
+		if (addr == BROADCAST_ADDR || it->m_addr == addr)
+			deliver(*from, *it, buf, len);
+	}
+
+	// like a UDP socket, sending to nobody is not an error
+	return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int InMemoryNetwork::receive( InMemoryTransport *transport, unsigned char *buf, Int len, UnsignedInt *fromAddr, UnsignedShort *fromPort )
+{
+	Endpoint *to = findEndpoint(transport);
+	if (to == NULL)
+		return -1;
+
+	PacketQueue::iterator it = to->m_packets.begin();
+	if (it == to->m_packets.end() || it->first > m_time)
+		return 0;
+
+	const Packet &packet = it->second;
+	Int packetLen = (Int)packet.m_data.size();
+	if (packetLen > len)
+		packetLen = len;	// truncated, like a datagram that does not fit
+
+	memcpy(buf, &packet.m_data[0], packetLen);
+	*fromAddr = packet.m_fromAddr;
+	*fromPort = packet.m_fromPort;
+
+	++m_statistics.m_deliveredPackets;
+	m_statistics.m_deliveredBytes += packetLen;
+	m_statistics.m_totalLatency += m_time - packet.m_sendTime;
+
+	to->m_packets.erase(it);
+	return packetLen;
+}
+
+//-------------------------------------------------------------------------------------------------
+InMemoryTransport::InMemoryTransport( InMemoryNetwork *network )
+{
+	m_network = network;
+	m_isOpen = false;
+}
+
+//-------------------------------------------------------------------------------------------------
+InMemoryTransport::~InMemoryTransport()
+{
+	closeSocket();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool InMemoryTransport::openSocket( UnsignedInt ip, UnsignedShort port )
+{
+	m_isOpen = m_network->attach(this, ip, port);
+	return m_isOpen;
+}
+
+//-------------------------------------------------------------------------------------------------
+void InMemoryTransport::closeSocket( void )
+{
+	if (m_isOpen)
+	{
+		m_network->detach(this);
+		m_isOpen = false;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void InMemoryTransport::writeSocket( UDP::Datagram *datagrams, Int count )
+{
+	for (Int i = 0; i < count; ++i)
+	{
+		UDP::Datagram &datagram = datagrams[i];
+		datagram.result = m_network->send(this, datagram.buf, datagram.len, datagram.ip, datagram.port);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+Int InMemoryTransport::readSocket( UDP::Datagram *datagrams, Int count )
+{
+	Int numRead = 0;
+	while (numRead < count)
+	{
+		UDP::Datagram &datagram = datagrams[numRead];
+		datagram.result = m_network->receive(this, datagram.buf, datagram.len, &datagram.ip, &datagram.port);
+		if (datagram.result <= 0)
+			return (datagram.result < 0 && numRead == 0) ? -1 : numRead;
+		++numRead;
+	}
+	return numRead;
+}
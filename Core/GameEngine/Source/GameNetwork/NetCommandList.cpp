@@ -335,6 +335,32 @@ NetCommandRef * NetCommandList::addMessage(NetCommandMsg *cmdMsg) {
 	return msg;
 }
 
+/**
+ * Adds a message at the end of the list without searching for its place. The message must not be
+ * ordered before the last message of the list, which is the case when merging sorted lists.
+ */
+NetCommandRef * NetCommandList::appendMessage(NetCommandMsg *cmdMsg) {
+	if (m_last != NULL) {
+		DEBUG_ASSERTCRASH(compareCommandMsg(m_last->getCommand(), cmdMsg) <= 0, ("NetCommandList::appendMessage - the message is out of order"));
+		if (isEqualCommandMsg(m_last->getCommand(), cmdMsg)) {
+			// This command is already in the list, don't duplicate it.
+			return NULL;
+		}
+	}
+
+	NetCommandRef *msg = NEW_NETCOMMANDREF(cmdMsg);
+	msg->setPrev(m_last);
+	msg->setNext(NULL);
+	if (m_last != NULL) {
+		m_last->setNext(msg);
+	} else {
+		m_first = msg;
+	}
+	m_last = msg;
+	m_lastMessageInserted = msg;
+	return msg;
+}
+
 Int NetCommandList::length() {
 	Int retval = 0;
 	NetCommandRef *temp = m_first;
@@ -370,6 +396,24 @@ NetCommandRef * NetCommandList::findMessage(UnsignedShort commandID, UnsignedByt
 	return retval;
 }
 
+/**
+ * Returns a negative value if msg1 goes before msg2 in the list, a positive value if it goes after
+ * msg2, and 0 if they have the same place. The messages are ordered by command type, then player id,
+ * and then command id.
+ */
+Int NetCommandList::compareCommandMsg(NetCommandMsg *msg1, NetCommandMsg *msg2) {
+	if (msg1->getNetCommandType() != msg2->getNetCommandType()) {
+		return (msg1->getNetCommandType() < msg2->getNetCommandType()) ? -1 : 1;
+	}
+	if (msg1->getPlayerID() != msg2->getPlayerID()) {
+		return (msg1->getPlayerID() < msg2->getPlayerID()) ? -1 : 1;
+	}
+	if (msg1->getSortNumber() != msg2->getSortNumber()) {
+		return (msg1->getSortNumber() < msg2->getSortNumber()) ? -1 : 1;
+	}
+	return 0;
+}
+
 Bool NetCommandList::isEqualCommandMsg(NetCommandMsg *msg1, NetCommandMsg *msg2) {
 	if (DoesCommandRequireACommandID(msg1->getNetCommandType()) != DoesCommandRequireACommandID(msg2->getNetCommandType())) {
 		return FALSE;
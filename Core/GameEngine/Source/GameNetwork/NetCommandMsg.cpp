@@ -86,12 +86,11 @@ Int NetCommandMsg::getSortNumber() {
  * Constructor with no argument, sets everything to default values.
  */
 NetGameCommandMsg::NetGameCommandMsg() : NetCommandMsg() {
-	m_argSize = 0;
 	m_numArgs = 0;
+	m_argCapacity = INLINE_ARGUMENT_COUNT;
 	m_type = (GameMessage::Type)0;
 	m_commandType = NETCOMMANDTYPE_GAMECOMMAND;
-	m_argList = NULL;
-	m_argTail = NULL;
+	m_args = m_inlineArgs;
 }
 
 /**
@@ -99,6 +98,9 @@ NetGameCommandMsg::NetGameCommandMsg() : NetCommandMsg() {
  * Also copies all the arguments.
  */
 NetGameCommandMsg::NetGameCommandMsg(GameMessage *msg) : NetCommandMsg() {
+	m_numArgs = 0;
+	m_argCapacity = INLINE_ARGUMENT_COUNT;
+	m_args = m_inlineArgs;
 	m_commandType = NETCOMMANDTYPE_GAMECOMMAND;
 
 	m_type = msg->getType();
@@ -112,11 +114,9 @@ NetGameCommandMsg::NetGameCommandMsg(GameMessage *msg) : NetCommandMsg() {
  * Destructor
  */
 NetGameCommandMsg::~NetGameCommandMsg() {
-	GameMessageArgument *arg = m_argList;
-	while (arg != NULL) {
-		m_argList = m_argList->m_next;
-		deleteInstance(arg);
-		arg = m_argList;
+	// free the arguments that did not fit into the command
+	if (m_args != m_inlineArgs) {
+		delete [] m_args;
 	}
 }
 
@@ -125,21 +125,20 @@ NetGameCommandMsg::~NetGameCommandMsg() {
  */
 void NetGameCommandMsg::addArgument(const GameMessageArgumentDataType type, GameMessageArgumentType arg)
 {
-	if (m_argTail == NULL) {
-		m_argList = newInstance(GameMessageArgument);
-		m_argTail = m_argList;
-		m_argList->m_data = arg;
-		m_argList->m_type = type;
-		m_argList->m_next = NULL;
-		return;
+	// move the arguments to a twice as large array when they do not fit anymore
+	if (m_numArgs == m_argCapacity) {
+		GameMessageArgument *args = NEW GameMessageArgument[m_argCapacity * 2];
+		memcpy(args, m_args, m_numArgs * sizeof(GameMessageArgument));
+		if (m_args != m_inlineArgs) {
+			delete [] m_args;
+		}
+		m_args = args;
+		m_argCapacity *= 2;
 	}
 
-	GameMessageArgument *newArg = newInstance(GameMessageArgument);
+	GameMessageArgument *newArg = &m_args[m_numArgs++];
 	newArg->m_data = arg;
 	newArg->m_type = type;
-	newArg->m_next = NULL;
-	m_argTail->m_next = newArg;
-	m_argTail = newArg;
 }
 
 // here's where we figure out which slot corresponds to which player
@@ -169,8 +168,8 @@ GameMessage *NetGameCommandMsg::constructGameMessage()
 	name.format("player%d", getPlayerID());
 	retval->friend_setPlayerIndex( ThePlayerList->findPlayerWithNameKey(TheNameKeyGenerator->nameToKey(name))->getPlayerIndex());
 
-	GameMessageArgument *arg = m_argList;
-	while (arg != NULL) {
+	for (Int i = 0; i < m_numArgs; ++i) {
+		const GameMessageArgument *arg = &m_args[i];
 
 		switch (arg->m_type) {
 
@@ -209,8 +208,6 @@ GameMessage *NetGameCommandMsg::constructGameMessage()
 			break;
 
 		}
-
-		arg = arg->m_next;
 	}
 	return retval;
 }
@@ -826,6 +823,8 @@ NetWrapperCommandMsg::NetWrapperCommandMsg() : NetCommandMsg() {
 	m_dataLength = 0;
 	m_dataOffset = 0;
 	m_wrappedCommandID = 0;
+	m_wrappedDataChecksum = 0;
+	m_hasWrappedDataChecksum = FALSE;
 }
 
 NetWrapperCommandMsg::~NetWrapperCommandMsg() {
@@ -889,6 +888,19 @@ void NetWrapperCommandMsg::setWrappedCommandID(UnsignedShort wrappedCommandID) {
 	m_wrappedCommandID = wrappedCommandID;
 }
 
+Bool NetWrapperCommandMsg::hasWrappedDataChecksum() {
+	return m_hasWrappedDataChecksum;
+}
+
+UnsignedInt NetWrapperCommandMsg::getWrappedDataChecksum() {
+	return m_wrappedDataChecksum;
+}
+
+void NetWrapperCommandMsg::setWrappedDataChecksum(UnsignedInt checksum) {
+	m_wrappedDataChecksum = checksum;
+	m_hasWrappedDataChecksum = TRUE;
+}
+
 //-------------------------
 // NetFileCommandMsg
 //-------------------------
@@ -29,6 +29,32 @@
 
 #include "GameNetwork/NetCommandWrapperList.h"
 #include "GameNetwork/NetPacket.h"
+#include "realcrc.h"
+
+// TheSuperHackers @feature The chunks of a big command that did not complete are kept when the wrapper list is
+// reset. Every chunk of a big command carries the checksum of the wrapped data after the first chunk. When a
+// command with the same checksum and size is sent again, the kept chunks are taken and acked before the sender
+// sends them, so the transfer resumes where it stopped. The first chunk holds the header of the wrapped command,
+// which differs between the transfers, so it is never taken. The assembled command is verified with the checksum.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////// NetCommandWrapperResumeData /////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void NetCommandWrapperResumeData::init() {
+	m_data = NULL;
+	m_chunksPresent = NULL;
+	m_totalDataLength = 0;
+	m_numChunks = 0;
+	m_chunkSize = 0;
+	m_wrappedDataChecksum = 0;
+}
+
+void NetCommandWrapperResumeData::release() {
+	delete[] m_data;
+	delete[] m_chunksPresent;
+	init();
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////// NetCommandWrapperListNode ///////////////////////////////////////////////////////////////////
@@ -49,6 +75,12 @@ NetCommandWrapperListNode::NetCommandWrapperListNode(NetWrapperCommandMsg *msg)
 	m_data = NEW UnsignedByte[m_totalDataLength];	// pool[]ify
 
 	m_commandID = msg->getWrappedCommandID();
+	m_chunkSize = 0;
+
+	m_hasWrappedDataChecksum = msg->hasWrappedDataChecksum();
+	m_wrappedDataChecksum = msg->getWrappedDataChecksum();
+
+	m_resumeData.init();
 }
 
 NetCommandWrapperListNode::~NetCommandWrapperListNode() {
@@ -57,6 +89,8 @@ NetCommandWrapperListNode::~NetCommandWrapperListNode() {
 
 	delete[] m_data;
 	m_data = NULL;
+
+	m_resumeData.release();
 }
 
 Bool NetCommandWrapperListNode::isComplete() {
@@ -78,7 +112,11 @@ UnsignedInt NetCommandWrapperListNode::getRawDataLength() {
 	return m_totalDataLength;
 }
 
-void NetCommandWrapperListNode::copyChunkData(NetWrapperCommandMsg *msg) {
+/**
+ * Copies the data of a chunk. The IDs of the chunks that are taken from an earlier transfer are added
+ * to resumedChunkIDs, they have to be acked. Nothing is taken without resumedChunkIDs.
+ */
+void NetCommandWrapperListNode::copyChunkData(NetWrapperCommandMsg *msg, std::vector<UnsignedShort> *resumedChunkIDs) {
 	if (msg == NULL) {
 		DEBUG_CRASH(("Trying to copy data from a non-existent wrapper command message"));
 		return;
@@ -121,6 +159,114 @@ void NetCommandWrapperListNode::copyChunkData(NetWrapperCommandMsg *msg) {
 
 	m_chunksPresent[chunkNumber] = TRUE;
 	++m_numChunksPresent;
+
+	// every chunk but the last one has the same size.
+	if (chunkNumber > 0 && m_chunkSize == 0 && (chunkDataOffset % chunkNumber) == 0) {
+		m_chunkSize = chunkDataOffset / chunkNumber;
+	}
+
+	// the first chunk that arrived may have come from a peer that does not send the checksum.
+	if (!m_hasWrappedDataChecksum && msg->hasWrappedDataChecksum()) {
+		m_hasWrappedDataChecksum = TRUE;
+		m_wrappedDataChecksum = msg->getWrappedDataChecksum();
+	}
+
+	// the chunk size is known once a chunk after the first one arrived.
+	if (m_resumeData.m_data != NULL && resumedChunkIDs != NULL && chunkNumber > 0) {
+		resume(msg, resumedChunkIDs);
+	}
+}
+
+/**
+ * Takes the kept chunks that are still missing. The chunks of a command have consecutive IDs.
+ */
+void NetCommandWrapperListNode::resume(NetWrapperCommandMsg *msg, std::vector<UnsignedShort> *resumedChunkIDs) {
+	if (m_chunkSize != m_resumeData.m_chunkSize) {
+		DEBUG_LOG(("NetCommandWrapperListNode::resume() - the chunks of the earlier transfer have a different size, dropping them"));
+		m_resumeData.release();
+		return;
+	}
+
+	const UnsignedShort firstChunkID = (UnsignedShort)(msg->getID() - msg->getChunkNumber());
+	UnsignedInt numResumedChunks = 0;
+
+	for (UnsignedInt i = 1; i < m_numChunks; ++i) {
+		UnsignedInt chunkDataOffset = i * m_chunkSize;
+		if (chunkDataOffset >= m_totalDataLength) {
+			break;
+		}
+		if (m_chunksPresent[i] || !m_resumeData.m_chunksPresent[i]) {
+			continue;
+		}
+
+		UnsignedInt chunkDataLength = min(m_chunkSize, m_totalDataLength - chunkDataOffset);
+		memcpy(m_data + chunkDataOffset, m_resumeData.m_data + chunkDataOffset, chunkDataLength);
+		m_chunksPresent[i] = TRUE;
+		++m_numChunksPresent;
+
+		resumedChunkIDs->push_back((UnsignedShort)(firstChunkID + i));
+		++numResumedChunks;
+	}
+
+	DEBUG_LOG(("NetCommandWrapperListNode::resume() - took %u of %u chunks of command %d from an earlier transfer",
+		numResumedChunks, m_numChunks, m_commandID));
+
+	m_resumeData.release();
+}
+
+/**
+ * Returns false if the assembled data does not match the checksum the sender announced with its chunks.
+ */
+Bool NetCommandWrapperListNode::isDataValid() {
+	if (!m_hasWrappedDataChecksum) {
+		return TRUE;
+	}
+
+	const UnsignedInt firstChunkSize = (m_numChunks > 1) ? m_chunkSize : m_totalDataLength;
+	if (firstChunkSize > m_totalDataLength) {
+		return FALSE;
+	}
+
+	return (UnsignedInt)CRC_Memory(m_data + firstChunkSize, m_totalDataLength - firstChunkSize) == m_wrappedDataChecksum;
+}
+
+/**
+ * Takes the kept chunks of an earlier transfer when they belong to the same command, they are used
+ * as soon as the chunk size is known. Chunks of another command are left in resumeData.
+ */
+void NetCommandWrapperListNode::takeResumeData(NetCommandWrapperResumeData &resumeData, UnsignedInt wrappedDataChecksum) {
+	if (resumeData.m_data == NULL || resumeData.m_wrappedDataChecksum != wrappedDataChecksum ||
+			resumeData.m_totalDataLength != m_totalDataLength || resumeData.m_numChunks != m_numChunks) {
+		return;
+	}
+
+	m_resumeData.release();
+	m_resumeData = resumeData;
+	resumeData.init();
+}
+
+/**
+ * Returns true if the node has chunks worth keeping for a later transfer of the same command.
+ */
+Bool NetCommandWrapperListNode::canKeepForResume() const {
+	return m_numChunksPresent < m_numChunks && m_numChunksPresent > 1 && m_chunkSize != 0 && m_hasWrappedDataChecksum;
+}
+
+/**
+ * Hands the chunks over to the data that is kept for a later transfer. The node has no data afterwards.
+ */
+void NetCommandWrapperListNode::keepForResume(NetCommandWrapperResumeData &resumeData) {
+	resumeData.release();
+	resumeData.m_data = m_data;
+	resumeData.m_chunksPresent = m_chunksPresent;
+	resumeData.m_totalDataLength = m_totalDataLength;
+	resumeData.m_numChunks = m_numChunks;
+	resumeData.m_chunkSize = m_chunkSize;
+	resumeData.m_wrappedDataChecksum = m_wrappedDataChecksum;
+
+	m_data = NULL;
+	m_chunksPresent = NULL;
+	m_numChunksPresent = 0;
 }
 
 UnsignedByte * NetCommandWrapperListNode::getRawData() {
@@ -133,6 +279,7 @@ UnsignedByte * NetCommandWrapperListNode::getRawData() {
 
 NetCommandWrapperList::NetCommandWrapperList() {
 	m_list = NULL;
+	m_resumeData.init();
 }
 
 NetCommandWrapperList::~NetCommandWrapperList() {
@@ -142,6 +289,8 @@ NetCommandWrapperList::~NetCommandWrapperList() {
 		deleteInstance(m_list);
 		m_list = temp;
 	}
+
+	m_resumeData.release();
 }
 
 void NetCommandWrapperList::init() {
@@ -149,6 +298,8 @@ void NetCommandWrapperList::init() {
 }
 
 void NetCommandWrapperList::reset() {
+	keepForResume();
+
 	NetCommandWrapperListNode *temp;
 	while (m_list != NULL) {
 		temp = m_list->m_next;
@@ -171,7 +322,7 @@ Int NetCommandWrapperList::getPercentComplete(UnsignedShort wrappedCommandID)
 	return temp->getPercentComplete();
 }
 
-void NetCommandWrapperList::processWrapper(NetCommandRef *ref) {
+void NetCommandWrapperList::processWrapper(NetCommandRef *ref, std::vector<UnsignedShort> *resumedChunkIDs) {
 	NetCommandWrapperListNode *temp = m_list;
 	NetWrapperCommandMsg *msg = (NetWrapperCommandMsg *)(ref->getCommand());
 
@@ -185,7 +336,12 @@ void NetCommandWrapperList::processWrapper(NetCommandRef *ref) {
 		m_list = temp;
 	}
 
-	temp->copyChunkData(msg);
+	// the chunks that were sent before the peers agreed on the checksums do not have it.
+	if (msg->hasWrappedDataChecksum()) {
+		temp->takeResumeData(m_resumeData, msg->getWrappedDataChecksum());
+	}
+
+	temp->copyChunkData(msg, resumedChunkIDs);
 }
 
 NetCommandList * NetCommandWrapperList::getReadyCommands()
@@ -199,12 +355,23 @@ NetCommandList * NetCommandWrapperList::getReadyCommands()
 	while (temp != NULL) {
 		next = temp->m_next;
 		if (temp->isComplete()) {
-			NetCommandRef *msg = NetPacket::ConstructNetCommandMsgFromRawData(temp->getRawData(), temp->getRawDataLength());
-			NetCommandRef *ret = retlist->addMessage(msg->getCommand());
-			ret->setRelay(msg->getRelay());
-
-			deleteInstance(msg);
-			msg = NULL;
+			NetCommandRef *msg = NULL;
+			if (temp->isDataValid()) {
+				msg = NetPacket::ConstructNetCommandMsgFromRawData(temp->getRawData(), temp->getRawDataLength());
+			} else {
+				DEBUG_LOG(("NetCommandWrapperList::getReadyCommands - the data of wrapped command %d does not match its checksum", temp->getCommandID()));
+			}
+			if (msg != NULL) {
+				NetCommandRef *ret = retlist->addMessage(msg->getCommand());
+				if (ret != NULL) {
+					ret->setRelay(msg->getRelay());
+				}
+
+				deleteInstance(msg);
+				msg = NULL;
+			} else {
+				DEBUG_LOG(("NetCommandWrapperList::getReadyCommands - dropping a wrapped command that could not be read"));
+			}
 
 			removeFromList(temp);
 			temp = NULL;
@@ -242,3 +409,20 @@ void NetCommandWrapperList::removeFromList(NetCommandWrapperListNode *node) {
 		temp = NULL;
 	}
 }
+
+/**
+ * Keeps the incomplete command with the most chunks for a later transfer, see NetCommandWrapperResumeData.
+ */
+void NetCommandWrapperList::keepForResume() {
+	NetCommandWrapperListNode *best = NULL;
+	for (NetCommandWrapperListNode *temp = m_list; temp != NULL; temp = temp->m_next) {
+		if (temp->canKeepForResume() && (best == NULL || temp->getNumChunksPresent() > best->getNumChunksPresent())) {
+			best = temp;
+		}
+	}
+
+	if (best != NULL) {
+		DEBUG_LOG(("NetCommandWrapperList::keepForResume() - keeping %u chunks of command %d", best->getNumChunksPresent(), best->getCommandID()));
+		best->keepForResume(m_resumeData);
+	}
+}
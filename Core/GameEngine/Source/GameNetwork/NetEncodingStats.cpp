@@ -0,0 +1,199 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: NetEncodingStats.cpp /////////////////////////////////////////////////////////////////////
+// Measures how many bytes the game commands of a replay take in network packets.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameNetwork/NetEncodingStats.h"
+
+#include "GameNetwork/NetCommandMsg.h"
+
+//-------------------------------------------------------------------------------------------------
+NetEncodingStats::NetEncodingStats()
+	: m_numCommands(0), m_maxArgumentCount(0), m_frame(0), m_playerIndex(-1), m_commandID(0)
+{
+	for (Int i = 0; i < ARGUMENT_COUNT_BUCKETS; ++i)
+	{
+		m_argumentCounts[i] = 0;
+	}
+	for (Int i = 0; i < ENCODING_COUNT; ++i)
+	{
+		m_packets[i] = newInstance(NetPacket);
+		m_bytes[i] = 0;
+		m_numPackets[i] = 0;
+		startPacket(i);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+NetEncodingStats::~NetEncodingStats()
+{
+	for (Int i = 0; i < ENCODING_COUNT; ++i)
+	{
+		deleteInstance(m_packets[i]);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetEncodingStats::startPacket(Int encoding)
+{
+	m_packets[encoding]->reset();
+	m_packets[encoding]->setCompactGameCommands(encoding == ENCODING_COMPACT);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Counts the packet if it is not empty and starts a new one. */
+//-------------------------------------------------------------------------------------------------
+void NetEncodingStats::finishPacket(Int encoding)
+{
+	if (m_packets[encoding]->getNumCommands() > 0)
+	{
+		m_bytes[encoding] += m_packets[encoding]->getLength();
+		++m_numPackets[encoding];
+	}
+	startPacket(encoding);
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetEncodingStats::flush()
+{
+	for (Int i = 0; i < ENCODING_COUNT; ++i)
+	{
+		finishPacket(i);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Confirms the commands whose ack has arrived by the given frame. */
+//-------------------------------------------------------------------------------------------------
+void NetEncodingStats::confirmCommands(UnsignedInt frame)
+{
+	while (!m_unackedCommands.empty() && m_unackedCommands.front().m_frame + AckDelayFrames <= frame)
+	{
+		m_sentGameCommands.confirm(m_unackedCommands.front().m_commandID, m_unackedCommands.front().m_playerID);
+		m_unackedCommands.pop_front();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The commands of one player and frame are packed together, as they are sent together in a game.
+	* A command that does not fit into an empty packet is split up like Connection::sendNetCommandMsg
+	* does, which only has the plain encoding. The compact encoding refers to the last command whose
+	* ack has arrived, like a connection does when it sends a command for the first time. */
+//-------------------------------------------------------------------------------------------------
+void NetEncodingStats::addGameMessage(GameMessage *msg, UnsignedInt frame)
+{
+	if (frame != m_frame || msg->getPlayerIndex() != m_playerIndex)
+	{
+		flush();
+		confirmCommands(frame);
+		m_frame = frame;
+		m_playerIndex = msg->getPlayerIndex();
+	}
+
+	NetGameCommandMsg *cmdMsg = newInstance(NetGameCommandMsg)(msg);
+	cmdMsg->setExecutionFrame(frame);
+	cmdMsg->setPlayerID(m_playerIndex);
+	cmdMsg->setID(m_commandID++);
+	NetCommandRef *ref = NEW_NETCOMMANDREF(cmdMsg);
+	cmdMsg->detach();
+
+	// the plain encoding decides whether the command is split up, like in Connection::sendNetCommandMsg.
+	Bool wrapped = FALSE;
+	for (Int i = 0; i < ENCODING_COUNT; ++i)
+	{
+		if (!wrapped)
+		{
+			const NetGameCommandDictionary::Entry *reference = (i == ENCODING_COMPACT) ? m_sentGameCommands.getConfirmed() : NULL;
+			if (m_packets[i]->addCommand(ref, reference))
+				continue;
+
+			finishPacket(i);
+			if (m_packets[i]->addCommand(ref, reference))
+				continue;
+		}
+
+		NetPacketList packetList = NetPacket::ConstructBigCommandPacketList(ref);
+		for (NetPacketListIter it = packetList.begin(); it != packetList.end(); ++it)
+		{
+			m_bytes[i] += (*it)->getLength();
+			++m_numPackets[i];
+			deleteInstance(*it);
+		}
+		wrapped = TRUE;
+	}
+
+	// a connection sends the chunks of a wrapped command, which the dictionary does not see.
+	if (!wrapped)
+	{
+		m_sentGameCommands.add(cmdMsg);
+		SentCommand sent;
+		sent.m_frame = frame;
+		sent.m_commandID = cmdMsg->getID();
+		sent.m_playerID = (UnsignedByte)m_playerIndex;
+		m_unackedCommands.push_back(sent);
+	}
+
+	deleteInstance(ref);
+	++m_numCommands;
+
+	const UnsignedInt numArgs = (UnsignedInt)msg->getArgumentCount();
+	++m_argumentCounts[min(numArgs, (UnsignedInt)ARGUMENT_COUNT_BUCKETS - 1)];
+	m_maxArgumentCount = max(m_maxArgumentCount, numArgs);
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetEncodingStats::print()
+{
+	flush();
+
+	const UnsignedInt plainBytes = m_bytes[ENCODING_PLAIN];
+	const UnsignedInt compactBytes = m_bytes[ENCODING_COMPACT];
+	const Real saved = (plainBytes > 0) ? 100.0f * ((Real)plainBytes - (Real)compactBytes) / (Real)plainBytes : 0.0f;
+
+	// Note that we use printf here because this is run from cmd.
+	printf("Network encoding of %u game commands:\n", m_numCommands);
+	printf("  plain:   %u bytes in %u packets\n", plainBytes, m_numPackets[ENCODING_PLAIN]);
+	printf("  compact: %u bytes in %u packets, %.1f%% fewer bytes\n", compactBytes, m_numPackets[ENCODING_COMPACT], saved);
+
+	UnsignedInt numInline = 0;
+	for (Int i = 0; i <= NetGameCommandMsg::INLINE_ARGUMENT_COUNT && i < ARGUMENT_COUNT_BUCKETS; ++i)
+	{
+		numInline += m_argumentCounts[i];
+	}
+	const Real inlinePercent = (m_numCommands > 0) ? 100.0f * (Real)numInline / (Real)m_numCommands : 0.0f;
+
+	printf("Game command arguments, at most %d are stored inline:\n", (Int)NetGameCommandMsg::INLINE_ARGUMENT_COUNT);
+	printf("  %.1f%% of the commands fit, the largest has %u arguments\n", inlinePercent, m_maxArgumentCount);
+	for (Int i = 0; i < ARGUMENT_COUNT_BUCKETS; ++i)
+	{
+		if (m_argumentCounts[i] > 0)
+		{
+			printf("  %2d%s arguments: %u commands\n", i, (i == ARGUMENT_COUNT_BUCKETS - 1) ? "+" : " ", m_argumentCounts[i]);
+		}
+	}
+	fflush(stdout);
+
+	DEBUG_LOG(("NetEncodingStats - %u game commands, plain %u bytes in %u packets, compact %u bytes in %u packets",
+		m_numCommands, plainBytes, m_numPackets[ENCODING_PLAIN], compactBytes, m_numPackets[ENCODING_COMPACT]));
+	DEBUG_LOG(("NetEncodingStats - %.1f%% of the game commands have at most %d arguments, the largest has %u",
+		inlinePercent, (Int)NetGameCommandMsg::INLINE_ARGUMENT_COUNT, m_maxArgumentCount));
+}
@@ -30,7 +30,7 @@
 #include "GameNetwork/NetCommandMsg.h"
 #include "GameNetwork/NetworkDefs.h"
 #include "GameNetwork/networkutil.h"
-#include "GameNetwork/GameMessageParser.h"
+#include "realcrc.h"
 
 // TheSuperHackers @refactor BobTista 10/06/2025 Extract magic character literals into named constants for improved readability
 typedef UnsignedByte NetPacketFieldType;
@@ -42,5861 +42,1805 @@ namespace NetPacketFieldTypes {
 	constexpr const NetPacketFieldType CommandId = 'C';			// Command ID field
 	constexpr const NetPacketFieldType Frame = 'F';				// Frame field
 	constexpr const NetPacketFieldType Data = 'D';				// Data payload field
+	constexpr const NetPacketFieldType CompactData = 'G';		// Game command data in the compact encoding
+	constexpr const NetPacketFieldType ChunkChecksum = 'X';	// Checksum of the data of the following chunk
+	constexpr const NetPacketFieldType WrappedDataChecksum = 'W';	// Checksum of the wrapped data after the first chunk
+	constexpr const NetPacketFieldType Repeat = 'Z';			// Repeat last command
 }
 
-// This function assumes that all of the fields are either of default value or are
-// present in the raw data.
-NetCommandRef * NetPacket::ConstructNetCommandMsgFromRawData(UnsignedByte *data, UnsignedShort dataLength) {
-	NetCommandType commandType = NETCOMMANDTYPE_GAMECOMMAND;
-	UnsignedShort commandID = 0;
-	UnsignedInt frame = 0;
-	UnsignedByte playerID = 0;
-	UnsignedByte relay = 0;
-
-	Int offset = 0;
-	NetCommandRef *ref = NULL;
-	NetCommandMsg *msg = NULL;
-
-	while (offset < (Int)dataLength) {
-
-		switch (data[offset]) {
-
-		case NetPacketFieldTypes::CommandType:
-			++offset;
-			memcpy(&commandType, data + offset, sizeof(UnsignedByte));
-			offset += sizeof(UnsignedByte);
-			break;
-
-		case NetPacketFieldTypes::Relay:
-			++offset;
-			memcpy(&relay, data + offset, sizeof(UnsignedByte));
-			offset += sizeof(UnsignedByte);
-			break;
-
-		case NetPacketFieldTypes::PlayerId:
-			++offset;
-			memcpy(&playerID, data + offset, sizeof(UnsignedByte));
-			offset += sizeof(UnsignedByte);
-			break;
-
-		case NetPacketFieldTypes::CommandId:
-			++offset;
-			memcpy(&commandID, data + offset, sizeof(UnsignedShort));
-			offset += sizeof(UnsignedShort);
-			break;
-
-		case NetPacketFieldTypes::Frame:
-			++offset;
-			memcpy(&frame, data + offset, sizeof(UnsignedInt));
-			offset += sizeof(UnsignedInt);
-			break;
-
-		case NetPacketFieldTypes::Data:
-			++offset;
-
-			switch (commandType) {
-
-			case NETCOMMANDTYPE_GAMECOMMAND:
-				msg = readGameMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_ACKBOTH:
-				msg = readAckBothMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_ACKSTAGE1:
-				msg = readAckStage1Message(data, offset);
-				break;
-			case NETCOMMANDTYPE_ACKSTAGE2:
-				msg = readAckStage2Message(data, offset);
-				break;
-			case NETCOMMANDTYPE_FRAMEINFO:
-				msg = readFrameMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_PLAYERLEAVE:
-				msg = readPlayerLeaveMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_RUNAHEADMETRICS:
-				msg = readRunAheadMetricsMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_RUNAHEAD:
-				msg = readRunAheadMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DESTROYPLAYER:
-				msg = readDestroyPlayerMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_KEEPALIVE:
-				msg = readKeepAliveMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTKEEPALIVE:
-				msg = readDisconnectKeepAliveMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTPLAYER:
-				msg = readDisconnectPlayerMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_PACKETROUTERQUERY:
-				msg = readPacketRouterQueryMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_PACKETROUTERACK:
-				msg = readPacketRouterAckMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTCHAT:
-				msg = readDisconnectChatMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTVOTE:
-				msg = readDisconnectVoteMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_CHAT:
-				msg = readChatMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_PROGRESS:
-				msg = readProgressMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_LOADCOMPLETE:
-				msg = readLoadCompleteMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_TIMEOUTSTART:
-				msg = readTimeOutGameStartMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_WRAPPER:
-				msg = readWrapperMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_FILE:
-				msg = readFileMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_FILEANNOUNCE:
-				msg = readFileAnnounceMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_FILEPROGRESS:
-				msg = readFileProgressMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTFRAME:
-				msg = readDisconnectFrameMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTSCREENOFF:
-				msg = readDisconnectScreenOffMessage(data, offset);
-				break;
-			case NETCOMMANDTYPE_FRAMERESENDREQUEST:
-				msg = readFrameResendRequestMessage(data, offset);
-				break;
-
-			}
-
-			msg->setExecutionFrame(frame);
-			msg->setID(commandID);
-			msg->setPlayerID(playerID);
-			msg->setNetCommandType(commandType);
-
-			ref = NEW_NETCOMMANDREF(msg);
-
-			ref->setRelay(relay);
-
-			msg->detach();
-			msg = NULL;
-
-			return ref;
-
-		}
-
-	}
-
-	return ref;
-}
-
-NetPacketList NetPacket::ConstructBigCommandPacketList(NetCommandRef *ref) {
-	// if we don't have a unique command ID, then the wrapped command cannot
-	// be identified.  Therefore don't allow commands without a unique ID to
-	// be wrapped.
-	NetCommandMsg *msg = ref->getCommand();
-
-	if (!DoesCommandRequireACommandID(msg->getNetCommandType())) {
-		DEBUG_CRASH(("Trying to wrap a command that doesn't have a unique command ID"));
-		return NetPacketList();
-	}
-
-	UnsignedInt bufferSize = GetBufferSizeNeededForCommand(msg);  // need to implement.  I have a drinking problem.
-	UnsignedByte *bigPacketData = NULL;
-
-	NetPacketList packetList;
-
-	// create the buffer for the huge message and fill the buffer with that message.
-	UnsignedInt bigPacketCurrentOffset = 0;
-	bigPacketData = NEW UnsignedByte[bufferSize];
-	FillBufferWithCommand(bigPacketData, ref);
-
-	// create the wrapper command message we'll be using.
-	NetWrapperCommandMsg *wrapperMsg = newInstance(NetWrapperCommandMsg);
-	// get the amount of space needed for the wrapper message, not including the wrapped command data.
-	UnsignedInt wrapperSize = GetBufferSizeNeededForCommand(wrapperMsg);
-	UnsignedInt commandSizePerPacket = MAX_PACKET_SIZE - wrapperSize;
-
-	UnsignedInt numChunks = bufferSize / commandSizePerPacket;
-	if ((bufferSize % commandSizePerPacket) > 0) {
-		++numChunks;
-	}
-	UnsignedInt currentChunk = 0;
-
-	// create the packets and the wrapper messages.
-	while (currentChunk < numChunks) {
-		NetPacket *packet = newInstance(NetPacket);
-
-		UnsignedShort dataSizeThisPacket = commandSizePerPacket;
-		if ((bufferSize - bigPacketCurrentOffset) < dataSizeThisPacket) {
-			dataSizeThisPacket = bufferSize - bigPacketCurrentOffset;
-		}
-
-		if (DoesCommandRequireACommandID(wrapperMsg->getNetCommandType())) {
-			wrapperMsg->setID(GenerateNextCommandID());
-		}
-		wrapperMsg->setPlayerID(msg->getPlayerID());
-		wrapperMsg->setExecutionFrame(msg->getExecutionFrame());
-
-		wrapperMsg->setChunkNumber(currentChunk);
-		wrapperMsg->setNumChunks(numChunks);
-		wrapperMsg->setDataOffset(bigPacketCurrentOffset);
-		wrapperMsg->setData(bigPacketData + bigPacketCurrentOffset, dataSizeThisPacket);
-		wrapperMsg->setTotalDataLength(bufferSize);
-		wrapperMsg->setWrappedCommandID(msg->getID());
-
-		bigPacketCurrentOffset += dataSizeThisPacket;
-
-		NetCommandRef * ref = NEW_NETCOMMANDREF(wrapperMsg);
-		ref->setRelay(ref->getRelay());
-
-		if (packet->addCommand(ref) == FALSE) {
-			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::BeginBigCommandPacketList - failed to add a wrapper command to the packet")); // I still have a drinking problem.
-		}
-
-		packetList.push_back(packet);
-
-		deleteInstance(ref);
-		ref = NULL;
-
-		++currentChunk;
-	}
-	wrapperMsg->detach();
-	wrapperMsg = NULL;
-
-	delete[] bigPacketData;
-	bigPacketData = NULL;
-
-	return packetList;
-}
+/*
+T = Net command type
+F = Execution frame
+P = Player ID
+C = Command ID
+R = Relay
+D = Command Data
+G = Game command data in the compact encoding
+X = Checksum of the data of the following chunk
+W = Checksum of the wrapped data after the first chunk, sent with every chunk
+Z = Repeat last command
+*/
 
-UnsignedInt NetPacket::GetBufferSizeNeededForCommand(NetCommandMsg *msg) {
-	// This is where the fun begins...
+//-------------------------------------------------------------------------------------------------
+// TheSuperHackers @refactor The packet codec is table driven. Every command type lists the header
+// fields it carries in wire order and has a single xfer function for its data. Computing the size,
+// writing and reading a command all go through the same two descriptions, and reading is bounds
+// checked against the end of the packet. The wire format is unchanged.
+//-------------------------------------------------------------------------------------------------
 
-	if (msg == NULL) {
-		return TRUE; // There was nothing to add, so it was successful.
-	}
+enum NetPacketXferMode CPP_11(: Int)
+{
+	NETPACKETXFER_SIZE,		///< only counts the bytes
+	NETPACKETXFER_WRITE,
+	NETPACKETXFER_READ
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Transfers the values of a command from or to a packet, or only counts their size. When the data
+	* is too short to read or the buffer too short to write a value, the transfer fails and all later
+	* values are left untouched. */
+//-------------------------------------------------------------------------------------------------
+class NetPacketXfer
+{
+public:
 
-	switch(msg->getNetCommandType())
+	NetPacketXfer(NetPacketXferMode mode, UnsignedByte *data, UnsignedInt offset, UnsignedInt length)
+		: m_data(data), m_offset(offset), m_length(length), m_mode(mode), m_failed(FALSE)
 	{
-		case NETCOMMANDTYPE_GAMECOMMAND:
-			return GetGameCommandSize(msg);
-		case NETCOMMANDTYPE_ACKSTAGE1:
-		case NETCOMMANDTYPE_ACKSTAGE2:
-		case NETCOMMANDTYPE_ACKBOTH:
-			return GetAckCommandSize(msg);
-		case NETCOMMANDTYPE_FRAMEINFO:
-			return GetFrameCommandSize(msg);
-		case NETCOMMANDTYPE_PLAYERLEAVE:
-			return GetPlayerLeaveCommandSize(msg);
-		case NETCOMMANDTYPE_RUNAHEADMETRICS:
-			return GetRunAheadMetricsCommandSize(msg);
-		case NETCOMMANDTYPE_RUNAHEAD:
-			return GetRunAheadCommandSize(msg);
-		case NETCOMMANDTYPE_DESTROYPLAYER:
-			return GetDestroyPlayerCommandSize(msg);
-		case NETCOMMANDTYPE_KEEPALIVE:
-			return GetKeepAliveCommandSize(msg);
-		case NETCOMMANDTYPE_DISCONNECTKEEPALIVE:
-			return GetDisconnectKeepAliveCommandSize(msg);
-		case NETCOMMANDTYPE_DISCONNECTPLAYER:
-			return GetDisconnectPlayerCommandSize(msg);
-		case NETCOMMANDTYPE_PACKETROUTERQUERY:
-			return GetPacketRouterQueryCommandSize(msg);
-		case NETCOMMANDTYPE_PACKETROUTERACK:
-			return GetPacketRouterAckCommandSize(msg);
-		case NETCOMMANDTYPE_DISCONNECTCHAT:
-			return GetDisconnectChatCommandSize(msg);
-		case NETCOMMANDTYPE_DISCONNECTVOTE:
-			return GetDisconnectVoteCommandSize(msg);
-		case NETCOMMANDTYPE_CHAT:
-			return GetChatCommandSize(msg);
-		case NETCOMMANDTYPE_PROGRESS:
-			return GetProgressMessageSize(msg);
-		case NETCOMMANDTYPE_LOADCOMPLETE:
-			return GetLoadCompleteMessageSize(msg);
-		case NETCOMMANDTYPE_TIMEOUTSTART:
-			return GetTimeOutGameStartMessageSize(msg);
-		case NETCOMMANDTYPE_WRAPPER:
-			return GetWrapperCommandSize(msg);
-		case NETCOMMANDTYPE_FILE:
-			return GetFileCommandSize(msg);
-		case NETCOMMANDTYPE_FILEANNOUNCE:
-			return GetFileAnnounceCommandSize(msg);
-		case NETCOMMANDTYPE_FILEPROGRESS:
-			return GetFileProgressCommandSize(msg);
-		case NETCOMMANDTYPE_DISCONNECTFRAME:
-			return GetDisconnectFrameCommandSize(msg);
-		case NETCOMMANDTYPE_DISCONNECTSCREENOFF:
-			return GetDisconnectScreenOffCommandSize(msg);
-		case NETCOMMANDTYPE_FRAMERESENDREQUEST:
-			return GetFrameResendRequestCommandSize(msg);
-		default:
-			DEBUG_CRASH(("Unknown NETCOMMANDTYPE %d", msg->getNetCommandType()));
-			break;
-	}
-
-	return 0;
-}
-
-UnsignedInt NetPacket::GetGameCommandSize(NetCommandMsg *msg) {
-	NetGameCommandMsg *cmdMsg = (NetGameCommandMsg *)msg;
-
-	UnsignedShort msglen = 0;
-	msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte); // frame number
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // relay
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // command type
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte); // command ID
-	msglen += sizeof(UnsignedByte); // the NetPacketFieldTypes::Data for the data section.
-
-	GameMessage *gmsg = cmdMsg->constructGameMessage();
-	GameMessageParser *parser = newInstance(GameMessageParser)(gmsg);
-
-	msglen += sizeof(GameMessage::Type);
-	msglen += sizeof(UnsignedByte);
-//	Int numTypes = parser->getNumTypes();
-	GameMessageParserArgumentType *arg = parser->getFirstArgumentType();
-	while (arg != NULL) {
-		msglen += 2 * sizeof(UnsignedByte); // for the type and number of args of that type declaration.
-		GameMessageArgumentDataType type = arg->getType();
-
-		switch (type) {
-
-		case ARGUMENTDATATYPE_INTEGER:
-			msglen += arg->getArgCount() * sizeof(Int);
-			break;
-		case ARGUMENTDATATYPE_REAL:
-			msglen += arg->getArgCount() * sizeof(Real);
-			break;
-		case ARGUMENTDATATYPE_BOOLEAN:
-			msglen += arg->getArgCount() * sizeof(Bool);
-			break;
-		case ARGUMENTDATATYPE_OBJECTID:
-			msglen += arg->getArgCount() * sizeof(ObjectID);
-			break;
-		case ARGUMENTDATATYPE_DRAWABLEID:
-			msglen += arg->getArgCount() * sizeof(DrawableID);
-			break;
-		case ARGUMENTDATATYPE_TEAMID:
-			msglen += arg->getArgCount() * sizeof(UnsignedInt);
-			break;
-		case ARGUMENTDATATYPE_LOCATION:
-			msglen += arg->getArgCount() * sizeof(Coord3D);
-			break;
-		case ARGUMENTDATATYPE_PIXEL:
-			msglen += arg->getArgCount() * sizeof(ICoord2D);
-			break;
-		case ARGUMENTDATATYPE_PIXELREGION:
-			msglen += arg->getArgCount() * sizeof(IRegion2D);
-			break;
-		case ARGUMENTDATATYPE_TIMESTAMP:
-			msglen += arg->getArgCount() * sizeof(UnsignedInt);
-			break;
-		case ARGUMENTDATATYPE_WIDECHAR:
-			msglen += arg->getArgCount() * sizeof(WideChar);
-			break;
-
-		}
-
-		arg = arg->getNext();
 	}
 
-	deleteInstance(parser);
-	parser = NULL;
-
-	deleteInstance(gmsg);
-	gmsg = NULL;
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetAckCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen;
-	msglen += sizeof(UnsignedShort);
-	msglen += sizeof(UnsignedByte);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetFrameCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen;
-	msglen += sizeof(UnsignedShort);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetPlayerLeaveCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetRunAheadMetricsCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(Real);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetRunAheadCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen;
-	msglen += sizeof(UnsignedShort);
-	msglen += sizeof(UnsignedByte);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDestroyPlayerCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen;
-	msglen += sizeof(UnsignedInt);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetKeepAliveCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // For the NetPacketFieldTypes::Data
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDisconnectKeepAliveCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // For the NetPacketFieldTypes::Data
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDisconnectPlayerCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen; // the NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedByte); // slot number
-	msglen += sizeof(UnsignedInt);	// disconnect frame
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetPacketRouterQueryCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // the NetPacketFieldTypes::Data
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetPacketRouterAckCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // the NetPacketFieldTypes::Data
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDisconnectChatCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-	NetDisconnectChatCommandMsg *cmdMsg = (NetDisconnectChatCommandMsg *)(msg);
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // the NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedByte); // string msglength
-	UnsignedByte textmsglen = cmdMsg->getText().getLength();
-	msglen += textmsglen * sizeof(UnsignedShort);
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDisconnectVoteCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen; // the NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedByte); // slot number
-	msglen += sizeof(UnsignedInt); // vote frame.
+	Bool isReading() const { return m_mode == NETPACKETXFER_READ; }
+	Bool hasFailed() const { return m_failed; }
+	void setFailed() { m_failed = TRUE; }
+	UnsignedInt getOffset() const { return m_offset; }
+	Bool isAtEnd() const { return m_failed || m_offset >= m_length; }
 
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetChatCommandSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-	NetChatCommandMsg *cmdMsg = (NetChatCommandMsg *)(msg);
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-
-	++msglen; // the NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedByte); // string msglength
-	UnsignedByte textmsglen = cmdMsg->getText().getLength();
-	msglen += textmsglen * sizeof(UnsignedShort);
-	msglen += sizeof(Int); // playerMask
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetProgressMessageSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // For the NetPacketFieldTypes::Data
-	++msglen; // percentage
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetLoadCompleteMessageSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // For the NetPacketFieldTypes::Data
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetTimeOutGameStartMessageSize(NetCommandMsg *msg) {
-	Int msglen = 0;
-
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	++msglen;
-	msglen += sizeof(UnsignedByte);
-
-	++msglen; // For the NetPacketFieldTypes::Data
-
-	return msglen;
-}
-
-// type, player, ID, relay, Data
-UnsignedInt NetPacket::GetWrapperCommandSize(NetCommandMsg *msg) {
-	UnsignedInt msglen = 0;
-
-	++msglen; // NetPacketFieldTypes::CommandType
-	msglen += sizeof(UnsignedByte); // command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::Relay and relay
-	++msglen; // NetPacketFieldTypes::Data
-
-	msglen += sizeof(UnsignedShort); // m_wrappedCommandID
-	msglen += sizeof(UnsignedInt); // m_chunkNumber
-	msglen += sizeof(UnsignedInt); // m_numChunks
-	msglen += sizeof(UnsignedInt); // m_totalDataLength
-	msglen += sizeof(UnsignedInt); // m_dataLength
-	msglen += sizeof(UnsignedInt); // m_dataOffset
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetFileCommandSize(NetCommandMsg *msg) {
-	NetFileCommandMsg *filemsg = (NetFileCommandMsg *)msg;
-	UnsignedInt msglen = 0;
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::CommandType and command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::Relay and relay
-
-	++msglen; // NetPacketFieldTypes::Data
-
-	msglen += filemsg->getPortableFilename().getLength() + 1; // PORTABLE filename and the terminating 0
-	msglen += sizeof(UnsignedInt); // file data length
-	msglen += filemsg->getFileLength(); // the file data
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetFileAnnounceCommandSize(NetCommandMsg *msg) {
-	NetFileAnnounceCommandMsg *filemsg = (NetFileAnnounceCommandMsg *)msg;
-	UnsignedInt msglen = 0;
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::CommandType and command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::Relay and relay
-
-	++msglen; // NetPacketFieldTypes::Data
-
-	msglen += filemsg->getPortableFilename().getLength() + 1; // PORTABLE filename and the terminating 0
-	msglen += sizeof(UnsignedShort); // m_fileID
-	msglen += sizeof(UnsignedByte); // m_playerMask
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetFileProgressCommandSize(NetCommandMsg *msg) {
-	UnsignedInt msglen = 0;
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::CommandType and command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte); // NetPacketFieldTypes::Relay and relay
-
-	++msglen; // NetPacketFieldTypes::Data
-
-	msglen += sizeof(UnsignedShort); // m_fileID
-	msglen += sizeof(Int); // m_progress
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDisconnectFrameCommandSize(NetCommandMsg *msg) {
-	UnsignedInt msglen = 0;
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::CommandType and command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::Relay and relay
-
-	++msglen; // NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedInt); // disconnect frame
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetDisconnectScreenOffCommandSize(NetCommandMsg *msg) {
-	UnsignedInt msglen = 0;
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::CommandType and command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::Relay and relay
-
-	++msglen; // NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedInt); // new frame
-
-	return msglen;
-}
-
-UnsignedInt NetPacket::GetFrameResendRequestCommandSize(NetCommandMsg *msg) {
-	UnsignedInt msglen = 0;
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::CommandType and command type
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::PlayerId and player ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedShort); // NetPacketFieldTypes::CommandId and command ID
-	msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);	// NetPacketFieldTypes::Relay and relay
-
-	++msglen; // NetPacketFieldTypes::Data
-	msglen += sizeof(UnsignedInt); // frame to resend
-
-	return msglen;
-}
-
-// this function assumes that buffer is already the correct size.
-void NetPacket::FillBufferWithCommand(UnsignedByte *buffer, NetCommandRef *ref) {
-	NetCommandMsg *msg = ref->getCommand();
-
-	switch(msg->getNetCommandType())
+	void xferBytes(void *data, UnsignedInt length)
 	{
-		case NETCOMMANDTYPE_GAMECOMMAND:
-			FillBufferWithGameCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_ACKSTAGE1:
-		case NETCOMMANDTYPE_ACKSTAGE2:
-		case NETCOMMANDTYPE_ACKBOTH:
-			FillBufferWithAckCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_FRAMEINFO:
-			FillBufferWithFrameCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_PLAYERLEAVE:
-			FillBufferWithPlayerLeaveCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_RUNAHEADMETRICS:
-			FillBufferWithRunAheadMetricsCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_RUNAHEAD:
-			FillBufferWithRunAheadCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DESTROYPLAYER:
-			FillBufferWithDestroyPlayerCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_KEEPALIVE:
-			FillBufferWithKeepAliveCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DISCONNECTKEEPALIVE:
-			FillBufferWithDisconnectKeepAliveCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DISCONNECTPLAYER:
-			FillBufferWithDisconnectPlayerCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_PACKETROUTERQUERY:
-			FillBufferWithPacketRouterQueryCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_PACKETROUTERACK:
-			FillBufferWithPacketRouterAckCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DISCONNECTCHAT:
-			FillBufferWithDisconnectChatCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DISCONNECTVOTE:
-			FillBufferWithDisconnectVoteCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_CHAT:
-			FillBufferWithChatCommand(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_PROGRESS:
-			FillBufferWithProgressMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_LOADCOMPLETE:
-			FillBufferWithLoadCompleteMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_TIMEOUTSTART:
-			FillBufferWithTimeOutGameStartMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_FILE:
-			FillBufferWithFileMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_FILEANNOUNCE:
-			FillBufferWithFileAnnounceMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_FILEPROGRESS:
-			FillBufferWithFileProgressMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DISCONNECTFRAME:
-			FillBufferWithDisconnectFrameMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_DISCONNECTSCREENOFF:
-			FillBufferWithDisconnectScreenOffMessage(buffer, ref);
-			break;
-		case NETCOMMANDTYPE_FRAMERESENDREQUEST:
-			FillBufferWithFrameResendRequestMessage(buffer, ref);
-			break;
-		default:
-			DEBUG_CRASH(("Unknown NETCOMMANDTYPE %d", msg->getNetCommandType()));
-			break;
-	}
-}
-
-void NetPacket::FillBufferWithGameCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetGameCommandMsg *cmdMsg = (NetGameCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-	// get the game message from the NetCommandMsg
-	GameMessage *gmsg = cmdMsg->constructGameMessage();
-
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::FillBufferWithGameCommand for command ID %d", cmdMsg->getID()));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, put the execution frame into the packet.
-	buffer[offset] = NetPacketFieldTypes::Frame;
-	++offset;
-	UnsignedInt newframe = cmdMsg->getExecutionFrame();
-	memcpy(buffer+offset, &newframe, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-
-	// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, put the playerID into the packet.
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	// Now copy the GameMessage type into the packet.
-	GameMessage::Type newType = gmsg->getType();
-	memcpy(buffer + offset, &newType, sizeof(GameMessage::Type));
-	offset += sizeof(GameMessage::Type);
-
-
-	GameMessageParser *parser = newInstance(GameMessageParser)(gmsg);
-	UnsignedByte numTypes = parser->getNumTypes();
-	memcpy(buffer + offset, &numTypes, sizeof(numTypes));
-	offset += sizeof(numTypes);
-
-	GameMessageParserArgumentType *argType = parser->getFirstArgumentType();
-	while (argType != NULL) {
-		UnsignedByte type = (UnsignedByte)(argType->getType());
-		memcpy(buffer + offset, &type, sizeof(type));
-		offset += sizeof(type);
-
-		UnsignedByte argTypeCount = argType->getArgCount();
-		memcpy(buffer + offset, &argTypeCount, sizeof(argTypeCount));
-		offset += sizeof(argTypeCount);
-
-		argType = argType->getNext();
-	}
-
-	Int numArgs = gmsg->getArgumentCount();
-	for (Int i = 0; i < numArgs; ++i) {
-		GameMessageArgumentDataType type = gmsg->getArgumentDataType(i);
-		GameMessageArgumentType arg = *(gmsg->getArgument(i));
-
-		switch (type) {
-
-		case ARGUMENTDATATYPE_INTEGER:
-			memcpy(buffer + offset, &(arg.integer), sizeof(arg.integer));
-			offset += sizeof(arg.integer);
-			break;
-		case ARGUMENTDATATYPE_REAL:
-			memcpy(buffer + offset, &(arg.real), sizeof(arg.real));
-			offset += sizeof(arg.real);
-			break;
-		case ARGUMENTDATATYPE_BOOLEAN:
-			memcpy(buffer + offset, &(arg.boolean), sizeof(arg.boolean));
-			offset += sizeof(arg.boolean);
-			break;
-		case ARGUMENTDATATYPE_OBJECTID:
-			memcpy(buffer + offset, &(arg.objectID), sizeof(arg.objectID));
-			offset += sizeof(arg.objectID);
-			break;
-		case ARGUMENTDATATYPE_DRAWABLEID:
-			memcpy(buffer + offset, &(arg.drawableID), sizeof(arg.drawableID));
-			offset += sizeof(arg.drawableID);
-			break;
-		case ARGUMENTDATATYPE_TEAMID:
-			memcpy(buffer + offset, &(arg.teamID), sizeof(arg.teamID));
-			offset += sizeof(arg.teamID);
-			break;
-		case ARGUMENTDATATYPE_LOCATION:
-			memcpy(buffer + offset, &(arg.location), sizeof(arg.location));
-			offset += sizeof(arg.location);
-			break;
-		case ARGUMENTDATATYPE_PIXEL:
-			memcpy(buffer + offset, &(arg.pixel), sizeof(arg.pixel));
-			offset += sizeof(arg.pixel);
-			break;
-		case ARGUMENTDATATYPE_PIXELREGION:
-			memcpy(buffer + offset, &(arg.pixelRegion), sizeof(arg.pixelRegion));
-			offset += sizeof(arg.pixelRegion);
-			break;
-		case ARGUMENTDATATYPE_TIMESTAMP:
-			memcpy(buffer + offset, &(arg.timestamp), sizeof(arg.timestamp));
-			offset += sizeof(arg.timestamp);
-			break;
-		case ARGUMENTDATATYPE_WIDECHAR:
-			memcpy(buffer + offset, &(arg.wChar), sizeof(arg.wChar));
-			offset += sizeof(arg.wChar);
-			break;
-		}
-
-	}
-
-	deleteInstance(parser);
-	parser = NULL;
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addGameMessage - added game message, frame %d, player %d, command ID %d", m_lastFrame, m_lastPlayerID, m_lastCommandID));
-
-	deleteInstance(gmsg);
-	gmsg = NULL;
-}
-
-void NetPacket::FillBufferWithAckCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::FillBufferWithAckCommand - adding ack for command %d for player %d", cmdMsg->getCommandID(), msg->getCommand()->getPlayerID()));
-
-	NetCommandMsg *cmdMsg = msg->getCommand();
-	UnsignedShort offset = 0;
-
-	UnsignedShort commandID = 0;
-	UnsignedByte originalPlayerID = 0;
-
-	NetCommandType type = cmdMsg->getNetCommandType();
-
-	switch (type) {
-
-	case NETCOMMANDTYPE_ACKBOTH: {
-		NetAckBothCommandMsg* ackbothmsg = (NetAckBothCommandMsg*)msg;
-		commandID = ackbothmsg->getCommandID();
-		originalPlayerID = ackbothmsg->getOriginalPlayerID();
-		break;
-	}
-
-	case NETCOMMANDTYPE_ACKSTAGE1: {
-		NetAckStage1CommandMsg* ackstageonemsg = (NetAckStage1CommandMsg*)msg;
-		commandID = ackstageonemsg->getCommandID();
-		originalPlayerID = ackstageonemsg->getOriginalPlayerID();
-		break;
-	}
-
-	case NETCOMMANDTYPE_ACKSTAGE2: {
-		NetAckStage2CommandMsg* ackstagetwomsg = (NetAckStage2CommandMsg*)msg;
-		commandID = ackstagetwomsg->getCommandID();
-		originalPlayerID = ackstagetwomsg->getOriginalPlayerID();
-		break;
-	}
-
-	}
-
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = type;
-	offset += sizeof(UnsignedByte);
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// Put in the command id of the command we are acking.
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	memcpy(buffer + offset, &commandID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-	memcpy(buffer + offset, &originalPlayerID, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("outgoing - added ACK, original player %d, command id %d", origPlayerID, cmdID));
-}
-
-void NetPacket::FillBufferWithFrameCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetFrameCommandMsg *cmdMsg = (NetFrameCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-	//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addFrameCommand - adding frame command for frame %d, command count = %d, command id = %d", cmdMsg->getExecutionFrame(), cmdMsg->getCommandCount(), cmdMsg->getID()));
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the execution frame into the packet.
-	buffer[offset] = NetPacketFieldTypes::Frame;
-	++offset;
-	UnsignedInt newframe = cmdMsg->getExecutionFrame();
-	memcpy(buffer+offset, &newframe, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnsignedShort cmdCount = cmdMsg->getCommandCount();
-	memcpy(buffer + offset, &cmdCount, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-	// frameinfodebug
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("outgoing - added frame %d, player %d, command count = %d, command id = %d", cmdMsg->getExecutionFrame(), cmdMsg->getPlayerID(), cmdMsg->getCommandCount(), cmdMsg->getID()));
-}
-
-void NetPacket::FillBufferWithPlayerLeaveCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetPlayerLeaveCommandMsg *cmdMsg = (NetPlayerLeaveCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addPlayerLeaveCommand - adding player leave command for player %d", cmdMsg->getLeavingPlayerID()));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the execution frame into the packet.
-	buffer[offset] = NetPacketFieldTypes::Frame;
-	++offset;
-	UnsignedInt newframe = cmdMsg->getExecutionFrame();
-	memcpy(buffer+offset, &newframe, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnsignedByte leavingPlayerID = cmdMsg->getLeavingPlayerID();
-	memcpy(buffer + offset, &leavingPlayerID, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-}
-
-void NetPacket::FillBufferWithRunAheadMetricsCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetRunAheadMetricsCommandMsg *cmdMsg = (NetRunAheadMetricsCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addRunAheadMetricsCommand - adding run ahead metrics for player %d, fps = %d, latency = %f", cmdMsg->getPlayerID(), cmdMsg->getAverageFps(), cmdMsg->getAverageLatency()));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	// write the average latency
-	Real averageLatency = cmdMsg->getAverageLatency();
-	memcpy(buffer + offset, &averageLatency, sizeof(averageLatency));
-	offset += sizeof(averageLatency);
-	// write the average fps
-	UnsignedShort averageFps = (UnsignedShort)(cmdMsg->getAverageFps());
-	memcpy(buffer + offset, &averageFps, sizeof(averageFps));
-	offset += sizeof(averageFps);
-}
-
-void NetPacket::FillBufferWithRunAheadCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetRunAheadCommandMsg *cmdMsg = (NetRunAheadCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::FillBufferWithRunAheadCommand - adding run ahead command"));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, put the execution frame into the packet.
-	buffer[offset] = NetPacketFieldTypes::Frame;
-	++offset;
-	UnsignedInt newframe = cmdMsg->getExecutionFrame();
-	memcpy(buffer+offset, &newframe, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-	// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnsignedShort newRunAhead = cmdMsg->getRunAhead();
-	memcpy(buffer + offset, &newRunAhead, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-	UnsignedByte newFrameRate = cmdMsg->getFrameRate();
-	memcpy(buffer + offset, &newFrameRate, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added run ahead command, frame %d, player id %d command id %d", m_lastFrame, m_lastPlayerID, m_lastCommandID));
-}
-
-void NetPacket::FillBufferWithDestroyPlayerCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDestroyPlayerCommandMsg *cmdMsg = (NetDestroyPlayerCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addRunAheadCommand - adding run ahead command"));
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the execution frame into the packet.
-	buffer[offset] = NetPacketFieldTypes::Frame;
-	++offset;
-	UnsignedInt newframe = cmdMsg->getExecutionFrame();
-	memcpy(buffer+offset, &newframe, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnsignedInt newVal = cmdMsg->getPlayerIndex();
-	memcpy(buffer + offset, &newVal, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-}
-
-void NetPacket::FillBufferWithKeepAliveCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetKeepAliveCommandMsg *cmdMsg = (NetKeepAliveCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-}
-
-void NetPacket::FillBufferWithDisconnectKeepAliveCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDisconnectKeepAliveCommandMsg *cmdMsg = (NetDisconnectKeepAliveCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-
-	// Put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// Put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	// Put the player ID into the packet.
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-}
-
-void NetPacket::FillBufferWithDisconnectPlayerCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDisconnectPlayerCommandMsg *cmdMsg = (NetDisconnectPlayerCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectPlayerCommand - adding run ahead command"));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-	//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnsignedByte slot = cmdMsg->getDisconnectSlot();
-	memcpy(buffer + offset, &slot, sizeof(slot));
-	offset += sizeof(slot);
-
-	UnsignedInt disconnectFrame = cmdMsg->getDisconnectFrame();
-	memcpy(buffer + offset, &disconnectFrame, sizeof(disconnectFrame));
-	offset += sizeof(disconnectFrame);
-}
-
-void NetPacket::FillBufferWithPacketRouterQueryCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetPacketRouterQueryCommandMsg *cmdMsg = (NetPacketRouterQueryCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addPacketRouterQueryCommand - adding packet router query command"));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-}
-
-void NetPacket::FillBufferWithPacketRouterAckCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetPacketRouterAckCommandMsg *cmdMsg = (NetPacketRouterAckCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addPacketRouterAckCommand - adding packet router query command"));
-
-	// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-}
-
-void NetPacket::FillBufferWithDisconnectChatCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDisconnectChatCommandMsg *cmdMsg = (NetDisconnectChatCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectChatCommand - adding run ahead command"));
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnicodeString unitext = cmdMsg->getText();
-	UnsignedByte length = unitext.getLength();
-	memcpy(buffer + offset, &length, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	memcpy(buffer + offset, unitext.str(), length * sizeof(UnsignedShort));
-	offset += length * sizeof(UnsignedShort);
-}
-
-void NetPacket::FillBufferWithDisconnectVoteCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDisconnectVoteCommandMsg *cmdMsg = (NetDisconnectVoteCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectVoteCommand - adding run ahead command"));
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnsignedByte slot = cmdMsg->getSlot();
-	memcpy(buffer + offset, &slot, sizeof(slot));
-	offset += sizeof(slot);
-
-	UnsignedInt voteFrame = cmdMsg->getVoteFrame();
-	memcpy(buffer + offset, &voteFrame, sizeof(voteFrame));
-	offset += sizeof(voteFrame);
-}
-
-void NetPacket::FillBufferWithChatCommand(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetChatCommandMsg *cmdMsg = (NetChatCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectChatCommand - adding run ahead command"));
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the execution frame into the packet.
-	buffer[offset] = NetPacketFieldTypes::Frame;
-	++offset;
-	UnsignedInt newframe = cmdMsg->getExecutionFrame();
-	memcpy(buffer+offset, &newframe, sizeof(UnsignedInt));
-	offset += sizeof(UnsignedInt);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-	UnicodeString unitext = cmdMsg->getText();
-	UnsignedByte length = unitext.getLength();
-	Int playerMask = cmdMsg->getPlayerMask();
-	memcpy(buffer + offset, &length, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	memcpy(buffer + offset, unitext.str(), length * sizeof(UnsignedShort));
-	offset += length * sizeof(UnsignedShort);
-
-	memcpy(buffer + offset, &playerMask, sizeof(Int));
-	offset += sizeof(Int);
-}
-
-void NetPacket::FillBufferWithProgressMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetProgressCommandMsg *cmdMsg = (NetProgressCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-// Put the player ID into the packet.
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	buffer[offset] = cmdMsg->getPercentage();
-	++offset;
-}
-
-void NetPacket::FillBufferWithLoadCompleteMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetCommandMsg *cmdMsg = (NetCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-}
-
-void NetPacket::FillBufferWithTimeOutGameStartMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetCommandMsg *cmdMsg = (NetCommandMsg *)(msg->getCommand());
-	UnsignedShort offset = 0;
-
-// If necessary, put the NetCommandType into the packet.
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, put the relay into the packet.
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	UnsignedByte newRelay = msg->getRelay();
-	memcpy(buffer+offset, &newRelay, sizeof(UnsignedByte));
-	offset += sizeof(UnsignedByte);
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-// If necessary, specify the command ID of this command.
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(UnsignedShort));
-	offset += sizeof(UnsignedShort);
-
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-}
-
-void NetPacket::FillBufferWithFileMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetFileCommandMsg *cmdMsg = (NetFileCommandMsg *)(msg->getCommand());
-	UnsignedInt offset = 0;
-
-	// command type
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// relay
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	buffer[offset] = msg->getRelay();
-	offset += sizeof(UnsignedByte);
-
-	// player ID
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// command ID
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(newID));
-	offset += sizeof(newID);
-
-	// data
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	AsciiString filename = cmdMsg->getPortableFilename();	// PORTABLE
-	for (Int i = 0; i < filename.getLength(); ++i) {
-		buffer[offset] = filename.getCharAt(i);
-		++offset;
-	}
-	buffer[offset] = 0;
-	++offset;
-
-	UnsignedInt newInt = cmdMsg->getFileLength();
-	memcpy(buffer + offset, &newInt, sizeof(newInt));
-	offset += sizeof(newInt);
-
-	memcpy(buffer + offset, cmdMsg->getFileData(), cmdMsg->getFileLength());
-	offset += cmdMsg->getFileLength();
-}
-
-void NetPacket::FillBufferWithFileAnnounceMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetFileAnnounceCommandMsg *cmdMsg = (NetFileAnnounceCommandMsg *)(msg->getCommand());
-	UnsignedInt offset = 0;
-
-	// command type
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// relay
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	buffer[offset] = msg->getRelay();
-	offset += sizeof(UnsignedByte);
-
-	// player ID
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// command ID
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(newID));
-	offset += sizeof(newID);
-
-	// data
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	AsciiString filename = cmdMsg->getPortableFilename();	// PORTABLE
-	for (Int i = 0; i < filename.getLength(); ++i) {
-		buffer[offset] = filename.getCharAt(i);
-		++offset;
-	}
-	buffer[offset] = 0;
-	++offset;
-
-	UnsignedShort fileID = cmdMsg->getFileID();
-	memcpy(buffer + offset, &fileID, sizeof(fileID));
-	offset += sizeof(fileID);
-
-	UnsignedByte playerMask = cmdMsg->getPlayerMask();
-	memcpy(buffer + offset, &playerMask, sizeof(playerMask));
-	offset += sizeof(playerMask);
-}
-
-void NetPacket::FillBufferWithFileProgressMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetFileProgressCommandMsg *cmdMsg = (NetFileProgressCommandMsg *)(msg->getCommand());
-	UnsignedInt offset = 0;
-
-	// command type
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// relay
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	buffer[offset] = msg->getRelay();
-	offset += sizeof(UnsignedByte);
-
-	// player ID
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// command ID
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(newID));
-	offset += sizeof(newID);
-
-	// data
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	UnsignedShort fileID = cmdMsg->getFileID();
-	memcpy(buffer + offset, &fileID, sizeof(fileID));
-	offset += sizeof(fileID);
-
-	Int progress = cmdMsg->getProgress();
-	memcpy(buffer + offset, &progress, sizeof(progress));
-	offset += sizeof(progress);
-}
-
-void NetPacket::FillBufferWithDisconnectFrameMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDisconnectFrameCommandMsg *cmdMsg = (NetDisconnectFrameCommandMsg *)(msg->getCommand());
-	UnsignedInt offset = 0;
-
-	// command type
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// relay
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	buffer[offset] = msg->getRelay();
-	offset += sizeof(UnsignedByte);
-
-	// player ID
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// command ID
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(newID));
-	offset += sizeof(newID);
-
-	// data
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	UnsignedInt disconnectFrame = cmdMsg->getDisconnectFrame();
-	memcpy(buffer + offset, &disconnectFrame, sizeof(disconnectFrame));
-	offset += sizeof(disconnectFrame);
-}
-
-void NetPacket::FillBufferWithDisconnectScreenOffMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetDisconnectScreenOffCommandMsg *cmdMsg = (NetDisconnectScreenOffCommandMsg *)(msg->getCommand());
-	UnsignedInt offset = 0;
-
-	// command type
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// relay
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	buffer[offset] = msg->getRelay();
-	offset += sizeof(UnsignedByte);
-
-	// player ID
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// command ID
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(newID));
-	offset += sizeof(newID);
-
-	// data
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	UnsignedInt newFrame = cmdMsg->getNewFrame();
-	memcpy(buffer + offset, &newFrame, sizeof(newFrame));
-	offset += sizeof(newFrame);
-}
-
-void NetPacket::FillBufferWithFrameResendRequestMessage(UnsignedByte *buffer, NetCommandRef *msg) {
-	NetFrameResendRequestCommandMsg *cmdMsg = (NetFrameResendRequestCommandMsg *)(msg->getCommand());
-	UnsignedInt offset = 0;
-
-	// command type
-	buffer[offset] = NetPacketFieldTypes::CommandType;
-	++offset;
-	buffer[offset] = cmdMsg->getNetCommandType();
-	offset += sizeof(UnsignedByte);
-
-	// relay
-	buffer[offset] = NetPacketFieldTypes::Relay;
-	++offset;
-	buffer[offset] = msg->getRelay();
-	offset += sizeof(UnsignedByte);
-
-	// player ID
-	buffer[offset] = NetPacketFieldTypes::PlayerId;
-	++offset;
-	buffer[offset] = cmdMsg->getPlayerID();
-	offset += sizeof(UnsignedByte);
-
-	// command ID
-	buffer[offset] = NetPacketFieldTypes::CommandId;
-	++offset;
-	UnsignedShort newID = cmdMsg->getID();
-	memcpy(buffer + offset, &newID, sizeof(newID));
-	offset += sizeof(newID);
-
-	// data
-	buffer[offset] = NetPacketFieldTypes::Data;
-	++offset;
-
-	UnsignedInt frameToResend = cmdMsg->getFrameToResend();
-	memcpy(buffer + offset, &frameToResend, sizeof(frameToResend));
-	offset += sizeof(frameToResend);
-}
-
-
-/**
- * Constructor
- */
-NetPacket::NetPacket() {
-	init();
-}
-
-/**
- * Constructor given raw transport data.
- */
-NetPacket::NetPacket(TransportMessage *msg) {
-	init();
-	m_packetLen = msg->length;
-	memcpy(m_packet, msg->data, MAX_PACKET_SIZE);
-	m_numCommands = -1;
-	m_addr = msg->addr;
-	m_port = msg->port;
-}
-
-/**
- * Destructor
- */
-NetPacket::~NetPacket() {
-	deleteInstance(m_lastCommand);
-	m_lastCommand = NULL;
-}
-
-/**
- * Initialize all the member variable values.
- */
-void NetPacket::init() {
-	m_addr = 0;
-	m_port = 0;
-	m_numCommands = 0;
-	m_packetLen = 0;
-	m_packet[0] = 0;
-
-	m_lastPlayerID = 0;
-	m_lastFrame = 0;
-	m_lastCommandID = 0;
-	m_lastCommandType = 0;
-	m_lastRelay = 0;
-
-	m_lastCommand = NULL;
-}
-
-void NetPacket::reset() {
-	deleteInstance(m_lastCommand);
-	m_lastCommand = NULL;
-
-	init();
-}
-
-/**
- * Set the address to which this packet is to be sent.
- */
-void NetPacket::setAddress(Int addr, Int port) {
-	m_addr = addr;
-	m_port = port;
-}
-
-/**
- * Adds this command to the packet.  Returns false if there wasn't enough room
- * in the packet for this message, true otherwise.
- */
-Bool NetPacket::addCommand(NetCommandRef *msg) {
-	// This is where the fun begins...
-
-	NetCommandMsg *cmdMsg = msg->getCommand();
-
-	if (msg == NULL) {
-		return TRUE; // There was nothing to add, so it was successful.
-	}
-
-	switch(cmdMsg->getNetCommandType())
+		if (m_mode == NETPACKETXFER_SIZE)
+		{
+			m_offset += length;
+			return;
+		}
+		if (!hasRoom(length))
+		{
+			m_failed = TRUE;
+			return;
+		}
+		if (m_mode == NETPACKETXFER_WRITE)
+			memcpy(m_data + m_offset, data, length);
+		else
+			memcpy(data, m_data + m_offset, length);
+		m_offset += length;
+	}
+
+	void xferUnsignedByte(UnsignedByte *value) { xferBytes(value, sizeof(UnsignedByte)); }
+	void xferUnsignedShort(UnsignedShort *value) { xferBytes(value, sizeof(UnsignedShort)); }
+	void xferInt(Int *value) { xferBytes(value, sizeof(Int)); }
+	void xferUnsignedInt(UnsignedInt *value) { xferBytes(value, sizeof(UnsignedInt)); }
+	void xferReal(Real *value) { xferBytes(value, sizeof(Real)); }
+
+	/// Transfers an unsigned value in groups of 7 bits, lowest group first. Values below 128 take a
+	/// single byte.
+	void xferVarUnsignedInt64(UnsignedInt64 *value)
 	{
-		case NETCOMMANDTYPE_GAMECOMMAND:
-			return addGameCommand(msg);
-		case NETCOMMANDTYPE_ACKSTAGE1:
-			return addAckStage1Command(msg);
-		case NETCOMMANDTYPE_ACKSTAGE2:
-			return addAckStage2Command(msg);
-		case NETCOMMANDTYPE_ACKBOTH:
-			return addAckBothCommand(msg);
-		case NETCOMMANDTYPE_FRAMEINFO:
-			return addFrameCommand(msg);
-		case NETCOMMANDTYPE_PLAYERLEAVE:
-			return addPlayerLeaveCommand(msg);
-		case NETCOMMANDTYPE_RUNAHEADMETRICS:
-			return addRunAheadMetricsCommand(msg);
-		case NETCOMMANDTYPE_RUNAHEAD:
-			return addRunAheadCommand(msg);
-		case NETCOMMANDTYPE_DESTROYPLAYER:
-			return addDestroyPlayerCommand(msg);
-		case NETCOMMANDTYPE_KEEPALIVE:
-			return addKeepAliveCommand(msg);
-		case NETCOMMANDTYPE_DISCONNECTKEEPALIVE:
-			return addDisconnectKeepAliveCommand(msg);
-		case NETCOMMANDTYPE_DISCONNECTPLAYER:
-			return addDisconnectPlayerCommand(msg);
-		case NETCOMMANDTYPE_PACKETROUTERQUERY:
-			return addPacketRouterQueryCommand(msg);
-		case NETCOMMANDTYPE_PACKETROUTERACK:
-			return addPacketRouterAckCommand(msg);
-		case NETCOMMANDTYPE_DISCONNECTCHAT:
-			return addDisconnectChatCommand(msg);
-		case NETCOMMANDTYPE_DISCONNECTVOTE:
-			return addDisconnectVoteCommand(msg);
-		case NETCOMMANDTYPE_CHAT:
-			return addChatCommand(msg);
-		case NETCOMMANDTYPE_PROGRESS:
-			return addProgressMessage(msg);
-		case NETCOMMANDTYPE_LOADCOMPLETE:
-			return addLoadCompleteMessage(msg);
-		case NETCOMMANDTYPE_TIMEOUTSTART:
-			return addTimeOutGameStartMessage(msg);
-		case NETCOMMANDTYPE_WRAPPER:
-			return addWrapperCommand(msg);
-		case NETCOMMANDTYPE_FILE:
-			return addFileCommand(msg);
-		case NETCOMMANDTYPE_FILEANNOUNCE:
-			return addFileAnnounceCommand(msg);
-		case NETCOMMANDTYPE_FILEPROGRESS:
-			return addFileProgressCommand(msg);
-		case NETCOMMANDTYPE_DISCONNECTFRAME:
-			return addDisconnectFrameCommand(msg);
-		case NETCOMMANDTYPE_DISCONNECTSCREENOFF:
-			return addDisconnectScreenOffCommand(msg);
-		case NETCOMMANDTYPE_FRAMERESENDREQUEST:
-			return addFrameResendRequestCommand(msg);
-		default:
-			DEBUG_CRASH(("Unknown NETCOMMANDTYPE %d", cmdMsg->getNetCommandType()));
-			break;
-	}
-
-	return TRUE;
-}
-
-/*
-T = Net command type
-F = Execution frame
-P = Player ID
-C = Command ID
-R = Relay
-D = Command Data
-Z = Repeat last command
-*/
-Bool NetPacket::addFrameResendRequestCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForFrameResendRequestMessage(msg)) {
-		NetFrameResendRequestCommandMsg *cmdMsg = (NetFrameResendRequestCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		UnsignedInt frameToResend = cmdMsg->getFrameToResend();
-		memcpy(m_packet + m_packetLen, &frameToResend, sizeof(frameToResend));
-		m_packetLen += sizeof(frameToResend);
-
-		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addFrameResendRequest - added frame resend request command from player %d for frame %d, command id = %d", m_lastPlayerID, frameToResend, m_lastCommandID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForFrameResendRequestMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetFrameResendRequestCommandMsg *cmdMsg = (NetFrameResendRequestCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedInt); // for the frame to be resent
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addDisconnectScreenOffCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForDisconnectScreenOffMessage(msg)) {
-		NetDisconnectScreenOffCommandMsg *cmdMsg = (NetDisconnectScreenOffCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		UnsignedInt newFrame = cmdMsg->getNewFrame();
-		memcpy(m_packet + m_packetLen, &newFrame, sizeof(newFrame));
-		m_packetLen += sizeof(newFrame);
-
-		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectScreenOff - added disconnect screen off command from player %d for frame %d, command id = %d", m_lastPlayerID, newFrame, m_lastCommandID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForDisconnectScreenOffMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetDisconnectScreenOffCommandMsg *cmdMsg = (NetDisconnectScreenOffCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedInt); // for the disconnect frame
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addDisconnectFrameCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForDisconnectFrameMessage(msg)) {
-		NetDisconnectFrameCommandMsg *cmdMsg = (NetDisconnectFrameCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		UnsignedInt disconnectFrame = cmdMsg->getDisconnectFrame();
-		memcpy(m_packet + m_packetLen, &disconnectFrame, sizeof(disconnectFrame));
-		m_packetLen += sizeof(disconnectFrame);
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectFrame - added disconnect frame command from player %d for frame %d, command id = %d", m_lastPlayerID, disconnectFrame, m_lastCommandID));
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForDisconnectFrameMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetDisconnectFrameCommandMsg *cmdMsg = (NetDisconnectFrameCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedInt); // for the disconnect frame
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addFileCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForFileMessage(msg)) {
-		NetFileCommandMsg *cmdMsg = (NetFileCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		AsciiString filename = cmdMsg->getPortableFilename();		// PORTABLE
-		strcpy((char *)(m_packet + m_packetLen), filename.str());
-		m_packetLen += filename.getLength() + 1;
-
-		UnsignedInt fileLength = cmdMsg->getFileLength();
-		memcpy(m_packet + m_packetLen, &fileLength, sizeof(fileLength));
-		m_packetLen += sizeof(fileLength);
-
-		memcpy(m_packet + m_packetLen, cmdMsg->getFileData(), fileLength);
-		m_packetLen += fileLength;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForFileMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetFileCommandMsg *cmdMsg = (NetFileCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedShort);
-	}
-
-	++len; // NetPacketFieldTypes::Data
-	len += cmdMsg->getPortableFilename().getLength() + 1; // PORTABLE filename + the terminating 0
-	len += sizeof(UnsignedInt); // filedata length
-	len += cmdMsg->getFileLength();
-
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-
-	return TRUE;
-}
-
-Bool NetPacket::addFileAnnounceCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForFileAnnounceMessage(msg)) {
-		NetFileAnnounceCommandMsg *cmdMsg = (NetFileAnnounceCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		AsciiString filename = cmdMsg->getPortableFilename();	// PORTABLE
-		strcpy((char *)(m_packet + m_packetLen), filename.str());
-		m_packetLen += filename.getLength() + 1;
-
-		UnsignedShort fileID = cmdMsg->getFileID();
-		memcpy(m_packet + m_packetLen, &fileID, sizeof(fileID));
-		m_packetLen += sizeof(fileID);
-
-		UnsignedByte playerMask = cmdMsg->getPlayerMask();
-		memcpy(m_packet + m_packetLen, &playerMask, sizeof(playerMask));
-		m_packetLen += sizeof(playerMask);
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Adding file announce message for fileID %d, ID %d to packet",
-			cmdMsg->getFileID(), cmdMsg->getID()));
-		return TRUE;
-	}
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("No room to add file announce message to packet"));
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForFileAnnounceMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetFileAnnounceCommandMsg *cmdMsg = (NetFileAnnounceCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedShort);
-	}
-
-	++len; // NetPacketFieldTypes::Data
-	len += cmdMsg->getPortableFilename().getLength() + 1; // PORTABLE filename + the terminating 0
-	len += sizeof(UnsignedShort); // m_fileID
-	len += sizeof(UnsignedByte); // m_playerMask
-
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-
-	return TRUE;
-}
-
-Bool NetPacket::addFileProgressCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForFileProgressMessage(msg)) {
-		NetFileProgressCommandMsg *cmdMsg = (NetFileProgressCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		UnsignedShort fileID = cmdMsg->getFileID();
-		memcpy(m_packet + m_packetLen, &fileID, sizeof(fileID));
-		m_packetLen += sizeof(fileID);
-
-		Int progress = cmdMsg->getProgress();
-		memcpy(m_packet + m_packetLen, &progress, sizeof(progress));
-		m_packetLen += sizeof(progress);
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForFileProgressMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetFileProgressCommandMsg *cmdMsg = (NetFileProgressCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedShort);
-	}
-
-	++len; // NetPacketFieldTypes::Data
-	len += sizeof(UnsignedShort); // m_fileID
-	len += sizeof(Int); // m_progress
-
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-
-	return TRUE;
-}
-
-Bool NetPacket::addWrapperCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForWrapperMessage(msg)) {
-		NetWrapperCommandMsg *cmdMsg = (NetWrapperCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet + m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary put the player ID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		// wrapped command ID
-		UnsignedShort wrappedCommandID = cmdMsg->getWrappedCommandID();
-		memcpy(m_packet + m_packetLen, &wrappedCommandID, sizeof(wrappedCommandID));
-		m_packetLen += sizeof(wrappedCommandID);
-
-		// chunk number
-//		m_packet[m_packetLen] = cmdMsg->getChunkNumber();
-//		++m_packetLen;
-		UnsignedInt chunkNumber = cmdMsg->getChunkNumber();
-		memcpy(m_packet + m_packetLen, &chunkNumber, sizeof(chunkNumber));
-		m_packetLen += sizeof(chunkNumber);
-
-		// number of chunks
-//		m_packet[m_packetLen] = cmdMsg->getNumChunks();
-//		++m_packetLen;
-		UnsignedInt numChunks = cmdMsg->getNumChunks();
-		memcpy(m_packet + m_packetLen, &numChunks, sizeof(numChunks));
-		m_packetLen += sizeof(numChunks);
-
-		// total length of data for all chunks
-		UnsignedInt totalDataLength = cmdMsg->getTotalDataLength();
-		memcpy(m_packet + m_packetLen, &totalDataLength, sizeof(totalDataLength));
-		m_packetLen += sizeof(totalDataLength);
-
-		// data length for this chunk
-		UnsignedInt dataLength = cmdMsg->getDataLength();
-		memcpy(m_packet + m_packetLen, &dataLength, sizeof(dataLength));
-		m_packetLen += sizeof(dataLength);
-
-		// the offset into the data of this chunk
-		UnsignedInt dataOffset = cmdMsg->getDataOffset();
-		memcpy(m_packet + m_packetLen, &dataOffset, sizeof(dataOffset));
-		m_packetLen += sizeof(dataOffset);
-
-		// the data for this chunk
-		UnsignedByte *data = cmdMsg->getData();
-		memcpy(m_packet + m_packetLen, data, dataLength);
-		m_packetLen += dataLength;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForWrapperMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetWrapperCommandMsg *cmdMsg = (NetWrapperCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedShort);
-	}
-
-	++len; // NetPacketFieldTypes::Data
-	len += sizeof(UnsignedShort); // wrapped command ID
-	len += sizeof(UnsignedInt); // chunk number
-	len += sizeof(UnsignedInt); // number of chunks
-	len += sizeof(UnsignedInt); // total data length
-	len += sizeof(UnsignedInt); // data length of this chunk
-	len += sizeof(UnsignedInt); // offset of this chunk
-	len += cmdMsg->getDataLength(); // for the data of this chunk
-
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-
-	return TRUE;
-}
-
-/**
- * Add a TimeOutGameStart  to the packet. Returns true if successful.
- */
-Bool NetPacket::addTimeOutGameStartMessage(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForLoadCompleteMessage(msg)) {
-		NetCommandMsg *cmdMsg = (NetCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Added keep alive command to packet."));
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room in the packet for this command.
- */
-Bool NetPacket::isRoomForTimeOutGameStartMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetCommandMsg *cmdMsg = (NetCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // For the NetPacketFieldTypes::Data
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-
-
-/**
- * Add a Progress command to the packet. Returns true if successful.
- */
-Bool NetPacket::addLoadCompleteMessage(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForLoadCompleteMessage(msg)) {
-		NetCommandMsg *cmdMsg = (NetCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Added keep alive command to packet."));
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room in the packet for this command.
- */
-Bool NetPacket::isRoomForLoadCompleteMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetCommandMsg *cmdMsg = (NetCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // For the NetPacketFieldTypes::Data
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-
-
-
-/**
- * Add a Progress command to the packet. Returns true if successful.
- */
-Bool NetPacket::addProgressMessage(NetCommandRef *msg) {
-	if (isRoomForProgressMessage(msg)) {
-		NetProgressCommandMsg *cmdMsg = (NetProgressCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		m_packet[m_packetLen] = cmdMsg->getPercentage();
-		++m_packetLen;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Added keep alive command to packet."));
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room in the packet for this command.
- */
-Bool NetPacket::isRoomForProgressMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetProgressCommandMsg *cmdMsg = (NetProgressCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // For the NetPacketFieldTypes::Data
-	++len; // percentage
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-
-
-Bool NetPacket::addDisconnectVoteCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectVoteCommand - entering..."));
-	//  need type, player id, relay, command id, slot number
-	if (isRoomForDisconnectVoteMessage(msg)) {
-		NetDisconnectVoteCommandMsg *cmdMsg = (NetDisconnectVoteCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectVoteCommand - adding run ahead command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnsignedByte slot = cmdMsg->getSlot();
-		memcpy(m_packet + m_packetLen, &slot, sizeof(slot));
-		m_packetLen += sizeof(slot);
-
-		UnsignedInt voteFrame = cmdMsg->getVoteFrame();
-		memcpy(m_packet + m_packetLen, &voteFrame, sizeof(voteFrame));
-		m_packetLen += sizeof(voteFrame);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectVoteCommand - added disconnect vote command, player id %d command id %d, voted slot %d", m_lastPlayerID, m_lastCommandID, slot));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room for this player disconnect command in this packet.
- */
-Bool NetPacket::isRoomForDisconnectVoteMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetDisconnectVoteCommandMsg *cmdMsg = (NetDisconnectVoteCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // the NetPacketFieldTypes::Data
-	len += sizeof(UnsignedByte); // slot number
-	len += sizeof(UnsignedInt); // vote frame
-
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addDisconnectChatCommand(NetCommandRef *msg) {
-	// type, player, id, relay, data
-	// data format: 1 byte string length, string (two bytes per character)
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectChatCommand - Entering..."));
-	if (isRoomForDisconnectChatMessage(msg)) {
-		NetDisconnectChatCommandMsg *cmdMsg = (NetDisconnectChatCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectChatCommand - adding run ahead command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnicodeString unitext = cmdMsg->getText();
-		UnsignedByte length = unitext.getLength();
-		memcpy(m_packet + m_packetLen, &length, sizeof(UnsignedByte));
-		m_packetLen += sizeof(UnsignedByte);
-
-		memcpy(m_packet + m_packetLen, unitext.str(), length * sizeof(UnsignedShort));
-		m_packetLen += length * sizeof(UnsignedShort);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added disconnect chat command"));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForDisconnectChatMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetDisconnectChatCommandMsg *cmdMsg = (NetDisconnectChatCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // the NetPacketFieldTypes::Data
-	len += sizeof(UnsignedByte); // string length
-	UnsignedByte textLen = cmdMsg->getText().getLength();
-	len += textLen * sizeof(UnsignedShort);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addChatCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForChatMessage(msg)) {
-		NetChatCommandMsg *cmdMsg = (NetChatCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectChatCommand - adding run ahead command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnicodeString unitext = cmdMsg->getText();
-		UnsignedByte length = unitext.getLength();
-		Int playerMask = cmdMsg->getPlayerMask();
-		memcpy(m_packet + m_packetLen, &length, sizeof(UnsignedByte));
-		m_packetLen += sizeof(UnsignedByte);
-
-		memcpy(m_packet + m_packetLen, unitext.str(), length * sizeof(UnsignedShort));
-		m_packetLen += length * sizeof(UnsignedShort);
-
-		memcpy(m_packet + m_packetLen, &playerMask, sizeof(Int));
-		m_packetLen += sizeof(Int);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added chat command"));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-Bool NetPacket::isRoomForChatMessage(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	Int len = 0;
-	NetChatCommandMsg *cmdMsg = (NetChatCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // the NetPacketFieldTypes::Data
-	len += sizeof(UnsignedByte); // string length
-	UnsignedByte textLen = cmdMsg->getText().getLength();
-	len += textLen * sizeof(UnsignedShort);
-	len += sizeof(Int); // playerMask
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addPacketRouterAckCommand(NetCommandRef *msg) {
-	//  need type, player id, relay, command id, slot number
-	if (isRoomForPacketRouterAckMessage(msg)) {
-		NetPacketRouterAckCommandMsg *cmdMsg = (NetPacketRouterAckCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addPacketRouterAckCommand - adding packet router query command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added packet router ack command, player id %d", m_lastPlayerID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room for this packet router ack command in this packet.
- */
-Bool NetPacket::isRoomForPacketRouterAckMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetPacketRouterAckCommandMsg *cmdMsg = (NetPacketRouterAckCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // the NetPacketFieldTypes::Data
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addPacketRouterQueryCommand(NetCommandRef *msg) {
-	//  need type, player id, relay, command id, slot number
-	if (isRoomForPacketRouterQueryMessage(msg)) {
-		NetPacketRouterQueryCommandMsg *cmdMsg = (NetPacketRouterQueryCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addPacketRouterQueryCommand - adding packet router query command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added packet router query command, player id %d", m_lastPlayerID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room for this packet router query command in this packet.
- */
-Bool NetPacket::isRoomForPacketRouterQueryMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetPacketRouterQueryCommandMsg *cmdMsg = (NetPacketRouterQueryCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // the NetPacketFieldTypes::Data
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::addDisconnectPlayerCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectPlayerCommand - entering..."));
-	//  need type, player id, relay, command id, slot number
-	if (isRoomForDisconnectPlayerMessage(msg)) {
-		NetDisconnectPlayerCommandMsg *cmdMsg = (NetDisconnectPlayerCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectPlayerCommand - adding run ahead command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnsignedByte slot = cmdMsg->getDisconnectSlot();
-		memcpy(m_packet + m_packetLen, &slot, sizeof(slot));
-		m_packetLen += sizeof(slot);
-
-		UnsignedInt disconnectFrame = cmdMsg->getDisconnectFrame();
-		memcpy(m_packet + m_packetLen, &disconnectFrame, sizeof(disconnectFrame));
-		m_packetLen += sizeof(disconnectFrame);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addDisconnectPlayerCommand - added disconnect player command, player id %d command id %d, disconnecting slot %d", m_lastPlayerID, m_lastCommandID, slot));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room for this player disconnect command in this packet.
- */
-Bool NetPacket::isRoomForDisconnectPlayerMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetDisconnectPlayerCommandMsg *cmdMsg = (NetDisconnectPlayerCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // the NetPacketFieldTypes::Data
-	len += sizeof(UnsignedByte); // slot number
-	len += sizeof(UnsignedInt);	// disconnectFrame
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-
-/**
- * Add a keep alive command to the packet. Returns true if successful.
- */
-Bool NetPacket::addDisconnectKeepAliveCommand(NetCommandRef *msg) {
-	if (isRoomForDisconnectKeepAliveMessage(msg)) {
-		NetDisconnectKeepAliveCommandMsg *cmdMsg = (NetDisconnectKeepAliveCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Added keep alive command to packet."));
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room in the packet for this command.
- */
-Bool NetPacket::isRoomForDisconnectKeepAliveMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetDisconnectKeepAliveCommandMsg *cmdMsg = (NetDisconnectKeepAliveCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // For the NetPacketFieldTypes::Data
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-/**
- * Add a keep alive command to the packet. Returns true if successful.
- */
-Bool NetPacket::addKeepAliveCommand(NetCommandRef *msg) {
-	if (isRoomForKeepAliveMessage(msg)) {
-		NetKeepAliveCommandMsg *cmdMsg = (NetKeepAliveCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Added keep alive command to packet."));
-
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room in the packet for this command.
- */
-Bool NetPacket::isRoomForKeepAliveMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetKeepAliveCommandMsg *cmdMsg = (NetKeepAliveCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-
-	++len; // For the NetPacketFieldTypes::Data
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-/**
- * Add a run ahead command to the packet. Returns true if successful.
- */
-Bool NetPacket::addRunAheadCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForRunAheadMessage(msg)) {
-		NetRunAheadCommandMsg *cmdMsg = (NetRunAheadCommandMsg *)(msg->getCommand());
-		//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addRunAheadCommand - adding run ahead command"));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnsignedShort newRunAhead = cmdMsg->getRunAhead();
-		memcpy(m_packet + m_packetLen, &newRunAhead, sizeof(UnsignedShort));
-		m_packetLen += sizeof(UnsignedShort);
-
-		UnsignedByte newFrameRate = cmdMsg->getFrameRate();
-		memcpy(m_packet + m_packetLen, &newFrameRate, sizeof(UnsignedByte));
-		m_packetLen += sizeof(UnsignedByte);
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added run ahead command, frame %d, player id %d command id %d", m_lastFrame, m_lastPlayerID, m_lastCommandID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room for this run ahead command in this packet.
- */
-Bool NetPacket::isRoomForRunAheadMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetRunAheadCommandMsg *cmdMsg = (NetRunAheadCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedShort);
-	len += sizeof(UnsignedByte);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-/**
- * Add a DestroyPlayer command to the packet. Returns true if successful.
- */
-Bool NetPacket::addDestroyPlayerCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForDestroyPlayerMessage(msg)) {
-		NetDestroyPlayerCommandMsg *cmdMsg = (NetDestroyPlayerCommandMsg *)(msg->getCommand());
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnsignedInt newVal = cmdMsg->getPlayerIndex();
-		memcpy(m_packet + m_packetLen, &newVal, sizeof(UnsignedInt));
-		m_packetLen += sizeof(UnsignedInt);
-
-		//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket - added CRC:0x%8.8X info command, frame %d, player id %d command id %d", newCRC, m_lastFrame, m_lastPlayerID, m_lastCommandID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is room for this DestroyPlayer command in this packet.
- */
-Bool NetPacket::isRoomForDestroyPlayerMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetDestroyPlayerCommandMsg *cmdMsg = (NetDestroyPlayerCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedInt);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-/**
- * Add a run ahead metrics command to the packet. Returns true if successful.
- */
-Bool NetPacket::addRunAheadMetricsCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForRunAheadMetricsMessage(msg)) {
-		NetRunAheadMetricsCommandMsg *cmdMsg = (NetRunAheadMetricsCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addRunAheadMetricsCommand - adding run ahead metrics for player %d, fps = %d, latency = %f", cmdMsg->getPlayerID(), cmdMsg->getAverageFps(), cmdMsg->getAverageLatency()));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		// write the average latency
-		Real averageLatency = cmdMsg->getAverageLatency();
-		memcpy(m_packet + m_packetLen, &averageLatency, sizeof(averageLatency));
-		m_packetLen += sizeof(averageLatency);
-		// write the average fps
-		UnsignedShort averageFps = (UnsignedShort)(cmdMsg->getAverageFps());
-		memcpy(m_packet + m_packetLen, &averageFps, sizeof(averageFps));
-		m_packetLen += sizeof(averageFps);
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		++m_numCommands;
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is enough room in the packet to fit this message.
- */
-Bool NetPacket::isRoomForRunAheadMetricsMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetRunAheadMetricsCommandMsg *cmdMsg = (NetRunAheadMetricsCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // NetPacketFieldTypes::Data
-	len += sizeof(UnsignedShort);
-	len += sizeof(Real);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-
-/**
- * Add a player leave command to the packet. Returns true if successful.
- */
-Bool NetPacket::addPlayerLeaveCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isRoomForPlayerLeaveMessage(msg)) {
-		NetPlayerLeaveCommandMsg *cmdMsg = (NetPlayerLeaveCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addPlayerLeaveCommand - adding player leave command for player %d", cmdMsg->getLeavingPlayerID()));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnsignedByte leavingPlayerID = cmdMsg->getLeavingPlayerID();
-		memcpy(m_packet + m_packetLen, &leavingPlayerID, sizeof(UnsignedByte));
-		m_packetLen += sizeof(UnsignedByte);
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		++m_numCommands;
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is enough room in the packet to fit this message.
- */
-Bool NetPacket::isRoomForPlayerLeaveMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetPlayerLeaveCommandMsg *cmdMsg = (NetPlayerLeaveCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedByte);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-/**
- * Add this frame command message. Returns true if successful.
- */
-Bool NetPacket::addFrameCommand(NetCommandRef *msg) {
-	Bool needNewCommandID = FALSE;
-	if (isFrameRepeat(msg)) {
-		if (m_packetLen >= MAX_PACKET_SIZE) {
-			return FALSE;
-		}
-		m_packet[m_packetLen] = 'Z';
-		++m_packetLen;
-		m_lastCommandID = msg->getCommand()->getID();
-		deleteInstance(m_lastCommand);
-		m_lastCommand = newInstance(NetCommandRef)(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		++m_lastFrame;		// need this cause we're actually advancing to the next frame by adding this command.
-		++m_numCommands;
-		// frameinfodebug
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("outgoing - added frame %d, player %d, command count = %d, command id = %d, repeat", m_lastFrame, m_lastPlayerID, 0, m_lastCommandID));
-		return TRUE;
-	}
-	if (isRoomForFrameMessage(msg)) {
-		NetFrameCommandMsg *cmdMsg = (NetFrameCommandMsg *)(msg->getCommand());
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addFrameCommand - adding frame command for frame %d, command count = %d, command id = %d", cmdMsg->getExecutionFrame(), cmdMsg->getCommandCount(), cmdMsg->getID()));
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("relay = %d, ", m_lastRelay));
-
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-			needNewCommandID = TRUE;
-		}
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("player = %d", m_lastPlayerID));
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command id = %d", m_lastCommandID));
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		UnsignedShort cmdCount = cmdMsg->getCommandCount();
-		memcpy(m_packet + m_packetLen, &cmdCount, sizeof(UnsignedShort));
-		m_packetLen += sizeof(UnsignedShort);
-
-		// frameinfodebug
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("outgoing - added frame %d, player %d, command count = %d, command id = %d", cmdMsg->getExecutionFrame(), cmdMsg->getPlayerID(), cmdMsg->getCommandCount(), cmdMsg->getID()));
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		++m_numCommands;
-		return TRUE;
-	}
-	return FALSE;
-}
-
-/**
- * Returns true if there is enough room in this packet for this frame message.
- */
-Bool NetPacket::isRoomForFrameMessage(NetCommandRef *msg) {
-	Int len = 0;
-	Bool needNewCommandID = FALSE;
-	NetFrameCommandMsg *cmdMsg = (NetFrameCommandMsg *)(msg->getCommand());
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		len += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		len += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		len += sizeof(UnsignedShort) + sizeof(UnsignedByte);
-	}
-
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedShort);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-Bool NetPacket::isFrameRepeat(NetCommandRef *msg) {
-	if (m_lastCommand == NULL) {
-		return FALSE;
-	}
-	if (m_lastCommand->getCommand()->getNetCommandType() != NETCOMMANDTYPE_FRAMEINFO) {
-		return FALSE;
-	}
-	NetFrameCommandMsg *framemsg = (NetFrameCommandMsg *)(msg->getCommand());
-	NetFrameCommandMsg *lastmsg = (NetFrameCommandMsg *)(m_lastCommand->getCommand());
-	if (framemsg->getCommandCount() != 0) {
-		return FALSE;
-	}
-	if (framemsg->getExecutionFrame() != (lastmsg->getExecutionFrame() + 1)) {
-		return FALSE;
-	}
-	if (msg->getRelay() != m_lastCommand->getRelay()) {
-		return FALSE;
-	}
-	if (framemsg->getID() != (lastmsg->getID() + 1)) {
-		return FALSE;
-	}
-	return TRUE;
-}
-
-/**
- * Add an ack "both" command.
- */
-Bool NetPacket::addAckBothCommand(NetCommandRef *msg) {
-	NetAckBothCommandMsg *ackmsg = (NetAckBothCommandMsg *)(msg->getCommand());
-	return addAckCommand(msg, ackmsg->getCommandID(), ackmsg->getOriginalPlayerID());
-}
-
-/**
- * Add an ack stage 1 command.
- */
-Bool NetPacket::addAckStage1Command(NetCommandRef *msg) {
-	NetAckStage1CommandMsg *ackmsg = (NetAckStage1CommandMsg *)(msg->getCommand());
-	return addAckCommand(msg, ackmsg->getCommandID(), ackmsg->getOriginalPlayerID());
-}
-
-/**
- * Add an ack stage 2 command.
- */
-Bool NetPacket::addAckStage2Command(NetCommandRef *msg) {
-	NetAckStage2CommandMsg *ackmsg = (NetAckStage2CommandMsg *)(msg->getCommand());
-	return addAckCommand(msg, ackmsg->getCommandID(), ackmsg->getOriginalPlayerID());
-}
-
-/**
- * Add this ack command to the packet.  Returns true if successful.
- */
-Bool NetPacket::addAckCommand(NetCommandRef *msg, UnsignedShort commandID, UnsignedByte originalPlayerID) {
-	if (isAckRepeat(msg)) {
-		if (m_packetLen >= MAX_PACKET_SIZE) {
-			return FALSE;
-		}
-		m_packet[m_packetLen] = 'Z';
-		++m_packetLen;
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-		return TRUE;
-	}
-	if (isRoomForAckMessage(msg)) {
-		NetCommandMsg *cmdMsg = msg->getCommand();
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addAckCommand - adding ack for command %d for player %d", cmdMsg->getCommandID(), msg->getCommand()->getPlayerID()));
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
+		if (m_mode != NETPACKETXFER_READ)
+		{
+			UnsignedInt64 remaining = *value;
+			do
+			{
+				UnsignedByte group = (UnsignedByte)(remaining & 0x7f);
+				remaining >>= 7;
+				if (remaining != 0)
+					group |= 0x80;
+				xferUnsignedByte(&group);
+			} while (remaining != 0);
+			return;
+		}
+		UnsignedInt64 result = 0;
+		for (Int shift = 0; shift < 64; shift += 7)
+		{
+			UnsignedByte group = 0;
+			xferUnsignedByte(&group);
+			if (m_failed)
+				return;
+			result |= (UnsignedInt64)(group & 0x7f) << shift;
+			if ((group & 0x80) == 0)
+			{
+				*value = result;
+				return;
+			}
 		}
+		m_failed = TRUE;
+	}
 
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
+	void xferVarUnsignedInt(UnsignedInt *value)
+	{
+		UnsignedInt64 wide = (m_mode != NETPACKETXFER_READ) ? *value : 0;
+		xferVarUnsignedInt64(&wide);
+		if (m_mode != NETPACKETXFER_READ || m_failed)
+			return;
+		if (wide > 0xffffffffu)
+			m_failed = TRUE;
+		else
+			*value = (UnsignedInt)wide;
+	}
+
+	/// Transfers a signed value with the sign in the lowest bit, so that values near zero are short.
+	void xferVarInt(Int *value)
+	{
+		UnsignedInt zigzag = 0;
+		if (m_mode != NETPACKETXFER_READ)
+			zigzag = ((UnsignedInt)*value << 1) ^ (UnsignedInt)(*value >> 31);
+		xferVarUnsignedInt(&zigzag);
+		if (m_mode == NETPACKETXFER_READ)
+			*value = (Int)((zigzag >> 1) ^ (0u - (zigzag & 1)));
+	}
 
-			m_lastPlayerID = cmdMsg->getPlayerID();
+	/// Transfers a block of bytes. When reading, the block is not copied and the returned pointer
+	/// points into the packet, or is NULL if the packet is too short.
+	UnsignedByte * xferBlock(UnsignedByte *block, UnsignedInt length)
+	{
+		if (m_mode != NETPACKETXFER_READ)
+		{
+			xferBytes(block, length);
+			return block;
 		}
-
-		// Put in the command id of the command we are acking.
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-		memcpy(m_packet + m_packetLen, &commandID, sizeof(UnsignedShort));
-		m_packetLen += sizeof(UnsignedShort);
-		memcpy(m_packet + m_packetLen, &originalPlayerID, sizeof(UnsignedByte));
-		m_packetLen += sizeof(UnsignedByte);
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("outgoing - added ACK, original player %d, command id %d", origPlayerID, cmdID));
-		++m_numCommands;
-		return TRUE;
+		if (!hasRoom(length))
+		{
+			m_failed = TRUE;
+			return NULL;
+		}
+		UnsignedByte *result = m_data + m_offset;
+		m_offset += length;
+		return result;
 	}
-	return FALSE;
-}
 
-/**
- * Returns true if there is enough room in the packet for this ack message.
- */
-Bool NetPacket::isRoomForAckMessage(NetCommandRef *msg) {
-	Int len = 0;
-	NetCommandMsg *cmdMsg = msg->getCommand();
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		++len;
-		len += sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		++len;
-		len += sizeof(UnsignedByte);
+	/// Transfers a NUL terminated string. Strings that are read are cut to maxLength characters.
+	void xferAsciiString(AsciiString &str, Int maxLength)
+	{
+		if (m_mode != NETPACKETXFER_READ)
+		{
+			xferBytes((void *)str.str(), str.getLength() + 1);
+			return;
+		}
+		const UnsignedByte *terminator = m_failed ? NULL : (const UnsignedByte *)memchr(m_data + m_offset, 0, m_length - m_offset);
+		if (terminator == NULL)
+		{
+			m_failed = TRUE;
+			return;
+		}
+		const Int length = (Int)(terminator - (m_data + m_offset));
+		str.set((const char *)(m_data + m_offset), (length < maxLength) ? length : maxLength);
+		m_offset += length + 1;
 	}
 
-	++len; // for NetPacketFieldTypes::Data
-	len += sizeof(UnsignedShort);
-	len += sizeof(UnsignedByte);
-	if ((len + m_packetLen) > MAX_PACKET_SIZE) {
-		return FALSE;
-	}
-	return TRUE;
+	/// Transfers a text of at most 255 characters with a leading length byte.
+	void xferUnicodeText(UnicodeString &text)
+	{
+		if (m_mode != NETPACKETXFER_READ)
+		{
+			UnsignedByte length = (UnsignedByte)text.getLength();
+			xferUnsignedByte(&length);
+			xferBytes((void *)text.str(), length * sizeof(WideChar));
+			return;
+		}
+		WideChar buffer[256];
+		UnsignedByte length = 0;
+		xferUnsignedByte(&length);
+		xferBytes(buffer, length * sizeof(WideChar));
+		if (m_failed)
+			return;
+		buffer[length] = 0;
+		text.set(buffer);
+	}
+
+private:
+
+	Bool hasRoom(UnsignedInt length) const { return !m_failed && m_offset <= m_length && length <= m_length - m_offset; }
+
+	UnsignedByte *m_data;
+	UnsignedInt m_offset;
+	UnsignedInt m_length;
+	NetPacketXferMode m_mode;
+	Bool m_failed;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** The values of the header fields of a command. */
+//-------------------------------------------------------------------------------------------------
+struct NetCommandHeader
+{
+	UnsignedInt m_frame;
+	UnsignedShort m_commandID;
+	UnsignedByte m_commandType;
+	UnsignedByte m_playerID;
+	UnsignedByte m_relay;
+};
+
+static NetCommandHeader makeNetCommandHeader(NetCommandMsg *msg, UnsignedByte relay)
+{
+	NetCommandHeader header;
+	header.m_frame = msg->getExecutionFrame();
+	header.m_commandID = msg->getID();
+	header.m_commandType = (UnsignedByte)msg->getNetCommandType();
+	header.m_playerID = (UnsignedByte)msg->getPlayerID();
+	header.m_relay = relay;
+	return header;
 }
 
-Bool NetPacket::isAckRepeat(NetCommandRef *msg) {
-	if (m_lastCommand == NULL) {
-		return FALSE;
-	}
-	if (m_lastCommand->getCommand()->getNetCommandType() != msg->getCommand()->getNetCommandType()) {
-		return FALSE;
-	}
-	if (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_ACKBOTH) {
-		return isAckBothRepeat(msg);
-	}
-	if (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_ACKSTAGE1) {
-		return isAckStage1Repeat(msg);
-	}
-	if (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_ACKSTAGE2) {
-		return isAckStage2Repeat(msg);
+/**
+ * Transfers the value of a single header field. Returns false if the field is not a header field.
+ */
+static Bool xferHeaderField(NetPacketXfer &xfer, NetPacketFieldType field, NetCommandHeader &header)
+{
+	switch (field)
+	{
+		case NetPacketFieldTypes::CommandType:
+			xfer.xferUnsignedByte(&header.m_commandType);
+			return TRUE;
+		case NetPacketFieldTypes::Frame:
+			xfer.xferUnsignedInt(&header.m_frame);
+			return TRUE;
+		case NetPacketFieldTypes::Relay:
+			xfer.xferUnsignedByte(&header.m_relay);
+			return TRUE;
+		case NetPacketFieldTypes::PlayerId:
+			xfer.xferUnsignedByte(&header.m_playerID);
+			return TRUE;
+		case NetPacketFieldTypes::CommandId:
+			xfer.xferUnsignedShort(&header.m_commandID);
+			return TRUE;
 	}
 	return FALSE;
 }
 
-Bool NetPacket::isAckBothRepeat(NetCommandRef *msg) {
-	NetAckBothCommandMsg *ack = (NetAckBothCommandMsg *)(msg->getCommand());
-	NetAckBothCommandMsg *lastAck = (NetAckBothCommandMsg *)(m_lastCommand->getCommand());
-	if (lastAck->getCommandID() != (ack->getCommandID() - 1)) {
-		return FALSE;
-	}
-	if (lastAck->getOriginalPlayerID() != ack->getOriginalPlayerID()) {
-		return FALSE;
-	}
-	if (msg->getRelay() != m_lastCommand->getRelay()) {
-		return FALSE;
-	}
-	return TRUE;
+static void xferFieldType(NetPacketXfer &xfer, NetPacketFieldType field)
+{
+	xfer.xferUnsignedByte(&field);
 }
 
-Bool NetPacket::isAckStage1Repeat(NetCommandRef *msg) {
-	NetAckStage2CommandMsg *ack = (NetAckStage2CommandMsg *)(msg->getCommand());
-	NetAckStage2CommandMsg *lastAck = (NetAckStage2CommandMsg *)(m_lastCommand->getCommand());
-	if (lastAck->getCommandID() != (ack->getCommandID() - 1)) {
-		return FALSE;
-	}
-	if (lastAck->getOriginalPlayerID() != ack->getOriginalPlayerID()) {
-		return FALSE;
-	}
-	if (msg->getRelay() != m_lastCommand->getRelay()) {
-		return FALSE;
-	}
-	return TRUE;
-}
+// TheSuperHackers @fix The compact encoding is announced with a keep alive command at the end of the
+// packet. Its frame holds this tag in the upper bytes and the NetPacket::CompactSupport in the lowest
+// byte. The original game reads a keep alive command and drops it, where an unknown byte would make
+// its debug builds assert. No real frame reaches the tag.
+static const UnsignedInt CompactSupportFrameTag = 0x5c0a7700;
+static const UnsignedInt CompactSupportFrameTagMask = 0xffffff00;
 
-Bool NetPacket::isAckStage2Repeat(NetCommandRef *msg) {
-	NetAckStage2CommandMsg *ack = (NetAckStage2CommandMsg *)(msg->getCommand());
-	NetAckStage2CommandMsg *lastAck = (NetAckStage2CommandMsg *)(m_lastCommand->getCommand());
-	if (lastAck->getCommandID() != (ack->getCommandID() - 1)) {
-		return FALSE;
-	}
-	if (lastAck->getOriginalPlayerID() != ack->getOriginalPlayerID()) {
-		return FALSE;
-	}
-	if (msg->getRelay() != m_lastCommand->getRelay()) {
-		return FALSE;
+//-------------------------------------------------------------------------------------------------
+// Command data. Each function transfers the data of one command type in both directions. When
+// reading, msg is NULL and the function creates the command.
+//-------------------------------------------------------------------------------------------------
+
+typedef NetCommandMsg * (*NetCommandDataXferFunc)(NetPacketXfer &xfer, NetCommandMsg *msg);
+
+/**
+ * Transfers a single argument. An argument of an unknown data type has no data on the wire, like in
+ * the original packet code, so it is skipped and the rest of the command stays readable. Returns false
+ * for such an argument.
+ */
+static Bool xferGameMessageArgument(NetPacketXfer &xfer, GameMessageArgumentDataType type, GameMessageArgumentType &arg)
+{
+	switch (type)
+	{
+		case ARGUMENTDATATYPE_INTEGER:			xfer.xferBytes(&arg.integer, sizeof(arg.integer)); break;
+		case ARGUMENTDATATYPE_REAL:					xfer.xferBytes(&arg.real, sizeof(arg.real)); break;
+		case ARGUMENTDATATYPE_BOOLEAN:			xfer.xferBytes(&arg.boolean, sizeof(arg.boolean)); break;
+		case ARGUMENTDATATYPE_OBJECTID:			xfer.xferBytes(&arg.objectID, sizeof(arg.objectID)); break;
+		case ARGUMENTDATATYPE_DRAWABLEID:		xfer.xferBytes(&arg.drawableID, sizeof(arg.drawableID)); break;
+		case ARGUMENTDATATYPE_TEAMID:				xfer.xferBytes(&arg.teamID, sizeof(arg.teamID)); break;
+		case ARGUMENTDATATYPE_LOCATION:			xfer.xferBytes(&arg.location, sizeof(arg.location)); break;
+		case ARGUMENTDATATYPE_PIXEL:				xfer.xferBytes(&arg.pixel, sizeof(arg.pixel)); break;
+		case ARGUMENTDATATYPE_PIXELREGION:	xfer.xferBytes(&arg.pixelRegion, sizeof(arg.pixelRegion)); break;
+		case ARGUMENTDATATYPE_TIMESTAMP:		xfer.xferBytes(&arg.timestamp, sizeof(arg.timestamp)); break;
+		case ARGUMENTDATATYPE_WIDECHAR:			xfer.xferBytes(&arg.wChar, sizeof(arg.wChar)); break;
+		default:
+			DEBUG_ASSERTCRASH(xfer.isReading(), ("Unknown game message argument data type %d", type));
+			return FALSE;
 	}
 	return TRUE;
 }
 
 /**
- * Adds this game command to the packet.  Returns true if successful.
+ * The running values of a game command in the compact encoding. They start at the values of the
+ * command that it refers to.
  */
-Bool NetPacket::addGameCommand(NetCommandRef *msg) {
-	Bool retval = FALSE;
-	NetGameCommandMsg *cmdMsg = (NetGameCommandMsg *)(msg->getCommand());
-	// get the game message from the NetCommandMsg
-	GameMessage *gmsg = cmdMsg->constructGameMessage();
-
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addGameCommand for command ID %d", cmdMsg->getID()));
-
-	if (isRoomForGameMessage(msg, gmsg)) {
-		// Now we know there is enough room, put the new game message into the packet.
-
-		Bool needNewCommandID = FALSE; // this is to allow us to force the starting command ID to be respecified with this command.
-
-		// If necessary, put the NetCommandType into the packet.
-		if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandType;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getNetCommandType();
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastCommandType = cmdMsg->getNetCommandType();
-		}
-
-		// If necessary, put the execution frame into the packet.
-		if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Frame;
-			++m_packetLen;
-			UnsignedInt newframe = cmdMsg->getExecutionFrame();
-			memcpy(m_packet+m_packetLen, &newframe, sizeof(UnsignedInt));
-			m_packetLen += sizeof(UnsignedInt);
-
-			m_lastFrame = newframe;
-		}
-
-		// If necessary, put the relay into the packet.
-		if (m_lastRelay != msg->getRelay()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::Relay;
-			++m_packetLen;
-			UnsignedByte newRelay = msg->getRelay();
-			memcpy(m_packet+m_packetLen, &newRelay, sizeof(UnsignedByte));
-			m_packetLen += sizeof(UnsignedByte);
-
-			m_lastRelay = newRelay;
-		}
-
-		// If necessary, put the playerID into the packet.
-		if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::PlayerId;
-			++m_packetLen;
-			m_packet[m_packetLen] = cmdMsg->getPlayerID();
-			m_packetLen += sizeof(UnsignedByte);
-			//since if we have a new player we need to respecify the starting command ID, lets force the command id to be different.
-			needNewCommandID = TRUE;
-
-			m_lastPlayerID = cmdMsg->getPlayerID();
-		}
-
-		// If necessary, specify the command ID of this command.
-		if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-			m_packet[m_packetLen] = NetPacketFieldTypes::CommandId;
-			++m_packetLen;
-			UnsignedShort newID = cmdMsg->getID();
-			memcpy(m_packet + m_packetLen, &newID, sizeof(UnsignedShort));
-			m_packetLen += sizeof(UnsignedShort);
-		}
-		m_lastCommandID = cmdMsg->getID();
-
-		m_packet[m_packetLen] = NetPacketFieldTypes::Data;
-		++m_packetLen;
-
-		// Now copy the GameMessage type into the packet.
-		GameMessage::Type newType = gmsg->getType();
-		memcpy(m_packet + m_packetLen, &newType, sizeof(GameMessage::Type));
-		m_packetLen += sizeof(GameMessage::Type);
-
-
-		GameMessageParser *parser = newInstance(GameMessageParser)(gmsg);
-		UnsignedByte numTypes = parser->getNumTypes();
-		memcpy(m_packet + m_packetLen, &numTypes, sizeof(numTypes));
-		m_packetLen += sizeof(numTypes);
-
-		GameMessageParserArgumentType *argType = parser->getFirstArgumentType();
-		while (argType != NULL) {
-			UnsignedByte type = (UnsignedByte)(argType->getType());
-			memcpy(m_packet + m_packetLen, &type, sizeof(type));
-			m_packetLen += sizeof(type);
-
-			UnsignedByte argTypeCount = argType->getArgCount();
-			memcpy(m_packet + m_packetLen, &argTypeCount, sizeof(argTypeCount));
-			m_packetLen += sizeof(argTypeCount);
-
-			argType = argType->getNext();
-		}
-
-		Int numArgs = gmsg->getArgumentCount();
-		for (Int i = 0; i < numArgs; ++i) {
-			GameMessageArgumentDataType type = gmsg->getArgumentDataType(i);
-			GameMessageArgumentType arg = *(gmsg->getArgument(i));
-			writeGameMessageArgumentToPacket(type, arg);
+struct CompactGameCommandState
+{
+	void init(const NetGameCommandDictionary::Entry *reference)
+	{
+		m_reference = reference;
+		m_unresolved = FALSE;
+		m_objectID = INVALID_ID;
+		m_location.zero();
+		if (reference != NULL)
+		{
+			if (reference->m_numObjectIDs > 0)
+				m_objectID = reference->m_objectIDs[reference->m_numObjectIDs - 1];
+			m_location = reference->m_location;
 		}
-
-		deleteInstance(parser);
-		parser = NULL;
-
-//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::addGameMessage - added game message, frame %d, player %d, command ID %d", m_lastFrame, m_lastPlayerID, m_lastCommandID));
-
-		++m_numCommands;
-
-		deleteInstance(m_lastCommand);
-		m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
-		m_lastCommand->setRelay(msg->getRelay());
-
-		retval = TRUE;
 	}
 
-	deleteInstance(gmsg);
-	gmsg = NULL;
-
-	return retval;
-}
-
-void NetPacket::writeGameMessageArgumentToPacket(GameMessageArgumentDataType type, GameMessageArgumentType arg) {
-
-	switch(type) {
-
-	case ARGUMENTDATATYPE_INTEGER:
-		memcpy(m_packet + m_packetLen, &(arg.integer), sizeof(arg.integer));
-		m_packetLen += sizeof(arg.integer);
-		break;
-	case ARGUMENTDATATYPE_REAL:
-		memcpy(m_packet + m_packetLen, &(arg.real), sizeof(arg.real));
-		m_packetLen += sizeof(arg.real);
-		break;
-	case ARGUMENTDATATYPE_BOOLEAN:
-		memcpy(m_packet + m_packetLen, &(arg.boolean), sizeof(arg.boolean));
-		m_packetLen += sizeof(arg.boolean);
-		break;
-	case ARGUMENTDATATYPE_OBJECTID:
-		memcpy(m_packet + m_packetLen, &(arg.objectID), sizeof(arg.objectID));
-		m_packetLen += sizeof(arg.objectID);
-		break;
-	case ARGUMENTDATATYPE_DRAWABLEID:
-		memcpy(m_packet + m_packetLen, &(arg.drawableID), sizeof(arg.drawableID));
-		m_packetLen += sizeof(arg.drawableID);
-		break;
-	case ARGUMENTDATATYPE_TEAMID:
-		memcpy(m_packet + m_packetLen, &(arg.teamID), sizeof(arg.teamID));
-		m_packetLen += sizeof(arg.teamID);
-		break;
-	case ARGUMENTDATATYPE_LOCATION:
-		memcpy(m_packet + m_packetLen, &(arg.location), sizeof(arg.location));
-		m_packetLen += sizeof(arg.location);
-		break;
-	case ARGUMENTDATATYPE_PIXEL:
-		memcpy(m_packet + m_packetLen, &(arg.pixel), sizeof(arg.pixel));
-		m_packetLen += sizeof(arg.pixel);
-		break;
-	case ARGUMENTDATATYPE_PIXELREGION:
-		memcpy(m_packet + m_packetLen, &(arg.pixelRegion), sizeof(arg.pixelRegion));
-		m_packetLen += sizeof(arg.pixelRegion);
-		break;
-	case ARGUMENTDATATYPE_TIMESTAMP:
-		memcpy(m_packet + m_packetLen, &(arg.timestamp), sizeof(arg.timestamp));
-		m_packetLen += sizeof(arg.timestamp);
-		break;
-	case ARGUMENTDATATYPE_WIDECHAR:
-		memcpy(m_packet + m_packetLen, &(arg.wChar), sizeof(arg.wChar));
-		m_packetLen += sizeof(arg.wChar);
-		break;
+	const NetGameCommandDictionary::Entry *m_reference;
+	Bool m_unresolved;			///< The command refers to a command that the receiver does not have
+	ObjectID m_objectID;
+	Coord3D m_location;
+};
 
-	}
-}
+enum { NoGameCommandReference = 0xff };
 
 /**
- * Returns true if there is enough room in this packet for this message.
+ * Transfers the command that a game command in the compact encoding refers to, as its player and the
+ * distance of its command ID. When reading, the command is looked up in the dictionary.
  */
-Bool NetPacket::isRoomForGameMessage(NetCommandRef *msg, GameMessage *gmsg) {
-	// Calculate how much space the NetCommandMsg will take in this packet.
-	Int msglen = 0;
-
-	NetGameCommandMsg *cmdMsg = (NetGameCommandMsg *)(msg->getCommand());
-
-	Bool needNewCommandID = FALSE;
-
-	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
-		msglen += sizeof(UnsignedInt) + sizeof(UnsignedByte);
-	}
-	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
-		msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-		needNewCommandID = TRUE;
-	}
-	if (m_lastRelay != msg->getRelay()) {
-		msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
-		msglen += sizeof(UnsignedByte) + sizeof(UnsignedByte);
-	}
-	if (((m_lastCommandID + 1) != (UnsignedShort)(cmdMsg->getID())) || (needNewCommandID == TRUE)) {
-		msglen += sizeof(UnsignedShort) + sizeof(UnsignedByte);
+static void xferGameCommandReference(NetPacketXfer &xfer, UnsignedShort commandID, CompactGameCommandState &state,
+	const NetGameCommandDictionary *dictionary)
+{
+	const NetGameCommandDictionary::Entry *reference = state.m_reference;
+	UnsignedByte playerID = (reference != NULL) ? reference->m_playerID : (UnsignedByte)NoGameCommandReference;
+	xfer.xferUnsignedByte(&playerID);
+	if (playerID == NoGameCommandReference)
+	{
+		state.init(NULL);
+		return;
 	}
 
-	GameMessageParser *parser = newInstance(GameMessageParser)(gmsg);
-
-	++msglen; // for NetPacketFieldTypes::Data
-	msglen += sizeof(GameMessage::Type);
-	msglen += sizeof(UnsignedByte);
-//	Int numTypes = parser->getNumTypes();
-	GameMessageParserArgumentType *arg = parser->getFirstArgumentType();
-	while (arg != NULL) {
-		msglen += 2 * sizeof(UnsignedByte); // for the type and number of args of that type declaration.
-		GameMessageArgumentDataType type = arg->getType();
+	UnsignedInt distance = (reference != NULL) ? (UnsignedShort)(commandID - reference->m_commandID) : 0;
+	xfer.xferVarUnsignedInt(&distance);
+	if (!xfer.isReading() || xfer.hasFailed())
+		return;
 
-		switch (type) {
+	reference = (dictionary != NULL) ? dictionary->find((UnsignedShort)(commandID - distance), playerID) : NULL;
+	state.init(reference);
+	state.m_unresolved = (reference == NULL);
+}
 
+/**
+ * Transfers an argument in the compact encoding. Integers are written with a variable length. An
+ * object ID is written as its index in the referred command, or as the difference to the previous
+ * object ID, with the lowest bit telling which. A location is written only with the coordinates that
+ * differ from the previous location. Nothing is rounded, so the arguments arrive exactly as they were
+ * sent.
+ *
+ * TheSuperHackers @info Quantised position deltas are deliberately not used. Every machine executes the
+ * game commands in lockstep, so a location that arrives rounded would move the units of the receiver to
+ * another place than those of the sender and the game would mismatch.
+ */
+static Bool xferCompactGameMessageArgument(NetPacketXfer &xfer, GameMessageArgumentDataType type, GameMessageArgumentType &arg,
+	CompactGameCommandState &state)
+{
+	switch (type)
+	{
 		case ARGUMENTDATATYPE_INTEGER:
-			msglen += arg->getArgCount() * sizeof(Int);
-			break;
-		case ARGUMENTDATATYPE_REAL:
-			msglen += arg->getArgCount() * sizeof(Real);
-			break;
-		case ARGUMENTDATATYPE_BOOLEAN:
-			msglen += arg->getArgCount() * sizeof(Bool);
+			xfer.xferVarInt(&arg.integer);
 			break;
+
 		case ARGUMENTDATATYPE_OBJECTID:
-			msglen += arg->getArgCount() * sizeof(ObjectID);
+		{
+			const NetGameCommandDictionary::Entry *reference = state.m_reference;
+			UnsignedInt64 code = 0;
+			if (!xfer.isReading())
+			{
+				Int index = -1;
+				for (Int i = 0; reference != NULL && i < reference->m_numObjectIDs; ++i)
+				{
+					if (reference->m_objectIDs[i] == arg.objectID)
+					{
+						index = i;
+						break;
+					}
+				}
+				if (index >= 0)
+				{
+					code = ((UnsignedInt64)index << 1) | 1;
+				}
+				else
+				{
+					const Int delta = (Int)((UnsignedInt)arg.objectID - (UnsignedInt)state.m_objectID);
+					const UnsignedInt zigzag = ((UnsignedInt)delta << 1) ^ (UnsignedInt)(delta >> 31);
+					code = (UnsignedInt64)zigzag << 1;
+				}
+			}
+			xfer.xferVarUnsignedInt64(&code);
+			if (xfer.hasFailed())
+				break;
+			if (xfer.isReading())
+			{
+				if (code & 1)
+				{
+					const UnsignedInt64 index = code >> 1;
+					if (state.m_unresolved)
+						arg.objectID = INVALID_ID; // the command is dropped anyway
+					else if (reference != NULL && index < reference->m_numObjectIDs)
+						arg.objectID = reference->m_objectIDs[index];
+					else
+						xfer.setFailed();
+				}
+				else if ((code >> 1) > 0xffffffffu)
+				{
+					xfer.setFailed();
+				}
+				else
+				{
+					const UnsignedInt zigzag = (UnsignedInt)(code >> 1);
+					const UnsignedInt delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+					arg.objectID = (ObjectID)((UnsignedInt)state.m_objectID + delta);
+				}
+			}
+			state.m_objectID = arg.objectID;
 			break;
+		}
+
 		case ARGUMENTDATATYPE_DRAWABLEID:
-			msglen += arg->getArgCount() * sizeof(DrawableID);
-			break;
-		case ARGUMENTDATATYPE_TEAMID:
-			msglen += arg->getArgCount() * sizeof(UnsignedInt);
+		{
+			UnsignedInt id = xfer.isReading() ? 0 : (UnsignedInt)arg.drawableID;
+			xfer.xferVarUnsignedInt(&id);
+			arg.drawableID = (DrawableID)id;
 			break;
+		}
+
 		case ARGUMENTDATATYPE_LOCATION:
-			msglen += arg->getArgCount() * sizeof(Coord3D);
-			break;
-		case ARGUMENTDATATYPE_PIXEL:
-			msglen += arg->getArgCount() * sizeof(ICoord2D);
-			break;
-		case ARGUMENTDATATYPE_PIXELREGION:
-			msglen += arg->getArgCount() * sizeof(IRegion2D);
-			break;
-		case ARGUMENTDATATYPE_TIMESTAMP:
-			msglen += arg->getArgCount() * sizeof(UnsignedInt);
-			break;
-		case ARGUMENTDATATYPE_WIDECHAR:
-			msglen += arg->getArgCount() * sizeof(WideChar);
+		{
+			Real *coords[3] = { &arg.location.x, &arg.location.y, &arg.location.z };
+			Real *lastCoords[3] = { &state.m_location.x, &state.m_location.y, &state.m_location.z };
+			UnsignedByte changed = 0;
+			Int i;
+			if (!xfer.isReading())
+			{
+				// compare the bits, so that -0 and 0 are told apart like the game would see them
+				for (i = 0; i < 3; ++i)
+					if (memcmp(coords[i], lastCoords[i], sizeof(Real)) != 0)
+						changed |= (1 << i);
+			}
+			xfer.xferUnsignedByte(&changed);
+			if (changed > 7)
+			{
+				xfer.setFailed();
+				break;
+			}
+			for (i = 0; i < 3; ++i)
+			{
+				if (changed & (1 << i))
+					xfer.xferReal(coords[i]);
+				else if (xfer.isReading())
+					*coords[i] = *lastCoords[i];
+			}
+			state.m_location = arg.location;
 			break;
-
 		}
 
-		arg = arg->getNext();
-
-	}
-
-	deleteInstance(parser);
-	parser = NULL;
-
-	// Is there enough room in the packet for this message?
-	if (msglen > (MAX_PACKET_SIZE - m_packetLen)) {
-		return FALSE; // there isn't enough room in this packet for this new message.
+		default:
+			return xferGameMessageArgument(xfer, type, arg);
 	}
 	return TRUE;
 }
 
 /**
- * Returns the list of commands that are in this packet.
+ * The game message type is followed by the number of argument runs, the data type and length of
+ * each run of arguments of the same data type, and then the argument values. In the compact
+ * encoding the message type is written with a variable length and the arguments with
+ * xferCompactGameMessageArgument.
+ * TheSuperHackers @performance The arguments are taken straight from the command instead of
+ * constructing a GameMessage and a GameMessageParser for every size check and write.
  */
-NetCommandList * NetPacket::getCommandList() {
-	NetCommandList *retval = newInstance(NetCommandList);
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList, packet length = %d", m_packetLen));
-	retval->init();
-
-	// These need to be the same as the default values for m_lastPlayerID, m_lastFrame, etc.
-	UnsignedByte playerID = 0;
-	UnsignedInt frame = 0;
-	UnsignedShort commandID = 1; // The first command is going to be
-	UnsignedByte commandType = 0;
-	UnsignedByte relay = 0;
-	NetCommandRef *lastCommand = NULL;
-
-	Int i = 0;
-	while (i < m_packetLen) {
+static NetCommandMsg * xferGameCommand(NetPacketXfer &xfer, NetCommandMsg *msg, CompactGameCommandState *state)
+{
+	NetGameCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetGameCommandMsg) : (NetGameCommandMsg *)msg;
 
-		switch(m_packet[i]) {
+	GameMessage::Type type = cmdMsg->getGameMessageType();
+	if (state != NULL)
+	{
+		UnsignedInt compactType = (UnsignedInt)type;
+		xfer.xferVarUnsignedInt(&compactType);
+		type = (GameMessage::Type)compactType;
+	}
+	else
+	{
+		xfer.xferBytes(&type, sizeof(type));
+	}
 
-		case NetPacketFieldTypes::CommandType:
-			++i;
-			memcpy(&commandType, m_packet + i, sizeof(UnsignedByte));
-			i += sizeof(UnsignedByte);
-			break;
-		case NetPacketFieldTypes::Frame:
-			++i;
-			memcpy(&frame, m_packet + i, sizeof(UnsignedInt));
-			i += sizeof(UnsignedInt);
-			break;
-		case NetPacketFieldTypes::PlayerId:
-			++i;
-			memcpy(&playerID, m_packet + i, sizeof(UnsignedByte));
-			i += sizeof(UnsignedByte);
-			break;
-		case NetPacketFieldTypes::Relay:
-			++i;
-			memcpy(&relay, m_packet + i, sizeof(UnsignedByte));
-			i += sizeof(UnsignedByte);
-			break;
-		case NetPacketFieldTypes::CommandId:
-			++i;
-			memcpy(&commandID, m_packet + i, sizeof(UnsignedShort));
-			i += sizeof(UnsignedShort);
-			break;
-		case NetPacketFieldTypes::Data: {
-			++i;
+	if (xfer.isReading())
+	{
+		cmdMsg->setGameMessageType(type);
 
-			NetCommandMsg *msg = NULL;
+		UnsignedByte numTypes = 0;
+		xfer.xferUnsignedByte(&numTypes);
 
-			//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList() - command of type %d(%s)", commandType, GetNetCommandTypeAsString((NetCommandType)commandType)));
+		UnsignedByte argTypes[255];
+		UnsignedByte argCounts[255];
+		Int i;
+		for (i = 0; i < numTypes; ++i)
+		{
+			xfer.xferUnsignedByte(&argTypes[i]);
+			xfer.xferUnsignedByte(&argCounts[i]);
+		}
 
-			switch((NetCommandType)commandType)
+		for (i = 0; i < numTypes && !xfer.hasFailed(); ++i)
+		{
+			const GameMessageArgumentDataType argType = (GameMessageArgumentDataType)argTypes[i];
+			for (Int j = 0; j < argCounts[i]; ++j)
 			{
-			case NETCOMMANDTYPE_GAMECOMMAND:
-				msg = readGameMessage(m_packet, i);
-				//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read game command from player %d for frame %d", playerID, frame));
-				break;
-			case NETCOMMANDTYPE_ACKBOTH:
-				msg = readAckBothMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_ACKSTAGE1:
-				msg = readAckStage1Message(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_ACKSTAGE2:
-				msg = readAckStage2Message(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_FRAMEINFO:
-				msg = readFrameMessage(m_packet, i);
-				// frameinfodebug
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read frame %d from player %d, command count = %d, relay = 0x%X", frame, playerID, ((NetFrameCommandMsg *)msg)->getCommandCount(), relay));
-				break;
-			case NETCOMMANDTYPE_PLAYERLEAVE:
-				msg = readPlayerLeaveMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read player leave message from player %d for execution on frame %d", playerID, frame));
-				break;
-			case NETCOMMANDTYPE_RUNAHEADMETRICS:
-				msg = readRunAheadMetricsMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_RUNAHEAD:
-				msg = readRunAheadMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read run ahead message from player %d for execution on frame %d", playerID, frame));
-				break;
-			case NETCOMMANDTYPE_DESTROYPLAYER:
-				msg = readDestroyPlayerMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read CRC info message from player %d for execution on frame %d", playerID, frame));
-				break;
-			case NETCOMMANDTYPE_KEEPALIVE:
-				msg = readKeepAliveMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read keep alive message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_DISCONNECTKEEPALIVE:
-				msg = readDisconnectKeepAliveMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read keep alive message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_DISCONNECTPLAYER:
-				msg = readDisconnectPlayerMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read disconnect player message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_PACKETROUTERQUERY:
-				msg = readPacketRouterQueryMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read packet router query message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_PACKETROUTERACK:
-				msg = readPacketRouterAckMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read packet router ack message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_DISCONNECTCHAT:
-				msg = readDisconnectChatMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read disconnect chat message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_DISCONNECTVOTE:
-				msg = readDisconnectVoteMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read disconnect vote message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_CHAT:
-				msg = readChatMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read chat message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_PROGRESS:
-				msg = readProgressMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read Progress message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_LOADCOMPLETE:
-				msg = readLoadCompleteMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read LoadComplete message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_TIMEOUTSTART:
-				msg = readTimeOutGameStartMessage(m_packet, i);
-//				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read TimeOutGameStart message from player %d", playerID));
-				break;
-			case NETCOMMANDTYPE_WRAPPER:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read Wrapper message from player %d", playerID));
-				msg = readWrapperMessage(m_packet, i);
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Done reading Wrapper message from player %d - wrapped command was %d", playerID,
-					((NetWrapperCommandMsg *)msg)->getWrappedCommandID()));
-				break;
-			case NETCOMMANDTYPE_FILE:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read file message from player %d", playerID));
-				msg = readFileMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_FILEANNOUNCE:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read file announce message from player %d", playerID));
-				msg = readFileAnnounceMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_FILEPROGRESS:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read file progress message from player %d", playerID));
-				msg = readFileProgressMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTFRAME:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read disconnect frame message from player %d", playerID));
-				msg = readDisconnectFrameMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_DISCONNECTSCREENOFF:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read disconnect screen off message from player %d", playerID));
-				msg = readDisconnectScreenOffMessage(m_packet, i);
-				break;
-			case NETCOMMANDTYPE_FRAMERESENDREQUEST:
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read frame resend request message from player %d", playerID));
-				msg = readFrameResendRequestMessage(m_packet, i);
-				break;
-			}
-
-			if (msg == NULL) {
-				DEBUG_CRASH(("Didn't read a message from the packet. Things are about to go wrong."));
-				continue;
+				GameMessageArgumentType arg;
+				Bool known;
+				if (state != NULL)
+					known = xferCompactGameMessageArgument(xfer, argType, arg, *state);
+				else
+					known = xferGameMessageArgument(xfer, argType, arg);
+				if (xfer.hasFailed())
+					break;
+				if (known)
+					cmdMsg->addArgument(argType, arg);
 			}
+		}
+		return cmdMsg;
+	}
 
-			// set the info
-			msg->setExecutionFrame(frame);
-			msg->setPlayerID(playerID);
-			msg->setNetCommandType((NetCommandType)commandType);
-			msg->setID(commandID);
+	const GameMessageArgument *args = cmdMsg->getArguments();
+	const Int numArgs = cmdMsg->getArgumentCount();
+	Int i;
+	UnsignedByte numTypes = 0;
+	for (i = 0; i < numArgs; ++i)
+	{
+		if (i == 0 || args[i].m_type != args[i - 1].m_type)
+			++numTypes;
+	}
+	xfer.xferUnsignedByte(&numTypes);
 
-//			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("frame = %d, player = %d, command type = %d, id = %d", frame, playerID, commandType, commandID));
+	for (i = 0; i < numArgs; )
+	{
+		UnsignedByte argType = (UnsignedByte)args[i].m_type;
+		UnsignedByte argCount = 0;
+		for (; i < numArgs && args[i].m_type == (GameMessageArgumentDataType)argType; ++i)
+			++argCount;
+		xfer.xferUnsignedByte(&argType);
+		xfer.xferUnsignedByte(&argCount);
+	}
 
-			// increment to the next command ID.
-			if (DoesCommandRequireACommandID((NetCommandType)commandType)) {
-				++commandID;
-			}
+	for (i = 0; i < numArgs; ++i)
+	{
+		GameMessageArgumentType data = args[i].m_data;
+		if (state != NULL)
+			xferCompactGameMessageArgument(xfer, args[i].m_type, data, *state);
+		else
+			xferGameMessageArgument(xfer, args[i].m_type, data);
+	}
 
-			// add the message to the list.
-			NetCommandRef *ref = retval->addMessage(msg);
-			if (ref != NULL) {
-				ref->setRelay(relay);
-			} else {
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - failed to set relay for message %d", msg->getID()));
-			}
+	return cmdMsg;
+}
 
-			deleteInstance(lastCommand);
-			lastCommand = newInstance(NetCommandRef)(msg);
+/**
+ * Transfers a game command in the compact encoding, which starts with the command it refers to.
+ */
+static NetCommandMsg * xferCompactGameCommand(NetPacketXfer &xfer, NetCommandMsg *msg, UnsignedShort commandID,
+	CompactGameCommandState &state, const NetGameCommandDictionary *dictionary)
+{
+	xferGameCommandReference(xfer, commandID, state, dictionary);
+	return xferGameCommand(xfer, msg, &state);
+}
 
-			msg->detach();  // Need to detach from new NetCommandMsg created by the "readXMessage" above.
+/**
+ * Returns the size of a game command in the compact encoding when it refers to the given command.
+ */
+static UnsignedInt getCompactGameCommandSize(NetCommandMsg *msg, const NetGameCommandDictionary::Entry *reference)
+{
+	NetPacketXfer xfer(NETPACKETXFER_SIZE, NULL, 0, 0);
+	CompactGameCommandState state;
+	state.init(reference);
+	xferCompactGameCommand(xfer, msg, msg->getID(), state, NULL);
+	return xfer.getOffset();
+}
 
-			// since the message is part of the list now, we don't have to keep track of it.  So we'll just set it to NULL.
-			msg = NULL;
-			break;
-		}
+static NetCommandMsg * xferGameCommandData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	return xferGameCommand(xfer, msg, NULL);
+}
 
-		case 'Z': {
+template <typename AckMsg>
+static void xferAckData(NetPacketXfer &xfer, AckMsg *cmdMsg)
+{
+	UnsignedShort commandID = cmdMsg->getCommandID();
+	UnsignedByte originalPlayerID = cmdMsg->getOriginalPlayerID();
+	xfer.xferUnsignedShort(&commandID);
+	xfer.xferUnsignedByte(&originalPlayerID);
+	if (xfer.isReading())
+	{
+		cmdMsg->setCommandID(commandID);
+		cmdMsg->setOriginalPlayerID(originalPlayerID);
+	}
+}
 
-			++i;
-			// Repeat the last command, doing some funky cool byte-saving stuff
-			if (lastCommand == NULL) {
-				DEBUG_CRASH(("Got a repeat command with no command to repeat."));
-			}
+static NetCommandMsg * xferAckBothData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetAckBothCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetAckBothCommandMsg) : (NetAckBothCommandMsg *)msg;
+	xferAckData(xfer, cmdMsg);
+	return cmdMsg;
+}
 
-			NetCommandMsg *msg = NULL;
+static NetCommandMsg * xferAckStage1Data(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetAckStage1CommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetAckStage1CommandMsg) : (NetAckStage1CommandMsg *)msg;
+	xferAckData(xfer, cmdMsg);
+	return cmdMsg;
+}
 
-			switch(commandType) {
+static NetCommandMsg * xferAckStage2Data(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetAckStage2CommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetAckStage2CommandMsg) : (NetAckStage2CommandMsg *)msg;
+	xferAckData(xfer, cmdMsg);
+	return cmdMsg;
+}
 
-			case NETCOMMANDTYPE_ACKSTAGE1: {
-				msg = newInstance(NetAckStage1CommandMsg)();
-				NetAckStage1CommandMsg* laststageone = (NetAckStage1CommandMsg*)(lastCommand->getCommand());
-				((NetAckStage1CommandMsg*)msg)->setCommandID(laststageone->getCommandID() + 1);
-				((NetAckStage1CommandMsg*)msg)->setOriginalPlayerID(laststageone->getOriginalPlayerID());
-				break;
-			}
-			case NETCOMMANDTYPE_ACKSTAGE2: {
-				msg = newInstance(NetAckStage2CommandMsg)();
-				NetAckStage2CommandMsg* laststagetwo = (NetAckStage2CommandMsg*)(lastCommand->getCommand());
-				((NetAckStage2CommandMsg*)msg)->setCommandID(laststagetwo->getCommandID() + 1);
-				((NetAckStage2CommandMsg*)msg)->setOriginalPlayerID(laststagetwo->getOriginalPlayerID());
-				break;
-			}
-			case NETCOMMANDTYPE_ACKBOTH: {
-				msg = newInstance(NetAckBothCommandMsg)();
-				NetAckBothCommandMsg* lastboth = (NetAckBothCommandMsg*)(lastCommand->getCommand());
-				((NetAckBothCommandMsg*)msg)->setCommandID(lastboth->getCommandID() + 1);
-				((NetAckBothCommandMsg*)msg)->setOriginalPlayerID(lastboth->getOriginalPlayerID());
-				break;
-			}
-			case NETCOMMANDTYPE_FRAMEINFO: {
-				msg = newInstance(NetFrameCommandMsg)();
-				++frame; // this is set below.
-				((NetFrameCommandMsg*)msg)->setCommandCount(0);
-				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Read a repeated frame command, frame = %d, player = %d, commandID = %d", frame, playerID, commandID));
-				break;
-			}
-			default:
-				DEBUG_CRASH(("Trying to repeat a command that shouldn't be repeated."));
-				continue;
+static NetCommandMsg * xferFrameData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetFrameCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetFrameCommandMsg) : (NetFrameCommandMsg *)msg;
+	UnsignedShort commandCount = cmdMsg->getCommandCount();
+	xfer.xferUnsignedShort(&commandCount);
+	if (xfer.isReading())
+		cmdMsg->setCommandCount(commandCount);
+	return cmdMsg;
+}
 
-			}
+static NetCommandMsg * xferPlayerLeaveData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetPlayerLeaveCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetPlayerLeaveCommandMsg) : (NetPlayerLeaveCommandMsg *)msg;
+	UnsignedByte leavingPlayerID = cmdMsg->getLeavingPlayerID();
+	xfer.xferUnsignedByte(&leavingPlayerID);
+	if (xfer.isReading())
+		cmdMsg->setLeavingPlayerID(leavingPlayerID);
+	return cmdMsg;
+}
 
-			msg->setExecutionFrame(frame);
-			msg->setPlayerID(playerID);
-			msg->setNetCommandType((NetCommandType)commandType);
-			msg->setID(commandID);
+static NetCommandMsg * xferRunAheadMetricsData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetRunAheadMetricsCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetRunAheadMetricsCommandMsg) : (NetRunAheadMetricsCommandMsg *)msg;
+	Real averageLatency = cmdMsg->getAverageLatency();
+	UnsignedShort averageFps = (UnsignedShort)cmdMsg->getAverageFps();
+	xfer.xferReal(&averageLatency);
+	xfer.xferUnsignedShort(&averageFps);
+	if (xfer.isReading())
+	{
+		cmdMsg->setAverageLatency(averageLatency);
+		cmdMsg->setAverageFps((Int)averageFps);
+	}
+	return cmdMsg;
+}
 
-//			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("frame = %d, player = %d, command type = %d, id = %d", frame, playerID, commandType, commandID));
+static NetCommandMsg * xferRunAheadData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetRunAheadCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetRunAheadCommandMsg) : (NetRunAheadCommandMsg *)msg;
+	UnsignedShort runAhead = cmdMsg->getRunAhead();
+	UnsignedByte frameRate = cmdMsg->getFrameRate();
+	xfer.xferUnsignedShort(&runAhead);
+	xfer.xferUnsignedByte(&frameRate);
+	if (xfer.isReading())
+	{
+		cmdMsg->setRunAhead(runAhead);
+		cmdMsg->setFrameRate(frameRate);
+	}
+	return cmdMsg;
+}
 
-			// increment to the next command ID.
-			if (DoesCommandRequireACommandID((NetCommandType)commandType)) {
-				++commandID;
-			}
+static NetCommandMsg * xferDestroyPlayerData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetDestroyPlayerCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetDestroyPlayerCommandMsg) : (NetDestroyPlayerCommandMsg *)msg;
+	UnsignedInt playerIndex = cmdMsg->getPlayerIndex();
+	xfer.xferUnsignedInt(&playerIndex);
+	if (xfer.isReading())
+		cmdMsg->setPlayerIndex(playerIndex);
+	return cmdMsg;
+}
 
-			// add the message to the list.
-			NetCommandRef *ref = retval->addMessage(msg);
-			if (ref != NULL) {
-				ref->setRelay(relay);
-			}
+static NetCommandMsg * xferKeepAliveData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	return xfer.isReading() ? newInstance(NetKeepAliveCommandMsg) : msg;
+}
 
-			deleteInstance(lastCommand);
-//			lastCommand = newInstance(NetCommandRef)(msg);
-			lastCommand = NEW_NETCOMMANDREF(msg);
+static NetCommandMsg * xferDisconnectKeepAliveData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	return xfer.isReading() ? newInstance(NetDisconnectKeepAliveCommandMsg) : msg;
+}
 
-			msg->detach();  // Need to detach from new NetCommandMsg created by the "readXMessage" above.
+static NetCommandMsg * xferDisconnectPlayerData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetDisconnectPlayerCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetDisconnectPlayerCommandMsg) : (NetDisconnectPlayerCommandMsg *)msg;
+	UnsignedByte slot = cmdMsg->getDisconnectSlot();
+	UnsignedInt disconnectFrame = cmdMsg->getDisconnectFrame();
+	xfer.xferUnsignedByte(&slot);
+	xfer.xferUnsignedInt(&disconnectFrame);
+	if (xfer.isReading())
+	{
+		cmdMsg->setDisconnectSlot(slot);
+		cmdMsg->setDisconnectFrame(disconnectFrame);
+	}
+	return cmdMsg;
+}
 
-			// since the message is part of the list now, we don't have to keep track of it.  So we'll just set it to NULL.
-			msg = NULL;
-			break;
-		}
+static NetCommandMsg * xferPacketRouterQueryData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	return xfer.isReading() ? newInstance(NetPacketRouterQueryCommandMsg) : msg;
+}
 
-		default:
-			// we don't recognize this command, but we have to increment i so we don't fall into an infinite loop.
-			DEBUG_CRASH(("Unrecognized packet entry, ignoring."));
-			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - Unrecognized packet entry at index %d", i));
-			dumpPacketToLog();
-			++i;
-			break;
+static NetCommandMsg * xferPacketRouterAckData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	return xfer.isReading() ? newInstance(NetPacketRouterAckCommandMsg) : msg;
+}
 
-		}
+static NetCommandMsg * xferDisconnectChatData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetDisconnectChatCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetDisconnectChatCommandMsg) : (NetDisconnectChatCommandMsg *)msg;
+	UnicodeString text = cmdMsg->getText();
+	xfer.xferUnicodeText(text);
+	if (xfer.isReading())
+		cmdMsg->setText(text);
+	return cmdMsg;
+}
 
+static NetCommandMsg * xferDisconnectVoteData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetDisconnectVoteCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetDisconnectVoteCommandMsg) : (NetDisconnectVoteCommandMsg *)msg;
+	UnsignedByte slot = cmdMsg->getSlot();
+	UnsignedInt voteFrame = cmdMsg->getVoteFrame();
+	xfer.xferUnsignedByte(&slot);
+	xfer.xferUnsignedInt(&voteFrame);
+	if (xfer.isReading())
+	{
+		cmdMsg->setSlot(slot);
+		cmdMsg->setVoteFrame(voteFrame);
 	}
+	return cmdMsg;
+}
 
-	deleteInstance(lastCommand);
-	lastCommand = NULL;
+static NetCommandMsg * xferChatData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetChatCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetChatCommandMsg) : (NetChatCommandMsg *)msg;
+	UnicodeString text = cmdMsg->getText();
+	Int playerMask = cmdMsg->getPlayerMask();
+	xfer.xferUnicodeText(text);
+	xfer.xferInt(&playerMask);
+	if (xfer.isReading())
+	{
+		cmdMsg->setText(text);
+		cmdMsg->setPlayerMask(playerMask);
+	}
+	return cmdMsg;
+}
 
-	return retval;
+static NetCommandMsg * xferProgressData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetProgressCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetProgressCommandMsg) : (NetProgressCommandMsg *)msg;
+	UnsignedByte percentage = cmdMsg->getPercentage();
+	xfer.xferUnsignedByte(&percentage);
+	if (xfer.isReading())
+		cmdMsg->setPercentage(percentage);
+	return cmdMsg;
 }
 
 /**
- * Reads the data portion of a game message from the given position in the packet.
+ * Used by the commands that only consist of their header, such as load complete and time out start.
  */
-NetCommandMsg * NetPacket::readGameMessage(UnsignedByte *data, Int &i)
+static NetCommandMsg * xferNoData(NetPacketXfer &xfer, NetCommandMsg *msg)
 {
-	NetGameCommandMsg *msg = newInstance(NetGameCommandMsg);
-
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readGameMessage"));
-
-	// Get the GameMessage command type.
-	GameMessage::Type newType;
-	memcpy(&newType, data + i, sizeof(GameMessage::Type));
-	i += sizeof(GameMessage::Type);
-	msg->setGameMessageType(newType);
-
-	// Get the number of argument types
-	UnsignedByte numArgTypes = 0;
-	memcpy(&numArgTypes, data + i, sizeof(numArgTypes));
-	i += sizeof(numArgTypes);
-
-	// Get the types and the number of arguments of those types.
-	Int totalArgCount = 0;
-	GameMessageParser *parser = newInstance(GameMessageParser)();
-	Int j = 0;
-	for (; j < numArgTypes; ++j) {
-		UnsignedByte type = (UnsignedByte)ARGUMENTDATATYPE_UNKNOWN;
-		memcpy(&type, data + i, sizeof(type));
-		i += sizeof(type);
+	return xfer.isReading() ? newInstance(NetCommandMsg) : msg;
+}
 
-		UnsignedByte argCount = 0;
-		memcpy(&argCount, data + i, sizeof(argCount));
-		i += sizeof(argCount);
+static NetCommandMsg * xferWrapperData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetWrapperCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetWrapperCommandMsg) : (NetWrapperCommandMsg *)msg;
+	UnsignedShort wrappedCommandID = cmdMsg->getWrappedCommandID();
+	UnsignedInt chunkNumber = cmdMsg->getChunkNumber();
+	UnsignedInt numChunks = cmdMsg->getNumChunks();
+	UnsignedInt totalDataLength = cmdMsg->getTotalDataLength();
+	UnsignedInt dataLength = cmdMsg->getDataLength();
+	UnsignedInt dataOffset = cmdMsg->getDataOffset();
+	xfer.xferUnsignedShort(&wrappedCommandID);
+	xfer.xferUnsignedInt(&chunkNumber);
+	xfer.xferUnsignedInt(&numChunks);
+	xfer.xferUnsignedInt(&totalDataLength);
+	xfer.xferUnsignedInt(&dataLength);
+	xfer.xferUnsignedInt(&dataOffset);
+	UnsignedByte *data = xfer.xferBlock(cmdMsg->getData(), dataLength);
+	if (xfer.isReading())
+	{
+		cmdMsg->setWrappedCommandID(wrappedCommandID);
+		cmdMsg->setChunkNumber(chunkNumber);
+		cmdMsg->setNumChunks(numChunks);
+		cmdMsg->setTotalDataLength(totalDataLength);
+		cmdMsg->setDataOffset(dataOffset);
+		if (data != NULL)
+			cmdMsg->setData(data, dataLength);
+	}
+	return cmdMsg;
+}
 
-		parser->addArgType((GameMessageArgumentDataType)type, argCount);
-		totalArgCount += argCount;
+static NetCommandMsg * xferFileData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetFileCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetFileCommandMsg) : (NetFileCommandMsg *)msg;
+	AsciiString filename = cmdMsg->getPortableFilename();	// PORTABLE
+	UnsignedInt fileLength = cmdMsg->getFileLength();
+	xfer.xferAsciiString(filename, _MAX_PATH - 1);
+	xfer.xferUnsignedInt(&fileLength);
+	UnsignedByte *data = xfer.xferBlock(cmdMsg->getFileData(), fileLength);
+	if (xfer.isReading())
+	{
+		cmdMsg->setPortableFilename(filename);	// it's transferred as a portable filename
+		if (data != NULL)
+			cmdMsg->setFileData(data, fileLength);
 	}
+	return cmdMsg;
+}
 
-	GameMessageParserArgumentType *parserArgType = parser->getFirstArgumentType();
-	GameMessageArgumentDataType lasttype = ARGUMENTDATATYPE_UNKNOWN;
-	Int argsLeftForType = 0;
-	if (parserArgType != NULL) {
-		lasttype = parserArgType->getType();
-		argsLeftForType = parserArgType->getArgCount();
+static NetCommandMsg * xferFileAnnounceData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetFileAnnounceCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetFileAnnounceCommandMsg) : (NetFileAnnounceCommandMsg *)msg;
+	AsciiString filename = cmdMsg->getPortableFilename();	// PORTABLE
+	UnsignedShort fileID = cmdMsg->getFileID();
+	UnsignedByte playerMask = cmdMsg->getPlayerMask();
+	xfer.xferAsciiString(filename, _MAX_PATH - 1);
+	xfer.xferUnsignedShort(&fileID);
+	xfer.xferUnsignedByte(&playerMask);
+	if (xfer.isReading())
+	{
+		cmdMsg->setPortableFilename(filename);	// it's transferred as a portable filename
+		cmdMsg->setFileID(fileID);
+		cmdMsg->setPlayerMask(playerMask);
 	}
-	for (j = 0; j < totalArgCount; ++j) {
-		readGameMessageArgumentFromPacket(lasttype, msg, data, i);
-
-		--argsLeftForType;
-		if (argsLeftForType == 0) {
-			DEBUG_ASSERTCRASH(parserArgType != NULL, ("parserArgType was NULL when it shouldn't have been."));
-			if (parserArgType == NULL) {
-				return NULL;
-			}
+	return cmdMsg;
+}
 
-			parserArgType = parserArgType->getNext();
-			// parserArgType is allowed to be NULL here
-			if (parserArgType != NULL) {
-				argsLeftForType = parserArgType->getArgCount();
-				lasttype = parserArgType->getType();
-			}
-		}
+static NetCommandMsg * xferFileProgressData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetFileProgressCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetFileProgressCommandMsg) : (NetFileProgressCommandMsg *)msg;
+	UnsignedShort fileID = cmdMsg->getFileID();
+	Int progress = cmdMsg->getProgress();
+	xfer.xferUnsignedShort(&fileID);
+	xfer.xferInt(&progress);
+	if (xfer.isReading())
+	{
+		cmdMsg->setFileID(fileID);
+		cmdMsg->setProgress(progress);
 	}
+	return cmdMsg;
+}
 
-	deleteInstance(parser);
-	parser = NULL;
+static NetCommandMsg * xferDisconnectFrameData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetDisconnectFrameCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetDisconnectFrameCommandMsg) : (NetDisconnectFrameCommandMsg *)msg;
+	UnsignedInt disconnectFrame = cmdMsg->getDisconnectFrame();
+	xfer.xferUnsignedInt(&disconnectFrame);
+	if (xfer.isReading())
+		cmdMsg->setDisconnectFrame(disconnectFrame);
+	return cmdMsg;
+}
 
-	return (NetCommandMsg *)msg;
+static NetCommandMsg * xferDisconnectScreenOffData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetDisconnectScreenOffCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetDisconnectScreenOffCommandMsg) : (NetDisconnectScreenOffCommandMsg *)msg;
+	UnsignedInt newFrame = cmdMsg->getNewFrame();
+	xfer.xferUnsignedInt(&newFrame);
+	if (xfer.isReading())
+		cmdMsg->setNewFrame(newFrame);
+	return cmdMsg;
 }
 
-void NetPacket::readGameMessageArgumentFromPacket(GameMessageArgumentDataType type, NetGameCommandMsg *msg, UnsignedByte *data, Int &i) {
-
-	GameMessageArgumentType arg;
-
-	switch (type) {
-
-	case ARGUMENTDATATYPE_INTEGER:
-		Int theint;
-		memcpy(&theint, data + i, sizeof(theint));
-		i += sizeof(theint);
-		arg.integer = theint;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_REAL:
-		Real thereal;
-		memcpy(&thereal, data + i, sizeof(thereal));
-		i += sizeof(thereal);
-		arg.real = thereal;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_BOOLEAN:
-		Bool thebool;
-		memcpy(&thebool, data + i, sizeof(thebool));
-		i += sizeof(thebool);
-		arg.boolean = thebool;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_OBJECTID:
-		ObjectID theobjectid;
-		memcpy(&theobjectid, data + i, sizeof(theobjectid));
-		i += sizeof(theobjectid);
-		arg.objectID = theobjectid;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_DRAWABLEID:
-		DrawableID thedrawableid;
-		memcpy(&thedrawableid, data + i, sizeof(thedrawableid));
-		i += sizeof(thedrawableid);
-		arg.drawableID = thedrawableid;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_TEAMID:
-		UnsignedInt theunsignedint;
-		memcpy(&theunsignedint, data + i, sizeof(theunsignedint));
-		i += sizeof(theunsignedint);
-		arg.teamID = theunsignedint;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_LOCATION:
-		Coord3D coord;
-		memcpy(&coord, data + i, sizeof(coord));
-		i += sizeof(coord);
-		arg.location = coord;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_PIXEL:
-		ICoord2D pixel;
-		memcpy(&pixel, data + i, sizeof(pixel));
-		i += sizeof(pixel);
-		arg.pixel = pixel;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_PIXELREGION:
-		IRegion2D reg;
-		memcpy(&reg, data + i, sizeof(reg));
-		i += sizeof(reg);
-		arg.pixelRegion = reg;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_TIMESTAMP:
-		UnsignedInt stamp;
-		memcpy(&stamp, data + i, sizeof(stamp));
-		i += sizeof(stamp);
-		arg.timestamp = stamp;
-		msg->addArgument(type, arg);
-		break;
-
-	case ARGUMENTDATATYPE_WIDECHAR:
-		WideChar c;
-		memcpy(&c, data + i, sizeof(c));
-		i += sizeof(c);
-		arg.wChar = c;
-		msg->addArgument(type, arg);
-		break;
+static NetCommandMsg * xferFrameResendRequestData(NetPacketXfer &xfer, NetCommandMsg *msg)
+{
+	NetFrameResendRequestCommandMsg *cmdMsg = xfer.isReading() ? newInstance(NetFrameResendRequestCommandMsg) : (NetFrameResendRequestCommandMsg *)msg;
+	UnsignedInt frameToResend = cmdMsg->getFrameToResend();
+	xfer.xferUnsignedInt(&frameToResend);
+	if (xfer.isReading())
+		cmdMsg->setFrameToResend(frameToResend);
+	return cmdMsg;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The wire format of a command type. The header fields are written in the given order, each only
+	* when it differs from the previous command in the packet, followed by 'D' and the data. A command
+	* ID is only written when it does not follow the previous one. A game command is followed by 'G'
+	* and its data in the compact encoding instead, when the receiver reads it. */
+//-------------------------------------------------------------------------------------------------
+struct NetCommandFormat
+{
+	NetCommandType m_type;
+	const char *m_fields;
+	NetCommandDataXferFunc m_xferData;
+};
+
+static const NetCommandFormat s_netCommandFormats[] =
+{
+	{ NETCOMMANDTYPE_ACKBOTH,							"TP",			xferAckBothData },
+	{ NETCOMMANDTYPE_ACKSTAGE1,						"TP",			xferAckStage1Data },
+	{ NETCOMMANDTYPE_ACKSTAGE2,						"TP",			xferAckStage2Data },
+	{ NETCOMMANDTYPE_FRAMEINFO,						"TFRPC",	xferFrameData },
+	{ NETCOMMANDTYPE_GAMECOMMAND,					"TFRPC",	xferGameCommandData },
+	{ NETCOMMANDTYPE_PLAYERLEAVE,					"TRFPC",	xferPlayerLeaveData },
+	{ NETCOMMANDTYPE_RUNAHEADMETRICS,			"TRPC",		xferRunAheadMetricsData },
+	{ NETCOMMANDTYPE_RUNAHEAD,						"TRFPC",	xferRunAheadData },
+	{ NETCOMMANDTYPE_DESTROYPLAYER,				"TRFPC",	xferDestroyPlayerData },
+	{ NETCOMMANDTYPE_KEEPALIVE,						"TRP",		xferKeepAliveData },
+	{ NETCOMMANDTYPE_DISCONNECTCHAT,			"TRP",		xferDisconnectChatData },
+	{ NETCOMMANDTYPE_CHAT,								"TFRPC",	xferChatData },
+	{ NETCOMMANDTYPE_MANGLERQUERY,				NULL,			NULL },
+	{ NETCOMMANDTYPE_MANGLERRESPONSE,			NULL,			NULL },
+	{ NETCOMMANDTYPE_PROGRESS,						"TRP",		xferProgressData },
+	{ NETCOMMANDTYPE_LOADCOMPLETE,				"TRPC",		xferNoData },
+	{ NETCOMMANDTYPE_TIMEOUTSTART,				"TRPC",		xferNoData },
+	{ NETCOMMANDTYPE_WRAPPER,							"TRPC",		xferWrapperData },
+	{ NETCOMMANDTYPE_FILE,								"TRPC",		xferFileData },
+	{ NETCOMMANDTYPE_FILEANNOUNCE,				"TRPC",		xferFileAnnounceData },
+	{ NETCOMMANDTYPE_FILEPROGRESS,				"TRPC",		xferFileProgressData },
+	{ NETCOMMANDTYPE_FRAMERESENDREQUEST,	"TFRPC",	xferFrameResendRequestData },
+	{ NETCOMMANDTYPE_DISCONNECTSTART,			NULL,			NULL },
+	{ NETCOMMANDTYPE_DISCONNECTKEEPALIVE,	"TRP",		xferDisconnectKeepAliveData },
+	{ NETCOMMANDTYPE_DISCONNECTPLAYER,		"TRPC",		xferDisconnectPlayerData },
+	{ NETCOMMANDTYPE_PACKETROUTERQUERY,		"TRP",		xferPacketRouterQueryData },
+	{ NETCOMMANDTYPE_PACKETROUTERACK,			"TRP",		xferPacketRouterAckData },
+	{ NETCOMMANDTYPE_DISCONNECTVOTE,			"TRPC",		xferDisconnectVoteData },
+	{ NETCOMMANDTYPE_DISCONNECTFRAME,			"TFRPC",	xferDisconnectFrameData },
+	{ NETCOMMANDTYPE_DISCONNECTSCREENOFF,	"TFRPC",	xferDisconnectScreenOffData },
+	{ NETCOMMANDTYPE_DISCONNECTEND,				NULL,			NULL },
+};
+static_assert(ARRAY_SIZE(s_netCommandFormats) == NETCOMMANDTYPE_DISCONNECTEND + 1, "Incorrect array size");
 
+/**
+ * Returns the wire format of the given command type, or NULL if the type cannot be sent.
+ */
+static const NetCommandFormat * findNetCommandFormat(Int type)
+{
+	if (type < 0 || type >= (Int)ARRAY_SIZE(s_netCommandFormats)) {
+		return NULL;
 	}
+	const NetCommandFormat *format = &s_netCommandFormats[type];
+	DEBUG_ASSERTCRASH(format->m_type == type, ("s_netCommandFormats is not in NetCommandType order"));
+	return (format->m_xferData != NULL) ? format : NULL;
+}
 
+/**
+ * Returns the CRC-32 of the data of a chunk.
+ */
+static UnsignedInt getChunkChecksum(NetWrapperCommandMsg *msg)
+{
+	return (UnsignedInt)CRC_Memory(msg->getData(), msg->getDataLength());
 }
 
 /**
- * Reads the data portion of the ack message at this position in the packet.
+ * Transfers a command with all of its header fields, as it is needed when the command does not
+ * follow other commands in a packet.
  */
-NetCommandMsg * NetPacket::readAckBothMessage(UnsignedByte *data, Int &i) {
-	NetAckBothCommandMsg *msg = newInstance(NetAckBothCommandMsg);
+static void xferCommand(NetPacketXfer &xfer, const NetCommandFormat &format, NetCommandMsg *msg, UnsignedByte relay)
+{
+	NetCommandHeader header = makeNetCommandHeader(msg, relay);
+	for (const char *field = format.m_fields; *field != 0; ++field) {
+		xferFieldType(xfer, *field);
+		xferHeaderField(xfer, *field, header);
+	}
+	xferFieldType(xfer, NetPacketFieldTypes::Data);
+	format.m_xferData(xfer, msg);
+}
 
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readAckMessage, "));
-	UnsignedShort cmdID = 0;
+static void setNetCommandHeader(NetCommandMsg *msg, const NetCommandHeader &header)
+{
+	msg->setExecutionFrame(header.m_frame);
+	msg->setPlayerID(header.m_playerID);
+	msg->setNetCommandType((NetCommandType)header.m_commandType);
+	msg->setID(header.m_commandID);
+}
 
-	memcpy(&cmdID, data + i, sizeof(UnsignedShort));
-	i += sizeof(UnsignedShort);
-	msg->setCommandID(cmdID);
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("commandID = %d, ", cmdID));
+/**
+ * Reads the data of a command and creates the command with the given header values. Returns NULL
+ * if the command type is unknown or the data is truncated or malformed.
+ */
+static NetCommandMsg * readCommand(NetPacketXfer &xfer, const NetCommandHeader &header)
+{
+	const NetCommandFormat *format = findNetCommandFormat(header.m_commandType);
+	if (format == NULL) {
+		return NULL;
+	}
 
-	UnsignedByte origPlayerID = 0;
-	memcpy(&origPlayerID, data + i, sizeof(UnsignedByte));
-	i += sizeof(UnsignedByte);
-	msg->setOriginalPlayerID(origPlayerID);
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("original player id = %d", origPlayerID));
+	NetCommandMsg *msg = format->m_xferData(xfer, NULL);
+	if (xfer.hasFailed()) {
+		msg->detach();
+		return NULL;
+	}
 
+	setNetCommandHeader(msg, header);
 	return msg;
 }
 
 /**
- * Reads the data portion of the ack message at this position in the packet.
+ * Reads the data of a game command in the compact encoding. Returns NULL if the data is truncated
+ * or malformed, or without failing the transfer if the command refers to a command that is not in
+ * the dictionary. Such a command is not acked, so the sender sends it again without a reference.
  */
-NetCommandMsg * NetPacket::readAckStage1Message(UnsignedByte *data, Int &i) {
-	NetAckStage1CommandMsg *msg = newInstance(NetAckStage1CommandMsg);
+static NetCommandMsg * readCompactGameCommand(NetPacketXfer &xfer, const NetCommandHeader &header, const NetGameCommandDictionary *dictionary)
+{
+	if (header.m_commandType != NETCOMMANDTYPE_GAMECOMMAND) {
+		xfer.setFailed(); // the length of the data is unknown, so nothing after it can be read
+		return NULL;
+	}
 
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readAckMessage, "));
-	UnsignedShort cmdID = 0;
+	CompactGameCommandState state;
+	state.init(NULL);
+	NetCommandMsg *msg = xferCompactGameCommand(xfer, NULL, header.m_commandID, state, dictionary);
+	if (xfer.hasFailed() || state.m_unresolved) {
+		msg->detach();
+		return NULL;
+	}
+
+	setNetCommandHeader(msg, header);
+	return msg;
+}
+
+// This function assumes that all of the fields are either of default value or are
+// present in the raw data.
+NetCommandRef * NetPacket::ConstructNetCommandMsgFromRawData(UnsignedByte *data, UnsignedShort dataLength) {
+	NetCommandHeader header;
+	header.m_frame = 0;
+	header.m_commandID = 0;
+	header.m_commandType = NETCOMMANDTYPE_GAMECOMMAND;
+	header.m_playerID = 0;
+	header.m_relay = 0;
+
+	NetPacketXfer xfer(NETPACKETXFER_READ, data, 0, dataLength);
+	while (!xfer.isAtEnd()) {
+		UnsignedByte field = 0;
+		xfer.xferUnsignedByte(&field);
+
+		if (field == NetPacketFieldTypes::Data) {
+			NetCommandMsg *msg = readCommand(xfer, header);
+			if (msg == NULL) {
+				break;
+			}
 
-	memcpy(&cmdID, data + i, sizeof(UnsignedShort));
-	i += sizeof(UnsignedShort);
-	msg->setCommandID(cmdID);
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("commandID = %d, ", cmdID));
+			NetCommandRef *ref = NEW_NETCOMMANDREF(msg);
+			ref->setRelay(header.m_relay);
 
-	UnsignedByte origPlayerID = 0;
-	memcpy(&origPlayerID, data + i, sizeof(UnsignedByte));
-	i += sizeof(UnsignedByte);
-	msg->setOriginalPlayerID(origPlayerID);
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("original player id = %d", origPlayerID));
+			msg->detach();
+			msg = NULL;
 
-	return msg;
+			return ref;
+		}
+
+		if (!xferHeaderField(xfer, field, header)) {
+			break;
+		}
+	}
+
+	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::ConstructNetCommandMsgFromRawData - no valid command in %d bytes of data", dataLength));
+	return NULL;
 }
 
-/**
- * Reads the data portion of the ack message at this position in the packet.
- */
-NetCommandMsg * NetPacket::readAckStage2Message(UnsignedByte *data, Int &i) {
-	NetAckStage2CommandMsg *msg = newInstance(NetAckStage2CommandMsg);
+NetPacketList NetPacket::ConstructBigCommandPacketList(NetCommandRef *ref) {
+	// if we don't have a unique command ID, then the wrapped command cannot
+	// be identified.  Therefore don't allow commands without a unique ID to
+	// be wrapped.
+	NetCommandMsg *msg = ref->getCommand();
+
+	if (!DoesCommandRequireACommandID(msg->getNetCommandType())) {
+		DEBUG_CRASH(("Trying to wrap a command that doesn't have a unique command ID"));
+		return NetPacketList();
+	}
 
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readAckMessage, "));
-	UnsignedShort cmdID = 0;
+	UnsignedInt bufferSize = GetBufferSizeNeededForCommand(msg);
+	UnsignedByte *bigPacketData = NULL;
 
-	memcpy(&cmdID, data + i, sizeof(UnsignedShort));
-	i += sizeof(UnsignedShort);
-	msg->setCommandID(cmdID);
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("commandID = %d, ", cmdID));
+	NetPacketList packetList;
 
-	UnsignedByte origPlayerID = 0;
-	memcpy(&origPlayerID, data + i, sizeof(UnsignedByte));
-	i += sizeof(UnsignedByte);
-	msg->setOriginalPlayerID(origPlayerID);
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("original player id = %d", origPlayerID));
+	// create the buffer for the huge message and fill the buffer with that message.
+	UnsignedInt bigPacketCurrentOffset = 0;
+	bigPacketData = NEW UnsignedByte[bufferSize];
+	FillBufferWithCommand(bigPacketData, bufferSize, ref);
 
-	return msg;
+	// create the wrapper command message we'll be using.
+	NetWrapperCommandMsg *wrapperMsg = newInstance(NetWrapperCommandMsg);
+	// get the amount of space needed for the wrapper message, not including the wrapped command data.
+	UnsignedInt wrapperSize = GetBufferSizeNeededForCommand(wrapperMsg);
+	// leave room for the checksums, which are added when the receiver reads them.
+	const UnsignedInt checksumSize = sizeof(NetPacketFieldType) + sizeof(UnsignedInt);
+	UnsignedInt commandSizePerPacket = MAX_PACKET_SIZE - wrapperSize - 2 * checksumSize;
+
+	UnsignedInt numChunks = bufferSize / commandSizePerPacket;
+	if ((bufferSize % commandSizePerPacket) > 0) {
+		++numChunks;
+	}
+	UnsignedInt currentChunk = 0;
+
+	// the receiver keys the resume of an earlier transfer on this checksum and verifies the assembled command with it.
+	// The first chunk holds the header of the wrapped command, which differs between transfers, so it is left out.
+	const UnsignedInt firstChunkSize = min(commandSizePerPacket, bufferSize);
+	wrapperMsg->setWrappedDataChecksum((UnsignedInt)CRC_Memory(bigPacketData + firstChunkSize, bufferSize - firstChunkSize));
+
+	// create the packets and the wrapper messages.
+	while (currentChunk < numChunks) {
+		NetPacket *packet = newInstance(NetPacket);
+
+		UnsignedShort dataSizeThisPacket = commandSizePerPacket;
+		if ((bufferSize - bigPacketCurrentOffset) < dataSizeThisPacket) {
+			dataSizeThisPacket = bufferSize - bigPacketCurrentOffset;
+		}
+
+		if (DoesCommandRequireACommandID(wrapperMsg->getNetCommandType())) {
+			wrapperMsg->setID(GenerateNextCommandID());
+		}
+		wrapperMsg->setPlayerID(msg->getPlayerID());
+		wrapperMsg->setExecutionFrame(msg->getExecutionFrame());
+
+		wrapperMsg->setChunkNumber(currentChunk);
+		wrapperMsg->setNumChunks(numChunks);
+		wrapperMsg->setDataOffset(bigPacketCurrentOffset);
+		wrapperMsg->setData(bigPacketData + bigPacketCurrentOffset, dataSizeThisPacket);
+		wrapperMsg->setTotalDataLength(bufferSize);
+		wrapperMsg->setWrappedCommandID(msg->getID());
+
+		bigPacketCurrentOffset += dataSizeThisPacket;
+
+		NetCommandRef * ref = NEW_NETCOMMANDREF(wrapperMsg);
+		ref->setRelay(ref->getRelay());
+
+		if (packet->addCommand(ref) == FALSE) {
+			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::BeginBigCommandPacketList - failed to add a wrapper command to the packet")); // I still have a drinking problem.
+		}
+
+		packetList.push_back(packet);
+
+		deleteInstance(ref);
+		ref = NULL;
+
+		++currentChunk;
+	}
+	wrapperMsg->detach();
+	wrapperMsg = NULL;
+
+	delete[] bigPacketData;
+	bigPacketData = NULL;
+
+	return packetList;
 }
 
 /**
- * Reads the data portion of the frame message at this position in the packet.
+ * Returns the size of the command with all of its header fields.
  */
-NetCommandMsg * NetPacket::readFrameMessage(UnsignedByte *data, Int &i) {
-	NetFrameCommandMsg *msg = newInstance(NetFrameCommandMsg);
-
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readFrameMessage, "));
-	UnsignedShort cmdCount = 0;
+UnsignedInt NetPacket::GetBufferSizeNeededForCommand(NetCommandMsg *msg) {
+	if (msg == NULL) {
+		return 0;
+	}
 
-	memcpy(&cmdCount, data + i, sizeof(UnsignedShort));
-	i += sizeof(UnsignedShort);
-	msg->setCommandCount(cmdCount);
-//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("command count = %d, ", cmdCount));
+	const NetCommandFormat *format = findNetCommandFormat(msg->getNetCommandType());
+	if (format == NULL) {
+		DEBUG_CRASH(("Unknown NETCOMMANDTYPE %d", msg->getNetCommandType()));
+		return 0;
+	}
 
-	return msg;
+	NetPacketXfer xfer(NETPACKETXFER_SIZE, NULL, 0, 0);
+	xferCommand(xfer, *format, msg, 0);
+	return xfer.getOffset();
 }
 
 /**
- * Reads the player leave message at this position in the packet.
+ * Writes the command with all of its header fields into the buffer.
  */
-NetCommandMsg * NetPacket::readPlayerLeaveMessage(UnsignedByte *data, Int &i) {
-	NetPlayerLeaveCommandMsg *msg = newInstance(NetPlayerLeaveCommandMsg);
+void NetPacket::FillBufferWithCommand(UnsignedByte *buffer, UnsignedInt bufferSize, NetCommandRef *ref) {
+	NetCommandMsg *msg = ref->getCommand();
 
-	UnsignedByte leavingPlayerID = 0;
+	const NetCommandFormat *format = findNetCommandFormat(msg->getNetCommandType());
+	if (format == NULL) {
+		DEBUG_CRASH(("Unknown NETCOMMANDTYPE %d", msg->getNetCommandType()));
+		return;
+	}
 
-	memcpy(&leavingPlayerID, data + i, sizeof(UnsignedByte));
-	i += sizeof(UnsignedByte);
-	msg->setLeavingPlayerID(leavingPlayerID);
+	NetPacketXfer xfer(NETPACKETXFER_WRITE, buffer, 0, bufferSize);
+	xferCommand(xfer, *format, msg, ref->getRelay());
+	DEBUG_ASSERTCRASH(!xfer.hasFailed() && xfer.getOffset() == bufferSize, ("NetPacket::FillBufferWithCommand - wrote %d of %d bytes", xfer.getOffset(), bufferSize));
+}
 
-	return msg;
+//-------------------------------------------------------------------------------------------------
+void NetGameCommandDictionary::Entry::set(NetGameCommandMsg *msg)
+{
+	m_commandID = msg->getID();
+	m_playerID = (UnsignedByte)msg->getPlayerID();
+	m_numObjectIDs = 0;
+	m_location.zero();
+
+	const GameMessageArgument *args = msg->getArguments();
+	const Int numArgs = msg->getArgumentCount();
+	for (Int i = 0; i < numArgs; ++i)
+	{
+		if (args[i].m_type == ARGUMENTDATATYPE_OBJECTID && m_numObjectIDs < MaxObjectIDs)
+			m_objectIDs[m_numObjectIDs++] = args[i].m_data.objectID;
+		else if (args[i].m_type == ARGUMENTDATATYPE_LOCATION)
+			m_location = args[i].m_data.location;
+	}
 }
 
-/**
- * Reads the run ahead metrics message at this position in the packet.
- */
-NetCommandMsg * NetPacket::readRunAheadMetricsMessage(UnsignedByte *data, Int &i) {
-	NetRunAheadMetricsCommandMsg *msg = newInstance(NetRunAheadMetricsCommandMsg);
+//-------------------------------------------------------------------------------------------------
+NetGameCommandDictionary::NetGameCommandDictionary()
+{
+	reset();
+}
 
-	Real averageLatency = (Real)0.2;
-	UnsignedShort averageFps = 30;
+//-------------------------------------------------------------------------------------------------
+void NetGameCommandDictionary::reset()
+{
+	m_sequence = 0;
+	m_hasConfirmed = FALSE;
+}
 
-	memcpy(&averageLatency, data + i, sizeof(Real));
-	i += sizeof(Real);
-	msg->setAverageLatency(averageLatency);
+//-------------------------------------------------------------------------------------------------
+void NetGameCommandDictionary::add(NetGameCommandMsg *msg)
+{
+	if (find(msg->getID(), (UnsignedByte)msg->getPlayerID()) != NULL)
+		return; // a resent command
 
-	memcpy(&averageFps, data + i, sizeof(UnsignedShort));
-	i += sizeof(UnsignedShort);
-	msg->setAverageFps((Int)averageFps);
-	return msg;
+	Entry &entry = m_entries[m_sequence % MaxEntries];
+	entry.set(msg);
+	entry.m_sequence = m_sequence;
+	++m_sequence;
 }
 
-/**
- * Reads the run ahead message at this position in the packet.
- */
-NetCommandMsg * NetPacket::readRunAheadMessage(UnsignedByte *data, Int &i) {
-	NetRunAheadCommandMsg *msg = newInstance(NetRunAheadCommandMsg);
-
-	UnsignedShort newRunAhead = 20;
-	memcpy(&newRunAhead, data + i, sizeof(UnsignedShort));
-	i += sizeof(UnsignedShort);
-	msg->setRunAhead(newRunAhead);
+//-------------------------------------------------------------------------------------------------
+const NetGameCommandDictionary::Entry * NetGameCommandDictionary::find(UnsignedShort commandID, UnsignedByte playerID) const
+{
+	const UnsignedInt numEntries = min(m_sequence, (UnsignedInt)MaxEntries);
+	for (UnsignedInt i = 0; i < numEntries; ++i)
+	{
+		const Entry &entry = m_entries[i];
+		if (entry.m_commandID == commandID && entry.m_playerID == playerID)
+			return &entry;
+	}
+	return NULL;
+}
 
-	UnsignedByte newFrameRate = 30;
-	memcpy(&newFrameRate, data + i, sizeof(UnsignedByte));
-	i += sizeof(UnsignedByte);
-	msg->setFrameRate(newFrameRate);
+//-------------------------------------------------------------------------------------------------
+void NetGameCommandDictionary::confirm(UnsignedShort commandID, UnsignedByte playerID)
+{
+	const Entry *entry = find(commandID, playerID);
+	if (entry != NULL)
+	{
+		m_confirmed = *entry;
+		m_hasConfirmed = TRUE;
+	}
+}
 
-	return msg;
+//-------------------------------------------------------------------------------------------------
+/** The receiver adds at most the commands that were sent since the confirmed command, and the resent
+	* ones that were sent before it. While the confirmed command is at most half a ring old, it is still
+	* in the ring of the receiver. */
+//-------------------------------------------------------------------------------------------------
+const NetGameCommandDictionary::Entry * NetGameCommandDictionary::getConfirmed() const
+{
+	if (!m_hasConfirmed || m_sequence - m_confirmed.m_sequence > MaxEntries / 2)
+		return NULL;
+	return &m_confirmed;
 }
 
 /**
- * Reads the CRC info message at this position in the packet.
+ * Constructor
  */
-NetCommandMsg * NetPacket::readDestroyPlayerMessage(UnsignedByte *data, Int &i) {
-	NetDestroyPlayerCommandMsg *msg = newInstance(NetDestroyPlayerCommandMsg);
-
-	UnsignedInt newVal = 0;
-	memcpy(&newVal, data + i, sizeof(UnsignedInt));
-	i += sizeof(UnsignedInt);
-	msg->setPlayerIndex(newVal);
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Saw CRC of 0x%8.8X", newCRC));
-
-	return msg;
+NetPacket::NetPacket() {
+	init();
 }
 
 /**
- * Reads the keep alive data, of which there is none.
+ * Constructor given raw transport data.
  */
-NetCommandMsg * NetPacket::readKeepAliveMessage(UnsignedByte *data, Int &i) {
-	NetKeepAliveCommandMsg *msg = newInstance(NetKeepAliveCommandMsg);
-
-	return msg;
+NetPacket::NetPacket(TransportMessage *msg) {
+	init();
+	m_packetLen = msg->length;
+	memcpy(m_packet, msg->data, MAX_PACKET_SIZE);
+	m_numCommands = -1;
+	m_addr = msg->addr;
+	m_port = msg->port;
 }
 
 /**
- * Reads the disconnect keep alive data, of which there is none.
+ * Destructor
  */
-NetCommandMsg * NetPacket::readDisconnectKeepAliveMessage(UnsignedByte *data, Int &i) {
-	NetDisconnectKeepAliveCommandMsg *msg = newInstance(NetDisconnectKeepAliveCommandMsg);
-
-	return msg;
+NetPacket::~NetPacket() {
+	deleteInstance(m_lastCommand);
+	m_lastCommand = NULL;
 }
 
 /**
- * Reads the disconnect player data.  Which is the slot number of the player being disconnected.
+ * Initialize all the member variable values.
  */
-NetCommandMsg * NetPacket::readDisconnectPlayerMessage(UnsignedByte *data, Int &i) {
-	NetDisconnectPlayerCommandMsg *msg = newInstance(NetDisconnectPlayerCommandMsg);
+void NetPacket::init() {
+	m_addr = 0;
+	m_port = 0;
+	m_numCommands = 0;
+	m_packetLen = 0;
+	m_packet = m_packetBuffer;
+	m_packet[0] = 0;
 
-	UnsignedByte slot = 0;
-	memcpy(&slot, data + i, sizeof(slot));
-	i += sizeof(slot);
-	msg->setDisconnectSlot(slot);
+	m_lastPlayerID = 0;
+	m_lastFrame = 0;
+	m_lastCommandID = 0;
+	m_lastCommandType = 0;
+	m_lastRelay = 0;
 
-	UnsignedInt disconnectFrame = 0;
-	memcpy(&disconnectFrame, data + i, sizeof(disconnectFrame));
-	i += sizeof(disconnectFrame);
-	msg->setDisconnectFrame(disconnectFrame);
+	m_compactGameCommands = FALSE;
+	m_chunkChecksums = FALSE;
+	m_readCompactSupport = COMPACT_SUPPORT_NONE;
+	m_readCompactGameCommands = FALSE;
 
-	return msg;
+	m_lastCommand = NULL;
 }
 
-/**
- * Reads the packet router query data, of which there is none.
- */
-NetCommandMsg * NetPacket::readPacketRouterQueryMessage(UnsignedByte *data, Int &i) {
-	NetPacketRouterQueryCommandMsg *msg = newInstance(NetPacketRouterQueryCommandMsg);
+void NetPacket::reset() {
+	deleteInstance(m_lastCommand);
+	m_lastCommand = NULL;
 
-	return msg;
+	init();
 }
 
 /**
- * Reads the packet router ack data, of which there is none.
+ * Build the packet in the given buffer instead of the packet's own one, for example directly in a
+ * send slot of the transport. Must be called before any command is added.
  */
-NetCommandMsg * NetPacket::readPacketRouterAckMessage(UnsignedByte *data, Int &i) {
-	NetPacketRouterAckCommandMsg *msg = newInstance(NetPacketRouterAckCommandMsg);
-
-	return msg;
+void NetPacket::setBuffer(UnsignedByte *buffer) {
+	DEBUG_ASSERTCRASH(m_packetLen == 0, ("NetPacket::setBuffer - the packet is not empty"));
+	m_packet = (buffer != NULL) ? buffer : m_packetBuffer;
+	m_packet[0] = 0;
 }
 
 /**
- * Reads the disconnect chat data, which is just the string.
+ * Set the address to which this packet is to be sent.
  */
-NetCommandMsg * NetPacket::readDisconnectChatMessage(UnsignedByte *data, Int &i) {
-	NetDisconnectChatCommandMsg *msg = newInstance(NetDisconnectChatCommandMsg);
-
-	WideChar text[256];
-	UnsignedByte length;
-	memcpy(&length, data + i, sizeof(UnsignedByte));
-	++i;
-	memcpy(text, data + i, length * sizeof(WideChar));
-	i += length * sizeof(WideChar);
-	text[length] = 0;
-
-	UnicodeString unitext;
-	unitext.set(text);
-
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readDisconnectChatMessage - read message, message is %ls", unitext.str()));
-
-	msg->setText(unitext);
-	return msg;
+void NetPacket::setAddress(Int addr, Int port) {
+	m_addr = addr;
+	m_port = port;
 }
 
 /**
- * Reads the chat data, which is just the string.
+ * Adds this command to the packet.  Returns false if there wasn't enough room
+ * in the packet for this message, true otherwise. A game command in the compact
+ * encoding may refer to the given command, which the receiver must have.
  */
-NetCommandMsg * NetPacket::readChatMessage(UnsignedByte *data, Int &i) {
-	NetChatCommandMsg *msg = newInstance(NetChatCommandMsg);
+Bool NetPacket::addCommand(NetCommandRef *ref, const NetGameCommandDictionary::Entry *reference) {
+	// This is where the fun begins...
+
+	if (ref == NULL) {
+		return TRUE; // There was nothing to add, so it was successful.
+	}
+
+	NetCommandMsg *msg = ref->getCommand();
+	const NetCommandFormat *format = findNetCommandFormat(msg->getNetCommandType());
+	if (format == NULL) {
+		DEBUG_CRASH(("Unknown NETCOMMANDTYPE %d", msg->getNetCommandType()));
+		return TRUE;
+	}
 
-	WideChar text[256];
-	UnsignedByte length;
-	Int playerMask;
-	memcpy(&length, data + i, sizeof(UnsignedByte));
-	++i;
-	memcpy(text, data + i, length * sizeof(WideChar));
-	i += length * sizeof(WideChar);
-	text[length] = 0;
-	memcpy(&playerMask, data + i, sizeof(Int));
-	i += sizeof(Int);
+	// An empty frame or an ack that follows the previous command is sent as a single repeat byte.
+	const Bool isFrame = (msg->getNetCommandType() == NETCOMMANDTYPE_FRAMEINFO);
+	if (isFrame ? isFrameRepeat(ref) : isAckRepeat(ref)) {
+		if (m_packetLen >= MAX_PACKET_SIZE) {
+			return FALSE;
+		}
+		m_packet[m_packetLen] = NetPacketFieldTypes::Repeat;
+		++m_packetLen;
+		if (isFrame) {
+			m_lastCommandID = msg->getID();
+			++m_lastFrame;		// need this cause we're actually advancing to the next frame by adding this command.
+		}
+		setLastCommand(ref);
+		return TRUE;
+	}
 
+	// TheSuperHackers @performance The command is written straight into the packet instead of
+	// computing its size first. When it does not fit, the packet length and the header state
+	// are left as they were.
+	NetCommandHeader last;
+	last.m_frame = m_lastFrame;
+	last.m_commandID = m_lastCommandID;
+	last.m_commandType = m_lastCommandType;
+	last.m_playerID = m_lastPlayerID;
+	last.m_relay = m_lastRelay;
+
+	NetCommandHeader header = makeNetCommandHeader(msg, ref->getRelay());
+	NetPacketXfer xfer(NETPACKETXFER_WRITE, m_packet, m_packetLen, MAX_PACKET_SIZE);
+	Bool needNewCommandID = FALSE; // this is to allow us to force the starting command ID to be respecified with this command.
+
+	for (const char *field = format->m_fields; *field != 0; ++field) {
+		Bool changed = FALSE;
+		switch (*field) {
+			case NetPacketFieldTypes::CommandType:
+				changed = (last.m_commandType != header.m_commandType);
+				last.m_commandType = header.m_commandType;
+				break;
+			case NetPacketFieldTypes::Frame:
+				changed = (last.m_frame != header.m_frame);
+				last.m_frame = header.m_frame;
+				break;
+			case NetPacketFieldTypes::Relay:
+				changed = (last.m_relay != header.m_relay);
+				last.m_relay = header.m_relay;
+				break;
+			case NetPacketFieldTypes::PlayerId:
+				//since if we have a new player we need to respecify the starting command ID, lets force the command id to be different.
+				changed = (last.m_playerID != header.m_playerID);
+				needNewCommandID = changed;
+				last.m_playerID = header.m_playerID;
+				break;
+			case NetPacketFieldTypes::CommandId:
+				changed = ((last.m_commandID + 1) != header.m_commandID) || needNewCommandID;
+				last.m_commandID = header.m_commandID;
+				break;
+		}
+		if (changed) {
+			xferFieldType(xfer, *field);
+			xferHeaderField(xfer, *field, header);
+		}
+	}
+
+	// TheSuperHackers @performance Game commands are written in the compact encoding when the receiver
+	// reads it, which saves most of the bytes of unit selections and orders. The reference is only used
+	// when it makes the command shorter. A command that only fits in the plain encoding is written plain,
+	// because the connection checks the plain size when it queues a command.
+	if (m_compactGameCommands && msg->getNetCommandType() == NETCOMMANDTYPE_GAMECOMMAND) {
+		if (reference != NULL && getCompactGameCommandSize(msg, reference) >= getCompactGameCommandSize(msg, NULL)) {
+			reference = NULL;
+		}
+		const NetPacketXfer headerXfer = xfer;
+		CompactGameCommandState state;
+		state.init(reference);
+		xferFieldType(xfer, NetPacketFieldTypes::CompactData);
+		xferCompactGameCommand(xfer, msg, msg->getID(), state, NULL);
+		if (xfer.hasFailed()) {
+			xfer = headerXfer;
+			xferFieldType(xfer, NetPacketFieldTypes::Data);
+			format->m_xferData(xfer, msg);
+		}
+	} else {
+		// TheSuperHackers @feature A chunk of a big command carries the CRC-32 of its data when the receiver
+		// reads it, because the packet checksum of the transport is too weak to catch every damaged chunk of
+		// a big map transfer. A chunk with the wrong checksum is not acked, so it is sent again.
+		// The checksum of the wrapped data goes with every chunk, because the chunks can arrive in any order.
+		if (m_chunkChecksums && msg->getNetCommandType() == NETCOMMANDTYPE_WRAPPER) {
+			NetWrapperCommandMsg *wrapperMsg = (NetWrapperCommandMsg *)msg;
+			if (wrapperMsg->hasWrappedDataChecksum()) {
+				UnsignedInt wrappedDataChecksum = wrapperMsg->getWrappedDataChecksum();
+				xferFieldType(xfer, NetPacketFieldTypes::WrappedDataChecksum);
+				xfer.xferUnsignedInt(&wrappedDataChecksum);
+			}
+			UnsignedInt checksum = getChunkChecksum(wrapperMsg);
+			xferFieldType(xfer, NetPacketFieldTypes::ChunkChecksum);
+			xfer.xferUnsignedInt(&checksum);
+		}
+		xferFieldType(xfer, NetPacketFieldTypes::Data);
+		format->m_xferData(xfer, msg);
+	}
 
-	UnicodeString unitext;
-	unitext.set(text);
+	if (xfer.hasFailed()) {
+		return FALSE;
+	}
 
-	//DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readChatMessage - read message, message is %ls", unitext.str()));
+	m_packetLen = xfer.getOffset();
+	m_lastFrame = last.m_frame;
+	m_lastCommandID = last.m_commandID;
+	m_lastCommandType = last.m_commandType;
+	m_lastPlayerID = last.m_playerID;
+	m_lastRelay = last.m_relay;
 
-	msg->setText(unitext);
-	msg->setPlayerMask(playerMask);
-	return msg;
+	setLastCommand(ref);
+	return TRUE;
 }
 
 /**
- * Reads the disconnect vote data.  Which is the slot number of the player being disconnected.
+ * Ends the packet with the keep alive command that tells the receiver that we read game commands in
+ * the compact encoding, see CompactSupportFrameTag. The command does not count as a command of the
+ * packet and needs no ack.
  */
-NetCommandMsg * NetPacket::readDisconnectVoteMessage(UnsignedByte *data, Int &i) {
-	NetDisconnectVoteCommandMsg *msg = newInstance(NetDisconnectVoteCommandMsg);
-
-	UnsignedByte slot = 0;
-	memcpy(&slot, data + i, sizeof(slot));
-	i += sizeof(slot);
-	msg->setSlot(slot);
+void NetPacket::announceCompactGameCommands(CompactSupport support) {
+	if (support == COMPACT_SUPPORT_NONE) {
+		return;
+	}
 
-	UnsignedInt voteFrame = 0;
-	memcpy(&voteFrame, data + i, sizeof(voteFrame));
-	i += sizeof(voteFrame);
-	msg->setVoteFrame(voteFrame);
+	UnsignedByte commandType = NETCOMMANDTYPE_KEEPALIVE;
+	UnsignedInt frame = CompactSupportFrameTag | (UnsignedInt)support;
+	NetPacketXfer xfer(NETPACKETXFER_WRITE, m_packet, m_packetLen, MAX_PACKET_SIZE);
+	xferFieldType(xfer, NetPacketFieldTypes::CommandType);
+	xfer.xferUnsignedByte(&commandType);
+	xferFieldType(xfer, NetPacketFieldTypes::Frame);
+	xfer.xferUnsignedInt(&frame);
+	xferFieldType(xfer, NetPacketFieldTypes::Data);
+	if (xfer.hasFailed()) {
+		return;
+	}
 
-	return msg;
+	m_packetLen = xfer.getOffset();
+	m_lastCommandType = commandType;
+	m_lastFrame = frame;
 }
 
 /**
- * Reads the Progress data.  Which is the slot number of the player being disconnected.
+ * Remembers the command that was just added, for the repeat checks of the next command.
  */
-NetCommandMsg * NetPacket::readProgressMessage(UnsignedByte *data, Int &i) {
-	NetProgressCommandMsg *msg = newInstance(NetProgressCommandMsg);
-
-	UnsignedByte percentage = 0;
-	memcpy(&percentage, data + i, sizeof(UnsignedByte));
-	i += sizeof(UnsignedByte);
-	msg->setPercentage(percentage);
+void NetPacket::setLastCommand(NetCommandRef *ref) {
+	deleteInstance(m_lastCommand);
+	m_lastCommand = NEW_NETCOMMANDREF(ref->getCommand());
+	m_lastCommand->setRelay(ref->getRelay());
+	++m_numCommands;
+}
 
-	return msg;
+Bool NetPacket::isFrameRepeat(NetCommandRef *msg) {
+	if (m_lastCommand == NULL) {
+		return FALSE;
+	}
+	if (m_lastCommand->getCommand()->getNetCommandType() != NETCOMMANDTYPE_FRAMEINFO) {
+		return FALSE;
+	}
+	NetFrameCommandMsg *framemsg = (NetFrameCommandMsg *)(msg->getCommand());
+	NetFrameCommandMsg *lastmsg = (NetFrameCommandMsg *)(m_lastCommand->getCommand());
+	if (framemsg->getCommandCount() != 0) {
+		return FALSE;
+	}
+	if (framemsg->getExecutionFrame() != (lastmsg->getExecutionFrame() + 1)) {
+		return FALSE;
+	}
+	if (msg->getRelay() != m_lastCommand->getRelay()) {
+		return FALSE;
+	}
+	if (framemsg->getID() != (lastmsg->getID() + 1)) {
+		return FALSE;
+	}
+	return TRUE;
 }
 
-NetCommandMsg * NetPacket::readLoadCompleteMessage(UnsignedByte *data, Int &i) {
-	NetCommandMsg *msg = newInstance(NetCommandMsg);
-	return msg;
+Bool NetPacket::isAckRepeat(NetCommandRef *msg) {
+	if (m_lastCommand == NULL) {
+		return FALSE;
+	}
+	if (m_lastCommand->getCommand()->getNetCommandType() != msg->getCommand()->getNetCommandType()) {
+		return FALSE;
+	}
+	if (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_ACKBOTH) {
+		return isAckBothRepeat(msg);
+	}
+	if (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_ACKSTAGE1) {
+		return isAckStage1Repeat(msg);
+	}
+	if (msg->getCommand()->getNetCommandType() == NETCOMMANDTYPE_ACKSTAGE2) {
+		return isAckStage2Repeat(msg);
+	}
+	return FALSE;
 }
 
-NetCommandMsg * NetPacket::readTimeOutGameStartMessage(UnsignedByte *data, Int &i) {
-	NetCommandMsg *msg = newInstance(NetCommandMsg);
-	return msg;
+Bool NetPacket::isAckBothRepeat(NetCommandRef *msg) {
+	NetAckBothCommandMsg *ack = (NetAckBothCommandMsg *)(msg->getCommand());
+	NetAckBothCommandMsg *lastAck = (NetAckBothCommandMsg *)(m_lastCommand->getCommand());
+	if (lastAck->getCommandID() != (ack->getCommandID() - 1)) {
+		return FALSE;
+	}
+	if (lastAck->getOriginalPlayerID() != ack->getOriginalPlayerID()) {
+		return FALSE;
+	}
+	if (msg->getRelay() != m_lastCommand->getRelay()) {
+		return FALSE;
+	}
+	return TRUE;
 }
 
-NetCommandMsg * NetPacket::readWrapperMessage(UnsignedByte *data, Int &i) {
-	NetWrapperCommandMsg *msg = newInstance(NetWrapperCommandMsg);
-
-	// get the wrapped command ID
-	UnsignedShort wrappedCommandID = 0;
-	memcpy(&wrappedCommandID, data + i, sizeof(wrappedCommandID));
-	msg->setWrappedCommandID(wrappedCommandID);
-	i += sizeof(wrappedCommandID);
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readWrapperMessage - wrapped command ID == %d", wrappedCommandID));
-
-	// get the chunk number.
-	UnsignedInt chunkNumber = 0;
-	memcpy(&chunkNumber, data + i, sizeof(chunkNumber));
-	msg->setChunkNumber(chunkNumber);
-	i += sizeof(chunkNumber);
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readWrapperMessage - chunk number = %d", chunkNumber));
-
-	// get the number of chunks
-	UnsignedInt numChunks = 0;
-	memcpy(&numChunks, data + i, sizeof(numChunks));
-	msg->setNumChunks(numChunks);
-	i += sizeof(numChunks);
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readWrapperMessage - number of chunks = %d", numChunks));
-
-	// get the total data length
-	UnsignedInt totalDataLength = 0;
-	memcpy(&totalDataLength, data + i, sizeof(totalDataLength));
-	msg->setTotalDataLength(totalDataLength);
-	i += sizeof(totalDataLength);
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readWrapperMessage - total data length = %d", totalDataLength));
-
-	// get the data length for this chunk
-	UnsignedInt dataLength = 0;
-	memcpy(&dataLength, data + i, sizeof(dataLength));
-	i += sizeof(dataLength);
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readWrapperMessage - data length = %d", dataLength));
-
-	UnsignedInt dataOffset = 0;
-	memcpy(&dataOffset, data + i, sizeof(dataOffset));
-	msg->setDataOffset(dataOffset);
-	i += sizeof(dataOffset);
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readWrapperMessage - data offset = %d", dataOffset));
-
-	msg->setData(data + i, dataLength);
-	i += dataLength;
+Bool NetPacket::isAckStage1Repeat(NetCommandRef *msg) {
+	NetAckStage2CommandMsg *ack = (NetAckStage2CommandMsg *)(msg->getCommand());
+	NetAckStage2CommandMsg *lastAck = (NetAckStage2CommandMsg *)(m_lastCommand->getCommand());
+	if (lastAck->getCommandID() != (ack->getCommandID() - 1)) {
+		return FALSE;
+	}
+	if (lastAck->getOriginalPlayerID() != ack->getOriginalPlayerID()) {
+		return FALSE;
+	}
+	if (msg->getRelay() != m_lastCommand->getRelay()) {
+		return FALSE;
+	}
+	return TRUE;
+}
 
-	return msg;
+Bool NetPacket::isAckStage2Repeat(NetCommandRef *msg) {
+	NetAckStage2CommandMsg *ack = (NetAckStage2CommandMsg *)(msg->getCommand());
+	NetAckStage2CommandMsg *lastAck = (NetAckStage2CommandMsg *)(m_lastCommand->getCommand());
+	if (lastAck->getCommandID() != (ack->getCommandID() - 1)) {
+		return FALSE;
+	}
+	if (lastAck->getOriginalPlayerID() != ack->getOriginalPlayerID()) {
+		return FALSE;
+	}
+	if (msg->getRelay() != m_lastCommand->getRelay()) {
+		return FALSE;
+	}
+	return TRUE;
 }
 
-NetCommandMsg * NetPacket::readFileMessage(UnsignedByte *data, Int &i) {
-	NetFileCommandMsg *msg = newInstance(NetFileCommandMsg);
-	char filename[_MAX_PATH];
+/**
+ * Returns the list of commands that are in this packet. The game commands are added to the given
+ * dictionary, which resolves the references of the game commands in the compact encoding.
+ */
+NetCommandList * NetPacket::getCommandList(NetGameCommandDictionary *dictionary) {
+	NetCommandList *retval = newInstance(NetCommandList);
+//	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList, packet length = %d", m_packetLen));
+	retval->init();
 
-	// TheSuperHackers @security Mauller/Jbremer/SkyAero 11/12/2025 Prevent buffer overflow when copying filepath string
-	i += strlcpy(filename, reinterpret_cast<const char*>(data), ARRAY_SIZE(filename));
-	++i; //Increment for null terminator
-	msg->setPortableFilename(AsciiString(filename));	// it's transferred as a portable filename
+	// These need to be the same as the default values for m_lastPlayerID, m_lastFrame, etc.
+	NetCommandHeader header;
+	header.m_playerID = 0;
+	header.m_frame = 0;
+	header.m_commandID = 1; // The first command is going to be
+	header.m_commandType = 0;
+	header.m_relay = 0;
+	NetCommandRef *lastCommand = NULL;
+	UnsignedInt chunkChecksum = 0;
+	Bool hasChunkChecksum = FALSE;
+	UnsignedInt wrappedDataChecksum = 0;
+	Bool hasWrappedDataChecksum = FALSE;
+	m_readCompactSupport = COMPACT_SUPPORT_NONE;
+	m_readCompactGameCommands = FALSE;
 
-	UnsignedInt dataLength = 0;
-	memcpy(&dataLength, data + i, sizeof(dataLength));
-	i += sizeof(dataLength);
+	NetPacketXfer xfer(NETPACKETXFER_READ, m_packet, 0, m_packetLen);
+	while (!xfer.isAtEnd()) {
 
-	UnsignedByte *buf = NEW UnsignedByte[dataLength];
-	memcpy(buf, data + i, dataLength);
-	i += dataLength;
+		UnsignedByte field = 0;
+		xfer.xferUnsignedByte(&field);
 
-	msg->setFileData(buf, dataLength);
+		NetCommandMsg *msg = NULL;
 
-	return msg;
-}
+		switch (field) {
 
-NetCommandMsg * NetPacket::readFileAnnounceMessage(UnsignedByte *data, Int &i) {
-	NetFileAnnounceCommandMsg *msg = newInstance(NetFileAnnounceCommandMsg);
-	char filename[_MAX_PATH];
+		case NetPacketFieldTypes::Data:
+		case NetPacketFieldTypes::CompactData: {
+			if (field == NetPacketFieldTypes::CompactData) {
+				m_readCompactGameCommands = TRUE;
+				msg = readCompactGameCommand(xfer, header, dictionary);
+				if (msg == NULL && !xfer.hasFailed()) {
+					DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - game command %d of player %d refers to an unknown command, waiting for it to be resent", header.m_commandID, header.m_playerID));
+					++header.m_commandID;
+					continue;
+				}
+			} else {
+				msg = readCommand(xfer, header);
+			}
+			const Bool checkChunkChecksum = hasChunkChecksum;
+			const Bool readWrappedDataChecksum = hasWrappedDataChecksum;
+			hasChunkChecksum = FALSE;
+			hasWrappedDataChecksum = FALSE;
+			if (msg == NULL) {
+				if (!xfer.hasFailed()) {
+					DEBUG_CRASH(("Didn't read a message from the packet. Things are about to go wrong."));
+				}
+				continue;
+			}
 
-	// TheSuperHackers @security Mauller/Jbremer/SkyAero 11/12/2025 Prevent buffer overflow when copying filepath string
-	i += strlcpy(filename, reinterpret_cast<const char*>(data), ARRAY_SIZE(filename));
-	++i; //Increment for null terminator
-	msg->setPortableFilename(AsciiString(filename));	// it's transferred as a portable filename
+			if (msg->getNetCommandType() == NETCOMMANDTYPE_KEEPALIVE &&
+					(header.m_frame & CompactSupportFrameTagMask) == CompactSupportFrameTag) {
+				const UnsignedInt support = header.m_frame & ~CompactSupportFrameTagMask;
+				if (support <= (UnsignedInt)COMPACT_SUPPORT_CONFIRMED) {
+					m_readCompactSupport = (CompactSupport)support;
+				}
+				msg->detach();
+				msg = NULL;
+				continue;
+			}
 
-	UnsignedShort fileID = 0;
-	memcpy(&fileID, data + i, sizeof(fileID));
-	i += sizeof(fileID);
-	msg->setFileID(fileID);
+			if (checkChunkChecksum && msg->getNetCommandType() == NETCOMMANDTYPE_WRAPPER &&
+					getChunkChecksum((NetWrapperCommandMsg *)msg) != chunkChecksum) {
+				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - chunk %d of player %d has the wrong checksum, waiting for it to be resent", header.m_commandID, header.m_playerID));
+				msg->detach();
+				msg = NULL;
+				++header.m_commandID;
+				continue;
+			}
 
-	UnsignedByte playerMask = 0;
-	memcpy(&playerMask, data + i, sizeof(playerMask));
-	i += sizeof(playerMask);
-	msg->setPlayerMask(playerMask);
+			if (readWrappedDataChecksum && msg->getNetCommandType() == NETCOMMANDTYPE_WRAPPER) {
+				((NetWrapperCommandMsg *)msg)->setWrappedDataChecksum(wrappedDataChecksum);
+			}
 
-	return msg;
-}
+			if (msg->getNetCommandType() == NETCOMMANDTYPE_FRAMEINFO) {
+				// frameinfodebug
+				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("read frame %d from player %d, command count = %d, relay = 0x%X", header.m_frame, header.m_playerID, ((NetFrameCommandMsg *)msg)->getCommandCount(), header.m_relay));
+			} else if (msg->getNetCommandType() == NETCOMMANDTYPE_GAMECOMMAND && dictionary != NULL) {
+				dictionary->add((NetGameCommandMsg *)msg);
+			}
+			break;
+		}
 
-NetCommandMsg * NetPacket::readFileProgressMessage(UnsignedByte *data, Int &i) {
-	NetFileProgressCommandMsg *msg = newInstance(NetFileProgressCommandMsg);
+		case NetPacketFieldTypes::ChunkChecksum:
+			xfer.xferUnsignedInt(&chunkChecksum);
+			hasChunkChecksum = !xfer.hasFailed();
+			continue;
 
-	UnsignedShort fileID = 0;
-	memcpy(&fileID, data + i, sizeof(fileID));
-	i += sizeof(fileID);
-	msg->setFileID(fileID);
+		case NetPacketFieldTypes::WrappedDataChecksum:
+			xfer.xferUnsignedInt(&wrappedDataChecksum);
+			hasWrappedDataChecksum = !xfer.hasFailed();
+			continue;
 
-	Int progress = 0;
-	memcpy(&progress, data + i, sizeof(progress));
-	i += sizeof(progress);
-	msg->setProgress(progress);
+		case NetPacketFieldTypes::Repeat: {
+			// Repeat the last command, doing some funky cool byte-saving stuff
+			switch (header.m_commandType) {
 
-	return msg;
-}
+			case NETCOMMANDTYPE_ACKSTAGE1:
+			case NETCOMMANDTYPE_ACKSTAGE2:
+			case NETCOMMANDTYPE_ACKBOTH: {
+				if (lastCommand == NULL || lastCommand->getCommand()->getNetCommandType() != header.m_commandType) {
+					DEBUG_CRASH(("Got a repeat command with no command to repeat."));
+					continue;
+				}
+				NetCommandMsg *lastMsg = lastCommand->getCommand();
+				if (header.m_commandType == NETCOMMANDTYPE_ACKSTAGE1) {
+					NetAckStage1CommandMsg *ackMsg = newInstance(NetAckStage1CommandMsg)();
+					ackMsg->setCommandID(((NetAckStage1CommandMsg *)lastMsg)->getCommandID() + 1);
+					ackMsg->setOriginalPlayerID(((NetAckStage1CommandMsg *)lastMsg)->getOriginalPlayerID());
+					msg = ackMsg;
+				} else if (header.m_commandType == NETCOMMANDTYPE_ACKSTAGE2) {
+					NetAckStage2CommandMsg *ackMsg = newInstance(NetAckStage2CommandMsg)();
+					ackMsg->setCommandID(((NetAckStage2CommandMsg *)lastMsg)->getCommandID() + 1);
+					ackMsg->setOriginalPlayerID(((NetAckStage2CommandMsg *)lastMsg)->getOriginalPlayerID());
+					msg = ackMsg;
+				} else {
+					NetAckBothCommandMsg *ackMsg = newInstance(NetAckBothCommandMsg)();
+					ackMsg->setCommandID(((NetAckBothCommandMsg *)lastMsg)->getCommandID() + 1);
+					ackMsg->setOriginalPlayerID(((NetAckBothCommandMsg *)lastMsg)->getOriginalPlayerID());
+					msg = ackMsg;
+				}
+				break;
+			}
+			case NETCOMMANDTYPE_FRAMEINFO: {
+				NetFrameCommandMsg *frameMsg = newInstance(NetFrameCommandMsg)();
+				++header.m_frame; // this is set below.
+				frameMsg->setCommandCount(0);
+				msg = frameMsg;
+				DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("Read a repeated frame command, frame = %d, player = %d, commandID = %d", header.m_frame, header.m_playerID, header.m_commandID));
+				break;
+			}
+			default:
+				DEBUG_CRASH(("Trying to repeat a command that shouldn't be repeated."));
+				continue;
+
+			}
+
+			setNetCommandHeader(msg, header);
+			break;
+		}
+
+		default:
+			if (xferHeaderField(xfer, field, header)) {
+				continue;
+			}
+			// we don't recognize this command, skip the byte so we don't fall into an infinite loop.
+			DEBUG_CRASH(("Unrecognized packet entry, ignoring."));
+			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - Unrecognized packet entry at index %d", xfer.getOffset() - 1));
+			dumpPacketToLog();
+			continue;
 
-NetCommandMsg * NetPacket::readDisconnectFrameMessage(UnsignedByte *data, Int &i) {
-	NetDisconnectFrameCommandMsg *msg = newInstance(NetDisconnectFrameCommandMsg);
+		}
 
-	UnsignedInt disconnectFrame = 0;
-	memcpy(&disconnectFrame, data + i, sizeof(disconnectFrame));
-	i += sizeof(disconnectFrame);
-	msg->setDisconnectFrame(disconnectFrame);
+//		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("frame = %d, player = %d, command type = %d, id = %d", header.m_frame, header.m_playerID, header.m_commandType, header.m_commandID));
 
-	DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::readDisconnectFrameMessage - read disconnect frame for frame %d", disconnectFrame));
+		// increment to the next command ID.
+		if (DoesCommandRequireACommandID((NetCommandType)header.m_commandType)) {
+			++header.m_commandID;
+		}
 
-	return msg;
-}
+		// add the message to the list.
+		NetCommandRef *ref = retval->addMessage(msg);
+		if (ref != NULL) {
+			ref->setRelay(header.m_relay);
+		} else {
+			DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - failed to set relay for message %d", msg->getID()));
+		}
 
-NetCommandMsg * NetPacket::readDisconnectScreenOffMessage(UnsignedByte *data, Int &i) {
-	NetDisconnectScreenOffCommandMsg *msg = newInstance(NetDisconnectScreenOffCommandMsg);
+		deleteInstance(lastCommand);
+		lastCommand = NEW_NETCOMMANDREF(msg);
 
-	UnsignedInt newFrame = 0;
-	memcpy(&newFrame, data + i, sizeof(newFrame));
-	i += sizeof(newFrame);
-	msg->setNewFrame(newFrame);
+		msg->detach();  // Need to detach from new NetCommandMsg created by readCommand above.
 
-	return msg;
-}
+		// since the message is part of the list now, we don't have to keep track of it.  So we'll just set it to NULL.
+		msg = NULL;
+	}
 
-NetCommandMsg * NetPacket::readFrameResendRequestMessage(UnsignedByte *data, Int &i) {
-	NetFrameResendRequestCommandMsg *msg = newInstance(NetFrameResendRequestCommandMsg);
+	if (xfer.hasFailed()) {
+		DEBUG_LOG_LEVEL(DEBUG_LEVEL_NET, ("NetPacket::getCommandList - the packet is truncated or malformed at index %d", xfer.getOffset()));
+	}
 
-	UnsignedInt frameToResend = 0;
-	memcpy(&frameToResend, data + i, sizeof(frameToResend));
-	i += sizeof(frameToResend);
-	msg->setFrameToResend(frameToResend);
+	deleteInstance(lastCommand);
+	lastCommand = NULL;
 
-	return msg;
+	return retval;
 }
 
 /**
@@ -37,6 +37,7 @@
 #include "Common/Player.h"
 #include "Common/PlayerList.h"
 #include "GameNetwork/NetworkInterface.h"
+#include "GameNetwork/NetworkTelemetry.h"
 #include "GameNetwork/udp.h"
 #include "GameNetwork/Transport.h"
 #include "strtok_r.h"
@@ -123,7 +124,7 @@ public:
 	void sendChat(UnicodeString text, Int playerMask);
 	void sendDisconnectChat(UnicodeString text);
 
-	void sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID);
+	Int sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID);
 	UnsignedShort sendFileAnnounce(AsciiString path, UnsignedByte playerMask);
 	Int getFileTransferProgress(Int playerID, AsciiString path);
 	Bool areAllQueuesEmpty(void);
@@ -190,8 +191,10 @@ protected:
 	void processDestroyPlayerCommand(NetDestroyPlayerCommandMsg *msg);	///< Do what needs to be done when we need to destroy a player.
 	void endOfGameCheck();																				///< Checks to see if its ok to leave this game.  If it is, send the apropriate command to the game logic.
 	Bool timeForNewFrame();
+	void writeTelemetry(UnsignedInt frame, Int numCommands, Int numGameCommands);
 
 	ConnectionManager *m_conMgr;																	///< The connection manager object
+	NetworkTelemetry *m_telemetry;																///< Writes the per frame statistics if -netTelemetry is given
 
 	UnsignedInt m_lastFrame;																			///< The last game logic frame that was processed.
 
@@ -271,6 +274,7 @@ Network::Network()
 	m_isStalling = FALSE;
 	m_sawCRCMismatch = FALSE;
 	m_conMgr = NULL;
+	m_telemetry = NULL;
 	m_messageWindow = NULL;
 
 #if defined(RTS_DEBUG)
@@ -284,6 +288,9 @@ Network::Network()
 Network::~Network()
 {
 	deinit();
+
+	delete m_telemetry;
+	m_telemetry = NULL;
 }
 
 /**
@@ -326,6 +333,10 @@ void Network::init()
 	m_conMgr = NEW ConnectionManager;
 	m_conMgr->init();
 
+	if (m_telemetry == NULL && TheGlobalData->m_netTelemetryFile.isNotEmpty()) {
+		m_telemetry = NEW NetworkTelemetry(TheGlobalData->m_netTelemetryFile);
+	}
+
 	m_lastFrame = 0;
 	m_runAhead = min(max(30, MIN_RUNAHEAD), MAX_FRAMES_AHEAD/2); ///< @todo: don't hard-code the run-ahead.
 	m_frameRate = 30;
@@ -585,9 +596,13 @@ void Network::RelayCommandsToCommandList(UnsignedInt frame) {
 	m_checkCRCsThisFrame = FALSE;
 	NetCommandList *netcmdlist = m_conMgr->getFrameCommandList(frame);
 	NetCommandRef *msg = netcmdlist->getFirstMessage();
+	Int numCommands = 0;
+	Int numGameCommands = 0;
 	while (msg != NULL) {
+		++numCommands;
 		NetCommandType cmdType = msg->getCommand()->getNetCommandType();
 		if (cmdType == NETCOMMANDTYPE_GAMECOMMAND) {
+			++numGameCommands;
 			//DEBUG_LOG(("Network::RelayCommandsToCommandList - appending command %d of type %s to command list on frame %d", msg->getCommand()->getID(), ((NetGameCommandMsg *)msg->getCommand())->constructGameMessage()->getCommandAsString(), TheGameLogic->getFrame()));
 			TheCommandList->appendMessage(((NetGameCommandMsg *)msg->getCommand())->constructGameMessage());
 		} else {
@@ -607,6 +622,25 @@ void Network::RelayCommandsToCommandList(UnsignedInt frame) {
 	m_playersToDisconnect.clear();
 
 	deleteInstance(netcmdlist);
+
+	if (m_telemetry != NULL) {
+		writeTelemetry(frame, numCommands, numGameCommands);
+	}
+}
+
+/**
+ * Writes the network statistics of the frame that is about to be executed.
+ */
+void Network::writeTelemetry(UnsignedInt frame, Int numCommands, Int numGameCommands) {
+	NetworkTelemetryFrame telemetryFrame;
+	telemetryFrame.m_frame = frame;
+	telemetryFrame.m_runAhead = m_runAhead;
+	telemetryFrame.m_frameRate = m_frameRate;
+	telemetryFrame.m_numCommands = numCommands;
+	telemetryFrame.m_numGameCommands = numGameCommands;
+	m_conMgr->getTelemetry(telemetryFrame);
+
+	m_telemetry->writeFrame(telemetryFrame);
 }
 
 /**
@@ -913,9 +947,9 @@ void Network::sendDisconnectChat(UnicodeString text) {
 }
 
 // send a file.  woohoo.
-void Network::sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID)
+Int Network::sendFile(AsciiString path, UnsignedByte playerMask, UnsignedShort commandID)
 {
-	m_conMgr->sendFile(path, playerMask, commandID);
+	return m_conMgr->sendFile(path, playerMask, commandID);
 }
 
 // send a file.  woohoo.
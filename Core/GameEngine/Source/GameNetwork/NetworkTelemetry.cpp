@@ -0,0 +1,109 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// FILE: NetworkTelemetry.cpp /////////////////////////////////////////////////////////////////////
+// Writes the network statistics of every executed game logic frame to a CSV file.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "GameNetwork/NetworkTelemetry.h"
+
+//-------------------------------------------------------------------------------------------------
+NetworkTelemetry::NetworkTelemetry(const AsciiString& path)
+{
+	m_lastTime = 0;
+	m_hasLast = FALSE;
+	memset(&m_last, 0, sizeof(m_last));
+
+	m_file = fopen(path.str(), "a");
+	if (m_file == NULL)
+	{
+		DEBUG_LOG(("NetworkTelemetry - could not open '%s'", path.str()));
+		return;
+	}
+
+	// the rows are only written once in a while, to keep the cost per frame low
+	setvbuf(m_file, NULL, _IOFBF, 64 * 1024);
+
+	fseek(m_file, 0, SEEK_END);
+	if (ftell(m_file) == 0)
+		writeHeader();
+}
+
+//-------------------------------------------------------------------------------------------------
+NetworkTelemetry::~NetworkTelemetry()
+{
+	if (m_file != NULL)
+		fclose(m_file);
+}
+
+//-------------------------------------------------------------------------------------------------
+void NetworkTelemetry::writeHeader()
+{
+	fprintf(m_file, "frame,time_ms,run_ahead,frame_rate,avg_fps,cushion,router_latency_ms,commands,game_commands,"
+		"bytes_in,packets_in,bytes_out,packets_out");
+	for (Int i = 0; i < MAX_SLOTS; ++i)
+		fprintf(m_file, ",latency_ms_%d,fps_%d,retries_%d", i, i, i);
+	fprintf(m_file, "\n");
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Writes one row. The time, byte, packet and retry columns are the growth since the previous row,
+	* and are 0 on the first row of a game. The columns of slots without a connection are empty. */
+//-------------------------------------------------------------------------------------------------
+void NetworkTelemetry::writeFrame(const NetworkTelemetryFrame& frame)
+{
+	if (m_file == NULL)
+		return;
+
+	const NetworkTelemetryFrame& last = m_hasLast ? m_last : frame;
+	const UnsignedInt now = timeGetTime();
+
+	fprintf(m_file, "%u,%u,%d,%d,%d,%d,%d,%d,%d,%u,%u,%u,%u",
+		frame.m_frame,
+		m_hasLast ? now - m_lastTime : 0,
+		frame.m_runAhead,
+		frame.m_frameRate,
+		frame.m_averageFps,
+		frame.m_minimumCushion,
+		REAL_TO_INT(frame.m_routerLatency * 1000.0f),
+		frame.m_numCommands,
+		frame.m_numGameCommands,
+		frame.m_incomingBytes - last.m_incomingBytes,
+		frame.m_incomingPackets - last.m_incomingPackets,
+		frame.m_outgoingBytes - last.m_outgoingBytes,
+		frame.m_outgoingPackets - last.m_outgoingPackets);
+
+	for (Int i = 0; i < MAX_SLOTS; ++i)
+	{
+		if (!frame.m_isConnected[i])
+		{
+			fprintf(m_file, ",,,");
+			continue;
+		}
+		const UnsignedInt retries = last.m_isConnected[i] ? frame.m_retries[i] - last.m_retries[i] : 0;
+		fprintf(m_file, ",%d,%d,%u", REAL_TO_INT(frame.m_latency[i]), frame.m_fps[i], retries);
+	}
+	fprintf(m_file, "\n");
+
+	m_last = frame;
+	m_lastTime = now;
+	m_hasLast = TRUE;
+}
@@ -65,12 +65,16 @@ static inline void decryptBuf( unsigned char *buf, Int len )
 	}
 }
 
+enum { RECV_BATCH_SIZE = 16 };
+
 //--------------------------------------------------------------------------
 
 Transport::Transport(void)
 {
 	m_winsockInit = false;
 	m_udpsock = NULL;
+	resetSendSlots();
+	resetTotals();
 }
 
 Transport::~Transport(void)
@@ -84,6 +88,52 @@ Bool Transport::init( AsciiString ip, UnsignedShort port )
 }
 
 Bool Transport::init( UnsignedInt ip, UnsignedShort port )
+{
+	if (!openSocket(ip, port))
+		return false;
+
+	// ------- Clear buffers --------
+	resetSendSlots();
+	int i=0;
+	for (; i<MAX_MESSAGES; ++i)
+	{
+		m_inBuffer[i].length = 0;
+#if defined(RTS_DEBUG)
+		m_delayedInBuffer[i].message.length = 0;
+#endif
+	}
+	for (i=0; i<MAX_TRANSPORT_STATISTICS_SECONDS; ++i)
+	{
+		m_incomingBytes[i] = 0;
+		m_outgoingBytes[i] = 0;
+		m_unknownBytes[i] = 0;
+		m_incomingPackets[i] = 0;
+		m_outgoingPackets[i] = 0;
+		m_unknownPackets[i] = 0;
+	}
+	m_statisticsSlot = 0;
+	m_lastSecond = timeGetTime();
+	resetTotals();
+
+	m_port = port;
+
+#if defined(RTS_DEBUG)
+	if (TheGlobalData->m_latencyAverage > 0 || TheGlobalData->m_latencyNoise)
+		m_useLatency = true;
+
+	if (TheGlobalData->m_packetLoss)
+		m_usePacketLoss = true;
+#endif
+
+	return true;
+}
+
+void Transport::reset( void )
+{
+	closeSocket();
+}
+
+Bool Transport::openSocket( UnsignedInt ip, UnsignedShort port )
 {
 	// ----- Initialize Winsock -----
 	if (!m_winsockInit)
@@ -124,42 +174,10 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 		return false;
 	}
 
-	// ------- Clear buffers --------
-	int i=0;
-	for (; i<MAX_MESSAGES; ++i)
-	{
-		m_outBuffer[i].length = 0;
-		m_inBuffer[i].length = 0;
-#if defined(RTS_DEBUG)
-		m_delayedInBuffer[i].message.length = 0;
-#endif
-	}
-	for (i=0; i<MAX_TRANSPORT_STATISTICS_SECONDS; ++i)
-	{
-		m_incomingBytes[i] = 0;
-		m_outgoingBytes[i] = 0;
-		m_unknownBytes[i] = 0;
-		m_incomingPackets[i] = 0;
-		m_outgoingPackets[i] = 0;
-		m_unknownPackets[i] = 0;
-	}
-	m_statisticsSlot = 0;
-	m_lastSecond = timeGetTime();
-
-	m_port = port;
-
-#if defined(RTS_DEBUG)
-	if (TheGlobalData->m_latencyAverage > 0 || TheGlobalData->m_latencyNoise)
-		m_useLatency = true;
-
-	if (TheGlobalData->m_packetLoss)
-		m_usePacketLoss = true;
-#endif
-
 	return true;
 }
 
-void Transport::reset( void )
+void Transport::closeSocket( void )
 {
 	delete m_udpsock;
 	m_udpsock = NULL;
@@ -171,15 +189,51 @@ void Transport::reset( void )
 	}
 }
 
+void Transport::resetSendSlots( void )
+{
+	for (Int i=0; i<MAX_MESSAGES; ++i)
+	{
+		m_outBuffer[i].length = 0;
+		// hand out the lowest slots first, as before
+		m_freeSendSlots[i] = MAX_MESSAGES - 1 - i;
+	}
+	m_numFreeSendSlots = MAX_MESSAGES;
+	m_sendQueueHead = 0;
+	m_sendQueueLength = 0;
+}
+
+void Transport::resetTotals( void )
+{
+	m_totals.m_incomingBytes = 0;
+	m_totals.m_incomingPackets = 0;
+	m_totals.m_outgoingBytes = 0;
+	m_totals.m_outgoingPackets = 0;
+}
+
+Bool Transport::isSocketAddressUnavailable( void )
+{
+	return m_udpsock && m_udpsock->GetStatus() == UDP::ADDRNOTAVAIL;
+}
+
+void Transport::writeSocket( UDP::Datagram *datagrams, Int count )
+{
+	m_udpsock->WriteBatch(datagrams, count);
+}
+
+Int Transport::readSocket( UDP::Datagram *datagrams, Int count )
+{
+	return m_udpsock->ReadBatch(datagrams, count);
+}
+
 Bool Transport::update( void )
 {
 	Bool retval = TRUE;
-	if (doRecv() == FALSE && m_udpsock && m_udpsock->GetStatus() == UDP::ADDRNOTAVAIL)
+	if (doRecv() == FALSE && isSocketAddressUnavailable())
 	{
 		retval = FALSE;
 	}
 	DEBUG_ASSERTLOG(retval, ("WSA error is %s", GetWSAErrorString(WSAGetLastError()).str()));
-	if (doSend() == FALSE && m_udpsock && m_udpsock->GetStatus() == UDP::ADDRNOTAVAIL)
+	if (doSend() == FALSE && isSocketAddressUnavailable())
 	{
 		retval = FALSE;
 	}
@@ -188,7 +242,7 @@ Bool Transport::update( void )
 }
 
 Bool Transport::doSend() {
-	if (!m_udpsock)
+	if (!isSocketOpen())
 	{
 		DEBUG_LOG(("Transport::doSend() - m_udpSock is NULL!"));
 		return FALSE;
@@ -210,35 +264,59 @@ Bool Transport::doSend() {
 		m_unknownBytes[m_statisticsSlot] = 0;
 	}
 
-	// Send all messages
+	// TheSuperHackers @performance Send all messages with one batched socket call. Messages that could not
+	// be sent stay queued in their order.
 	int i;
-	for (i=0; i<MAX_MESSAGES; ++i)
+	const Int numQueued = m_sendQueueLength;
+	UDP::Datagram datagrams[MAX_MESSAGES];
+	Int n;
+	for (n=0; n<numQueued; ++n)
+	{
+		i = m_sendQueue[(m_sendQueueHead + n) % MAX_MESSAGES];
+		datagrams[n].buf = (unsigned char *)(&m_outBuffer[i]);
+		datagrams[n].len = m_outBuffer[i].length + sizeof(TransportMessageHeader);
+		datagrams[n].ip = m_outBuffer[i].addr;
+		datagrams[n].port = m_outBuffer[i].port;
+		datagrams[n].result = -1;
+	}
+
+	if (numQueued > 0)
+	{
+		writeSocket(datagrams, numQueued);
+	}
+
+	for (n=0; n<numQueued; ++n)
 	{
-		if (m_outBuffer[i].length != 0)
+		i = m_sendQueue[m_sendQueueHead];
+		m_sendQueueHead = (m_sendQueueHead + 1) % MAX_MESSAGES;
+		--m_sendQueueLength;
+
+		int bytesSent = datagrams[n].result;
+		int bytesToSend = datagrams[n].len;
+		if (bytesSent > 0)
 		{
-			int bytesSent = 0;
-			int bytesToSend = m_outBuffer[i].length + sizeof(TransportMessageHeader);
-			// Send this message
-			if ((bytesSent = m_udpsock->Write((unsigned char *)(&m_outBuffer[i]), bytesToSend, m_outBuffer[i].addr, m_outBuffer[i].port)) > 0)
+			//DEBUG_LOG(("Sending %d bytes to %d.%d.%d.%d:%d", bytesToSend, PRINTF_IP_AS_4_INTS(m_outBuffer[i].addr), m_outBuffer[i].port));
+			m_outgoingPackets[m_statisticsSlot]++;
+			m_outgoingBytes[m_statisticsSlot] += m_outBuffer[i].length + sizeof(TransportMessageHeader);
+			++m_totals.m_outgoingPackets;
+			m_totals.m_outgoingBytes += m_outBuffer[i].length + sizeof(TransportMessageHeader);
+			m_outBuffer[i].length = 0;  // Remove from queue
+			m_freeSendSlots[m_numFreeSendSlots++] = i;
+			if (bytesSent != bytesToSend)
 			{
-				//DEBUG_LOG(("Sending %d bytes to %d.%d.%d.%d:%d", bytesToSend, PRINTF_IP_AS_4_INTS(m_outBuffer[i].addr), m_outBuffer[i].port));
-				m_outgoingPackets[m_statisticsSlot]++;
-				m_outgoingBytes[m_statisticsSlot] += m_outBuffer[i].length + sizeof(TransportMessageHeader);
-				m_outBuffer[i].length = 0;  // Remove from queue
-				if (bytesSent != bytesToSend)
-				{
-					DEBUG_LOG(("Transport::doSend - wanted to send %d bytes, only sent %d bytes to %d.%d.%d.%d:%d",
-						bytesToSend, bytesSent,
-						PRINTF_IP_AS_4_INTS(m_outBuffer[i].addr), m_outBuffer[i].port));
-				}
-			}
-			else
-			{
-				//DEBUG_LOG(("Could not write to socket!!!  Not discarding message!"));
-				retval = FALSE;
-				//DEBUG_LOG(("Transport::doSend returning FALSE"));
+				DEBUG_LOG(("Transport::doSend - wanted to send %d bytes, only sent %d bytes to %d.%d.%d.%d:%d",
+					bytesToSend, bytesSent,
+					PRINTF_IP_AS_4_INTS(m_outBuffer[i].addr), m_outBuffer[i].port));
 			}
 		}
+		else
+		{
+			//DEBUG_LOG(("Could not write to socket!!!  Not discarding message!"));
+			m_sendQueue[(m_sendQueueHead + m_sendQueueLength) % MAX_MESSAGES] = i;
+			++m_sendQueueLength;
+			retval = FALSE;
+			//DEBUG_LOG(("Transport::doSend returning FALSE"));
+		}
 	}
 
 #if defined(RTS_DEBUG)
@@ -268,7 +346,7 @@ Bool Transport::doSend() {
 
 Bool Transport::doRecv()
 {
-	if (!m_udpsock)
+	if (!isSocketOpen())
 	{
 		DEBUG_LOG(("Transport::doRecv() - m_udpSock is NULL!"));
 		return FALSE;
@@ -277,17 +355,46 @@ Bool Transport::doRecv()
 	Bool retval = TRUE;
 
 	// Read in anything on our socket
-	sockaddr_in from;
 #if defined(RTS_DEBUG)
 	UnsignedInt now = timeGetTime();
 #endif
 
-	TransportMessage incomingMessage;
-	unsigned char *buf = (unsigned char *)&incomingMessage;
+	// TheSuperHackers @performance Read the waiting packets in batches, with one socket call per batch.
+	TransportMessage incomingMessages[RECV_BATCH_SIZE];
+	UDP::Datagram datagrams[RECV_BATCH_SIZE];
+	Int numRead = 0;
+	Int batchIndex = 0;
 	int len = MAX_MESSAGE_LEN;
 //	DEBUG_LOG(("Transport::doRecv - checking"));
-	while ( (len=m_udpsock->Read(buf, MAX_MESSAGE_LEN, &from)) > 0 )
+	for (;;)
 	{
+		if (batchIndex == numRead)
+		{
+			// the last batch was not full, so there is nothing more waiting.
+			if (numRead > 0 && numRead < RECV_BATCH_SIZE)
+				break;
+
+			for (Int k=0; k<RECV_BATCH_SIZE; ++k)
+			{
+				datagrams[k].buf = (unsigned char *)&incomingMessages[k];
+				datagrams[k].len = MAX_MESSAGE_LEN;
+			}
+			numRead = readSocket(datagrams, RECV_BATCH_SIZE);
+			batchIndex = 0;
+			if (numRead <= 0)
+			{
+				len = numRead;
+				break;
+			}
+		}
+
+		TransportMessage &incomingMessage = incomingMessages[batchIndex];
+		unsigned char *buf = datagrams[batchIndex].buf;
+		UnsignedInt fromAddr = datagrams[batchIndex].ip;
+		UnsignedShort fromPort = datagrams[batchIndex].port;
+		len = datagrams[batchIndex].result;
+		++batchIndex;
+
 #if defined(RTS_DEBUG)
 		// Packet loss simulation
 		if (m_usePacketLoss)
@@ -319,9 +426,11 @@ Bool Transport::doRecv()
 		}
 
 		// Something there; stick it somewhere
-//		DEBUG_LOG(("Saw %d bytes from %d:%d", len, ntohl(from.sin_addr.S_un.S_addr), ntohs(from.sin_port)));
+//		DEBUG_LOG(("Saw %d bytes from %d:%d", len, fromAddr, fromPort));
 		m_incomingPackets[m_statisticsSlot]++;
 		m_incomingBytes[m_statisticsSlot] += len;
+		++m_totals.m_incomingPackets;
+		m_totals.m_incomingBytes += len;
 
 		for (int i=0; i<MAX_MESSAGES; ++i)
 		{
@@ -337,8 +446,8 @@ Bool Transport::doRecv()
 						(Int)(TheGlobalData->m_latencyAmplitude * sin(now * TheGlobalData->m_latencyPeriod)) +
 						GameClientRandomValue(-TheGlobalData->m_latencyNoise, TheGlobalData->m_latencyNoise);
 					m_delayedInBuffer[i].message.length = incomingMessage.length;
-					m_delayedInBuffer[i].message.addr = ntohl(from.sin_addr.S_un.S_addr);
-					m_delayedInBuffer[i].message.port = ntohs(from.sin_port);
+					m_delayedInBuffer[i].message.addr = fromAddr;
+					m_delayedInBuffer[i].message.port = fromPort;
 					memcpy(&m_delayedInBuffer[i].message, buf, len);
 					break;
 				}
@@ -350,8 +459,8 @@ Bool Transport::doRecv()
 				{
 					// Empty slot; use it
 					m_inBuffer[i].length = incomingMessage.length;
-					m_inBuffer[i].addr = ntohl(from.sin_addr.S_un.S_addr);
-					m_inBuffer[i].port = ntohs(from.sin_port);
+					m_inBuffer[i].addr = fromAddr;
+					m_inBuffer[i].port = fromPort;
 					memcpy(&m_inBuffer[i], buf, len);
 					break;
 				}
@@ -374,42 +483,69 @@ Bool Transport::doRecv()
 Bool Transport::queueSend(UnsignedInt addr, UnsignedShort port, const UnsignedByte *buf, Int len /*,
 						  NetMessageFlags flags, Int id */)
 {
-	int i;
-
 	if (len < 1 || len > MAX_PACKET_SIZE)
 	{
 		DEBUG_LOG(("Transport::queueSend - Invalid Packet size"));
 		return false;
 	}
 
-	for (i=0; i<MAX_MESSAGES; ++i)
+	TransportMessage *msg = beginSend(addr, port);
+	if (msg == NULL)
 	{
-		if (m_outBuffer[i].length == 0)
-		{
-			// Insert data here
-			m_outBuffer[i].length = len;
-			memcpy(m_outBuffer[i].data, buf, len);
-			m_outBuffer[i].addr = addr;
-			m_outBuffer[i].port = port;
-//			m_outBuffer[i].header.flags = flags;
-//			m_outBuffer[i].header.id = id;
-			m_outBuffer[i].header.magic = GENERALS_MAGIC_NUMBER;
-
-			CRC crc;
-			crc.computeCRC( (unsigned char *)(&(m_outBuffer[i].header.magic)), m_outBuffer[i].length + sizeof(TransportMessageHeader) - sizeof(UnsignedInt) );
-//			DEBUG_LOG(("About to assign the CRC for the packet"));
-			m_outBuffer[i].header.crc = crc.get();
-
-			// Encrypt packet
-//			DEBUG_LOG(("buffer: "));
-			encryptBuf((unsigned char *)&m_outBuffer[i], len + sizeof(TransportMessageHeader));
-//			DEBUG_LOG((""));
-
-			return true;
-		}
+		return false;
+	}
+
+	// Insert data here
+	memcpy(msg->data, buf, len);
+	return endSend(msg, len);
+}
+
+TransportMessage * Transport::beginSend(UnsignedInt addr, UnsignedShort port)
+{
+	if (m_numFreeSendSlots == 0)
+	{
+		DEBUG_LOG(("Send Queue is getting full, dropping packets"));
+		return NULL;
+	}
+
+	TransportMessage *msg = &m_outBuffer[m_freeSendSlots[--m_numFreeSendSlots]];
+	msg->length = 0;
+	msg->addr = addr;
+	msg->port = port;
+	return msg;
+}
+
+Bool Transport::endSend(TransportMessage *msg, Int len)
+{
+	Int i = (Int)(msg - m_outBuffer);
+	DEBUG_ASSERTCRASH(i >= 0 && i < MAX_MESSAGES && msg->length == 0, ("Transport::endSend - not a slot from beginSend"));
+
+	if (len < 1 || len > MAX_PACKET_SIZE)
+	{
+		DEBUG_ASSERTLOG(len == 0, ("Transport::endSend - Invalid Packet size"));
+		m_freeSendSlots[m_numFreeSendSlots++] = i;
+		return len == 0;
 	}
-	DEBUG_LOG(("Send Queue is getting full, dropping packets"));
-	return false;
+
+	msg->length = len;
+//	msg->header.flags = flags;
+//	msg->header.id = id;
+	msg->header.magic = GENERALS_MAGIC_NUMBER;
+
+	CRC crc;
+	crc.computeCRC( (unsigned char *)(&(msg->header.magic)), msg->length + sizeof(TransportMessageHeader) - sizeof(UnsignedInt) );
+//	DEBUG_LOG(("About to assign the CRC for the packet"));
+	msg->header.crc = crc.get();
+
+	// Encrypt packet
+//	DEBUG_LOG(("buffer: "));
+	encryptBuf((unsigned char *)msg, len + sizeof(TransportMessageHeader));
+//	DEBUG_LOG((""));
+
+	m_sendQueue[(m_sendQueueHead + m_sendQueueLength) % MAX_MESSAGES] = i;
+	++m_sendQueueLength;
+
+	return true;
 }
 
 Bool Transport::isGeneralsPacket( TransportMessage *msg )
@@ -177,7 +177,7 @@ Int UDP::Bind(UnsignedInt IP,UnsignedShort Port)
     return(status);
   }
 
-  int namelen=sizeof(addr);
+  socklen_t namelen=sizeof(addr);
   getsockname(fd, (struct sockaddr *)&addr, &namelen);
 
   myIP=ntohl(addr.sin_addr.s_addr);
@@ -262,7 +262,7 @@ Int UDP::Write(const unsigned char *msg,UnsignedInt len,UnsignedInt IP,UnsignedS
 Int UDP::Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from)
 {
   Int retval;
-  int    alen=sizeof(sockaddr_in);
+  socklen_t alen=sizeof(sockaddr_in);
 
   if (from!=NULL)
   {
@@ -309,6 +309,137 @@ Int UDP::Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from)
   return(retval);
 }
 
+Int UDP::ReadBatch(Datagram *datagrams,Int count)
+{
+#if defined(_UNIX) && defined(__linux__)
+  enum { MAX_BATCH = 64 };
+  struct mmsghdr msgs[MAX_BATCH];
+  struct iovec iovecs[MAX_BATCH];
+  struct sockaddr_in froms[MAX_BATCH];
+
+  if (count > MAX_BATCH)
+    count = MAX_BATCH;
+
+  memset(msgs, 0, sizeof(struct mmsghdr) * count);
+  for (Int i=0; i<count; ++i)
+  {
+    iovecs[i].iov_base = datagrams[i].buf;
+    iovecs[i].iov_len = datagrams[i].len;
+    msgs[i].msg_hdr.msg_iov = &iovecs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &froms[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+  }
+
+  ClearStatus();
+  Int numRead = recvmmsg(fd, msgs, count, MSG_DONTWAIT, NULL);
+  if (numRead < 0)
+  {
+    if (errno == EAGAIN || errno == EWOULDBLOCK)
+      return(0);
+    m_lastError = errno;
+    return(-1);
+  }
+
+  for (Int i=0; i<numRead; ++i)
+  {
+    datagrams[i].result = msgs[i].msg_len;
+    datagrams[i].ip = ntohl(froms[i].sin_addr.s_addr);
+    datagrams[i].port = ntohs(froms[i].sin_port);
+  }
+  return(numRead);
+#else
+  Int numRead = 0;
+  sockaddr_in from;
+
+  while (numRead < count)
+  {
+    Int retval = Read(datagrams[numRead].buf, datagrams[numRead].len, &from);
+    if (retval <= 0)
+    {
+      if (retval < 0 && numRead == 0)
+        return(-1);
+      break;
+    }
+    datagrams[numRead].result = retval;
+    datagrams[numRead].ip = ntohl(from.sin_addr.s_addr);
+    datagrams[numRead].port = ntohs(from.sin_port);
+    ++numRead;
+  }
+  return(numRead);
+#endif
+}
+
+Int UDP::WriteBatch(Datagram *datagrams,Int count)
+{
+  Int numSent = 0;
+
+#if defined(_UNIX) && defined(__linux__)
+  enum { MAX_BATCH = 64 };
+  struct mmsghdr msgs[MAX_BATCH];
+  struct iovec iovecs[MAX_BATCH];
+  struct sockaddr_in tos[MAX_BATCH];
+
+  Int done = 0;
+  while (done < count)
+  {
+    // Datagrams without an address fail like they do in Write, and are not handed to the system.
+    if ((datagrams[done].ip==0)||(datagrams[done].port==0))
+    {
+      m_lastError = EADDRNOTAVAIL;
+      datagrams[done].result = ADDRNOTAVAIL;
+      ++done;
+      continue;
+    }
+
+    Int batch = 0;
+    while (done + batch < count && batch < MAX_BATCH && datagrams[done + batch].ip != 0 && datagrams[done + batch].port != 0)
+    {
+      Datagram &datagram = datagrams[done + batch];
+      memset(&msgs[batch], 0, sizeof(struct mmsghdr));
+      memset(&tos[batch], 0, sizeof(sockaddr_in));
+      tos[batch].sin_family = AF_INET;
+      tos[batch].sin_port = htons(datagram.port);
+      tos[batch].sin_addr.s_addr = htonl(datagram.ip);
+      iovecs[batch].iov_base = datagram.buf;
+      iovecs[batch].iov_len = datagram.len;
+      msgs[batch].msg_hdr.msg_iov = &iovecs[batch];
+      msgs[batch].msg_hdr.msg_iovlen = 1;
+      msgs[batch].msg_hdr.msg_name = &tos[batch];
+      msgs[batch].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      ++batch;
+    }
+
+    ClearStatus();
+    Int retval = sendmmsg(fd, msgs, batch, 0);
+    if (retval <= 0)
+    {
+      // the first datagram of the batch failed, skip it and go on with the rest like Write would
+      m_lastError = errno;
+      datagrams[done].result = -1;
+      ++done;
+      continue;
+    }
+
+    for (Int i=0; i<retval; ++i)
+    {
+      datagrams[done + i].result = msgs[i].msg_len;
+      ++numSent;
+    }
+    done += retval;
+  }
+#else
+  for (Int i=0; i<count; ++i)
+  {
+    datagrams[i].result = Write(datagrams[i].buf, datagrams[i].len, datagrams[i].ip, datagrams[i].port);
+    if (datagrams[i].result > 0)
+      ++numSent;
+  }
+#endif
+
+  return(numSent);
+}
+
 
 void UDP::ClearStatus(void)
 {
@@ -373,8 +504,10 @@ UDP::sockStat UDP::GetStatus(void)
       return ALREADY;
     case EAGAIN:
       return AGAIN;
+#if EWOULDBLOCK != EAGAIN
     case EWOULDBLOCK:
       return WOULDBLOCK;
+#endif
     case EBADF:
       return BADF;
     default:
@@ -505,7 +638,8 @@ Int UDP::SetOutputBuffer(UnsignedInt bytes)
 
 int UDP::GetInputBuffer(void)
 {
-   int retval,arg=0,len=sizeof(int);
+   int retval,arg=0;
+   socklen_t len=sizeof(int);
 
    retval=getsockopt(fd,SOL_SOCKET,SO_RCVBUF,
      (char *)&arg,&len);
@@ -515,7 +649,8 @@ int UDP::GetInputBuffer(void)
 
 int UDP::GetOutputBuffer(void)
 {
-   int retval,arg=0,len=sizeof(int);
+   int retval,arg=0;
+   socklen_t len=sizeof(int);
 
    retval=getsockopt(fd,SOL_SOCKET,SO_SNDBUF,
      (char *)&arg,&len);
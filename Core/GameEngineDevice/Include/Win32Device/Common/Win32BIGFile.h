@@ -40,6 +40,7 @@ class Win32BIGFile : public ArchiveFile
 
 		virtual Bool					getFileInfo(const AsciiString& filename, FileInfo *fileInfo) const;	///< fill in the fileInfo struct with info about the requested file.
 		virtual File*					openFile( const Char *filename, Int access = 0 );///< Open the specified file within the BIG file
+		virtual File*					openArchivedFile( const Char *filename, const ArchivedFileInfo *fileInfo, Int access = 0 );///< Open the file within the BIG file whose directory entry is already known
 		virtual void					closeAllFiles( void );									///< Close all file opened in this BIG file
 		virtual AsciiString		getName( void );												///< Returns the name of the BIG file
 		virtual AsciiString		getPath( void );												///< Returns full path and name of BIG file
@@ -33,6 +33,7 @@
 #include "Common/GameAudio.h"
 #include "Common/GameMemory.h"
 #include "Common/LocalFileSystem.h"
+#include "Common/StartupProfiler.h"
 
 #if RTS_ZEROHOUR
 #include "Common/Registry.h"
@@ -78,102 +79,150 @@ void StdBIGFileSystem::update() {
 void StdBIGFileSystem::postProcessLoad() {
 }
 
-ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
-	File *fp = TheLocalFileSystem->openFile(filename, File::READ | File::BINARY);
-	AsciiString archiveFileName;
-	archiveFileName = filename;
-	archiveFileName.toLower();
-	Int archiveFileSize = 0;
-	Int numLittleFiles = 0;
-
-	ArchiveFile *archiveFile = NEW StdBIGFile(filename, AsciiString::TheEmptyString);
+//============================================================================
+// readDirectoryBytes
+//============================================================================
+// Makes sure that at least 'needed' bytes of the directory are in 'directory',
+// reading more of the archive file if necessary.
+static Bool readDirectoryBytes(File *fp, std::vector<char> &directory, size_t needed)
+{
+	if (directory.size() >= needed) {
+		return TRUE;
+	}
 
-	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - opening BIG file %s", filename));
+	const size_t oldSize = directory.size();
+	const size_t newSize = (needed > oldSize * 2) ? needed : oldSize * 2;
+	directory.resize(newSize);
+	const Int bytesRead = fp->read(&directory[oldSize], (Int)(newSize - oldSize));
+	directory.resize(bytesRead > 0 ? oldSize + bytesRead : oldSize);
 
-	if (fp == NULL) {
-		DEBUG_CRASH(("Could not open archive file %s for parsing", filename));
-		return NULL;
-	}
+	return directory.size() >= needed;
+}
 
-	AsciiString asciibuf;
-	char buffer[_MAX_PATH];
-	fp->read(buffer, 4); // read the "BIG" at the beginning of the file.
-	buffer[4] = 0;
-	if (strcmp(buffer, BIGFileIdentifier) != 0) {
+//============================================================================
+// readBigDirectory
+//============================================================================
+// TheSuperHackers @performance Reads the directory of a BIG file with one read and parses it from
+// memory, instead of reading the path of every entry one byte at a time.
+static Bool readBigDirectory(File *fp, const Char *filename, ArchiveIndex &index)
+{
+	// The header is the "BIG" identifier, the archive size, the number of files and the size of
+	// the header and directory together. The last two are in big endian byte order.
+	char header[0x10];
+	if (fp->read(header, sizeof(header)) != sizeof(header) || memcmp(header, BIGFileIdentifier, 4) != 0) {
 		DEBUG_CRASH(("Error reading BIG file identifier in file %s", filename));
-		fp->close();
-		fp = NULL;
-		return NULL;
+		return FALSE;
 	}
 
-	// read in the file size.
-	fp->read(&archiveFileSize, 4);
+	Int archiveFileSize = 0;
+	Int numLittleFiles = 0;
+	Int directoryEnd = 0;
+	memcpy(&archiveFileSize, header + 4, 4);
+	memcpy(&numLittleFiles, header + 8, 4);
+	memcpy(&directoryEnd, header + 12, 4);
+	numLittleFiles = betoh(numLittleFiles);
+	directoryEnd = betoh(directoryEnd);
 
 	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - size of archive file is %d bytes", archiveFileSize));
+	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - %d are contained in archive", numLittleFiles));
 
-//	char t;
-
-	// read in the number of files contained in this BIG file.
-	// change the order of the bytes cause the file size is in reverse byte order for some reason.
-	fp->read(&numLittleFiles, 4);
-	numLittleFiles = betoh(numLittleFiles);
+	// every entry takes at least 9 bytes
+	if (numLittleFiles < 0 || numLittleFiles > fp->size() / 9) {
+		DEBUG_CRASH(("Error reading BIG file directory in file %s", filename));
+		return FALSE;
+	}
 
-	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - %d are contained in archive", numLittleFiles));
-//	for (Int i = 0; i < 2; ++i) {
-//		t = buffer[i];
-//		buffer[i] = buffer[(4-i)-1];
-//		buffer[(4-i)-1] = t;
-//	}
+	// Some tools do not write the directory size correctly, so it is only a hint for the first read.
+	std::vector<char> directory;
+	const Int directorySize = directoryEnd - (Int)sizeof(header);
+	readDirectoryBytes(fp, directory, directorySize > 0 ? directorySize : 0x10000);
 
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
-	// read in each directory listing.
-	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
+	index.resize(numLittleFiles);
 
+	size_t pos = 0;
 	for (Int i = 0; i < numLittleFiles; ++i) {
-		Int filesize = 0;
-		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
+		// each entry is the offset and the size of the file followed by its zero terminated path
+		if (!readDirectoryBytes(fp, directory, pos + 9)) {
+			DEBUG_CRASH(("Error reading BIG file directory in file %s", filename));
+			return FALSE;
+		}
 
-		filesize = betoh(filesize);
-		fileOffset = betoh(fileOffset);
+		Int fileOffset = 0;
+		Int filesize = 0;
+		memcpy(&fileOffset, &directory[pos], 4);
+		memcpy(&filesize, &directory[pos + 4], 4);
+		pos += 8;
+
+		size_t pathEnd = pos;
+		for (;;) {
+			if (pathEnd == directory.size() && !readDirectoryBytes(fp, directory, pathEnd + 1)) {
+				DEBUG_CRASH(("Error reading BIG file directory in file %s", filename));
+				return FALSE;
+			}
+			if (directory[pathEnd] == 0) {
+				break;
+			}
+			++pathEnd;
+		}
 
-		fileInfo->m_archiveFilename = archiveFileName;
-		fileInfo->m_offset = fileOffset;
-		fileInfo->m_size = filesize;
+		const char *path = &directory[pos];
+		const Int pathLength = (Int)(pathEnd - pos);
+		pos = pathEnd + 1;
 
-		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
+		if (pathLength >= _MAX_PATH) {
+			DEBUG_CRASH(("Error reading BIG file directory in file %s", filename));
+			return FALSE;
+		}
 
-		Int filenameIndex = pathIndex;
-		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
+		Int filenameIndex = pathLength;
+		while ((filenameIndex > 0) && (path[filenameIndex - 1] != '\\') && (path[filenameIndex - 1] != '/')) {
 			--filenameIndex;
 		}
 
-		fileInfo->m_filename = (char *)(buffer + filenameIndex + 1);
-		fileInfo->m_filename.toLower();
-		buffer[filenameIndex + 1] = 0;
+		ArchiveIndexEntry &entry = index[i];
+		entry.m_offset = betoh(fileOffset);
+		entry.m_size = betoh(filesize);
+		entry.m_path.set(path, filenameIndex);
+		entry.m_filename.set(path + filenameIndex, pathLength - filenameIndex);
+		entry.m_filename.toLower();
+	}
+
+	return TRUE;
+}
+
+ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
+	File *fp = TheLocalFileSystem->openFile(filename, File::READ | File::BINARY);
+	AsciiString archiveFileName;
+	archiveFileName = filename;
+	archiveFileName.toLower();
 
-		AsciiString path;
-		path = buffer;
+	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - opening BIG file %s", filename));
 
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
+	if (fp == NULL) {
+		DEBUG_CRASH(("Could not open archive file %s for parsing", filename));
+		return NULL;
+	}
 
-		archiveFile->addFile(path, fileInfo);
+	// TheSuperHackers @performance Take the directory from the archive index cache if the archive
+	// file did not change since it was cached.
+	ArchiveIndex parsedIndex;
+	const ArchiveIndex *index = findCachedArchiveIndex(filename);
+	if (index == NULL) {
+		if (!readBigDirectory(fp, filename, parsedIndex)) {
+			fp->close();
+			fp = NULL;
+			return NULL;
+		}
+		cacheArchiveIndex(filename, parsedIndex);
+		index = &parsedIndex;
 	}
 
-	archiveFile->attachFile(fp);
+	// TheSuperHackers @fix Mauller 23/04/2025 Create new file handle when necessary to prevent memory leak
+	ArchiveFile *archiveFile = NEW StdBIGFile(filename, AsciiString::TheEmptyString);
 
-	delete fileInfo;
-	fileInfo = NULL;
+	archiveFile->addFiles(archiveFileName, *index);
+
+	archiveFile->attachFile(fp);
 
 	// leave fp open as the archive file will be using it.
 
@@ -225,14 +274,18 @@ Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fi
 		}
 #endif
 
-		ArchiveFile *archiveFile = openArchiveFile((*it).str());
+		{
+			StartupProfilerScope profileArchive("BIG", (*it).str());
+
+			ArchiveFile *archiveFile = openArchiveFile((*it).str());
 
-		if (archiveFile != NULL) {
-			DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - loading %s into the directory tree.", (*it).str()));
-			loadIntoDirectoryTree(archiveFile, overwrite);
-			m_archiveFileMap[(*it)] = archiveFile;
-			DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.", (*it).str()));
-			actuallyAdded = TRUE;
+			if (archiveFile != NULL) {
+				DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - loading %s into the directory tree.", (*it).str()));
+				loadIntoDirectoryTree(archiveFile, overwrite);
+				m_archiveFileMap[(*it)] = archiveFile;
+				DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.", (*it).str()));
+				actuallyAdded = TRUE;
+			}
 		}
 
 		it++;
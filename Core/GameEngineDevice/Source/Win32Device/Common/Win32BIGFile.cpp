@@ -66,6 +66,24 @@ File* Win32BIGFile::openFile( const Char *filename, Int access )
 		return NULL;
 	}
 
+	return openArchivedFile(filename, fileInfo, access);
+}
+
+//============================================================================
+// Win32BIGFile::openArchivedFile
+//============================================================================
+
+File* Win32BIGFile::openArchivedFile( const Char *filename, const ArchivedFileInfo *fileInfo, Int access )
+{
+
+	// TheSuperHackers @performance Read only files point straight into the mapped archive.
+	if (!BitIsSet(access, File::STREAMING) && (access & File::WRITE) == 0) {
+		File *mappedFile = openMappedFile(fileInfo);
+		if (mappedFile != NULL) {
+			return mappedFile;
+		}
+	}
+
 	RAMFile *ramFile = NULL;
 
 	if (BitIsSet(access, File::STREAMING))
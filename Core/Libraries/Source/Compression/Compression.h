@@ -24,6 +24,8 @@
 
 #include "Lib/BaseTypeCore.h"
 
+#include <vector>
+
 enum CompressionType
 {
 	COMPRESSION_MIN = 0,
@@ -64,3 +66,89 @@ public:
 
 	static CompressionType getPreferredCompression( void );
 };
+
+// TheSuperHackers @performance DecompressionStream decompresses data that was written by
+// CompressionManager::compressData piece by piece. Compressed data is fed in as it is read, and
+// uncompressed data is pulled into a buffer of any size, so that neither has to be held in memory
+// as a whole. RefPack and ZLib are decoded incrementally. NoxLZH, BTree and Huff have no incremental
+// decoders and are decoded in one go once all input was fed. Data without a compression header is
+// passed through unchanged.
+class DecompressionStream
+{
+public:
+
+	DecompressionStream();
+	~DecompressionStream();
+
+	void reset( void );												///< Prepares the stream for new data.
+
+	void feed( const void *src, Int srcLen );	///< Appends compressed data. The data is copied.
+	void finish( void );											///< Marks the end of the compressed data.
+
+	/// Writes up to destLen uncompressed bytes to dest and returns their number. Returns 0 if more input
+	/// must be fed or all data was returned, and -1 if the data is damaged or ended too early.
+	Int pull( void *dest, Int destLen );
+
+	Bool isDone( void ) const { return m_state == STATE_DONE; }
+	Bool hasError( void ) const { return m_state == STATE_ERROR; }
+	Bool isFinished( void ) const { return m_finished; }
+
+	/// Returns COMPRESSION_NONE until the header was fed.
+	CompressionType getCompressionType( void ) const { return m_compType; }
+
+	/// Returns -1 until the header was fed, and for data that is not compressed.
+	Int getUncompressedSize( void ) const { return m_uncompressedSize; }
+
+	/// Returns the bytes of the buffers held by the stream, for comparing it with the one-shot API.
+	Int getBufferSize( void ) const;
+
+private:
+
+	enum State
+	{
+		STATE_HEADER,
+		STATE_DATA,
+		STATE_DONE,
+		STATE_ERROR,
+	};
+
+	DecompressionStream(const DecompressionStream&);
+	DecompressionStream& operator=(const DecompressionStream&);
+
+	Int getInputSize( void ) const { return (Int)m_input.size() - m_inputPos; }
+	const UnsignedByte *getInput( void ) const { return &m_input[m_inputPos]; }
+
+	Bool readHeader( void );
+	Int pullStored( UnsignedByte *dest, Int destLen );
+	Int pullRefPack( UnsignedByte *dest, Int destLen );
+	Int pullZLib( UnsignedByte *dest, Int destLen );
+	Int pullBuffered( UnsignedByte *dest, Int destLen );
+	Bool readRefPackHeader( void );
+	Bool readRefPackCommand( void );
+	void writeRefPackWindow( const UnsignedByte *src, Int len );
+	Int fail( void );
+
+	State m_state;
+	CompressionType m_compType;
+	Int m_uncompressedSize;
+	Int m_totalOut;										///< uncompressed bytes returned so far
+	Bool m_finished;
+
+	std::vector<UnsignedByte> m_input;	///< fed data that was not consumed yet starts at m_inputPos
+	Int m_inputPos;
+
+	// RefPack
+	std::vector<UnsignedByte> m_window;	///< the most recent output, for back references
+	Bool m_refPackHeaderRead;
+	Bool m_refPackEnded;							///< the end command was read
+	Int m_literalsLeft;								///< bytes still to copy from the input
+	Int m_matchLeft;									///< bytes still to copy from the window
+	Int m_matchDistance;
+
+	// ZLib
+	void *m_zStream;
+
+	// NoxLZH, BTree, Huff
+	std::vector<UnsignedByte> m_output;
+	Int m_outputPos;
+};
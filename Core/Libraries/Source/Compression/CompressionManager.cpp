@@ -350,14 +350,57 @@ Int CompressionManager::decompressData( void *srcVoid, Int srcLen, void *destVoi
 
 #include "Common/PerfTimer.h"
 enum { NUM_TIMES = 10 };
+enum { STREAM_CHUNK_SIZE = 16 * 1024 };
 
 struct CompData
 {
 public:
 	Int origSize;
 	Int compressedSize[COMPRESSION_MAX+1];
+	Int streamPeakBytes[COMPRESSION_MAX+1];
 };
 
+// Decompresses in chunks, the way a DecompressingFile reads a file. Returns the bytes produced.
+static Int streamDecompress( DecompressionStream &stream, const UnsignedByte *src, Int srcLen, UnsignedByte *dest, Int destLen, Int &peakBytes )
+{
+	UnsignedByte chunk[STREAM_CHUNK_SIZE];
+	Int srcPos = 0;
+	Int destPos = 0;
+
+	stream.reset();
+	peakBytes = 0;
+
+	while (!stream.isDone())
+	{
+		Int len = stream.pull(chunk, sizeof(chunk));
+		if (len < 0)
+			break;
+
+		if (len == 0)
+		{
+			if (stream.isFinished())
+				break;
+			const Int feedLen = min(srcLen - srcPos, (Int)STREAM_CHUNK_SIZE);
+			if (feedLen > 0)
+				stream.feed(src + srcPos, feedLen);
+			else
+				stream.finish();
+			srcPos += feedLen;
+		}
+		else
+		{
+			len = min(len, destLen - destPos);
+			memcpy(dest + destPos, chunk, len);
+			destPos += len;
+		}
+
+		// the input and output chunks plus what the stream holds on to
+		peakBytes = max(peakBytes, stream.getBufferSize() + 2 * STREAM_CHUNK_SIZE);
+	}
+
+	return destPos;
+}
+
 void DoCompressTest( void )
 {
 
@@ -365,12 +408,18 @@ void DoCompressTest( void )
 
 	PerfGather *s_compressGathers[COMPRESSION_MAX+1];
 	PerfGather *s_decompressGathers[COMPRESSION_MAX+1];
+	PerfGather *s_streamGathers[COMPRESSION_MAX+1];
+	static char s_streamNames[COMPRESSION_MAX+1][64];
 	for (i = 0; i < COMPRESSION_MAX+1; ++i)
 	{
 		s_compressGathers[i] = new PerfGather(CompressionManager::getCompressionNameByType((CompressionType)i));
 		s_decompressGathers[i] = new PerfGather(CompressionManager::getDecompressionNameByType((CompressionType)i));
+		sprintf(s_streamNames[i], "%s (stream)", CompressionManager::getDecompressionNameByType((CompressionType)i));
+		s_streamGathers[i] = new PerfGather(s_streamNames[i]);
 	}
 
+	DecompressionStream stream;
+
 	std::map<AsciiString, CompData> s_sizes;
 
 	std::map<AsciiString, MapMetaData>::const_iterator it = TheMapCache->begin();
@@ -420,6 +469,27 @@ void DoCompressTest( void )
 					s_decompressGathers[i]->stopTimer();
 				}
 				d.compressedSize[i] = compressedLen;
+
+				Int streamedLen = 0;
+				Int streamPeakBytes = 0;
+				for (Int j=0; j < NUM_TIMES; ++j)
+				{
+					memset(uncompressedBuf, 0, origSize);
+					s_streamGathers[i]->startTimer();
+					streamedLen = streamDecompress(stream, compressedBuf, compressedLen, uncompressedBuf, origSize, streamPeakBytes);
+					s_streamGathers[i]->stopTimer();
+				}
+				d.streamPeakBytes[i] = streamPeakBytes;
+				DEBUG_LOG(("Streamed len is %d, peak memory %d bytes streamed vs %d bytes one-shot", streamedLen,
+					streamPeakBytes, compressedLen + origSize));
+				DEBUG_ASSERTCRASH(streamedLen == origSize, ("orig size does not match streamed output"));
+				if (streamedLen == origSize && memcmp(buf, uncompressedBuf, origSize) != 0)
+				{
+					DEBUG_CRASH(("orig buffer does not match streamed output"));
+				}
+
+				memset(uncompressedBuf, 0, origSize);
+				decompressedLen = CompressionManager::decompressData(compressedBuf, compressedLen, uncompressedBuf, origSize);
 				DEBUG_LOG(("Compressed len is %d (%g%% of original size)", compressedLen, (double)compressedLen/(double)origSize*100.0));
 				DEBUG_ASSERTCRASH(compressedLen, ("Failed to compress"));
 				DEBUG_LOG(("Decompressed len is %d (%g%% of original size)", decompressedLen, (double)decompressedLen/(double)origSize*100.0));
@@ -458,6 +528,8 @@ void DoCompressTest( void )
 		Real minCompression = 0.0f;
 		Int totalUncompressedBytes = 0;
 		Int totalCompressedBytes = 0;
+		Int maxOneShotBytes = 0;
+		Int maxStreamBytes = 0;
 		for (std::map<AsciiString, CompData>::iterator cd = s_sizes.begin(); cd != s_sizes.end(); ++cd)
 		{
 			CompData d = cd->second;
@@ -468,6 +540,9 @@ void DoCompressTest( void )
 
 			totalUncompressedBytes += d.origSize;
 			totalCompressedBytes += d.compressedSize[i];
+
+			maxOneShotBytes = max(maxOneShotBytes, d.origSize + d.compressedSize[i]);
+			maxStreamBytes = max(maxStreamBytes, d.streamPeakBytes[i]);
 		}
 		DEBUG_LOG(("***************************************************"));
 		DEBUG_LOG(("Compression method %s:", CompressionManager::getCompressionNameByType((CompressionType)i)));
@@ -475,6 +550,8 @@ void DoCompressTest( void )
 			totalCompressedBytes/(Real)totalUncompressedBytes*100.0f));
 		DEBUG_LOG(("Min ratio: %g%%, Max ratio: %g%%",
 			minCompression*100.0f, maxCompression*100.0f));
+		DEBUG_LOG(("Peak decompression memory: %d bytes one-shot, %d bytes streamed",
+			maxOneShotBytes, maxStreamBytes));
 		DEBUG_LOG((""));
 	}
 
@@ -490,6 +567,9 @@ void DoCompressTest( void )
 
 		delete s_decompressGathers[i];
 		s_decompressGathers[i] = NULL;
+
+		delete s_streamGathers[i];
+		s_streamGathers[i] = NULL;
 	}
 
 }
@@ -0,0 +1,471 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: DecompressionStream.cpp //////////////////////////////////////////////////////////////////
+// Decompresses the data of CompressionManager piece by piece.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Compression.h"
+
+#include <string.h>
+
+#define __MACTYPES__
+#include <zlib.h>
+
+enum
+{
+	HEADER_SIZE = 8,
+	REFPACK_WINDOW_SIZE = 1 << 17,	///< the largest RefPack back reference
+	REFPACK_WINDOW_MASK = REFPACK_WINDOW_SIZE - 1,
+};
+
+DecompressionStream::DecompressionStream()
+	: m_zStream(NULL)
+{
+	reset();
+}
+
+DecompressionStream::~DecompressionStream()
+{
+	reset();
+}
+
+void DecompressionStream::reset( void )
+{
+	if (m_zStream != NULL)
+	{
+		inflateEnd((z_stream *)m_zStream);
+		delete (z_stream *)m_zStream;
+		m_zStream = NULL;
+	}
+
+	m_state = STATE_HEADER;
+	m_compType = COMPRESSION_NONE;
+	m_uncompressedSize = -1;
+	m_totalOut = 0;
+	m_finished = FALSE;
+
+	m_input.clear();
+	m_inputPos = 0;
+
+	m_refPackHeaderRead = FALSE;
+	m_refPackEnded = FALSE;
+	m_literalsLeft = 0;
+	m_matchLeft = 0;
+	m_matchDistance = 0;
+
+	m_output.clear();
+	m_outputPos = 0;
+}
+
+void DecompressionStream::feed( const void *src, Int srcLen )
+{
+	if (srcLen <= 0 || m_finished)
+		return;
+
+	// drop the consumed data first, so that the buffer only holds what is not decoded yet
+	if (m_inputPos > 0)
+	{
+		m_input.erase(m_input.begin(), m_input.begin() + m_inputPos);
+		m_inputPos = 0;
+	}
+
+	const UnsignedByte *bytes = (const UnsignedByte *)src;
+	m_input.insert(m_input.end(), bytes, bytes + srcLen);
+}
+
+void DecompressionStream::finish( void )
+{
+	m_finished = TRUE;
+}
+
+Int DecompressionStream::getBufferSize( void ) const
+{
+	Int size = (Int)(m_input.capacity() + m_window.capacity() + m_output.capacity());
+	if (m_zStream != NULL)
+		size += sizeof(z_stream) + (1 << MAX_WBITS);
+	return size;
+}
+
+Int DecompressionStream::fail( void )
+{
+	m_state = STATE_ERROR;
+	return -1;
+}
+
+Bool DecompressionStream::readHeader( void )
+{
+	if (getInputSize() < HEADER_SIZE)
+	{
+		if (!m_finished)
+			return FALSE;
+
+		// too short for a header, so it can only be uncompressed data
+		m_compType = COMPRESSION_NONE;
+		m_state = STATE_DATA;
+		return TRUE;
+	}
+
+	m_compType = CompressionManager::getCompressionType(getInput(), getInputSize());
+	m_state = STATE_DATA;
+
+	if (m_compType == COMPRESSION_NONE)
+		return TRUE;
+
+	m_uncompressedSize = CompressionManager::getUncompressedSize(getInput(), getInputSize());
+	if (m_uncompressedSize < 0)
+		return FALSE;
+
+	if (m_compType == COMPRESSION_REFPACK)
+	{
+		m_inputPos += HEADER_SIZE;
+		m_window.resize(REFPACK_WINDOW_SIZE);
+	}
+	else if (m_compType >= COMPRESSION_ZLIB1 && m_compType <= COMPRESSION_ZLIB9)
+	{
+		m_inputPos += HEADER_SIZE;
+		z_stream *zs = new z_stream;
+		memset(zs, 0, sizeof(*zs));
+		if (inflateInit(zs) != Z_OK)
+		{
+			delete zs;
+			return FALSE;
+		}
+		m_zStream = zs;
+	}
+
+	// the buffered decoders take the data with its header
+	return TRUE;
+}
+
+Int DecompressionStream::pull( void *destVoid, Int destLen )
+{
+	if (m_state == STATE_ERROR)
+		return -1;
+
+	if (m_state == STATE_DONE || destLen <= 0)
+		return 0;
+
+	if (m_state == STATE_HEADER)
+	{
+		if (!readHeader())
+		{
+			if (m_state == STATE_HEADER)
+				return 0;
+			return fail();
+		}
+	}
+
+	UnsignedByte *dest = (UnsignedByte *)destVoid;
+
+	// never write more than the header announced, even for damaged data
+	if (m_compType == COMPRESSION_REFPACK && destLen > m_uncompressedSize - m_totalOut)
+		destLen = m_uncompressedSize - m_totalOut;
+
+	Int written;
+	switch (m_compType)
+	{
+		case COMPRESSION_NONE:
+			written = pullStored(dest, destLen);
+			break;
+
+		case COMPRESSION_REFPACK:
+			written = pullRefPack(dest, destLen);
+			break;
+
+		case COMPRESSION_ZLIB1:
+		case COMPRESSION_ZLIB2:
+		case COMPRESSION_ZLIB3:
+		case COMPRESSION_ZLIB4:
+		case COMPRESSION_ZLIB5:
+		case COMPRESSION_ZLIB6:
+		case COMPRESSION_ZLIB7:
+		case COMPRESSION_ZLIB8:
+		case COMPRESSION_ZLIB9:
+			written = pullZLib(dest, destLen);
+			break;
+
+		default:
+			written = pullBuffered(dest, destLen);
+			break;
+	}
+
+	if (written < 0)
+		return fail();
+
+	// all input was fed and nothing more comes out, but the end was not reached
+	if (written == 0 && m_finished && m_state == STATE_DATA)
+		return fail();
+
+	return written;
+}
+
+Int DecompressionStream::pullStored( UnsignedByte *dest, Int destLen )
+{
+	Int len = getInputSize();
+	if (len > destLen)
+		len = destLen;
+
+	if (len > 0)
+	{
+		memcpy(dest, getInput(), len);
+		m_inputPos += len;
+		m_totalOut += len;
+	}
+
+	if (m_finished && getInputSize() == 0)
+	{
+		m_uncompressedSize = m_totalOut;
+		m_state = STATE_DONE;
+	}
+
+	return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+// RefPack decoding follows REF_decode in EAC/refdecode.cpp. The last 128 KB of output are kept in
+// a ring buffer, because that is as far as a back reference can reach.
+//-------------------------------------------------------------------------------------------------
+Bool DecompressionStream::readRefPackHeader( void )
+{
+	if (getInputSize() < 2)
+		return FALSE;
+
+	const UnsignedByte *s = getInput();
+	const Int type = (s[0] << 8) + s[1];
+	const Int sizeFieldLen = (type & 0x8000) ? 4 : 3;
+	const Int headerLen = 2 + ((type & 0x100) ? 2 * sizeFieldLen : sizeFieldLen);
+
+	if (getInputSize() < headerLen)
+		return FALSE;
+
+	m_inputPos += headerLen;
+	m_refPackHeaderRead = TRUE;
+	return TRUE;
+}
+
+Bool DecompressionStream::readRefPackCommand( void )
+{
+	const Int available = getInputSize();
+	if (available < 1)
+		return FALSE;
+
+	const UnsignedByte *s = getInput();
+	const UnsignedByte first = s[0];
+	Int commandLen;
+
+	if (!(first & 0x80))						// short form
+	{
+		if (available < 2)
+			return FALSE;
+		commandLen = 2;
+		m_literalsLeft = first & 3;
+		m_matchDistance = ((first & 0x60) << 3) + s[1] + 1;
+		m_matchLeft = ((first & 0x1c) >> 2) + 3;
+	}
+	else if (!(first & 0x40))				// int form
+	{
+		if (available < 3)
+			return FALSE;
+		commandLen = 3;
+		m_literalsLeft = s[1] >> 6;
+		m_matchDistance = ((s[1] & 0x3f) << 8) + s[2] + 1;
+		m_matchLeft = (first & 0x3f) + 4;
+	}
+	else if (!(first & 0x20))				// very int form
+	{
+		if (available < 4)
+			return FALSE;
+		commandLen = 4;
+		m_literalsLeft = first & 3;
+		m_matchDistance = ((first & 0x10) << 12) + (s[1] << 8) + s[2] + 1;
+		m_matchLeft = ((first & 0x0c) << 6) + s[3] + 5;
+	}
+	else
+	{
+		commandLen = 1;
+		const Int run = ((first & 0x1f) << 2) + 4;
+		if (run <= 112)								// literal
+		{
+			m_literalsLeft = run;
+		}
+		else													// eof (+0..3 literal)
+		{
+			m_literalsLeft = first & 3;
+			m_refPackEnded = TRUE;
+		}
+		m_matchLeft = 0;
+		m_matchDistance = 0;
+	}
+
+	m_inputPos += commandLen;
+	return TRUE;
+}
+
+void DecompressionStream::writeRefPackWindow( const UnsignedByte *src, Int len )
+{
+	while (len > 0)
+	{
+		const Int pos = m_totalOut & REFPACK_WINDOW_MASK;
+		Int chunk = REFPACK_WINDOW_SIZE - pos;
+		if (chunk > len)
+			chunk = len;
+
+		memcpy(&m_window[pos], src, chunk);
+		src += chunk;
+		len -= chunk;
+		m_totalOut += chunk;
+	}
+}
+
+Int DecompressionStream::pullRefPack( UnsignedByte *dest, Int destLen )
+{
+	if (!m_refPackHeaderRead && !readRefPackHeader())
+		return 0;
+
+	UnsignedByte *d = dest;
+	Int left = destLen;
+
+	// Commands are also read when dest is full, so that the end command is found right after the
+	// last byte was returned.
+	for (;;)
+	{
+		if (m_literalsLeft > 0)
+		{
+			Int len = getInputSize();
+			if (len > m_literalsLeft)
+				len = m_literalsLeft;
+			if (len > left)
+				len = left;
+			if (len == 0)
+				break;
+
+			memcpy(d, getInput(), len);
+			writeRefPackWindow(getInput(), len);
+			m_inputPos += len;
+			m_literalsLeft -= len;
+			d += len;
+			left -= len;
+			continue;
+		}
+
+		if (m_matchLeft > 0)
+		{
+			if (m_matchDistance > m_totalOut)
+				return -1;
+
+			Int len = m_matchLeft;
+			if (len > left)
+				len = left;
+			if (len == 0)
+				break;
+
+			// byte by byte, because the source may overlap the bytes being written
+			for (Int i = 0; i < len; ++i)
+			{
+				const UnsignedByte b = m_window[(m_totalOut - m_matchDistance) & REFPACK_WINDOW_MASK];
+				m_window[m_totalOut & REFPACK_WINDOW_MASK] = b;
+				*d++ = b;
+				++m_totalOut;
+			}
+			m_matchLeft -= len;
+			left -= len;
+			continue;
+		}
+
+		if (m_refPackEnded || !readRefPackCommand())
+			break;
+	}
+
+	if (m_refPackEnded && m_literalsLeft == 0)
+	{
+		if (m_totalOut != m_uncompressedSize)
+			return -1;
+		m_state = STATE_DONE;
+	}
+
+	return destLen - left;
+}
+
+Int DecompressionStream::pullZLib( UnsignedByte *dest, Int destLen )
+{
+	z_stream *zs = (z_stream *)m_zStream;
+
+	const Int available = getInputSize();
+	zs->next_in = available > 0 ? (Bytef *)getInput() : NULL;
+	zs->avail_in = available;
+	zs->next_out = (Bytef *)dest;
+	zs->avail_out = destLen;
+
+	const Int err = inflate(zs, Z_NO_FLUSH);
+
+	m_inputPos += available - (Int)zs->avail_in;
+	const Int written = destLen - (Int)zs->avail_out;
+	m_totalOut += written;
+
+	if (err == Z_STREAM_END)
+	{
+		if (m_totalOut != m_uncompressedSize)
+			return -1;
+		m_state = STATE_DONE;
+	}
+	else if (err != Z_OK && err != Z_BUF_ERROR)
+	{
+		return -1;
+	}
+
+	return written;
+}
+
+Int DecompressionStream::pullBuffered( UnsignedByte *dest, Int destLen )
+{
+	if (!m_finished)
+		return 0;
+
+	if (m_output.empty() && m_uncompressedSize > 0)
+	{
+		m_output.resize(m_uncompressedSize);
+		const Int len = CompressionManager::decompressData((void *)getInput(), getInputSize(), &m_output[0], m_uncompressedSize);
+		if (len != m_uncompressedSize)
+			return -1;
+
+		// the compressed data is not needed anymore
+		std::vector<UnsignedByte>().swap(m_input);
+		m_inputPos = 0;
+	}
+
+	Int len = (Int)m_output.size() - m_outputPos;
+	if (len > destLen)
+		len = destLen;
+
+	if (len > 0)
+	{
+		memcpy(dest, &m_output[m_outputPos], len);
+		m_outputPos += len;
+		m_totalOut += len;
+	}
+
+	if (m_outputPos == (Int)m_output.size())
+	{
+		std::vector<UnsignedByte>().swap(m_output);
+		m_outputPos = 0;
+		m_state = STATE_DONE;
+	}
+
+	return len;
+}
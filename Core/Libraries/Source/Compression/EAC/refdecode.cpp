@@ -47,6 +47,41 @@ bool GCALL REF_is(const void *compresseddata)
 }
 
 
+/****************************************************************/
+/*  Internal Functions                                          */
+/****************************************************************/
+
+// TheSuperHackers @performance Copy back references in wide steps where the source and the
+// destination do not overlap within a step. Short distances repeat the most recent bytes and
+// must be copied one byte at a time.
+static __inline unsigned char *refcopy(unsigned char *d, const unsigned char *ref, unsigned int len)
+{
+    unsigned int dist = (unsigned int)(d-ref);
+
+    if (dist>=len)
+    {
+        memcpy(d,ref,len);
+        return(d+len);
+    }
+
+    if (dist>=4)
+    {
+        while (len>=4)
+        {
+            memcpy(d,ref,4);
+            d += 4;
+            ref += 4;
+            len -= 4;
+        }
+    }
+
+    while (len--)
+        *d++ = *ref++;
+
+    return(d);
+}
+
+
 /****************************************************************/
 /*  Decode Functions                                            */
 /****************************************************************/
@@ -122,11 +157,8 @@ int GCALL REF_decode(void *dest, const void *compresseddata, int *compressedsize
                 while (run--)
                     *d++ = *s++;
                 ref = d-1 - (((first&0x60)<<3) + second);
-                run = ((first&0x1c)>>2)+3-1;
-                do
-                {
-                    *d++ = *ref++;
-                } while (run--);
+                run = ((first&0x1c)>>2)+3;
+                d = refcopy(d,ref,run);
                 continue;
             }
             if (!(first&0x40))          /* int form */
@@ -139,11 +171,8 @@ int GCALL REF_decode(void *dest, const void *compresseddata, int *compressedsize
 
                 ref = d-1 - (((second&0x3f)<<8) + third);
 
-                run = (first&0x3f)+4-1;
-                do
-                {
-                    *d++ = *ref++;
-                } while (run--);
+                run = (first&0x3f)+4;
+                d = refcopy(d,ref,run);
                 continue;
             }
             if (!(first&0x20))          /* very int form */
@@ -157,18 +186,16 @@ int GCALL REF_decode(void *dest, const void *compresseddata, int *compressedsize
 
                 ref = d-1 - (((first&0x10)>>4<<16) +  (second<<8) + third);
 
-                run = ((first&0x0c)>>2<<8) + forth + 5-1;
-                do
-                {
-                    *d++ = *ref++;
-                } while (run--);
+                run = ((first&0x0c)>>2<<8) + forth + 5;
+                d = refcopy(d,ref,run);
                 continue;
             }
             run = ((first&0x1f)<<2)+4;  /* literal */
             if (run<=112)
             {
-                while (run--)
-                    *d++ = *s++;
+                memcpy(d,s,run);
+                d += run;
+                s += run;
                 continue;
             }
             run = first&3;              /* eof (+0..3 literal) */
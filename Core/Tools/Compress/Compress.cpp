@@ -17,6 +17,8 @@
 */
 
 #include <string>
+#include <vector>
+#include <ctime>
 #include <Utility/stdio_adapter.h>
 #include <cstdarg>
 #include "Lib/BaseTypeCore.h"
@@ -42,6 +44,7 @@ void dumpHelp(const char *exe)
 	DEBUG_LOG(("Usage:"));
 	DEBUG_LOG(("  To print the compression type of an existing file: %s -in infile", exe));
 	DEBUG_LOG(("  To compress a file: %s -in infile -out outfile <-type compressionmode>", exe));
+	DEBUG_LOG(("  To benchmark all compression modes: %s -benchmark -in infile <-in infile ...> <-iterations count>", exe));
 	DEBUG_LOG((""));
 	DEBUG_LOG(("Compression modes:"));
 	for (int i=COMPRESSION_MIN; i<=COMPRESSION_MAX; ++i)
@@ -50,10 +53,128 @@ void dumpHelp(const char *exe)
 	}
 }
 
+static bool readFile(const std::string &fileName, std::vector<char> &data)
+{
+	FILE *fp = fopen(fileName.c_str(), "rb");
+	if (!fp)
+		return false;
+
+	fseek(fp, 0, SEEK_END);
+	int size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	data.resize(size);
+	int numRead = size > 0 ? fread(&data[0], 1, size, fp) : 0;
+	fclose(fp);
+
+	return numRead == size;
+}
+
+static double getMegaBytesPerSecond(double bytes, clock_t ticks)
+{
+	double seconds = (double)ticks / CLOCKS_PER_SEC;
+	if (seconds <= 0.0)
+		return 0.0;
+	return bytes / (1024.0 * 1024.0) / seconds;
+}
+
+// TheSuperHackers @feature Runs every compression mode over a set of files, for example maps and save
+// games, and reports the compression ratio and the compression and decompression speed. Every file is
+// decompressed again and compared with the original.
+static int runBenchmark(const std::vector<std::string> &inFiles, int iterations)
+{
+	std::vector< std::vector<char> > corpus;
+	double totalBytes = 0;
+
+	for (size_t f = 0; f < inFiles.size(); ++f)
+	{
+		std::vector<char> data;
+		if (!readFile(inFiles[f], data))
+		{
+			DEBUG_LOG(("Cannot read input '%s'", inFiles[f].c_str()));
+			return EXIT_FAILURE;
+		}
+		if (data.empty())
+			continue;
+		totalBytes += data.size();
+		corpus.push_back(data);
+	}
+
+	if (corpus.empty())
+	{
+		DEBUG_LOG(("No input to benchmark"));
+		return EXIT_FAILURE;
+	}
+
+	DEBUG_LOG(("Benchmarking %d files with %.0f bytes, %d iterations", (int)corpus.size(), totalBytes, iterations));
+	DEBUG_LOG(("%-18s %12s %8s %14s %14s %s", "Mode", "Bytes", "Ratio", "Compress MB/s", "Decomp MB/s", "Result"));
+
+	int result = EXIT_SUCCESS;
+
+	for (int i=COMPRESSION_MIN; i<=COMPRESSION_MAX; ++i)
+	{
+		CompressionType compType = (CompressionType)i;
+		if (compType == COMPRESSION_NONE)
+			continue;
+
+		double compressedBytes = 0;
+		clock_t compressTicks = 0;
+		clock_t decompressTicks = 0;
+		bool ok = true;
+
+		for (size_t f = 0; f < corpus.size(); ++f)
+		{
+			std::vector<char> &data = corpus[f];
+			int dataSize = (int)data.size();
+
+			// some codecs exceed their estimated maximum on incompressible data
+			std::vector<char> compressed(CompressionManager::getMaxCompressedSize(dataSize, compType) * 2 + 64);
+			std::vector<char> decompressed(dataSize);
+			int compressedSize = 0;
+			int decompressedSize = 0;
+
+			for (int j = 0; j < iterations; ++j)
+			{
+				clock_t start = clock();
+				compressedSize = CompressionManager::compressData(compType, &data[0], dataSize, &compressed[0], (int)compressed.size());
+				compressTicks += clock() - start;
+
+				start = clock();
+				decompressedSize = CompressionManager::decompressData(&compressed[0], compressedSize, &decompressed[0], dataSize);
+				decompressTicks += clock() - start;
+			}
+
+			compressedBytes += compressedSize;
+
+			if (compressedSize == 0 || decompressedSize != dataSize || memcmp(&data[0], &decompressed[0], dataSize) != 0)
+			{
+				DEBUG_LOG(("%s round trip failed for '%s'", CompressionManager::getCompressionNameByType(compType), inFiles[f].c_str()));
+				ok = false;
+			}
+		}
+
+		DEBUG_LOG(("%-18s %12.0f %7.2f%% %14.2f %14.2f %s",
+			CompressionManager::getCompressionNameByType(compType),
+			compressedBytes,
+			compressedBytes / totalBytes * 100.0,
+			getMegaBytesPerSecond(totalBytes * iterations, compressTicks),
+			getMegaBytesPerSecond(totalBytes * iterations, decompressTicks),
+			ok ? "OK" : "FAILED"));
+
+		if (!ok)
+			result = EXIT_FAILURE;
+	}
+
+	return result;
+}
+
 int main(int argc, char **argv)
 {
 	std::string inFile;
 	std::string outFile;
+	std::vector<std::string> inFiles;
+	bool benchmark = false;
+	int iterations = 5;
 	CompressionType compressType = CompressionManager::getPreferredCompression();
 
 	for (int i=1; i<argc; ++i)
@@ -70,6 +191,7 @@ int main(int argc, char **argv)
 			if (i<argc)
 			{
 				inFile = argv[i];
+				inFiles.push_back(inFile);
 			}
 		}
 
@@ -82,6 +204,22 @@ int main(int argc, char **argv)
 			}
 		}
 
+		if ( !strcmp(argv[i], "-benchmark") )
+		{
+			benchmark = true;
+		}
+
+		if ( !strcmp(argv[i], "-iterations") )
+		{
+			++i;
+			if (i<argc)
+			{
+				iterations = atoi(argv[i]);
+				if (iterations < 1)
+					iterations = 1;
+			}
+		}
+
 		if ( !strcmp(argv[i], "-type") )
 		{
 			++i;
@@ -105,6 +243,11 @@ int main(int argc, char **argv)
 		return EXIT_SUCCESS;
 	}
 
+	if (benchmark)
+	{
+		return runBenchmark(inFiles, iterations);
+	}
+
 	DEBUG_LOG(("IN:'%s' OUT:'%s' Compression:'%s'",
 		inFile.c_str(), outFile.c_str(), CompressionManager::getCompressionNameByType(compressType)));
 
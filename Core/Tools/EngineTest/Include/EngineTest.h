@@ -0,0 +1,33 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: EngineTest.h /////////////////////////////////////////////////////////////////////////////
+// Tests and measurements of engine code that run outside of the game.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Lib/BaseType.h"
+
+// Each test prints what it checked and measured, and returns FALSE when a check failed.
+
+Bool testFileTransfer( void ); ///< measure map sized transfers over a lossy link and check their resume
+Bool testINITokenIndex( void ); ///< compare the INI token index with the linear field scan
+Bool testNetPacket( void ); ///< compare the packet encoding with the bytes of the original encoder
+Bool testRefPack( void ); ///< compare the RefPack encoder with the encoder before its optimization
+Bool testUDPBatch( void ); ///< compare the batched UDP reads and writes with the single ones
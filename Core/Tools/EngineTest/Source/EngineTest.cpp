@@ -0,0 +1,235 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: EngineTest.cpp ///////////////////////////////////////////////////////////////////////////
+// Entry point of the engine test tool. It loads the INI data like the MapCacheBuilder does, then runs
+// the tests that are named on the command line, or all of them. The exit code is the number of
+// failed tests.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES ////////////////////////////////////////////////////////////
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+// USER INCLUDES //////////////////////////////////////////////////////////////
+#include "Lib/BaseType.h"
+#include "Common/ArchiveFileSystem.h"
+#include "Common/DamageFX.h"
+#include "Common/Debug.h"
+#include "Common/FileSystem.h"
+#include "Common/GameAudio.h"
+#include "Common/GameMemory.h"
+#include "Common/GlobalData.h"
+#include "Common/INI.h"
+#include "Common/LocalFileSystem.h"
+#include "Common/ModuleFactory.h"
+#include "Common/MultiplayerSettings.h"
+#include "Common/NameKeyGenerator.h"
+#include "Common/PlayerTemplate.h"
+#include "Common/Science.h"
+#include "Common/SpecialPower.h"
+#include "Common/SubsystemInterface.h"
+#include "Common/TerrainTypes.h"
+#include "Common/ThingFactory.h"
+#include "Common/Upgrade.h"
+#include "GameClient/Anim2D.h"
+#include "GameClient/FXList.h"
+#include "GameClient/GameText.h"
+#include "GameClient/ParticleSys.h"
+#include "GameClient/TerrainRoads.h"
+#include "GameClient/VideoPlayer.h"
+#include "GameLogic/Armor.h"
+#include "GameLogic/CaveSystem.h"
+#include "GameLogic/CrateSystem.h"
+#include "GameLogic/Locomotor.h"
+#include "GameLogic/ObjectCreationList.h"
+#include "GameLogic/RankInfo.h"
+#include "GameLogic/ScriptEngine.h"
+#include "GameLogic/SidesList.h"
+#include "GameLogic/Weapon.h"
+#include "MilesAudioDevice/MilesAudioManager.h"
+#include "W3DDevice/Common/W3DModuleFactory.h"
+#include "W3DDevice/GameClient/W3DParticleSys.h"
+#include "Win32Device/Common/Win32BIGFileSystem.h"
+#include "Win32Device/Common/Win32LocalFileSystem.h"
+
+#include "EngineTest.h"
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////
+
+struct EngineTest
+{
+	const char *name;				///< command line switch of the test
+	Bool (*run)( void );
+};
+
+static const EngineTest s_tests[] =
+{
+	{ "-filetransfer", testFileTransfer },
+	{ "-initokenindex", testINITokenIndex },
+	{ "-netpacket", testNetPacket },
+	{ "-refpack", testRefPack },
+	{ "-udpbatch", testUDPBatch },
+};
+
+static SubsystemInterfaceList _TheSubsystemList;
+
+template<class SUBSYSTEM>
+void initSubsystem(SUBSYSTEM*& sysref, SUBSYSTEM* sys, const char* path1 = NULL, const char* path2 = NULL)
+{
+	sysref = sys;
+	_TheSubsystemList.initSubsystem(sys, path1, path2, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PUBLIC DATA ////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+HINSTANCE ApplicationHInstance = NULL;  ///< our application instance
+
+/// just to satisfy the game libraries we link to
+HWND ApplicationHWnd = NULL;
+
+const char *gAppPrefix = "ET_";
+
+// Where are the default string files?
+const Char *g_strFile = "data\\Generals.str";
+const Char *g_csfFile = "data\\%s\\Generals.csf";
+
+///////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS //////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+/** Load the same INI data as the MapCacheBuilder, from the game directory */
+//-------------------------------------------------------------------------------------------------
+static void initEngine( void )
+{
+	// not part of the subsystem list, because it should normally never be reset!
+	TheNameKeyGenerator = new NameKeyGenerator;
+	TheNameKeyGenerator->init();
+
+	TheFileSystem = new FileSystem;
+
+	initSubsystem(TheLocalFileSystem, (LocalFileSystem*)new Win32LocalFileSystem);
+	initSubsystem(TheArchiveFileSystem, (ArchiveFileSystem*)new Win32BIGFileSystem);
+	initSubsystem(TheWritableGlobalData, new GlobalData(), "Data\\INI\\Default\\GameData", "Data\\INI\\GameData");
+	initSubsystem(TheGameText, CreateGameTextInterface());
+	initSubsystem(TheScienceStore, new ScienceStore(), "Data\\INI\\Default\\Science", "Data\\INI\\Science");
+	initSubsystem(TheMultiplayerSettings, new MultiplayerSettings(), "Data\\INI\\Default\\Multiplayer", "Data\\INI\\Multiplayer");
+	initSubsystem(TheTerrainTypes, new TerrainTypeCollection(), "Data\\INI\\Default\\Terrain", "Data\\INI\\Terrain");
+	initSubsystem(TheTerrainRoads, new TerrainRoadCollection(), "Data\\INI\\Default\\Roads", "Data\\INI\\Roads");
+	initSubsystem(TheScriptEngine, (ScriptEngine*)(new ScriptEngine()));
+	initSubsystem(TheAudio, (AudioManager*)new MilesAudioManager());
+	initSubsystem(TheVideoPlayer, (VideoPlayerInterface*)(new VideoPlayer()));
+	initSubsystem(TheModuleFactory, (ModuleFactory*)(new W3DModuleFactory()));
+	initSubsystem(TheSidesList, new SidesList());
+	initSubsystem(TheCaveSystem, new CaveSystem());
+	initSubsystem(TheRankInfoStore, new RankInfoStore(), NULL, "Data\\INI\\Rank");
+	initSubsystem(ThePlayerTemplateStore, new PlayerTemplateStore(), "Data\\INI\\Default\\PlayerTemplate", "Data\\INI\\PlayerTemplate");
+	initSubsystem(TheSpecialPowerStore, new SpecialPowerStore(), "Data\\INI\\Default\\SpecialPower", "Data\\INI\\SpecialPower" );
+	initSubsystem(TheParticleSystemManager, (ParticleSystemManager*)(new W3DParticleSystemManager()));
+	initSubsystem(TheFXListStore, new FXListStore(), "Data\\INI\\Default\\FXList", "Data\\INI\\FXList");
+	initSubsystem(TheWeaponStore, new WeaponStore(), NULL, "Data\\INI\\Weapon");
+	initSubsystem(TheObjectCreationListStore, new ObjectCreationListStore(), "Data\\INI\\Default\\ObjectCreationList", "Data\\INI\\ObjectCreationList");
+	initSubsystem(TheLocomotorStore, new LocomotorStore(), NULL, "Data\\INI\\Locomotor");
+	initSubsystem(TheDamageFXStore, new DamageFXStore(), NULL, "Data\\INI\\DamageFX");
+	initSubsystem(TheArmorStore, new ArmorStore(), NULL, "Data\\INI\\Armor");
+	initSubsystem(TheThingFactory, new ThingFactory(), "Data\\INI\\Default\\Object", "Data\\INI\\Object");
+	initSubsystem(TheCrateSystem, new CrateSystem(), "Data\\INI\\Default\\Crate", "Data\\INI\\Crate");
+	initSubsystem(TheUpgradeCenter, new UpgradeCenter, "Data\\INI\\Default\\Upgrade", "Data\\INI\\Upgrade");
+	initSubsystem(TheAnim2DCollection, new Anim2DCollection ); //Init's itself.
+
+	_TheSubsystemList.postProcessLoadAll();
+}
+
+//-------------------------------------------------------------------------------------------------
+static void shutdownEngine( void )
+{
+	_TheSubsystemList.shutdownAll();
+
+	delete TheFileSystem;
+	TheFileSystem = NULL;
+
+	delete TheNameKeyGenerator;
+	TheNameKeyGenerator = NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+static Bool isTestSelected( const EngineTest& test, int argc, char *argv[] )
+{
+	if (argc <= 1)
+		return TRUE;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (_stricmp(argv[i], test.name) == 0)
+			return TRUE;
+	}
+	return FALSE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int main( int argc, char *argv[] )
+{
+	// initialize the memory manager early
+	initMemoryManager();
+
+	ApplicationHInstance = GetModuleHandle(NULL);
+
+	// Set the current directory to the app directory, where the game data is.
+	char buf[_MAX_PATH];
+	GetModuleFileName(NULL, buf, sizeof(buf));
+	if (char *pEnd = strrchr(buf, '\\')) {
+		*pEnd = 0;
+	}
+	::SetCurrentDirectory(buf);
+
+	int numFailed = 0;
+
+	try
+	{
+		initEngine();
+
+		for (Int i = 0; i < (Int)(sizeof(s_tests) / sizeof(s_tests[0])); ++i)
+		{
+			if (!isTestSelected(s_tests[i], argc, argv))
+				continue;
+
+			printf("%s\n", s_tests[i].name + 1);
+			const Bool passed = s_tests[i].run();
+			printf("%s %s\n\n", s_tests[i].name + 1, passed ? "passed" : "FAILED");
+			if (!passed)
+				++numFailed;
+		}
+
+		shutdownEngine();
+	}
+	catch (...)
+	{
+		printf("enginetest: unexpected exception\n");
+		++numFailed;
+	}
+
+	shutdownMemoryManager();
+
+	return numFailed;
+}
@@ -0,0 +1,254 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: FileTransferTest.cpp /////////////////////////////////////////////////////////////////////
+// Measures map sized file transfers over a lossy link and checks the resume of a stopped one.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "Lib/BaseType.h"
+#include "Common/GameMemory.h"
+#include "GameNetwork/Connection.h"
+#include "GameNetwork/InMemoryTransport.h"
+#include "GameNetwork/NetCommandList.h"
+#include "GameNetwork/NetCommandMsg.h"
+#include "GameNetwork/NetCommandWrapperList.h"
+#include "GameNetwork/NetPacket.h"
+#include "GameNetwork/User.h"
+
+#include "EngineTest.h"
+
+enum { TEST_FILE_SIZE = 512 * 1024 };
+enum { TEST_PORT = 8088 };
+enum { TEST_TIMEOUT = 2*60*1000 };
+
+// One side of the test link, with a transport on the in-memory network and the connection to the other side.
+struct FileTransferTestPeer
+{
+	InMemoryTransport *m_transport;
+	Connection *m_connection;
+	UnsignedByte m_slot;
+};
+
+static void initTestPeer(FileTransferTestPeer &peer, InMemoryNetwork *network, UnsignedByte slot, UnsignedByte otherSlot)
+{
+	peer.m_slot = slot;
+	peer.m_transport = NEW InMemoryTransport(network);
+	peer.m_transport->init(slot + 1, TEST_PORT);
+	peer.m_connection = newInstance(Connection);
+	peer.m_connection->init();
+	peer.m_connection->attachTransport(peer.m_transport);
+	peer.m_connection->setUser(newInstance(User)(UnicodeString(L"FileTransferTest"), otherSlot + 1, TEST_PORT));
+}
+
+static void deleteTestPeer(FileTransferTestPeer &peer)
+{
+	deleteInstance(peer.m_connection);
+	peer.m_connection = NULL;
+	delete peer.m_transport;
+	peer.m_transport = NULL;
+}
+
+static void sendTestAck(FileTransferTestPeer &peer, UnsignedShort commandID, UnsignedByte originalPlayerID)
+{
+	NetAckBothCommandMsg *ackMsg = newInstance(NetAckBothCommandMsg)();
+	ackMsg->setCommandID(commandID);
+	ackMsg->setOriginalPlayerID(originalPlayerID);
+	ackMsg->setPlayerID(peer.m_slot);
+	peer.m_connection->sendNetCommandMsg(ackMsg, 1 << originalPlayerID);
+	ackMsg->detach();
+}
+
+// Sends and reads the packets of a peer. Chunks go into the wrapper list and are acked like
+// ConnectionManager does, including the chunks that were resumed from an earlier transfer.
+static void updateTestPeer(FileTransferTestPeer &peer, NetCommandWrapperList *wrapperList)
+{
+	peer.m_connection->doSend();
+	peer.m_transport->update();
+
+	for (Int i = 0; i < MAX_MESSAGES; ++i)
+	{
+		TransportMessage &message = peer.m_transport->m_inBuffer[i];
+		if (message.length == 0)
+			continue;
+
+		NetPacket *packet = newInstance(NetPacket)(&message);
+		NetCommandList *cmdList = packet->getCommandList(peer.m_connection->getReceivedGameCommands());
+		peer.m_connection->processCompactGameCommandsSupport(packet->getCompactSupport(), packet->hasCompactGameCommands());
+
+		for (NetCommandRef *ref = cmdList->getFirstMessage(); ref != NULL; ref = ref->getNext())
+		{
+			NetCommandMsg *msg = ref->getCommand();
+			if (msg->getNetCommandType() == NETCOMMANDTYPE_ACKBOTH)
+			{
+				NetCommandRef *ackedRef = peer.m_connection->processAck(msg);
+				deleteInstance(ackedRef);
+			}
+			else if (msg->getNetCommandType() == NETCOMMANDTYPE_WRAPPER && wrapperList != NULL)
+			{
+				std::vector<UnsignedShort> resumedChunkIDs;
+				wrapperList->processWrapper(ref, &resumedChunkIDs);
+				sendTestAck(peer, msg->getID(), msg->getPlayerID());
+				for (size_t j = 0; j < resumedChunkIDs.size(); ++j)
+					sendTestAck(peer, resumedChunkIDs[j], msg->getPlayerID());
+			}
+		}
+
+		deleteInstance(cmdList);
+		deleteInstance(packet);
+		message.length = 0;
+	}
+}
+
+// Sends the file from slot 0 to slot 1 until it arrived, or until the receiver has stopAfterPercent of it.
+// The wrapper list is reset afterwards like a network shutdown does, which keeps an incomplete transfer.
+static Bool runTestTransfer(InMemoryNetwork &network, NetCommandWrapperList *wrapperList, UnsignedByte *fileData,
+	UnsignedShort commandID, Int stopAfterPercent, Bool &fileMatches, UnsignedInt &elapsedTime)
+{
+	FileTransferTestPeer sender;
+	FileTransferTestPeer receiver;
+	initTestPeer(sender, &network, 0, 1);
+	initTestPeer(receiver, &network, 1, 0);
+
+	NetFileCommandMsg *fileMsg = newInstance(NetFileCommandMsg);
+	fileMsg->setPlayerID(sender.m_slot);
+	fileMsg->setID(commandID);
+	fileMsg->setPortableFilename("maps\\FileTransferTest\\FileTransferTest.map");
+	fileMsg->setFileData(fileData, TEST_FILE_SIZE);
+	sender.m_connection->sendNetCommandMsg(fileMsg, 1 << receiver.m_slot);
+	fileMsg->detach();
+
+	const UnsignedInt startTime = timeGetTime();
+	UnsignedInt lastTime = startTime;
+	Bool done = FALSE;
+	fileMatches = FALSE;
+
+	while (!done && timeGetTime() - startTime < TEST_TIMEOUT)
+	{
+		// the network delivers by its own clock
+		UnsignedInt now = timeGetTime();
+		network.advanceTime(now - lastTime);
+		lastTime = now;
+
+		updateTestPeer(sender, NULL);
+		updateTestPeer(receiver, wrapperList);
+
+		if (stopAfterPercent < 100 && wrapperList->getPercentComplete(commandID) >= stopAfterPercent)
+			break;
+
+		NetCommandList *readyList = wrapperList->getReadyCommands();
+		NetCommandRef *readyRef = readyList->getFirstMessage();
+		if (readyRef != NULL)
+		{
+			NetFileCommandMsg *readMsg = (NetFileCommandMsg *)readyRef->getCommand();
+			fileMatches = readMsg->getNetCommandType() == NETCOMMANDTYPE_FILE && readMsg->getFileLength() == TEST_FILE_SIZE &&
+				memcmp(readMsg->getFileData(), fileData, TEST_FILE_SIZE) == 0;
+			done = TRUE;
+		}
+		deleteInstance(readyList);
+
+		Sleep(1);
+	}
+
+	elapsedTime = timeGetTime() - startTime;
+
+	wrapperList->reset();
+	deleteTestPeer(receiver);
+	deleteTestPeer(sender);
+	return done;
+}
+
+static void printTestTransfer(const char *name, InMemoryNetwork &network, Bool done, UnsignedInt elapsedTime)
+{
+	const InMemoryNetwork::Settings &settings = network.getSettings();
+	const InMemoryNetwork::Statistics &stats = network.getStatistics();
+	printf("  %s, %d%% loss, %u ms latency: %s after %u ms, %.1f KB/s, %u packets with %u bytes sent, %u lost\n",
+		name, settings.m_lossPercent, settings.m_latency, done ? "complete" : "stopped", elapsedTime,
+		elapsedTime > 0 ? TEST_FILE_SIZE / 1.024f / elapsedTime : 0.0f, stats.m_sentPackets, stats.m_sentBytes, stats.m_lostPackets);
+}
+
+// Prints what went wrong when the condition does not hold.
+static Bool check(Bool condition, const char *what)
+{
+	if (!condition)
+		printf("  %s\n", what);
+	return condition;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Measures the throughput of a map sized transfer over a lossy link, and checks that a transfer
+	* that stopped halfway is resumed by the next one, which sends about half of the chunks. */
+//-------------------------------------------------------------------------------------------------
+Bool testFileTransfer( void )
+{
+	UnsignedByte *fileData = NEW UnsignedByte[TEST_FILE_SIZE];
+	srand(1);
+	for (Int i = 0; i < TEST_FILE_SIZE; ++i)
+		fileData[i] = (UnsignedByte)rand();
+
+	NetCommandWrapperList *wrapperList = newInstance(NetCommandWrapperList);
+	wrapperList->init();
+
+	InMemoryNetwork network(1);
+	InMemoryNetwork::Settings settings;
+	settings.m_latency = 50;
+	settings.m_jitter = 20;
+
+	static const Int s_lossPercents[] = { 0, 5, 20 };
+	enum { RESUME_LOSS_PERCENT = 5 };
+	UnsignedShort commandID = 1000;
+	UnsignedInt elapsedTime = 0;
+	UnsignedInt wholeFilePackets = 0;
+	Bool fileMatches = FALSE;
+	Bool passed = TRUE;
+
+	for (Int i = 0; i < (Int)(sizeof(s_lossPercents) / sizeof(s_lossPercents[0])); ++i)
+	{
+		settings.m_lossPercent = s_lossPercents[i];
+		network.setSettings(settings);
+		network.resetStatistics();
+		Bool done = runTestTransfer(network, wrapperList, fileData, commandID++, 100, fileMatches, elapsedTime);
+		printTestTransfer("whole file", network, done, elapsedTime);
+		passed = check(done, "the transfer did not complete") && passed;
+		passed = check(!done || fileMatches, "the received file differs from the sent one") && passed;
+		if (settings.m_lossPercent == RESUME_LOSS_PERCENT)
+			wholeFilePackets = network.getStatistics().m_sentPackets;
+	}
+
+	settings.m_lossPercent = RESUME_LOSS_PERCENT;
+	network.setSettings(settings);
+	network.resetStatistics();
+	Bool done = runTestTransfer(network, wrapperList, fileData, commandID++, 50, fileMatches, elapsedTime);
+	printTestTransfer("first half", network, done, elapsedTime);
+
+	network.resetStatistics();
+	done = runTestTransfer(network, wrapperList, fileData, commandID++, 100, fileMatches, elapsedTime);
+	printTestTransfer("resumed", network, done, elapsedTime);
+	passed = check(done, "the resumed transfer did not complete") && passed;
+	passed = check(!done || fileMatches, "the resumed file differs from the sent one") && passed;
+	passed = check(network.getStatistics().m_sentPackets < wholeFilePackets * 3 / 4, "the resumed transfer sent the whole file again") && passed;
+
+	deleteInstance(wrapperList);
+	delete[] fileData;
+	return passed;
+}
@@ -0,0 +1,139 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: INITokenIndexTest.cpp ////////////////////////////////////////////////////////////////////
+// Compares the INITokenIndex lookup of the INI field parser with the linear scan it replaced.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <windows.h>
+#include <stdio.h>
+#include <vector>
+
+#include "Lib/BaseType.h"
+#include "Common/AsciiString.h"
+#include "Common/GameMemory.h"
+#include "Common/INI.h"
+#include "Common/INITokenIndex.h"
+
+#include "EngineTest.h"
+
+enum { NUM_INITOKENINDEX_TIMES = 100 };
+
+typedef INITokenIndex<FieldParse> FieldParseIndex;
+
+//-------------------------------------------------------------------------------------------------
+/** The lookup of the INI field parser before the INITokenIndex, a strcmp scan of the table */
+//-------------------------------------------------------------------------------------------------
+static const FieldParse* findFieldParseLinear(const FieldParse* parseTable, const char* token)
+{
+	for (const FieldParse* parse = parseTable; parse->token; ++parse)
+	{
+		if (strcmp(parse->token, token) == 0)
+			return parse;
+	}
+	return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Compares the INITokenIndex lookup with the linear scan, over every field parse table that the
+	* loaded INI files used. Each table is queried with its own tokens, which hit, and with the tokens
+	* of another table, which mostly miss like the lookups of a field in the other tables of a
+	* MultiIniFieldParse. Both lookups must find the same entries. */
+//-------------------------------------------------------------------------------------------------
+Bool testINITokenIndex( void )
+{
+	std::vector<const FieldParse*> tables;
+	INI::getIndexedFieldParseTables(tables);
+
+	const Int numTables = (Int)tables.size();
+	if (numTables == 0)
+	{
+		printf("  no field parse tables were used by the INI loading\n");
+		return FALSE;
+	}
+
+	std::vector<FieldParseIndex> indices(numTables);
+	Int i;
+	for (i = 0; i < numTables; ++i)
+		indices[i].build(tables[i]);
+
+	// copies of the tokens, so that no lookup compares a token with itself
+	std::vector<AsciiString> queries;
+	std::vector<Int> firstQuery(numTables + 1);
+	for (i = 0; i < numTables; ++i)
+	{
+		firstQuery[i] = (Int)queries.size();
+		const FieldParse* parse;
+		for (parse = tables[i]; parse->token; ++parse)
+			queries.push_back(AsciiString(parse->token));
+		for (parse = tables[(i + 1) % numTables]; parse->token; ++parse)
+			queries.push_back(AsciiString(parse->token));
+	}
+	firstQuery[numTables] = (Int)queries.size();
+
+	Int numMismatches = 0;
+	for (i = 0; i < numTables; ++i)
+	{
+		for (Int q = firstQuery[i]; q < firstQuery[i + 1]; ++q)
+		{
+			const char* token = queries[q].str();
+			if (findFieldParseLinear(tables[i], token) != indices[i].find(token, hashINIToken(token)))
+				++numMismatches;
+		}
+	}
+
+	Int linearHits = 0;
+	Int indexHits = 0;
+
+	const UnsignedInt linearStart = timeGetTime();
+	for (Int n = 0; n < NUM_INITOKENINDEX_TIMES; ++n)
+	{
+		for (i = 0; i < numTables; ++i)
+		{
+			for (Int q = firstQuery[i]; q < firstQuery[i + 1]; ++q)
+			{
+				if (findFieldParseLinear(tables[i], queries[q].str()))
+					++linearHits;
+			}
+		}
+	}
+	const UnsignedInt linearTime = timeGetTime() - linearStart;
+
+	const UnsignedInt indexStart = timeGetTime();
+	for (Int n = 0; n < NUM_INITOKENINDEX_TIMES; ++n)
+	{
+		for (i = 0; i < numTables; ++i)
+		{
+			for (Int q = firstQuery[i]; q < firstQuery[i + 1]; ++q)
+			{
+				// the parser hashes each field once, for all the tables it looks the field up in
+				const char* token = queries[q].str();
+				if (indices[i].find(token, hashINIToken(token)))
+					++indexHits;
+			}
+		}
+	}
+	const UnsignedInt indexTime = timeGetTime() - indexStart;
+
+	const Int numLookups = (Int)queries.size() * NUM_INITOKENINDEX_TIMES;
+	printf("  %d tables, %d lookups, %d hits: linear scan %u ms, INITokenIndex %u ms (%d hits)\n",
+		numTables, numLookups, linearHits, linearTime, indexTime, indexHits);
+	printf("  %d lookups found a different entry than the linear scan\n", numMismatches);
+
+	return numMismatches == 0 && linearHits == indexHits;
+}
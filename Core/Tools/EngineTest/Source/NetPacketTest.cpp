@@ -0,0 +1,712 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: NetPacketTest.cpp ////////////////////////////////////////////////////////////////////////
+// Checks that the command format table of NetPacket writes the bytes of the original encoder, and
+// measures and fuzzes the packet encoding.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "Lib/BaseType.h"
+#include "Common/GameMemory.h"
+#include "Common/GlobalData.h"
+#include "GameNetwork/NetCommandList.h"
+#include "GameNetwork/NetCommandMsg.h"
+#include "GameNetwork/NetCommandRef.h"
+#include "GameNetwork/NetPacket.h"
+#include "GameNetwork/NetworkDefs.h"
+
+#include "EngineTest.h"
+
+enum { NUM_TIMES = 100 };
+enum { NUM_FUZZ_PACKETS = 100000 };
+enum { NUM_BENCHMARK_COMMANDS = 2000 };
+
+// Returns true if the command type can be sent in a packet.
+static Bool isSendableType(Int type)
+{
+	switch (type)
+	{
+		case NETCOMMANDTYPE_MANGLERQUERY:
+		case NETCOMMANDTYPE_MANGLERRESPONSE:
+		case NETCOMMANDTYPE_DISCONNECTSTART:
+		case NETCOMMANDTYPE_DISCONNECTEND:
+			return FALSE;
+		default:
+			return TRUE;
+	}
+}
+
+// Prints what went wrong when the condition does not hold.
+static Bool check(Bool condition, const char *what)
+{
+	if (!condition)
+		printf("  %s\n", what);
+	return condition;
+}
+
+// Creates a command of the given type with all of its values set.
+static NetCommandMsg * newTestCommand(NetCommandType type, Int index)
+{
+	static UnsignedByte s_data[300];
+	for (Int i = 0; i < (Int)sizeof(s_data); ++i)
+		s_data[i] = (UnsignedByte)(i * 7 + index);
+
+	NetCommandMsg *msg = NULL;
+	switch (type)
+	{
+		case NETCOMMANDTYPE_ACKBOTH:
+		case NETCOMMANDTYPE_ACKSTAGE1:
+		case NETCOMMANDTYPE_ACKSTAGE2:
+		{
+			// consecutive acks of the same player are written as repeats
+			if (type == NETCOMMANDTYPE_ACKBOTH)
+			{
+				NetAckBothCommandMsg *ackMsg = newInstance(NetAckBothCommandMsg)();
+				ackMsg->setCommandID(100 + index);
+				ackMsg->setOriginalPlayerID(2);
+				msg = ackMsg;
+			}
+			else if (type == NETCOMMANDTYPE_ACKSTAGE1)
+			{
+				NetAckStage1CommandMsg *ackMsg = newInstance(NetAckStage1CommandMsg)();
+				ackMsg->setCommandID(100 + index);
+				ackMsg->setOriginalPlayerID(2);
+				msg = ackMsg;
+			}
+			else
+			{
+				NetAckStage2CommandMsg *ackMsg = newInstance(NetAckStage2CommandMsg)();
+				ackMsg->setCommandID(100 + index);
+				ackMsg->setOriginalPlayerID(2);
+				msg = ackMsg;
+			}
+			break;
+		}
+		case NETCOMMANDTYPE_FRAMEINFO:
+		{
+			// empty consecutive frames are written as repeats
+			NetFrameCommandMsg *cmdMsg = newInstance(NetFrameCommandMsg)();
+			cmdMsg->setCommandCount((index == 0) ? 3 : 0);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_GAMECOMMAND:
+		{
+			NetGameCommandMsg *cmdMsg = newInstance(NetGameCommandMsg)();
+			cmdMsg->setGameMessageType((index % 2) ? GameMessage::MSG_DO_MOVETO : GameMessage::MSG_CREATE_SELECTED_GROUP);
+			GameMessageArgumentType arg;
+			arg.boolean = TRUE;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_BOOLEAN, arg);
+			for (Int i = 0; i < 12 + index; ++i)
+			{
+				arg.objectID = (ObjectID)(1000 + i * 3 + index);
+				cmdMsg->addArgument(ARGUMENTDATATYPE_OBJECTID, arg);
+			}
+			arg.location.x = 100.5f + index;
+			arg.location.y = -0.0f;
+			arg.location.z = 12.25f;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_LOCATION, arg);
+			arg.integer = -5 + index;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_INTEGER, arg);
+			arg.real = 0.75f;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_REAL, arg);
+			arg.drawableID = (DrawableID)(70000 + index);
+			cmdMsg->addArgument(ARGUMENTDATATYPE_DRAWABLEID, arg);
+			arg.teamID = 4;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_TEAMID, arg);
+			arg.pixel.x = 320;
+			arg.pixel.y = 240;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_PIXEL, arg);
+			arg.pixelRegion.lo.x = 1;
+			arg.pixelRegion.lo.y = 2;
+			arg.pixelRegion.hi.x = 3;
+			arg.pixelRegion.hi.y = 4;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_PIXELREGION, arg);
+			arg.timestamp = 123456;
+			cmdMsg->addArgument(ARGUMENTDATATYPE_TIMESTAMP, arg);
+			arg.wChar = L'x';
+			cmdMsg->addArgument(ARGUMENTDATATYPE_WIDECHAR, arg);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_PLAYERLEAVE:
+		{
+			NetPlayerLeaveCommandMsg *cmdMsg = newInstance(NetPlayerLeaveCommandMsg)();
+			cmdMsg->setLeavingPlayerID(3);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_RUNAHEADMETRICS:
+		{
+			NetRunAheadMetricsCommandMsg *cmdMsg = newInstance(NetRunAheadMetricsCommandMsg)();
+			cmdMsg->setAverageLatency(0.125f);
+			cmdMsg->setAverageFps(30 + index);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_RUNAHEAD:
+		{
+			NetRunAheadCommandMsg *cmdMsg = newInstance(NetRunAheadCommandMsg)();
+			cmdMsg->setRunAhead(10 + index);
+			cmdMsg->setFrameRate(30);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_DESTROYPLAYER:
+		{
+			NetDestroyPlayerCommandMsg *cmdMsg = newInstance(NetDestroyPlayerCommandMsg)();
+			cmdMsg->setPlayerIndex(5);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_KEEPALIVE:
+			msg = newInstance(NetKeepAliveCommandMsg)();
+			break;
+		case NETCOMMANDTYPE_DISCONNECTKEEPALIVE:
+			msg = newInstance(NetDisconnectKeepAliveCommandMsg)();
+			break;
+		case NETCOMMANDTYPE_PACKETROUTERQUERY:
+			msg = newInstance(NetPacketRouterQueryCommandMsg)();
+			break;
+		case NETCOMMANDTYPE_PACKETROUTERACK:
+			msg = newInstance(NetPacketRouterAckCommandMsg)();
+			break;
+		case NETCOMMANDTYPE_DISCONNECTCHAT:
+		{
+			NetDisconnectChatCommandMsg *cmdMsg = newInstance(NetDisconnectChatCommandMsg)();
+			cmdMsg->setText(UnicodeString(L"Disconnect chat"));
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_CHAT:
+		{
+			NetChatCommandMsg *cmdMsg = newInstance(NetChatCommandMsg)();
+			cmdMsg->setText(UnicodeString(L"Chat"));
+			cmdMsg->setPlayerMask(0x5a);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_PROGRESS:
+		{
+			NetProgressCommandMsg *cmdMsg = newInstance(NetProgressCommandMsg)();
+			cmdMsg->setPercentage(42);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_WRAPPER:
+		{
+			NetWrapperCommandMsg *cmdMsg = newInstance(NetWrapperCommandMsg)();
+			cmdMsg->setWrappedCommandID(500);
+			cmdMsg->setChunkNumber(index);
+			cmdMsg->setNumChunks(3);
+			cmdMsg->setTotalDataLength(3 * 200);
+			cmdMsg->setDataOffset(index * 200);
+			cmdMsg->setData(s_data, 200);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_FILE:
+		{
+			NetFileCommandMsg *cmdMsg = newInstance(NetFileCommandMsg)();
+			cmdMsg->setPortableFilename("maps\\test\\test.map");
+			cmdMsg->setFileData(s_data, sizeof(s_data));
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_FILEANNOUNCE:
+		{
+			NetFileAnnounceCommandMsg *cmdMsg = newInstance(NetFileAnnounceCommandMsg)();
+			cmdMsg->setPortableFilename("maps\\test\\test.tga");
+			cmdMsg->setFileID(7);
+			cmdMsg->setPlayerMask(0x0e);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_FILEPROGRESS:
+		{
+			NetFileProgressCommandMsg *cmdMsg = newInstance(NetFileProgressCommandMsg)();
+			cmdMsg->setFileID(7);
+			cmdMsg->setProgress(-1 + index);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_FRAMERESENDREQUEST:
+		{
+			NetFrameResendRequestCommandMsg *cmdMsg = newInstance(NetFrameResendRequestCommandMsg)();
+			cmdMsg->setFrameToResend(9000 + index);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_DISCONNECTPLAYER:
+		{
+			NetDisconnectPlayerCommandMsg *cmdMsg = newInstance(NetDisconnectPlayerCommandMsg)();
+			cmdMsg->setDisconnectSlot(6);
+			cmdMsg->setDisconnectFrame(8000 + index);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_DISCONNECTVOTE:
+		{
+			NetDisconnectVoteCommandMsg *cmdMsg = newInstance(NetDisconnectVoteCommandMsg)();
+			cmdMsg->setSlot(1);
+			cmdMsg->setVoteFrame(7000 + index);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_DISCONNECTFRAME:
+		{
+			NetDisconnectFrameCommandMsg *cmdMsg = newInstance(NetDisconnectFrameCommandMsg)();
+			cmdMsg->setDisconnectFrame(6000 + index);
+			msg = cmdMsg;
+			break;
+		}
+		case NETCOMMANDTYPE_DISCONNECTSCREENOFF:
+		{
+			NetDisconnectScreenOffCommandMsg *cmdMsg = newInstance(NetDisconnectScreenOffCommandMsg)();
+			cmdMsg->setNewFrame(5000 + index);
+			msg = cmdMsg;
+			break;
+		}
+		default:
+			// commands without data, such as NETCOMMANDTYPE_LOADCOMPLETE
+			msg = newInstance(NetCommandMsg)();
+			break;
+	}
+
+	msg->setNetCommandType(type);
+	msg->setExecutionFrame(4000 + index);
+	msg->setPlayerID(1 + (type % 3));
+	msg->setID(200 + index);
+	return msg;
+}
+
+// Returns true if both commands are written the same on their own, which compares all of their values.
+static Bool isSameCommand(NetCommandRef *a, NetCommandRef *b)
+{
+	NetPacket *packetA = newInstance(NetPacket);
+	NetPacket *packetB = newInstance(NetPacket);
+	Bool same = packetA->addCommand(a) && packetB->addCommand(b) &&
+		packetA->getLength() == packetB->getLength() &&
+		memcmp(packetA->getData(), packetB->getData(), packetA->getLength()) == 0;
+	deleteInstance(packetA);
+	deleteInstance(packetB);
+	return same;
+}
+
+// Returns true if both lists hold the same commands in the same order.
+static Bool isSameCommandList(NetCommandList *a, NetCommandList *b)
+{
+	NetCommandRef *refA = a->getFirstMessage();
+	NetCommandRef *refB = b->getFirstMessage();
+	for (; refA != NULL && refB != NULL; refA = refA->getNext(), refB = refB->getNext())
+	{
+		if (refA->getRelay() != refB->getRelay() || !isSameCommand(refA, refB))
+			return FALSE;
+	}
+	return refA == NULL && refB == NULL;
+}
+
+// Packs the commands into packets, with chunk checksums when compact. The sent dictionary gives the compact
+// encoding its references.
+static void packCommands(NetCommandList *list, std::vector<NetPacket *> &packets, Bool compact, NetGameCommandDictionary *sent)
+{
+	NetPacket *packet = NULL;
+	for (NetCommandRef *ref = list->getFirstMessage(); ref != NULL; ref = ref->getNext())
+	{
+		const Bool isGameCommand = (ref->getCommand()->getNetCommandType() == NETCOMMANDTYPE_GAMECOMMAND);
+		const NetGameCommandDictionary::Entry *reference = (sent != NULL && isGameCommand) ? sent->getConfirmed() : NULL;
+		if (packet == NULL || !packet->addCommand(ref, reference))
+		{
+			packet = newInstance(NetPacket);
+			packet->setCompactGameCommands(compact);
+			packet->setChunkChecksums(compact);
+			packets.push_back(packet);
+			if (!packet->addCommand(ref, reference))
+			{
+				printf("  a command of type %d does not fit into an empty packet\n", ref->getCommand()->getNetCommandType());
+				continue;
+			}
+		}
+		if (sent != NULL && isGameCommand)
+			sent->add((NetGameCommandMsg *)ref->getCommand());
+	}
+}
+
+// Reads the packets back into a single list.
+static NetCommandList * unpackCommands(std::vector<NetPacket *> &packets, NetGameCommandDictionary *received)
+{
+	NetCommandList *list = newInstance(NetCommandList);
+	list->init();
+	for (size_t i = 0; i < packets.size(); ++i)
+	{
+		NetCommandList *packetList = packets[i]->getCommandList(received);
+		list->appendList(packetList);
+		deleteInstance(packetList);
+	}
+	return list;
+}
+
+static void deletePackets(std::vector<NetPacket *> &packets)
+{
+	for (size_t i = 0; i < packets.size(); ++i)
+		deleteInstance(packets[i]);
+	packets.clear();
+}
+
+static UnsignedInt getPacketBytes(const std::vector<NetPacket *> &packets)
+{
+	UnsignedInt bytes = 0;
+	for (size_t i = 0; i < packets.size(); ++i)
+		bytes += packets[i]->getLength();
+	return bytes;
+}
+
+// The bytes that the add*Command functions of the original game wrote for the commands of
+// testOriginalBytes. The original game reads the packets of the format table, so they must not change.
+static const UnsignedByte s_originalBytes[] =
+{
+	// frame resend request: every header field, in the order T F R P C
+	'T', NETCOMMANDTYPE_FRAMERESENDREQUEST, 'F', 0xa0, 0x0f, 0x00, 0x00, 'R', 0x03, 'P', 0x01, 'C', 0xc8, 0x00, 'D', 0x28, 0x23, 0x00, 0x00,
+	// the next frame resend request with the next command id: only the data
+	'D', 0x29, 0x23, 0x00, 0x00,
+	// disconnect frame: a new frame, and a command id that does not follow
+	'T', NETCOMMANDTYPE_DISCONNECTFRAME, 'F', 0xa1, 0x0f, 0x00, 0x00, 'C', 0xcd, 0x00, 'D', 0x70, 0x17, 0x00, 0x00,
+	// disconnect screen off: a new player always writes the command id
+	'T', NETCOMMANDTYPE_DISCONNECTSCREENOFF, 'P', 0x02, 'C', 0xce, 0x00, 'D', 0x88, 0x13, 0x00, 0x00,
+	// run ahead: the relay comes before the frame
+	'T', NETCOMMANDTYPE_RUNAHEAD, 'R', 0x05, 'F', 0xa2, 0x0f, 0x00, 0x00, 'D', 0x0a, 0x00, 0x1e,
+	// keep alive: no frame and no command id
+	'T', NETCOMMANDTYPE_KEEPALIVE, 'P', 0x01, 'D',
+	// disconnect vote: no frame, and the command id follows the one of the run ahead
+	'T', NETCOMMANDTYPE_DISCONNECTVOTE, 'D', 0x01, 0x58, 0x1b, 0x00, 0x00,
+	// ack: the acked command id and its player
+	'T', NETCOMMANDTYPE_ACKBOTH, 'D', 0x2c, 0x01, 0x02,
+	// the ack of the next command is a repeat
+	'Z',
+	// frame info: the command id follows the one of the disconnect vote
+	'T', NETCOMMANDTYPE_FRAMEINFO, 'F', 0xa3, 0x0f, 0x00, 0x00, 'D', 0x02, 0x00,
+	// the empty frame after it is a repeat
+	'Z',
+};
+
+// Gives the command its header values and wraps it for a packet.
+static NetCommandRef * newOriginalBytesCommand(NetCommandMsg *msg, NetCommandType type, UnsignedInt frame, UnsignedByte relay, Int playerID, UnsignedShort id)
+{
+	msg->setNetCommandType(type);
+	msg->setExecutionFrame(frame);
+	msg->setPlayerID(playerID);
+	msg->setID(id);
+	NetCommandRef *ref = NEW_NETCOMMANDREF(msg);
+	ref->setRelay(relay);
+	msg->detach();
+	return ref;
+}
+
+// Writes commands whose header fields change in the ways that the original encoder wrote or left out,
+// and compares the packet with s_originalBytes.
+static Bool testOriginalBytes()
+{
+	NetCommandRef *refs[11];
+	Int numRefs = 0;
+
+	NetFrameResendRequestCommandMsg *frameResend = newInstance(NetFrameResendRequestCommandMsg)();
+	frameResend->setFrameToResend(9000);
+	refs[numRefs++] = newOriginalBytesCommand(frameResend, NETCOMMANDTYPE_FRAMERESENDREQUEST, 4000, 3, 1, 200);
+
+	frameResend = newInstance(NetFrameResendRequestCommandMsg)();
+	frameResend->setFrameToResend(9001);
+	refs[numRefs++] = newOriginalBytesCommand(frameResend, NETCOMMANDTYPE_FRAMERESENDREQUEST, 4000, 3, 1, 201);
+
+	NetDisconnectFrameCommandMsg *disconnectFrame = newInstance(NetDisconnectFrameCommandMsg)();
+	disconnectFrame->setDisconnectFrame(6000);
+	refs[numRefs++] = newOriginalBytesCommand(disconnectFrame, NETCOMMANDTYPE_DISCONNECTFRAME, 4001, 3, 1, 205);
+
+	NetDisconnectScreenOffCommandMsg *screenOff = newInstance(NetDisconnectScreenOffCommandMsg)();
+	screenOff->setNewFrame(5000);
+	refs[numRefs++] = newOriginalBytesCommand(screenOff, NETCOMMANDTYPE_DISCONNECTSCREENOFF, 4001, 3, 2, 206);
+
+	NetRunAheadCommandMsg *runAhead = newInstance(NetRunAheadCommandMsg)();
+	runAhead->setRunAhead(10);
+	runAhead->setFrameRate(30);
+	refs[numRefs++] = newOriginalBytesCommand(runAhead, NETCOMMANDTYPE_RUNAHEAD, 4002, 5, 2, 207);
+
+	refs[numRefs++] = newOriginalBytesCommand(newInstance(NetKeepAliveCommandMsg)(), NETCOMMANDTYPE_KEEPALIVE, 4002, 5, 1, 0);
+
+	NetDisconnectVoteCommandMsg *vote = newInstance(NetDisconnectVoteCommandMsg)();
+	vote->setSlot(1);
+	vote->setVoteFrame(7000);
+	refs[numRefs++] = newOriginalBytesCommand(vote, NETCOMMANDTYPE_DISCONNECTVOTE, 4002, 5, 1, 208);
+
+	for (Int i = 0; i < 2; ++i)
+	{
+		NetAckBothCommandMsg *ack = newInstance(NetAckBothCommandMsg)();
+		ack->setCommandID(300 + i);
+		ack->setOriginalPlayerID(2);
+		refs[numRefs++] = newOriginalBytesCommand(ack, NETCOMMANDTYPE_ACKBOTH, 4002, 5, 1, 0);
+	}
+
+	for (Int i = 0; i < 2; ++i)
+	{
+		NetFrameCommandMsg *frame = newInstance(NetFrameCommandMsg)();
+		frame->setCommandCount((i == 0) ? 2 : 0);
+		refs[numRefs++] = newOriginalBytesCommand(frame, NETCOMMANDTYPE_FRAMEINFO, 4003 + i, 5, 1, 209 + i);
+	}
+
+	NetPacket *packet = newInstance(NetPacket);
+	Bool added = TRUE;
+	for (Int i = 0; i < numRefs; ++i)
+	{
+		added = packet->addCommand(refs[i]) && added;
+		deleteInstance(refs[i]);
+	}
+
+	const Bool same = added && packet->getLength() == (Int)sizeof(s_originalBytes) &&
+		memcmp(packet->getData(), s_originalBytes, sizeof(s_originalBytes)) == 0;
+	printf("  %d commands written to %d bytes, the original encoder wrote %d bytes\n",
+		numRefs, packet->getLength(), (Int)sizeof(s_originalBytes));
+	if (!same)
+	{
+		for (Int i = 0; i < packet->getLength(); ++i)
+			printf("%02x%s", packet->getData()[i], ((i % 16) == 15) ? "\n" : " ");
+		printf("\n");
+	}
+	deleteInstance(packet);
+
+	return check(same, "the packet differs from the bytes of the original encoder");
+}
+
+// Writes every command type, reads it back and checks that it is written the same again. Once in the
+// plain encoding, and once in the compact encoding with references to commands that the receiver has.
+static Bool testRoundTrip()
+{
+	Bool passed = TRUE;
+	NetCommandList *list = newInstance(NetCommandList);
+	list->init();
+	Int numTypes = 0;
+	for (Int type = 0; type <= NETCOMMANDTYPE_DISCONNECTEND; ++type)
+	{
+		if (!isSendableType(type))
+			continue;
+		++numTypes;
+		for (Int index = 0; index < 3; ++index)
+		{
+			NetCommandMsg *msg = newTestCommand((NetCommandType)type, index);
+			NetCommandRef *ref = list->addMessage(msg);
+			if (ref != NULL)
+				ref->setRelay((UnsignedByte)(0x0f + type));
+			msg->detach();
+		}
+	}
+
+	for (Int pass = 0; pass < 3; ++pass)
+	{
+		const Bool compact = (pass > 0);
+		NetGameCommandDictionary sent;
+		NetGameCommandDictionary received;
+		std::vector<NetPacket *> packets;
+
+		if (pass == 2)
+		{
+			// the receiver has the first game command and acked it
+			NetCommandList *ackedList = newInstance(NetCommandList);
+			ackedList->init();
+			NetCommandRef *first = list->findMessage(200, 1 + (NETCOMMANDTYPE_GAMECOMMAND % 3));
+			ackedList->addMessage(first->getCommand());
+			packCommands(ackedList, packets, TRUE, &sent);
+			NetCommandList *receivedList = unpackCommands(packets, &received);
+			sent.confirm(200, 1 + (NETCOMMANDTYPE_GAMECOMMAND % 3));
+			passed = check(sent.getConfirmed() != NULL, "the acked game command is not in the dictionary") && passed;
+			deleteInstance(receivedList);
+			deleteInstance(ackedList);
+			deletePackets(packets);
+		}
+
+		packCommands(list, packets, compact, (pass == 2) ? &sent : NULL);
+		NetCommandList *readList = unpackCommands(packets, &received);
+		passed = check(isSameCommandList(list, readList), "the round trip changed the commands") && passed;
+
+		if (!compact)
+		{
+			// writing the commands that were read gives the same packets, including the repeats
+			std::vector<NetPacket *> packetsAgain;
+			packCommands(readList, packetsAgain, FALSE, NULL);
+			Bool same = (packets.size() == packetsAgain.size());
+			for (size_t i = 0; same && i < packets.size(); ++i)
+			{
+				same = packets[i]->getLength() == packetsAgain[i]->getLength() &&
+					memcmp(packets[i]->getData(), packetsAgain[i]->getData(), packets[i]->getLength()) == 0;
+			}
+			passed = check(same, "the commands that were read are written differently") && passed;
+			deletePackets(packetsAgain);
+		}
+		else if (pass == 2)
+		{
+			// a receiver without the referred command drops the game commands that refer to it
+			NetGameCommandDictionary empty;
+			NetCommandList *droppedList = unpackCommands(packets, &empty);
+			passed = check(droppedList->length() < list->length(), "no game command used a reference") && passed;
+			printf("  %d of %d commands were read without the referred command\n", droppedList->length(), list->length());
+			deleteInstance(droppedList);
+		}
+
+		printf("  round trip %d: %d commands of %d types in %d packets, %u bytes\n", pass,
+			list->length(), numTypes, (Int)packets.size(), getPacketBytes(packets));
+
+		deleteInstance(readList);
+		deletePackets(packets);
+	}
+
+	deleteInstance(list);
+	return passed;
+}
+
+// Reads damaged and random packets, which must neither crash nor read outside of the packet.
+static void testFuzz()
+{
+	NetCommandList *list = newInstance(NetCommandList);
+	list->init();
+	for (Int type = 0; type <= NETCOMMANDTYPE_DISCONNECTEND; ++type)
+	{
+		if (!isSendableType(type))
+			continue;
+		NetCommandMsg *msg = newTestCommand((NetCommandType)type, 0);
+		list->addMessage(msg);
+		msg->detach();
+	}
+	std::vector<NetPacket *> packets;
+	packCommands(list, packets, FALSE, NULL);
+	packCommands(list, packets, TRUE, NULL);
+	deleteInstance(list);
+
+#ifdef DEBUG_CRASHING
+	// the decoder asserts on the bytes it does not know
+	const Bool ignoreAsserts = TheGlobalData->m_debugIgnoreAsserts;
+	TheWritableGlobalData->m_debugIgnoreAsserts = TRUE;
+#endif
+
+	srand(1);
+	NetGameCommandDictionary received;
+	TransportMessage message;
+	memset(&message, 0, sizeof(message));
+	Int numCommands = 0;
+	for (Int i = 0; i < NUM_FUZZ_PACKETS; ++i)
+	{
+		NetPacket *source = packets[i % packets.size()];
+		if (i % 4 == 3)
+		{
+			// random bytes, mostly field types
+			message.length = rand() % MAX_PACKET_SIZE;
+			for (Int j = 0; j < message.length; ++j)
+				message.data[j] = (rand() % 2) ? "TFRPCDGZXW"[rand() % 10] : (UnsignedByte)rand();
+		}
+		else
+		{
+			// a damaged or cut off packet
+			message.length = source->getLength();
+			memcpy(message.data, source->getData(), message.length);
+			const Int numChanges = 1 + rand() % 4;
+			for (Int j = 0; j < numChanges; ++j)
+				message.data[rand() % message.length] = (UnsignedByte)rand();
+			if (i % 4 == 2)
+				message.length = rand() % (message.length + 1);
+		}
+		// the bytes after the end must not be read
+		memset(message.data + message.length, 0xcd, MAX_MESSAGE_LEN - message.length);
+
+		NetPacket *packet = newInstance(NetPacket)(&message);
+		NetCommandList *cmdList = packet->getCommandList(&received);
+		numCommands += cmdList->length();
+		deleteInstance(cmdList);
+		deleteInstance(packet);
+	}
+
+#ifdef DEBUG_CRASHING
+	TheWritableGlobalData->m_debugIgnoreAsserts = ignoreAsserts;
+#endif
+
+	deletePackets(packets);
+	printf("  %d damaged and random packets read, %d commands in them\n", (Int)NUM_FUZZ_PACKETS, numCommands);
+}
+
+// Measures how fast game commands like unit selections and orders are written and read.
+static void testThroughput()
+{
+	NetCommandList *list = newInstance(NetCommandList);
+	list->init();
+	for (Int i = 0; i < NUM_BENCHMARK_COMMANDS; ++i)
+	{
+		NetCommandMsg *msg = newTestCommand(NETCOMMANDTYPE_GAMECOMMAND, i % 8);
+		msg->setID(i);
+		list->addMessage(msg);
+		msg->detach();
+	}
+
+	for (Int compact = 0; compact < 2; ++compact)
+	{
+		UnsignedInt writeTime = 0;
+		UnsignedInt readTime = 0;
+		UnsignedInt bytes = 0;
+		Int numPackets = 0;
+
+		for (Int j = 0; j < NUM_TIMES; ++j)
+		{
+			std::vector<NetPacket *> packets;
+			packets.reserve(NUM_BENCHMARK_COMMANDS);
+
+			UnsignedInt start = timeGetTime();
+			packCommands(list, packets, compact != 0, NULL);
+			writeTime += timeGetTime() - start;
+
+			start = timeGetTime();
+			NetCommandList *readList = unpackCommands(packets, NULL);
+			readTime += timeGetTime() - start;
+
+			bytes = getPacketBytes(packets);
+			numPackets = (Int)packets.size();
+			deleteInstance(readList);
+			deletePackets(packets);
+		}
+
+		const Real numCommands = (Real)NUM_BENCHMARK_COMMANDS * NUM_TIMES;
+		printf("  %s: %d commands in %d packets, %u bytes, write %g commands/ms, read %g commands/ms\n",
+			compact ? "compact" : "plain", (Int)NUM_BENCHMARK_COMMANDS, numPackets, bytes,
+			numCommands / (Real)max(writeTime, 1u), numCommands / (Real)max(readTime, 1u));
+	}
+
+	deleteInstance(list);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Checks the packet encoding against the encoder before the command format table, its round trips,
+	* damaged packets and its throughput. */
+//-------------------------------------------------------------------------------------------------
+Bool testNetPacket( void )
+{
+	Bool passed = testOriginalBytes();
+	passed = testRoundTrip() && passed;
+	testFuzz();
+	testThroughput();
+	return passed;
+}
+
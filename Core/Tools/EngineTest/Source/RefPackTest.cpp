@@ -0,0 +1,389 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: RefPackTest.cpp //////////////////////////////////////////////////////////////////////////
+// Checks that the RefPack encoder writes the same bytes as the encoder before its @performance
+// change, and that its output decodes to the source.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Lib/BaseType.h"
+#include "Common/AsciiString.h"
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Common/GameMemory.h"
+#include "EAC/refcodex.h"
+
+#include "EngineTest.h"
+
+//-------------------------------------------------------------------------------------------------
+// RefPack data ends up in maps and save games, so the faster encoder must write exactly the bytes of
+// the encoder before its @performance change. This is a verbatim copy of that encoder, renamed and
+// allocating with malloc like galloc does.
+//-------------------------------------------------------------------------------------------------
+static unsigned int refMatchlenReference(unsigned char *s,unsigned char *d, unsigned int maxmatch)
+{
+    unsigned int current;
+
+    for (current=0; current<maxmatch && *s++==*d++; ++current)
+        ;
+
+    return(current);
+}
+
+#define REF_HASH_REFERENCE(cptr) (int)((((unsigned int)(unsigned char)cptr[0]<<8) | ((unsigned int)(unsigned char)cptr[2])) ^ ((unsigned int)(unsigned char)cptr[1]<<4))
+
+static int refcompressReference(unsigned char *from, int len, unsigned char *dest, int maxback, int quick)
+{
+    unsigned int tlen;
+    unsigned int tcost;
+//    unsigned int ccost;    // context cost
+    unsigned int run;
+    unsigned int toffset;
+    unsigned int boffset;
+    unsigned int blen;
+    unsigned int bcost;
+    unsigned int mlen;
+    unsigned char *tptr;
+    unsigned char *cptr;
+    unsigned char *to;
+    unsigned char *rptr;
+    int countliterals=0;
+    int countshort=0;
+    int countint=0;
+    int countvint=0;
+    int hash;
+    int hoffset;
+    int minhoffset;
+    int i;
+    int *link;
+    int *hashtbl;
+
+    to = dest;
+    run = 0;
+    cptr = rptr = from;
+
+    if ((unsigned int)maxback > (unsigned int)131071)
+        maxback = 131071;
+
+	hashtbl = (int *) malloc(65536L*sizeof(int));
+	if (!hashtbl)
+        return(0);
+	link = (int *) malloc(131072L*sizeof(int));
+	if (!link)
+	{
+	    free(hashtbl);
+	    return(0);
+	}
+
+    memset(hashtbl,-1,65536L*sizeof(int));
+
+    len -= 4;
+    while (len>=0)
+    {
+        boffset = 0;
+        blen = 2;
+        bcost = 2;
+//        ccost = 0;
+        mlen = qmin(len,1028);
+        tptr=cptr-1;
+        hash = REF_HASH_REFERENCE(cptr);
+        hoffset = hashtbl[hash];
+        minhoffset = qmax(cptr-from-131071,0);
+
+
+        if (hoffset>=minhoffset)
+        {
+            do
+            {
+                tptr = from+hoffset;
+                if (cptr[blen]==tptr[blen])
+                {
+                    tlen = refMatchlenReference(cptr,tptr,mlen);
+                    if (tlen > blen)
+                    {
+                        toffset = (cptr-1)-tptr;
+                        if (toffset<1024 && tlen<=10)       /* two byte int form */
+                            tcost = 2;
+                        else if (toffset<16384 && tlen<=67) /* three byte int form */
+                            tcost = 3;
+                        else                                /* four byte very int form */
+                            tcost = 4;
+
+                        if (tlen-tcost+4 > blen-bcost+4)
+                        {
+                            blen = tlen;
+                            bcost = tcost;
+                            boffset = toffset;
+                            if (blen>=1028) break;
+                        }
+                    }
+                }
+            } while ((hoffset = link[hoffset&131071]) >= minhoffset);
+        }
+
+//        ccost = 0;
+//        if ((run<4) && ((run+blen)>=4))
+//            ccost = 1;  // extra packet cost to switch out of literal into reference
+
+//        if (bcost>blen || (blen<=2 && bcost==blen && !ccost) || (len<4))
+        if (bcost>=blen || len<4)
+        {
+            hoffset = (cptr-from);
+            link[hoffset&131071] = hashtbl[hash];
+            hashtbl[hash] = hoffset;
+
+            ++run;
+            ++cptr;
+            --len;
+        }
+        else
+        {
+            while (run>3)                   /* literal block of data */
+            {
+                tlen = qmin(112,run&~3);
+                run -= tlen;
+                *to++ = (unsigned char) (0xe0+(tlen>>2)-1);
+                memcpy(to,rptr,tlen);
+                rptr += tlen;
+                to += tlen;
+                ++countliterals;
+            }
+            if (bcost==2)                   /* two byte int form */
+            {
+                *to++ = (unsigned char) (((boffset>>8)<<5) + ((blen-3)<<2) + run);
+                *to++ = (unsigned char) boffset;
+                ++countshort;
+            }
+            else if (bcost==3)              /* three byte int form */
+            {
+                *to++ = (unsigned char) (0x80 + (blen-4));
+                *to++ = (unsigned char) ((run<<6) + (boffset>>8));
+                *to++ = (unsigned char) boffset;
+                ++countint;
+            }
+            else                            /* four byte very int form */
+            {
+                *to++ = (unsigned char) (0xc0 + ((boffset>>16)<<4) + (((blen-5)>>8)<<2) + run);
+                *to++ = (unsigned char) (boffset>>8);
+                *to++ = (unsigned char) (boffset);
+                *to++ = (unsigned char) (blen-5);
+                ++countvint;
+            }
+            if (run)
+            {
+                memcpy(to, rptr, run);
+                to += run;
+                run = 0;
+            }
+
+            if (quick)
+            {
+                hoffset = (cptr-from);
+                link[hoffset&131071] = hashtbl[hash];
+                hashtbl[hash] = hoffset;
+                cptr += blen;
+            }
+            else
+            {
+                for (i=0; i < (int)blen; ++i)
+                {
+                    hash = REF_HASH_REFERENCE(cptr);
+                    hoffset = (cptr-from);
+                    link[hoffset&131071] = hashtbl[hash];
+                    hashtbl[hash] = hoffset;
+                    ++cptr;
+                }
+            }
+
+            rptr = cptr;
+            len -= blen;
+        }
+    }
+    len += 4;
+    run += len;
+    while (run>3)                       /* no match at end, use literal */
+    {
+        tlen = qmin(112,run&~3);
+        run -= tlen;
+        *to++ = (unsigned char) (0xe0+(tlen>>2)-1);
+        memcpy(to,rptr,tlen);
+        rptr += tlen;
+        to += tlen;
+    }
+
+    *to++ = (unsigned char) (0xfc+run); /* end of stream command + 0..3 literal */
+    if (run)
+    {
+        memcpy(to,rptr,run);
+        to += run;
+    }
+
+	free(link);
+	free(hashtbl);
+    return(to-dest);
+}
+
+#undef REF_HASH_REFERENCE
+
+enum RefPackTestPattern
+{
+	REFPACK_TEST_ZEROS,
+	REFPACK_TEST_RANDOM,
+	REFPACK_TEST_PERIOD_2,
+	REFPACK_TEST_PERIOD_3,
+	REFPACK_TEST_COPIES,
+
+	REFPACK_TEST_PATTERN_COUNT
+};
+
+// Fills the buffer with test data that reaches the different RefPack commands: literal blocks,
+// overlapping references at short distances, the longest matches and references beyond the window.
+static void fillRefPackTestData( UnsignedByte *buf, Int len, Int pattern )
+{
+	UnsignedInt state = 12345u + pattern;
+	Int i = 0;
+	while (i < len)
+	{
+		state = state * 1664525u + 1013904223u;
+		switch (pattern)
+		{
+			case REFPACK_TEST_ZEROS:
+				buf[i++] = 0;
+				break;
+			case REFPACK_TEST_RANDOM:
+				buf[i++] = (UnsignedByte)(state >> 24);
+				break;
+			case REFPACK_TEST_PERIOD_2:
+				buf[i] = (UnsignedByte)('a' + i % 2);
+				++i;
+				break;
+			case REFPACK_TEST_PERIOD_3:
+				buf[i] = (UnsignedByte)('a' + i % 3);
+				++i;
+				break;
+			case REFPACK_TEST_COPIES:
+			default:
+				if (i < 8 || (state >> 30) == 0)
+				{
+					buf[i++] = (UnsignedByte)(state >> 16);
+				}
+				else
+				{
+					const Int distance = 1 + (Int)((state >> 4) % (UnsignedInt)min(i, 140000));
+					const Int copyLen = min(len - i, 3 + (Int)((state >> 20) % 1100));
+					for (Int j = 0; j < copyLen; ++j, ++i)
+						buf[i] = buf[i - distance];
+				}
+				break;
+		}
+	}
+}
+
+// Checks that REF_encode writes the same bytes as the reference encoder, and that REF_decode
+// restores the source from them. Returns TRUE if both hold.
+static Bool checkRefPack( const UnsignedByte *src, Int srcLen, const char *name )
+{
+	// worst case is one literal command per 112 bytes plus the header and the end of stream command
+	const Int maxLen = srcLen + srcLen / 16 + 64;
+	UnsignedByte *encoded = NEW UnsignedByte[maxLen];
+	UnsignedByte *reference = NEW UnsignedByte[maxLen];
+	UnsignedByte *decoded = NEW UnsignedByte[srcLen + 1];
+
+	// the header is written the same way by both, only the compressed data can differ
+	const Int headerLen = (srcLen > 0xffffff) ? 6 : 5;
+	const Int encodedLen = REF_encode(encoded, src, srcLen);
+	const Int referenceLen = headerLen + refcompressReference((unsigned char *)src, srcLen, reference + headerLen, 131072, 0);
+	const Bool exact = encodedLen == referenceLen && memcmp(encoded + headerLen, reference + headerLen, encodedLen - headerLen) == 0;
+	if (!exact)
+	{
+		printf("  '%s' of %d bytes encodes to %d bytes that differ from the %d bytes of the reference encoder\n",
+			name, srcLen, encodedLen, referenceLen);
+	}
+
+	Int decodedFrom = 0;
+	const Int decodedLen = REF_decode(decoded, encoded, &decodedFrom);
+	const Bool roundTrip = decodedLen == srcLen && decodedFrom == encodedLen && memcmp(decoded, src, srcLen) == 0;
+	if (!roundTrip)
+		printf("  '%s' of %d bytes does not decode to its source\n", name, srcLen);
+
+	delete[] encoded;
+	delete[] reference;
+	delete[] decoded;
+
+	return exact && roundTrip;
+}
+
+// Runs checkRefPack on generated data of sizes around the limits of the encoder.
+static void checkRefPackTestData( Int &numCases, Int &numFailed )
+{
+	static const Int sizes[] = { 0, 1, 2, 3, 4, 5, 7, 8, 16, 112, 113, 1027, 1028, 1029, 4096, 65537, 131072, 300000 };
+
+	for (Int pattern = 0; pattern < REFPACK_TEST_PATTERN_COUNT; ++pattern)
+	{
+		for (Int i = 0; i < (Int)(sizeof(sizes) / sizeof(sizes[0])); ++i)
+		{
+			UnsignedByte *buf = NEW UnsignedByte[sizes[i] + 1];
+			fillRefPackTestData(buf, sizes[i], pattern);
+
+			char name[64];
+			sprintf(name, "pattern %d", pattern);
+			++numCases;
+			if (!checkRefPack(buf, sizes[i], name))
+				++numFailed;
+
+			delete[] buf;
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Runs checkRefPack on the generated data and on every map of the game */
+//-------------------------------------------------------------------------------------------------
+Bool testRefPack( void )
+{
+	Int numCases = 0;
+	Int numFailed = 0;
+	checkRefPackTestData(numCases, numFailed);
+
+	FilenameList mapNames;
+	TheFileSystem->getFileListInDirectory("Maps\\", "*.map", mapNames, TRUE);
+	for (FilenameListIter it = mapNames.begin(); it != mapNames.end(); ++it)
+	{
+		File *f = TheFileSystem->openFile(it->str());
+		if (!f)
+			continue;
+
+		const Int size = f->size();
+		UnsignedByte *buf = (UnsignedByte *)f->readEntireAndClose();
+
+		++numCases;
+		if (!checkRefPack(buf, size, it->str()))
+			++numFailed;
+
+		delete[] buf;
+	}
+
+	printf("  %d of %d cases, %d of them maps, encode exactly like the reference encoder and decode to their source\n",
+		numCases - numFailed, numCases, (Int)mapNames.size());
+
+	return numFailed == 0;
+}
@@ -0,0 +1,250 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: UDPBatchTest.cpp /////////////////////////////////////////////////////////////////////////
+// Measures the batched UDP reads and writes against the single ones and checks what arrives.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <windows.h>
+#include <stdio.h>
+
+#include "Lib/BaseType.h"
+#include "Common/GameMemory.h"
+#include "GameNetwork/udp.h"
+
+#include "EngineTest.h"
+
+enum { NUM_UDPBATCH_ROUNDS = 2000 };
+enum { NUM_UDPBATCH_DATAGRAMS = 64 };		///< datagrams per round, the most that ReadBatch and WriteBatch pass to one recvmmsg or sendmmsg
+enum { UDPBATCH_DATAGRAM_SIZE = 476 };	///< MAX_PACKET_SIZE, the largest packet the game sends
+enum { UDPBATCH_HEADER_SIZE = 6 };			///< round and index at the start of every datagram
+enum { MAX_UDPBATCH_EMPTY_READS = 10000 };
+
+//-------------------------------------------------------------------------------------------------
+/** Sends rounds of datagrams between two sockets on the loopback address, once with Write and Read
+	* and once with WriteBatch and ReadBatch, and checks that every datagram arrives intact. On Linux
+	* the batched calls go through recvmmsg and sendmmsg, elsewhere through the single calls. */
+//-------------------------------------------------------------------------------------------------
+struct UDPBatchTest
+{
+	UDP sender;
+	UDP receiver;
+	UnsignedInt senderIP;
+	UnsignedShort senderPort;
+	UnsignedInt receiverIP;
+	UnsignedShort receiverPort;
+	unsigned char sendBufs[NUM_UDPBATCH_DATAGRAMS][UDPBATCH_DATAGRAM_SIZE];
+	unsigned char readBufs[NUM_UDPBATCH_DATAGRAMS][UDPBATCH_DATAGRAM_SIZE];
+	UDP::Datagram datagrams[NUM_UDPBATCH_DATAGRAMS];
+	Int numBytes;
+	Int numBad;
+
+	static UnsignedInt getLength( Int round, Int index )
+	{
+		// the sizes of game packets vary, so do these
+		return UDPBATCH_HEADER_SIZE + (index * 37 + round) % (UDPBATCH_DATAGRAM_SIZE - UDPBATCH_HEADER_SIZE + 1);
+	}
+
+	static unsigned char getByte( Int round, Int index, UnsignedInt pos )
+	{
+		return (unsigned char)(round * 7 + index * 13 + pos);
+	}
+
+	Bool open()
+	{
+		const UnsignedInt loopback = 0x7f000001;
+		if (sender.Bind(loopback, 0) != UDP::OK || receiver.Bind(loopback, 0) != UDP::OK)
+			return FALSE;
+
+		// room for a whole round in the receive buffer
+		receiver.SetInputBuffer(NUM_UDPBATCH_DATAGRAMS * UDPBATCH_DATAGRAM_SIZE * 4);
+
+		sender.getLocalAddr(senderIP, senderPort);
+		receiver.getLocalAddr(receiverIP, receiverPort);
+		numBytes = 0;
+		numBad = 0;
+		return TRUE;
+	}
+
+	void fillRound( Int round )
+	{
+		for (Int i = 0; i < NUM_UDPBATCH_DATAGRAMS; ++i)
+		{
+			unsigned char *buf = sendBufs[i];
+			const UnsignedInt len = getLength(round, i);
+			buf[0] = (unsigned char)(round & 0xff);
+			buf[1] = (unsigned char)((round >> 8) & 0xff);
+			buf[2] = (unsigned char)((round >> 16) & 0xff);
+			buf[3] = (unsigned char)((round >> 24) & 0xff);
+			buf[4] = (unsigned char)(i & 0xff);
+			buf[5] = (unsigned char)((i >> 8) & 0xff);
+			for (UnsignedInt pos = UDPBATCH_HEADER_SIZE; pos < len; ++pos)
+				buf[pos] = getByte(round, i, pos);
+		}
+	}
+
+	void checkDatagram( Int round, const unsigned char *buf, Int len, UnsignedInt ip, UnsignedShort port )
+	{
+		Bool ok = len >= UDPBATCH_HEADER_SIZE && ip == senderIP && port == senderPort;
+		if (ok)
+		{
+			const Int bufRound = buf[0] | (buf[1] << 8) | (buf[2] << 16) | (buf[3] << 24);
+			const Int index = buf[4] | (buf[5] << 8);
+			ok = bufRound == round && index < NUM_UDPBATCH_DATAGRAMS && (UnsignedInt)len == getLength(round, index);
+			for (UnsignedInt pos = UDPBATCH_HEADER_SIZE; ok && pos < (UnsignedInt)len; ++pos)
+				ok = buf[pos] == getByte(round, index, pos);
+		}
+
+		if (ok)
+			numBytes += len;
+		else
+			++numBad;
+	}
+
+	void writeRound( Int round, Bool batched )
+	{
+		if (batched)
+		{
+			for (Int i = 0; i < NUM_UDPBATCH_DATAGRAMS; ++i)
+			{
+				datagrams[i].buf = sendBufs[i];
+				datagrams[i].len = getLength(round, i);
+				datagrams[i].ip = receiverIP;
+				datagrams[i].port = receiverPort;
+				datagrams[i].result = 0;
+			}
+			sender.WriteBatch(datagrams, NUM_UDPBATCH_DATAGRAMS);
+		}
+		else
+		{
+			for (Int i = 0; i < NUM_UDPBATCH_DATAGRAMS; ++i)
+				sender.Write(sendBufs[i], getLength(round, i), receiverIP, receiverPort);
+		}
+	}
+
+	/// Reads the datagrams of a round, returns how many arrived.
+	Int readRound( Int round, Bool batched )
+	{
+		Int numRead = 0;
+		Int numEmptyReads = 0;
+		while (numRead < NUM_UDPBATCH_DATAGRAMS && numEmptyReads < MAX_UDPBATCH_EMPTY_READS)
+		{
+			if (batched)
+			{
+				const Int count = NUM_UDPBATCH_DATAGRAMS - numRead;
+				for (Int i = 0; i < count; ++i)
+				{
+					datagrams[i].buf = readBufs[i];
+					datagrams[i].len = UDPBATCH_DATAGRAM_SIZE;
+				}
+
+				const Int retval = receiver.ReadBatch(datagrams, count);
+				if (retval <= 0)
+				{
+					++numEmptyReads;
+					continue;
+				}
+
+				for (Int i = 0; i < retval; ++i)
+					checkDatagram(round, datagrams[i].buf, datagrams[i].result, datagrams[i].ip, datagrams[i].port);
+				numRead += retval;
+			}
+			else
+			{
+				sockaddr_in from;
+				const Int retval = receiver.Read(readBufs[0], UDPBATCH_DATAGRAM_SIZE, &from);
+				if (retval <= 0)
+				{
+					++numEmptyReads;
+					continue;
+				}
+
+				checkDatagram(round, readBufs[0], retval, ntohl(from.sin_addr.s_addr), ntohs(from.sin_port));
+				++numRead;
+			}
+		}
+		return numRead;
+	}
+
+	/// Sends and reads all rounds, returns the time in milliseconds.
+	UnsignedInt run( Bool batched, Int& numLost )
+	{
+		numBytes = 0;
+		numBad = 0;
+		numLost = 0;
+
+		UnsignedInt time = 0;
+		for (Int round = 0; round < NUM_UDPBATCH_ROUNDS; ++round)
+		{
+			fillRound(round);
+
+			const UnsignedInt start = timeGetTime();
+			writeRound(round, batched);
+			numLost += NUM_UDPBATCH_DATAGRAMS - readRound(round, batched);
+			time += timeGetTime() - start;
+		}
+		return time;
+	}
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Compares Write and Read with WriteBatch and ReadBatch on the loopback address. Both must deliver
+	* every datagram intact. */
+//-------------------------------------------------------------------------------------------------
+Bool testUDPBatch( void )
+{
+	WSADATA wsadata;
+	if (WSAStartup(MAKEWORD(2, 2), &wsadata) != 0)
+	{
+		printf("  cannot start winsock\n");
+		return FALSE;
+	}
+
+	Bool passed = FALSE;
+	UDPBatchTest *test = NEW UDPBatchTest;
+	if (!test->open())
+	{
+		printf("  cannot bind the loopback sockets\n");
+	}
+	else
+	{
+		Int singleLost = 0;
+		Int batchLost = 0;
+		const UnsignedInt singleTime = test->run(FALSE, singleLost);
+		const Int singleBytes = test->numBytes;
+		const Int singleBad = test->numBad;
+		const UnsignedInt batchTime = test->run(TRUE, batchLost);
+		const Int batchBytes = test->numBytes;
+		const Int batchBad = test->numBad;
+
+		const Int numDatagrams = NUM_UDPBATCH_ROUNDS * NUM_UDPBATCH_DATAGRAMS;
+		printf("  %d datagrams, %d bytes on the loopback address\n", numDatagrams, singleBytes);
+		printf("  Write and Read: %u ms, %g datagrams/s, %g MB/s, %d lost, %d bad\n",
+			singleTime, numDatagrams * 1000.0f / max(singleTime, 1u), singleBytes / 1024.0f / 1024.0f * 1000.0f / max(singleTime, 1u), singleLost, singleBad);
+		printf("  WriteBatch and ReadBatch: %u ms, %g datagrams/s, %g MB/s, %d lost, %d bad\n",
+			batchTime, numDatagrams * 1000.0f / max(batchTime, 1u), batchBytes / 1024.0f / 1024.0f * 1000.0f / max(batchTime, 1u), batchLost, batchBad);
+
+		// the loopback address can drop datagrams when the receive buffer is full, so losses are not a failure
+		passed = singleBad == 0 && batchBad == 0 && (singleBytes == batchBytes || singleLost != 0 || batchLost != 0);
+	}
+	delete test;
+
+	WSACleanup();
+
+	return passed;
+}
@@ -0,0 +1,328 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: NetTelemetry.cpp /////////////////////////////////////////////////////////////////////////
+// Summarizes the CSV files written by the game with the -netTelemetry command line argument.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+enum { MAX_SLOTS = 8 };
+
+static const int MISSING = -0x7fffffff;
+
+//-------------------------------------------------------------------------------------------------
+/** Collects the values of one column and reports their spread. */
+//-------------------------------------------------------------------------------------------------
+class Series
+{
+public:
+
+	void add(int value) { if (value != MISSING) m_values.push_back(value); }
+	bool empty() const { return m_values.empty(); }
+	int count() const { return (int)m_values.size(); }
+
+	double sum() const
+	{
+		double total = 0.0;
+		for (size_t i = 0; i < m_values.size(); ++i)
+			total += m_values[i];
+		return total;
+	}
+
+	double average() const { return empty() ? 0.0 : sum() / m_values.size(); }
+
+	/// Returns the value below which the given percentage of the values lie.
+	int percentile(int percent) const
+	{
+		if (empty())
+			return 0;
+		std::vector<int> sorted(m_values);
+		std::sort(sorted.begin(), sorted.end());
+		size_t index = (sorted.size() - 1) * percent / 100;
+		return sorted[index];
+	}
+
+	int minimum() const { return empty() ? 0 : *std::min_element(m_values.begin(), m_values.end()); }
+	int maximum() const { return empty() ? 0 : *std::max_element(m_values.begin(), m_values.end()); }
+
+	int numChanges() const
+	{
+		int changes = 0;
+		for (size_t i = 1; i < m_values.size(); ++i)
+			if (m_values[i] != m_values[i - 1])
+				++changes;
+		return changes;
+	}
+
+	void print(const char *name, const char *unit) const
+	{
+		if (empty())
+			return;
+		printf("  %-22s avg %8.1f  min %6d  p5 %6d  p50 %6d  p95 %6d  max %6d %s\n", name, average(), minimum(),
+			percentile(5), percentile(50), percentile(95), maximum(), unit);
+	}
+
+private:
+
+	std::vector<int> m_values;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** The rows of one game. A game ends where the frame number does not grow. */
+//-------------------------------------------------------------------------------------------------
+struct Game
+{
+	Game() : m_firstFrame(0), m_lastFrame(0) {}
+
+	unsigned int m_firstFrame;
+	unsigned int m_lastFrame;
+	Series m_frameTime;
+	Series m_runAhead;
+	Series m_frameRate;
+	Series m_averageFps;
+	Series m_cushion;
+	Series m_routerLatency;
+	Series m_commands;
+	Series m_gameCommands;
+	Series m_bytesIn;
+	Series m_packetsIn;
+	Series m_bytesOut;
+	Series m_packetsOut;
+	Series m_slowFrames;	///< 1 for frames that took more than twice the time of the frame rate
+	Series m_latency[MAX_SLOTS];
+	Series m_fps[MAX_SLOTS];
+	Series m_retries[MAX_SLOTS];
+};
+
+//-------------------------------------------------------------------------------------------------
+static void splitLine(const char *line, std::vector<std::string> &fields)
+{
+	fields.clear();
+	const char *start = line;
+	for (const char *c = line; ; ++c)
+	{
+		if (*c == ',' || *c == '\0' || *c == '\n' || *c == '\r')
+		{
+			fields.push_back(std::string(start, c - start));
+			if (*c != ',')
+				break;
+			start = c + 1;
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+class Columns
+{
+public:
+
+	void setHeader(const std::vector<std::string> &header) { m_header = header; }
+
+	int find(const char *name) const
+	{
+		for (size_t i = 0; i < m_header.size(); ++i)
+			if (m_header[i] == name)
+				return (int)i;
+		return -1;
+	}
+
+	static int getValue(const std::vector<std::string> &fields, int column)
+	{
+		if (column < 0 || column >= (int)fields.size() || fields[column].empty())
+			return MISSING;
+		return atoi(fields[column].c_str());
+	}
+
+private:
+
+	std::vector<std::string> m_header;
+};
+
+//-------------------------------------------------------------------------------------------------
+static void printGame(int index, const Game &game)
+{
+	const double seconds = game.m_frameTime.sum() / 1000.0;
+
+	printf("Game %d: frames %u to %u, %d frames in %.1f s\n", index, game.m_firstFrame, game.m_lastFrame,
+		game.m_frameTime.count(), seconds);
+
+	game.m_frameTime.print("frame time", "ms");
+	printf("  %-22s %d of %d frames took more than twice the frame rate\n", "slow frames",
+		(int)game.m_slowFrames.sum(), game.m_slowFrames.count());
+	game.m_runAhead.print("run ahead", "frames");
+	printf("  %-22s %d changes\n", "run ahead changes", game.m_runAhead.numChanges());
+	game.m_frameRate.print("frame rate", "fps");
+	game.m_averageFps.print("local logic fps", "fps");
+	game.m_cushion.print("cushion", "frames");
+	game.m_routerLatency.print("router latency", "ms");
+	game.m_commands.print("commands per frame", "");
+	printf("  %-22s %d game commands\n", "total", (int)game.m_gameCommands.sum());
+
+	if (seconds > 0.0)
+	{
+		const double bytesIn = game.m_bytesIn.sum();
+		const double bytesOut = game.m_bytesOut.sum();
+		const double packetsIn = game.m_packetsIn.sum();
+		const double packetsOut = game.m_packetsOut.sum();
+		printf("  %-22s %8.1f B/s  %6.1f packets/s  %6.1f B per packet\n", "incoming", bytesIn / seconds,
+			packetsIn / seconds, packetsIn > 0.0 ? bytesIn / packetsIn : 0.0);
+		printf("  %-22s %8.1f B/s  %6.1f packets/s  %6.1f B per packet\n", "outgoing", bytesOut / seconds,
+			packetsOut / seconds, packetsOut > 0.0 ? bytesOut / packetsOut : 0.0);
+	}
+
+	for (int slot = 0; slot < MAX_SLOTS; ++slot)
+	{
+		if (game.m_latency[slot].empty())
+			continue;
+		printf("  slot %d: %d resends (%.1f per minute)\n", slot, (int)game.m_retries[slot].sum(),
+			seconds > 0.0 ? game.m_retries[slot].sum() * 60.0 / seconds : 0.0);
+		game.m_latency[slot].print("  ack latency", "ms");
+		game.m_fps[slot].print("  reported fps", "fps");
+	}
+	printf("\n");
+}
+
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+	if (argc != 2)
+	{
+		printf("Usage: %s telemetry.csv\n", argv[0]);
+		printf("Summarizes a file written with the -netTelemetry command line argument of the game.\n");
+		return 1;
+	}
+
+	FILE *fp = fopen(argv[1], "r");
+	if (!fp)
+	{
+		printf("Could not open %s\n", argv[1]);
+		return 1;
+	}
+
+	Columns columns;
+	std::vector<std::string> fields;
+	std::vector<Game> games;
+
+	int frameColumn = -1;
+	int timeColumn = -1, runAheadColumn = -1, frameRateColumn = -1, averageFpsColumn = -1, cushionColumn = -1;
+	int routerLatencyColumn = -1, commandsColumn = -1, gameCommandsColumn = -1;
+	int bytesInColumn = -1, packetsInColumn = -1, bytesOutColumn = -1, packetsOutColumn = -1;
+	int latencyColumn[MAX_SLOTS], fpsColumn[MAX_SLOTS], retriesColumn[MAX_SLOTS];
+
+	char line[4096];
+	while (fgets(line, sizeof(line), fp))
+	{
+		splitLine(line, fields);
+
+		// files can be appended to each other, so a header can follow rows
+		if (fields[0] == "frame")
+		{
+			columns.setHeader(fields);
+			frameColumn = columns.find("frame");
+			timeColumn = columns.find("time_ms");
+			runAheadColumn = columns.find("run_ahead");
+			frameRateColumn = columns.find("frame_rate");
+			averageFpsColumn = columns.find("avg_fps");
+			cushionColumn = columns.find("cushion");
+			routerLatencyColumn = columns.find("router_latency_ms");
+			commandsColumn = columns.find("commands");
+			gameCommandsColumn = columns.find("game_commands");
+			bytesInColumn = columns.find("bytes_in");
+			packetsInColumn = columns.find("packets_in");
+			bytesOutColumn = columns.find("bytes_out");
+			packetsOutColumn = columns.find("packets_out");
+			for (int slot = 0; slot < MAX_SLOTS; ++slot)
+			{
+				char name[32];
+				sprintf(name, "latency_ms_%d", slot);
+				latencyColumn[slot] = columns.find(name);
+				sprintf(name, "fps_%d", slot);
+				fpsColumn[slot] = columns.find(name);
+				sprintf(name, "retries_%d", slot);
+				retriesColumn[slot] = columns.find(name);
+			}
+			continue;
+		}
+
+		if (frameColumn < 0)
+			continue;
+
+		const int frameValue = Columns::getValue(fields, frameColumn);
+		if (frameValue == MISSING)
+			continue;
+		const unsigned int frame = (unsigned int)frameValue;
+
+		if (games.empty() || frame <= games.back().m_lastFrame)
+		{
+			games.push_back(Game());
+			games.back().m_firstFrame = frame;
+		}
+
+		Game &game = games.back();
+		game.m_lastFrame = frame;
+
+		// the time of the first row of a game is the time before the game, so it is left out
+		const int frameTime = Columns::getValue(fields, timeColumn);
+		const int frameRate = Columns::getValue(fields, frameRateColumn);
+		if (frame != game.m_firstFrame)
+		{
+			game.m_frameTime.add(frameTime);
+			if (frameTime != MISSING && frameRate != MISSING && frameRate > 0)
+				game.m_slowFrames.add(frameTime > 2 * 1000 / frameRate ? 1 : 0);
+		}
+
+		game.m_runAhead.add(Columns::getValue(fields, runAheadColumn));
+		game.m_frameRate.add(frameRate);
+		game.m_averageFps.add(Columns::getValue(fields, averageFpsColumn));
+		game.m_cushion.add(Columns::getValue(fields, cushionColumn));
+		game.m_routerLatency.add(Columns::getValue(fields, routerLatencyColumn));
+		game.m_commands.add(Columns::getValue(fields, commandsColumn));
+		game.m_gameCommands.add(Columns::getValue(fields, gameCommandsColumn));
+		game.m_bytesIn.add(Columns::getValue(fields, bytesInColumn));
+		game.m_packetsIn.add(Columns::getValue(fields, packetsInColumn));
+		game.m_bytesOut.add(Columns::getValue(fields, bytesOutColumn));
+		game.m_packetsOut.add(Columns::getValue(fields, packetsOutColumn));
+
+		for (int slot = 0; slot < MAX_SLOTS; ++slot)
+		{
+			game.m_latency[slot].add(Columns::getValue(fields, latencyColumn[slot]));
+			game.m_retries[slot].add(Columns::getValue(fields, retriesColumn[slot]));
+			const int fps = Columns::getValue(fields, fpsColumn[slot]);
+			if (fps >= 0)
+				game.m_fps[slot].add(fps);
+		}
+	}
+	fclose(fp);
+
+	if (games.empty())
+	{
+		printf("No telemetry rows in %s\n", argv[1]);
+		return 1;
+	}
+
+	for (size_t i = 0; i < games.size(); ++i)
+		printGame((int)i + 1, games[i]);
+
+	return 0;
+}
@@ -346,6 +346,16 @@ public:
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
 
+	Bool m_profileScripts; ///< If true, collect script engine timings and write them to a report when the map is unloaded.
+	UnsignedInt m_profileScriptsFrameLimit; ///< If not 0, quit the game after this many logic frames have been profiled.
+
+	Bool m_useArchiveIndexCache; ///< If true, read the directories of unchanged BIG files from the archive index cache in the user data folder.
+	Bool m_prefetchArchiveFiles; ///< If true, read the archived files of a map on worker threads while the map loads.
+
+	AsciiString m_startupTraceFile; ///< If not empty, write a Chrome trace of the startup and map load phases to this file.
+	AsciiString m_netTelemetryFile; ///< If not empty, append the network statistics of every multiplayer frame to this CSV file.
+	Bool m_measureNetEncoding; ///< If true, print how many bytes the game commands of a replay take in the plain and compact network encoding.
+
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
 	WeaponBonusSet* m_weaponBonusSet;
@@ -333,6 +333,12 @@ public:
 	*/
 	const char* getNextTokenOrNull(const char* seps = NULL);
 
+	/**
+		reentrant replacement of strtok() for the current line. pass the line buffer to get its
+		first token, and NULL to get the following tokens. all INI token functions use this.
+	*/
+	char* tokenize(char* str, const char* seps);
+
 	/**
 		This is called when the next thing you expect is something like:
 
@@ -383,6 +389,9 @@ public:
 
 	static Bool scanBool(const char* token);
 
+	/// the field parse tables that were indexed for lookups so far, for the engine tests
+	static void getIndexedFieldParseTables( std::vector<const FieldParse*>& tables );
+
 protected:
 
 	static Bool isValidINIFilename( const char *filename ); ///< is this a valid .ini filename
@@ -404,6 +413,7 @@ protected:
 	const char *m_sepsQuote;									///< token to represent a quoted ascii string
 	const char *m_blockEndToken;							///< token to represent end of data block
 	Bool m_endOfFile;													///< TRUE when we've hit EOF
+	char *m_tokenCursor;											///< next token position in m_buffer, see tokenize()
 #ifdef DEBUG_CRASHING
 	char m_curBlockStart[ INI_MAX_CHARS_PER_LINE ];	///< first line of cur block
 #endif
@@ -53,6 +53,8 @@
 #define K_LIGHTING_VERSION_3	3	// Added 2 additional global lights for terrain.
 #define K_WORLDDICT_VERSION_1 1
 #define K_MAPPREVIEW_VERSION_1 1
+class File;
+
 /** Virtual helper class, so that we can write map data using FILE* or CFile. */
 class OutputStream {
 public:
@@ -83,6 +85,8 @@ protected:
 	int m_size;
 	char* m_buffer;
 	int m_pos;
+	File *m_file;	///< open file whose contents m_buffer points into, or NULL if m_buffer is owned
+	void releaseBuffer(void);
 public:
 	CachedFileInputStream(void);
 	~CachedFileInputStream(void);
@@ -66,6 +66,15 @@ class PolygonTrigger : public MemoryPoolObject,
 {
 	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(PolygonTrigger, "PolygonTrigger")
 
+public:
+	/// Describes how a grid cell relates to the polygon area.
+	enum CellCoverage
+	{
+		CELL_OUTSIDE,		///< No point of the cell is inside the polygon.
+		CELL_INSIDE,		///< Every point of the cell is inside the polygon.
+		CELL_BOUNDARY,	///< The polygon edge is close to the cell, so points need the exact test.
+	};
+
 protected:
 	PolygonTrigger*		m_nextPolygonTrigger;		///< linked list.
 	AsciiString				m_triggerName;		///< The name of this polygon area.
@@ -82,8 +91,12 @@ protected:
 	Bool							m_isWaterArea; ///< Used to specify water areas in the map.
 	Bool							m_isRiver;		///< Used to specify that a water area is a river.
 
+	IRegion2D		m_cellMaskRegion;	///< Inclusive range of grid cells that overlap m_bounds.
+	std::vector<UnsignedByte> m_cellMask; ///< CellCoverage of every cell in m_cellMaskRegion, row by row.
+
 	static PolygonTrigger* ThePolygonTriggerListPtr;
 	static Int s_currentID; ///< Current id for new triggers.
+	static UnsignedInt s_triggerGeneration; ///< Changes whenever a trigger shape or the trigger list changes.
 
 protected:
 	void reallocate(void);
@@ -114,7 +127,7 @@ public:
 	void setPoint(const ICoord3D &point, Int ndx);
 	void insertPoint(const ICoord3D &point, Int ndx);
 	void deletePoint(Int ndx);
-	void setTriggerName(AsciiString name) {m_triggerName = name;};
+	void setTriggerName(AsciiString name) {m_triggerName = name; ++s_triggerGeneration;};
 
 	void getCenterPoint(Coord3D* pOutCoord) const;
 	Real getRadius(void) const;
@@ -127,6 +140,12 @@ public:
 	const PolygonTrigger *getNext(void) const {return m_nextPolygonTrigger;}
 	AsciiString getTriggerName(void)  const {return m_triggerName;} ///< Gets the trigger name.
 	Bool pointInTrigger(ICoord3D &point) const;
+
+	/// Classifies every grid cell that overlaps the trigger bounds. See getCellCoverage.
+	void updateCellMask(const Coord2D &gridOrigin, Real cellSize, Int cellCountX, Int cellCountY);
+	const IRegion2D &getCellMaskRegion(void) const {return m_cellMaskRegion;}
+	CellCoverage getCellCoverage(Int cellX, Int cellY) const;
+	static UnsignedInt getTriggerGeneration(void) {return s_triggerGeneration;}
 	Bool doExportWithScripts(void) const {return m_exportWithScripts;}
 	void setDoExportWithScripts(Bool val) {m_exportWithScripts = val;}
 	Bool isWaterArea(void) const {return m_isWaterArea;}
@@ -0,0 +1,97 @@
+/*
+**	Command & Conquer Generals(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: ScriptProfiler.h /////////////////////////////////////////////////////////////////////////
+// Accumulates call counts, results and timings of scripts, conditions and actions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GameLogic/Scripts.h"
+
+// TheSuperHackers @feature The script profiler collects the cost of every script, condition type
+// and action type that the ScriptEngine evaluates. It is enabled with the -profileScripts command
+// line argument and writes a sorted text report and a CSV file into the user data folder when the
+// map is unloaded. All timings are inclusive, so a script time contains its condition and action
+// times, and a CALL_SUBROUTINE action time contains the subroutine scripts.
+class ScriptProfiler
+{
+public:
+
+	struct Sample
+	{
+		Sample() : m_calls(0), m_trueCount(0), m_ticks(0), m_maxTicks(0) {}
+
+		void add(Int64 ticks, Bool result)
+		{
+			++m_calls;
+			if (result)
+				++m_trueCount;
+			m_ticks += ticks;
+			if (ticks > m_maxTicks)
+				m_maxTicks = ticks;
+		}
+
+		UnsignedInt m_calls; ///< Number of evaluations or executions
+		UnsignedInt m_trueCount; ///< Number of evaluations that returned true
+		Int64 m_ticks; ///< Accumulated performance counter ticks
+		Int64 m_maxTicks; ///< Most expensive single call in performance counter ticks
+	};
+
+	ScriptProfiler();
+
+	void reset(); ///< Clears all collected samples.
+	Bool hasSamples() const { return m_numFrames > 0; }
+
+	static Int64 getTicks(); ///< Returns the current performance counter value.
+
+	void addFrame() { ++m_numFrames; }
+	void addScript(const Script *script, Int64 startTicks, Bool result);
+	void addCondition(Condition::ConditionType type, Int64 startTicks, Bool result);
+	void addAction(ScriptAction::ScriptActionType type, Int64 startTicks);
+
+	/// Writes the sorted text report and the CSV file. Returns false if the files could not be written.
+	Bool writeReport(const AsciiString& mapName) const;
+
+protected:
+
+	struct ScriptSample : public Sample
+	{
+		AsciiString m_name;
+	};
+
+	struct ReportRow
+	{
+		AsciiString m_name;
+		const Sample *m_sample;
+	};
+
+	typedef std::map<const Script *, ScriptSample> ScriptSampleMap;
+	typedef std::vector<ReportRow> ReportRows;
+
+	static bool isMoreExpensive(const ReportRow& a, const ReportRow& b);
+
+	Real ticksToMilliseconds(Int64 ticks) const;
+	void writeSection(FILE *txt, FILE *csv, const char *category, ReportRows& rows, Bool hasResult) const;
+
+	ScriptSampleMap m_scripts;
+	Sample m_conditions[Condition::NUM_ITEMS];
+	Sample m_actions[ScriptAction::NUM_ITEMS];
+	UnsignedInt m_numFrames;
+	Int64 m_frequency;
+};
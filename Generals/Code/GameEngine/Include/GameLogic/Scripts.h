@@ -781,11 +781,24 @@ public:
 		REL_FRIEND		= ALLIES
 	};
 
+	enum ResolvedType // What kind of handle the string of this parameter has been resolved to.
+	{
+		RESOLVED_NONE = 0,
+		RESOLVED_UNIT,						// Object *
+		RESOLVED_TEAM_PROTOTYPE,	// TeamPrototype *
+		RESOLVED_TRIGGER_AREA,		// PolygonTrigger *
+		RESOLVED_OBJECT_TYPES,		// ObjectTypes *
+		RESOLVED_WAYPOINT					// Waypoint *
+	};
+
 	Parameter(ParameterType type, int val = 0) :
 		m_initialized(false),
 		m_paramType(type),
 		m_int(val),
-		m_real(0)
+		m_real(0),
+		m_resolvedType(RESOLVED_NONE),
+		m_resolvedGeneration(0),
+		m_resolvedHandle(NULL)
 	{
 		m_coord.x=0;m_coord.y=0;m_coord.z=0;
 	}
@@ -799,11 +812,18 @@ private:
 	Coord3D				m_coord;
 	ObjectStatusMaskType m_objectStatus;
 
+	// TheSuperHackers @performance Resolve-once cache for the name in m_string. The ScriptEngine stores
+	// the handle it looked up together with the generation of the table it was found in, and only
+	// looks the name up again once that table has changed.
+	mutable ResolvedType	m_resolvedType;
+	mutable UnsignedInt		m_resolvedGeneration;
+	mutable void					*m_resolvedHandle;
+
 protected:
 	void setInt(Int i) {m_int = i;}
 	void setReal(Real r) {m_real = r;}
 	void setCoord3D(const Coord3D *pLoc);
-	void setString(AsciiString s) {m_string = s;}
+	void setString(AsciiString s) {m_string = s; m_resolvedType = RESOLVED_NONE;}
 	void setStatus( ObjectStatusMaskType objectStatus ) { m_objectStatus.set( objectStatus ); }
 
 public:
@@ -816,7 +836,22 @@ public:
 	void friend_setInt(Int i) {m_int = i;}
 	void friend_setReal(Real r) {m_real = r;}
 	void friend_setCoord3D(const Coord3D *pLoc) { setCoord3D(pLoc); }
-	void friend_setString(AsciiString s) {m_string = s;}
+	void friend_setString(AsciiString s) {m_string = s; m_resolvedType = RESOLVED_NONE;}
+
+	/// Returns true and the cached handle if the string was resolved to a handle of this type at this generation.
+	Bool getResolvedHandle(ResolvedType type, UnsignedInt generation, void **handle) const
+	{
+		if (m_resolvedType != type || m_resolvedGeneration != generation)
+			return false;
+		*handle = m_resolvedHandle;
+		return true;
+	}
+	void setResolvedHandle(ResolvedType type, UnsignedInt generation, void *handle) const
+	{
+		m_resolvedType = type;
+		m_resolvedGeneration = generation;
+		m_resolvedHandle = handle;
+	}
 
 	void qualify(const AsciiString& qualifier,const AsciiString& playerTemplateName,const AsciiString& newPlayerName);
 
@@ -29,6 +29,7 @@
 #include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
 
 #include "Common/ActionManager.h"
+#include "Common/ArchivePrefetcher.h"
 #include "Common/AudioAffect.h"
 #include "Common/BuildAssistant.h"
 #include "Common/CRCDebug.h"
@@ -53,6 +54,7 @@
 #include "Common/RandomValue.h"
 #include "Common/NameKeyGenerator.h"
 #include "Common/ModuleFactory.h"
+#include "Common/StartupProfiler.h"
 #include "Common/Debug.h"
 #include "Common/GameState.h"
 #include "Common/GameStateMap.h"
@@ -293,6 +295,12 @@ GameEngine::~GameEngine()
 
 	Drawable::killStaticImages();
 
+	delete TheStartupProfiler;
+	TheStartupProfiler = NULL;
+
+	delete TheArchivePrefetcher;
+	TheArchivePrefetcher = NULL;
+
 	_Module.Term();
 
 #ifdef PERF_TIMERS
@@ -344,6 +352,13 @@ Bool GameEngine::isGameHalted()
  */
 void GameEngine::init()
 {
+	if (TheStartupProfiler == NULL && TheGlobalData->m_startupTraceFile.isNotEmpty())
+		TheStartupProfiler = NEW StartupProfiler(TheGlobalData->m_startupTraceFile);
+	StartupProfilerScope profileInit("Startup", "GameEngine::init", TRUE);
+
+	if (TheArchivePrefetcher == NULL && TheGlobalData->m_prefetchArchiveFiles)
+		TheArchivePrefetcher = NEW ArchivePrefetcher;
+
 	try {
 		//create an INI object to use for loading stuff
 		INI ini;
@@ -401,6 +416,7 @@ void GameEngine::init()
 		CommandLine::parseCommandLineForEngineInit();
 
 		TheArchiveFileSystem->loadMods();
+		TheArchiveFileSystem->saveArchiveIndexCache();
 
 		// doesn't require resets so just create a single instance here.
 		TheGameLODManager = MSGNEW("GameEngineSubsystem") GameLODManager;
@@ -976,6 +976,16 @@ GlobalData::GlobalData()
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
 
+	m_profileScripts = FALSE;
+	m_profileScriptsFrameLimit = 0;
+
+	m_useArchiveIndexCache = FALSE;
+	m_prefetchArchiveFiles = FALSE;
+
+	m_startupTraceFile.clear();
+	m_netTelemetryFile.clear();
+	m_measureNetEncoding = FALSE;
+
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
 
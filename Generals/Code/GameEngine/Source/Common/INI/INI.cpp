@@ -34,6 +34,7 @@
 
 #include "Common/INI.h"
 #include "Common/INIException.h"
+#include "Common/INITokenIndex.h"
 
 #include "Common/DamageFX.h"
 #include "Common/file.h"
@@ -41,6 +42,7 @@
 #include "Common/GameAudio.h"
 #include "Common/Science.h"
 #include "Common/SpecialPower.h"
+#include "Common/StartupProfiler.h"
 #include "Common/ThingFactory.h"
 #include "Common/ThingTemplate.h"
 #include "Common/Upgrade.h"
@@ -185,6 +187,7 @@ INI::INI( void )
 	m_sepsQuote					= "\"\n=";				///< stop at " = EOL
 	m_blockEndToken			= "END";
 	m_endOfFile					= FALSE;
+	m_tokenCursor				= NULL;
 	m_buffer[0]					= 0;
 #ifdef DEBUG_CRASHING
 	m_curBlockStart[0]	= 0;
@@ -333,37 +336,60 @@ void INI::unPrepFile()
 	m_loadType = INI_LOAD_INVALID;
 	m_lineNum = 0;
 	m_endOfFile = FALSE;
+	m_tokenCursor = NULL;
 	s_xfer = NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Hashed lookups of the block and field parse tables, see INITokenIndex */
+//-------------------------------------------------------------------------------------------------
+typedef INITokenIndex<FieldParse> FieldParseIndex;
+typedef std::hash_map< const FieldParse*, FieldParseIndex, rts::hash<const FieldParse*>, rts::equal_to<const FieldParse*> > FieldParseIndexMap;
+
+static INITokenIndex<BlockParse> s_blockParseIndex;
+static FieldParseIndexMap s_fieldParseIndexMap;
+
+//-------------------------------------------------------------------------------------------------
+static const FieldParseIndex& getFieldParseIndex(const FieldParse* parseTable)
+{
+	FieldParseIndex& index = s_fieldParseIndexMap[parseTable];
+	if (!index.isBuilt())
+		index.build(parseTable);
+	return index;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INI::getIndexedFieldParseTables( std::vector<const FieldParse*>& tables )
+{
+	tables.clear();
+	for (FieldParseIndexMap::const_iterator it = s_fieldParseIndexMap.begin(); it != s_fieldParseIndexMap.end(); ++it)
+		tables.push_back(it->first);
+}
+
 //-------------------------------------------------------------------------------------------------
 static INIBlockParse findBlockParse(const char* token)
 {
-	for (const BlockParse* parse = theTypeTable; parse->token; ++parse)
-	{
-		if (strcmp( parse->token, token ) == 0)
-		{
-			return parse->parse;
-		}
-	}
-	return NULL;
+	if (!s_blockParseIndex.isBuilt())
+		s_blockParseIndex.build(theTypeTable);
+
+	const BlockParse* parse = s_blockParseIndex.find(token, hashINIToken(token));
+	return parse ? parse->parse : NULL;
 }
 
 //-------------------------------------------------------------------------------------------------
-static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, int& offset, const void*& userData)
+static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, UnsignedInt tokenHash, int& offset, const void*& userData)
 {
-	const FieldParse* parse = parseTable;
-	for (; parse->token; ++parse)
+	const FieldParseIndex& index = getFieldParseIndex(parseTable);
+	const FieldParse* parse = index.find(token, tokenHash);
+	if (parse)
 	{
-		if (strcmp( parse->token, token ) == 0)
-		{
-			offset = parse->offset;
-			userData = parse->userData;
-			return parse->parse;
-		}
+		offset = parse->offset;
+		userData = parse->userData;
+		return parse->parse;
 	}
 
-	if (!parse->token && parse->parse)
+	parse = index.getTerminator();
+	if (parse->parse)
 	{
 		offset = parse->offset;
 		userData = token;
@@ -380,6 +406,8 @@ static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char
 //-------------------------------------------------------------------------------------------------
 UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 {
+	StartupProfilerScope profileFile("INI", filename.str());
+
 	setFPMode(); // so we have consistent Real values for GameLogic -MDC
 
 	s_xfer = pXfer;
@@ -398,7 +426,7 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 			AsciiString currentLine = m_buffer;
 
 			// the first word is the type of data we're processing
-			const char *token = strtok( m_buffer, m_seps );
+			const char *token = tokenize( m_buffer, m_seps );
 			if( token )
 			{
 				INIBlockParse parse = findBlockParse(token);
@@ -1525,7 +1553,7 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 		readLine();
 
 		// check for end token
-		const char* field = strtok( m_buffer, INI::getSeps() );
+		const char* field = tokenize( m_buffer, INI::getSeps() );
 		if( field )
 		{
 
@@ -1536,11 +1564,12 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 			else
 			{
 				Bool found = false;
+				const UnsignedInt fieldHash = hashINIToken(field);
 				for (int ptIdx = 0; ptIdx < parseTableList.getCount(); ++ptIdx)
 				{
 					int offset = 0;
 					const void* userData = 0;
-					INIFieldParseProc parse = findFieldParse(parseTableList.getNthFieldParse(ptIdx), field, offset, userData);
+					INIFieldParseProc parse = findFieldParse(parseTableList.getNthFieldParse(ptIdx), field, fieldHash, offset, userData);
 					if (parse)
 					{
 						// parse this block and check for parse errors
@@ -1589,11 +1618,39 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 
 }
 
+//-------------------------------------------------------------------------------------------------
+char* INI::tokenize(char* str, const char* seps)
+{
+	// same semantics as strtok, but the position is kept per INI instead of per process
+	char *token = str ? str : m_tokenCursor;
+	if (token == NULL)
+		return NULL;
+
+	token += strspn(token, seps);
+	if (*token == '\0')
+	{
+		m_tokenCursor = token;
+		return NULL;
+	}
+
+	char *end = token + strcspn(token, seps);
+	if (*end == '\0')
+	{
+		m_tokenCursor = end;
+	}
+	else
+	{
+		*end = '\0';
+		m_tokenCursor = end + 1;
+	}
+	return token;
+}
+
 //-------------------------------------------------------------------------------------------------
 /*static*/ const char* INI::getNextToken(const char* seps)
 {
 	if (!seps) seps = getSeps();
-	const char *token = ::strtok(NULL, seps);
+	const char *token = tokenize(NULL, seps);
 	if (!token)
 		throw INI_INVALID_DATA;
 	return token;
@@ -1603,7 +1660,7 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 /*static*/ const char* INI::getNextTokenOrNull(const char* seps)
 {
 	if (!seps) seps = getSeps();
-	const char *token = ::strtok(NULL, seps);
+	const char *token = tokenize(NULL, seps);
 	return token;
 }
 
@@ -56,8 +56,8 @@ GameMessage::GameMessage( GameMessage::Type type )
 {
 	m_playerIndex = ThePlayerList->getLocalPlayer()->getPlayerIndex();
 	m_type = type;
-	m_argList = NULL;
-	m_argTail = NULL;
+	m_args = m_inlineArgs;
+	m_argCapacity = INLINE_ARGUMENT_COUNT;
 	m_argCount = 0;
 	m_list = 0;
 }
@@ -68,14 +68,9 @@ GameMessage::GameMessage( GameMessage::Type type )
  */
 GameMessage::~GameMessage( )
 {
-	// free all arguments
-	GameMessageArgument *arg, *nextArg;
-
-	for( arg = m_argList; arg; arg=nextArg )
-	{
-		nextArg = arg->m_next;
-		deleteInstance(arg);
-	}
+	// free the arguments that did not fit into the message
+	if (m_args != m_inlineArgs)
+		delete [] m_args;
 
 	// detach message from list
 	if (m_list)
@@ -84,16 +79,13 @@ GameMessage::~GameMessage( )
 
 /**
  * Return the given argument union.
- * @todo This should be a more list-like interface.  Very inefficient.
  */
 const GameMessageArgumentType *GameMessage::getArgument( Int argIndex ) const
 {
 	static const GameMessageArgumentType junk = { 0 };
 
-	int i=0;
-	for( GameMessageArgument *a = m_argList; a; a=a->m_next, i++ )
-		if (i == argIndex)
-			return &a->m_data;
+	if (argIndex >= 0 && argIndex < m_argCount)
+		return &m_args[argIndex].m_data;
 
 	DEBUG_CRASH(("argument not found"));
 	return &junk;
@@ -104,43 +96,37 @@ const GameMessageArgumentType *GameMessage::getArgument( Int argIndex ) const
  */
 GameMessageArgumentDataType GameMessage::getArgumentDataType( Int argIndex )
 {
-	if (argIndex >= m_argCount) {
+	if (argIndex < 0 || argIndex >= m_argCount) {
 		return ARGUMENTDATATYPE_UNKNOWN;
 	}
-	int i=0;
-	GameMessageArgument *a = m_argList;
-	for (; a && (i < argIndex); a=a->m_next, ++i );
-
-	if (a != NULL)
-	{
-		return a->m_type;
-	}
-	return ARGUMENTDATATYPE_UNKNOWN;
+	return m_args[argIndex].m_type;
 }
 
 /**
- * Allocate a new argument, add it to the argument list, and increment the total arg count
+ * Allocate a new argument at the end of the arguments, and increment the total arg count
  */
 GameMessageArgument *GameMessage::allocArg( void )
 {
-	// allocate a new argument
-	GameMessageArgument *arg = newInstance(GameMessageArgument);
-
-	// add to end of argument list
-	if (m_argTail)
-		m_argTail->m_next = arg;
-	else
+	if (m_argCount == 255)
 	{
-		m_argList = arg;
-		m_argTail = arg;
+		// the count cannot grow any further, so the argument is dropped
+		DEBUG_CRASH(("GameMessage %s has too many arguments", getCommandAsString()));
+		static GameMessageArgument junk;
+		return &junk;
 	}
 
-	arg->m_next = NULL;
-	m_argTail = arg;
-
-	m_argCount++;
+	// move the arguments to a twice as large array when they do not fit anymore
+	if (m_argCount == m_argCapacity)
+	{
+		GameMessageArgument *args = NEW GameMessageArgument[m_argCapacity * 2];
+		memcpy(args, m_args, m_argCount * sizeof(GameMessageArgument));
+		if (m_args != m_inlineArgs)
+			delete [] m_args;
+		m_args = args;
+		m_argCapacity *= 2;
+	}
 
-	return arg;
+	return &m_args[m_argCount++];
 }
 
 /**
@@ -57,6 +57,191 @@
 // GLOBALS ////////////////////////////////////////////////////////////////////
 TeamFactory *TheTeamFactory = NULL;
 
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+TeamMemberCounts::TeamMemberCounts()
+{
+	clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+UnsignedByte TeamMemberCounts::getState(const Object *obj)
+{
+	UnsignedByte state = 0;
+	if (obj->isEffectivelyDead())
+		state |= STATE_DEAD;
+	if (obj->isDestroyed())
+		state |= STATE_DESTROYED;
+	if (obj->testStatus(OBJECT_STATUS_UNDER_CONSTRUCTION))
+		state |= STATE_UNDER_CONSTRUCTION;
+	return state;
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void TeamMemberCounts::clear()
+{
+	m_templateCounts.clear();
+	m_numMembers = 0;
+	m_numDeadMembers = 0;
+	for (Int i = 0; i < KINDOF_COUNT; ++i)
+	{
+		m_kindOfCount[i] = 0;
+		m_liveKindOfCount[i] = 0;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+const TeamMemberCounts::TemplateCount *TeamMemberCounts::findTemplateCount(const ThingTemplate *tmpl) const
+{
+	for (TemplateCountVec::const_iterator it = m_templateCounts.begin(); it != m_templateCounts.end(); ++it)
+	{
+		if (it->m_template == tmpl)
+			return &(*it);
+	}
+	return NULL;
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void TeamMemberCounts::adjust(const ThingTemplate *tmpl, UnsignedByte state, Int delta)
+{
+	TemplateCountVec::iterator it = m_templateCounts.begin();
+	for (; it != m_templateCounts.end(); ++it)
+	{
+		if (it->m_template == tmpl)
+			break;
+	}
+
+	if (it == m_templateCounts.end())
+	{
+		DEBUG_ASSERTCRASH(delta > 0, ("TeamMemberCounts - removing a member of template '%s' that was never counted", tmpl->getName().str()));
+		TemplateCount entry;
+		entry.m_template = tmpl;
+		entry.m_total = 0;
+		for (Int i = 0; i < NUM_STATES; ++i)
+			entry.m_count[i] = 0;
+		m_templateCounts.push_back(entry);
+		it = m_templateCounts.end() - 1;
+	}
+
+	it->m_total += delta;
+	it->m_count[state] += delta;
+	m_numMembers += delta;
+	if (state & STATE_DEAD)
+		m_numDeadMembers += delta;
+
+	const Bool live = isLiveState(state);
+	for (Int i = 0; i < KINDOF_COUNT; ++i)
+	{
+		if (!tmpl->isKindOf((KindOfType)i))
+			continue;
+		m_kindOfCount[i] += delta;
+		if (live)
+			m_liveKindOfCount[i] += delta;
+	}
+
+	if (it->m_total == 0)
+	{
+		// keep the list short, so the queries only visit templates that are actually present
+		*it = m_templateCounts.back();
+		m_templateCounts.pop_back();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void TeamMemberCounts::changeMemberState(const ThingTemplate *tmpl, UnsignedByte oldState, UnsignedByte newState)
+{
+	if (oldState == newState)
+		return;
+	adjust(tmpl, newState, 1);
+	adjust(tmpl, oldState, -1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void TeamMemberCounts::countObjectsByThingTemplate(Int numTmplates, const ThingTemplate* const* things, Bool ignoreDead, Int *counts, Bool ignoreUnderConstruction) const
+{
+	for (TemplateCountVec::const_iterator it = m_templateCounts.begin(); it != m_templateCounts.end(); ++it)
+	{
+		for (Int i = 0; i < numTmplates; ++i)
+		{
+			if (!it->m_template->isEquivalentTo(things[i]))
+				continue;
+
+			Int count = 0;
+			for (Int state = 0; state < NUM_STATES; ++state)
+			{
+				if (ignoreDead && (state & STATE_DEAD))
+					continue;
+				if (ignoreUnderConstruction && (state & STATE_UNDER_CONSTRUCTION))
+					continue;
+				count += it->m_count[state];
+			}
+
+			counts[i] += count;
+			break;	// from 'next i', NOT 'next template'
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+Int TeamMemberCounts::countObjects(const KindOfMaskType& setMask, const KindOfMaskType& clearMask) const
+{
+	Int count = 0;
+	for (TemplateCountVec::const_iterator it = m_templateCounts.begin(); it != m_templateCounts.end(); ++it)
+	{
+		if (it->m_template->isKindOfMulti(setMask, clearMask))
+			count += it->m_total;
+	}
+	return count;
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+Bool TeamMemberCounts::hasAnyLiveObjects(const KindOfMaskType& setMask, const KindOfMaskType& clearMask) const
+{
+	for (TemplateCountVec::const_iterator it = m_templateCounts.begin(); it != m_templateCounts.end(); ++it)
+	{
+		const Int liveCount = it->m_count[0] + it->m_count[STATE_UNDER_CONSTRUCTION];
+		if (liveCount > 0 && it->m_template->isKindOfMulti(setMask, clearMask))
+			return true;
+	}
+	return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+Bool TeamMemberCounts::isEqual(const TeamMemberCounts& that) const
+{
+	if (m_numMembers != that.m_numMembers || m_numDeadMembers != that.m_numDeadMembers || m_templateCounts.size() != that.m_templateCounts.size())
+		return false;
+
+	Int i;
+	for (i = 0; i < KINDOF_COUNT; ++i)
+	{
+		if (m_kindOfCount[i] != that.m_kindOfCount[i] || m_liveKindOfCount[i] != that.m_liveKindOfCount[i])
+			return false;
+	}
+
+	for (TemplateCountVec::const_iterator it = m_templateCounts.begin(); it != m_templateCounts.end(); ++it)
+	{
+		const TemplateCount *other = that.findTemplateCount(it->m_template);
+		if (other == NULL)
+			return false;
+		for (i = 0; i < NUM_STATES; ++i)
+		{
+			if (it->m_count[i] != other->m_count[i])
+				return false;
+		}
+	}
+	return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------
 TeamRelationMap::TeamRelationMap( void )
@@ -172,6 +357,7 @@ TeamFactory::TeamFactory()
 
 	m_uniqueTeamPrototypeID = TEAM_PROTOTYPE_ID_INVALID;
 	m_uniqueTeamID = TEAM_ID_INVALID;
+	m_prototypeGeneration = 0;
 
 }
 
@@ -207,6 +393,7 @@ void TeamFactory::clear()
 		// the TeamProto will try to remove itself from the list when it goes away
 	TeamPrototypeMap tmp = m_prototypes;
 	m_prototypes.clear();
+	++m_prototypeGeneration;
 	for (TeamPrototypeMap::iterator it = tmp.begin(); it != tmp.end(); ++it)
 	{
 		deleteInstance(it->second);
@@ -258,6 +445,7 @@ void TeamFactory::addTeamPrototypeToList(TeamPrototype* team)
 	}
 
 	m_prototypes[nk] = team;
+	++m_prototypeGeneration;
 }
 
 //=============================================================================
@@ -266,7 +454,10 @@ void TeamFactory::removeTeamPrototypeFromList(TeamPrototype* team)
 	NameKeyType nk = NAMEKEY(team->getName());
 	TeamPrototypeMap::iterator it = m_prototypes.find(nk);
 	if (it != m_prototypes.end())
+	{
 		m_prototypes.erase(it);
+		++m_prototypeGeneration;
+	}
 }
 
 // ------------------------------------------------------------------------
@@ -1598,60 +1789,31 @@ Bool Team::removeOverridePlayerRelationship( Int playerIndex )
 // ------------------------------------------------------------------------
 void Team::countObjectsByThingTemplate(Int numTmplates, const ThingTemplate* const* things, Bool ignoreDead, Int *counts, Bool ignoreUnderConstruction) const
 {
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
-	{
-		const ThingTemplate *objtmpl = iter.cur()->getTemplate();
-		for (Int i = 0; i < numTmplates; ++i)
-		{
-			//Kris: Compare
-			if( !objtmpl->isEquivalentTo( things[i] ) )
-			{
-				continue;
-			}
-
-			if (ignoreDead && iter.cur()->isEffectivelyDead())
-				continue;
-
-			if( ignoreUnderConstruction && iter.cur()->getStatusBits().test( OBJECT_STATUS_UNDER_CONSTRUCTION ) )
-				continue;
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
 
-			counts[i] += 1;
-			break;	// from 'next i', NOT 'next object'
-
-		}
-	}
+	m_memberCounts.countObjectsByThingTemplate(numTmplates, things, ignoreDead, counts, ignoreUnderConstruction);
 }
 
 // ------------------------------------------------------------------------
 Int Team::countBuildings(void)
 {
-	int retVal = 0;
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance()) {
-		const ThingTemplate* objtmpl = iter.cur()->getTemplate();
-		if (!objtmpl) {
-			continue;
-		}
-		if (objtmpl->isKindOf(KINDOF_STRUCTURE)) {
-			++retVal;
-		}
-	}
-	return retVal;
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
+
+	return m_memberCounts.countObjects(KINDOF_STRUCTURE);
 }
 
 // ------------------------------------------------------------------------
 Int Team::countObjects(KindOfMaskType setMask, KindOfMaskType clearMask)
 {
-	int retVal = 0;
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance()) {
-		const ThingTemplate* objtmpl = iter.cur()->getTemplate();
-		if (!objtmpl) {
-			continue;
-		}
-		if (objtmpl->isKindOfMulti(setMask, clearMask)) {
-			++retVal;
-		}
-	}
-	return retVal;
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
+
+	return m_memberCounts.countObjects(setMask, clearMask);
 }
 
 // ------------------------------------------------------------------------
@@ -1675,66 +1837,41 @@ void Team::iterateObjects( ObjectIterateFunc func, void *userData )
 // ------------------------------------------------------------------------
 Bool Team::hasAnyBuildings() const
 {
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
-	{
-		if (iter.cur()->isEffectivelyDead())
-			continue;
-
-		if (iter.cur()->isDestroyed())
-			continue;
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
 
-		if (iter.cur()->isKindOf(KINDOF_STRUCTURE))
-			return true;
-	}
-	return false;
+	return m_memberCounts.hasAnyLiveObjects(KINDOF_STRUCTURE);
 }
 
 // ------------------------------------------------------------------------
 Bool Team::hasAnyBuildings(KindOfMaskType kindOf) const
 {
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
-	{
-		if (iter.cur()->isEffectivelyDead())
-			continue;
-
-		if (iter.cur()->isDestroyed())
-			continue;
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
 
-		kindOf.set(KINDOF_STRUCTURE);
-		if (iter.cur()->isKindOfMulti(kindOf, KINDOFMASK_NONE))
-			return true;
-	}
-	return false;
+	kindOf.set(KINDOF_STRUCTURE);
+	return m_memberCounts.hasAnyLiveObjects(kindOf, KINDOFMASK_NONE);
 }
 
 // ------------------------------------------------------------------------
 Bool Team::hasAnyUnits() const
 {
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
-	{
-		if (iter.cur()->isEffectivelyDead())
-			continue;
-
-		if (iter.cur()->isDestroyed())
-			continue;
-
-		// If it's a structure, it's not  a unit.
-		if (iter.cur()->isKindOf(KINDOF_STRUCTURE)) continue;
-
-		// If it's a projectile, it's not  a unit.
-		if (iter.cur()->isKindOf(KINDOF_PROJECTILE)) continue;
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
 
-		// If it's a mine, it's not  a unit.
-		if (iter.cur()->isKindOf(KINDOF_MINE)) continue;
-
-		return true;
-	}
-	return false;
+	// Structures, projectiles and mines are not units.
+	static const KindOfMaskType notUnitMask(KindOfMaskType::kInit, KINDOF_STRUCTURE, KINDOF_PROJECTILE, KINDOF_MINE);
+	return m_memberCounts.hasAnyLiveObjects(KINDOFMASK_NONE, notUnitMask);
 }
 
 // ------------------------------------------------------------------------
 Bool Team::isIdle() const
 {
+	// TheSuperHackers @performance Not kept as a running idle count. The AI goes idle and busy inside its
+	// state machines without telling the team, and this loop already stops at the first busy member.
 	Bool idle = true; // assume idle.
 	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
 	{
@@ -1756,33 +1893,30 @@ Bool Team::isIdle() const
 // ------------------------------------------------------------------------
 Bool Team::hasAnyObjects() const
 {
-	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
-	{
-		if (iter.cur()->isEffectivelyDead())
-			continue;
-
-		if (iter.cur()->isDestroyed())
-			continue;
-
-		if (iter.cur()->isKindOf(KINDOF_PROJECTILE)) {
-			continue; // shell & missiles don't count. jba.
-		}
+#if defined(RTS_DEBUG)
+	validateMemberCounts();
+#endif
 
-		if (iter.cur()->isKindOf(KINDOF_INERT)) {
-			// inert stuff doesn't count.  This is for radiation fields, which are living
-			// so they can be attacked by ambulances.
-			continue;
-		}
-
-		if (iter.cur()->isKindOf(KINDOF_MINE)) {
-			// Mines don't count.
-			continue;
-		}
+	// Shells & missiles don't count. jba.
+	// Inert stuff doesn't count. This is for radiation fields, which are living so they can be attacked by ambulances.
+	// Mines don't count.
+	static const KindOfMaskType notObjectMask(KindOfMaskType::kInit, KINDOF_PROJECTILE, KINDOF_INERT, KINDOF_MINE);
+	return m_memberCounts.hasAnyLiveObjects(KINDOFMASK_NONE, notObjectMask);
+}
 
-		return true;
+#if defined(RTS_DEBUG)
+// ------------------------------------------------------------------------
+void Team::validateMemberCounts() const
+{
+	TeamMemberCounts counts;
+	for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
+	{
+		counts.addMember(iter.cur()->getTemplate(), TeamMemberCounts::getState(iter.cur()));
 	}
-	return false;
+
+	DEBUG_ASSERTCRASH(counts.isEqual(m_memberCounts), ("Team '%s' member counts are out of sync with its member list", m_proto ? m_proto->getName().str() : "<none>"));
 }
+#endif
 
 // ------------------------------------------------------------------------
 /** Clears m_enteredExited, checks & clears m_created. */
@@ -1861,14 +1995,7 @@ void Team::updateState(void)
 	if (!pInfo->m_scriptOnDestroyed.isEmpty())
 	{
 		Int prevUnits = m_curUnits;
-		m_curUnits = 0;
-		for (DLINK_ITERATOR<Object> iter = iterate_TeamMemberList(); !iter.done(); iter.advance())
-		{
-			if (iter.cur()->isEffectivelyDead())
-				continue;
-
-			m_curUnits++;
-		}
+		m_curUnits = getNumLiveMembers();
 		if (m_curUnits != prevUnits && m_curUnits <= m_destroyThreshold)
 		{
 			TheScriptEngine->runScript(pInfo->m_scriptOnDestroyed, this);
@@ -1891,6 +2018,7 @@ void Team::updateState(void)
 			anyAliveInTeam = true;
 			if (!ai->isIdle()) {
 				isIdle = false;
+				break; // the outcome can no longer change
 			}
 		}
 		if (anyAliveInTeam && isIdle && m_wasIdle)
@@ -2213,6 +2341,8 @@ const Coord3D* Team::getEstimateTeamPosition(void)
 {
 	// this doesn't actually calculate the team position, but rather estimates it by
 	// returning the position of the first member of the team
+	// TheSuperHackers @info This is deliberately not a cached centroid. Scripts and AI expect a position
+	// that an actual member stands on, and a different answer would change the logic and break retail compatibility.
 	DLINK_ITERATOR<Object> iter = iterate_TeamMemberList();
 	Object *obj = iter.cur();
 	if (!obj)
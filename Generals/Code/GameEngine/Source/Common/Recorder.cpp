@@ -40,6 +40,7 @@
 
 #include "GameNetwork/LANAPICallbacks.h"
 #include "GameNetwork/GameMessageParser.h"
+#include "GameNetwork/NetEncodingStats.h"
 #include "GameNetwork/GameSpy/PeerDefs.h"
 #include "GameNetwork/networkutil.h"
 #include "GameLogic/GameLogic.h"
@@ -372,6 +373,7 @@ RecorderClass::RecorderClass()
 	m_archiveReplays = FALSE;
 	m_nextFrame = 0;
 	m_wasDesync = FALSE;
+	m_netEncodingStats = NULL;
 	init(); // just for the heck of it.
 }
 
@@ -379,6 +381,7 @@ RecorderClass::RecorderClass()
  * Destructor
  */
 RecorderClass::~RecorderClass() {
+	delete m_netEncodingStats;
 }
 
 /**
@@ -419,6 +422,9 @@ void RecorderClass::reset() {
 	}
 	m_fileName.clear();
 
+	delete m_netEncodingStats;
+	m_netEncodingStats = NULL;
+
 	init();
 }
 
@@ -476,6 +482,13 @@ void RecorderClass::stopPlayback() {
 	}
 	m_fileName.clear();
 
+	if (m_netEncodingStats != NULL)
+	{
+		m_netEncodingStats->print();
+		delete m_netEncodingStats;
+		m_netEncodingStats = NULL;
+	}
+
 	if (!m_doingAnalysis)
 	{
 		TheGameLogic->exitGame();
@@ -1304,6 +1317,10 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 		InitRandom( m_gameInfo.getSeed() );
 	}
 
+	// TheSuperHackers @feature Measure the network encoding of the game commands of this replay.
+	delete m_netEncodingStats;
+	m_netEncodingStats = TheGlobalData->m_measureNetEncoding ? NEW NetEncodingStats : NULL;
+
 	m_currentReplayFilename = filename;
 	m_playbackFrameCount = header.frameCount;
 	return TRUE;
@@ -1461,6 +1478,11 @@ void RecorderClass::appendNextCommand() {
 		}
 	}
 
+	if (m_netEncodingStats != NULL && type > GameMessage::MSG_BEGIN_NETWORK_MESSAGES && type < GameMessage::MSG_END_NETWORK_MESSAGES)
+	{
+		m_netEncodingStats->addGameMessage(msg, m_nextFrame);
+	}
+
 	if (type != GameMessage::MSG_BEGIN_NETWORK_MESSAGES && type != GameMessage::MSG_CLEAR_GAME_DATA && !m_doingAnalysis)
 	{
 		TheCommandList->appendMessage(msg);
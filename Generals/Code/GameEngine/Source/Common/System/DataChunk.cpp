@@ -31,19 +31,30 @@
 #include "stdlib.h"
 #include "Compression.h"
 #include "Common/DataChunk.h"
+#include "Common/DecompressingFile.h"
 #include "Common/file.h"
 #include "Common/FileSystem.h"
 
 // If verbose, lots of debug logging.
 #define not_VERBOSE
 
-CachedFileInputStream::CachedFileInputStream(void):m_buffer(NULL),m_size(0)
+CachedFileInputStream::CachedFileInputStream(void):m_buffer(NULL),m_size(0),m_file(NULL)
 {
 }
 
 CachedFileInputStream::~CachedFileInputStream(void)
 {
-	delete[] m_buffer;
+	releaseBuffer();
+}
+
+void CachedFileInputStream::releaseBuffer(void)
+{
+	if (m_file) {
+		m_file->close();
+		m_file=NULL;
+	} else {
+		delete[] m_buffer;
+	}
 	m_buffer=NULL;
 }
 
@@ -55,7 +66,27 @@ Bool CachedFileInputStream::open(AsciiString path)
 	if (file) {
 		m_size=file->size();
 		if (m_size) {
-			m_buffer = file->readEntireAndClose();
+			// TheSuperHackers @performance Read files that are already in memory in place, e.g. maps
+			// in a mapped BIG archive. The file stays open for as long as the data is used.
+			Int viewSize = 0;
+			const char *view = file->getView(viewSize);
+			if (view != NULL) {
+				m_buffer = const_cast<char*>(view);
+				m_size = viewSize;
+				m_file = file;
+			} else {
+				// TheSuperHackers @performance Decompress compressed files while they are read, so that the
+				// compressed data is never held in memory as a whole.
+				DecompressingFile *decompressingFile = newInstance( DecompressingFile );
+				decompressingFile->deleteOnClose();
+				if (decompressingFile->openFromFile(file)) {
+					m_size = decompressingFile->size();
+					m_buffer = decompressingFile->readEntireAndClose();
+				} else {
+					deleteInstance(decompressingFile);
+					m_buffer = file->readEntireAndClose();
+				}
+			}
 			file = NULL;
 		}
 		m_pos=0;
@@ -75,7 +106,7 @@ Bool CachedFileInputStream::open(AsciiString path)
 		if (actualLen == uncompLen)
 		{
 			//DEBUG_LOG(("Using uncompressed data"));
-			delete[] m_buffer;
+			releaseBuffer();
 			m_buffer = uncompBuffer;
 			m_size = uncompLen;
 		}
@@ -101,8 +132,7 @@ Bool CachedFileInputStream::open(AsciiString path)
 
 void CachedFileInputStream::close(void)
 {
-	delete[] m_buffer;
-	m_buffer=NULL;
+	releaseBuffer();
 
 	m_pos=0;
 	m_size=0;
@@ -2570,6 +2570,8 @@ PartitionManager::PartitionManager()
 	m_worldExtents.hi.zero();
 	m_dirtyModules = NULL;
 	m_updatedSinceLastReset = false;
+	m_triggerAreaGeneration = 0;
+	m_triggerAreaIndexValid = false;
 #ifdef FASTER_GCO
 	m_maxGcoRadius = 0;
 #endif
@@ -2618,6 +2620,8 @@ void PartitionManager::init()
 
 	DEBUG_ASSERTCRASH(m_cells == NULL, ("double init"));
 
+	m_triggerAreaIndexValid = false;
+
 	if (TheTerrainLogic)
 	{
 		TheTerrainLogic->getExtent(&m_worldExtents);
@@ -2722,6 +2726,10 @@ void PartitionManager::shutdown()
 	delete [] m_cells;
 	m_cells = NULL;
 
+	m_triggerAreaCellStart.clear();
+	m_triggerAreaCellEntries.clear();
+	m_triggerAreaIndexValid = false;
+
 	m_cellSize = m_cellSizeInv = 0.0f;
 	m_cellCountX = 0;
 	m_cellCountY = 0;
@@ -2730,6 +2738,87 @@ void PartitionManager::shutdown()
 	m_worldExtents.hi.zero();
 }
 
+//-----------------------------------------------------------------------------
+// TheSuperHackers @performance Index the trigger areas by partition cell, so that objects that move
+// only need to consider the trigger areas near them instead of testing every trigger area of the map.
+void PartitionManager::buildTriggerAreaIndex()
+{
+	m_triggerAreaCellStart.clear();
+	m_triggerAreaCellEntries.clear();
+	m_triggerAreaGeneration = PolygonTrigger::getTriggerGeneration();
+	m_triggerAreaIndexValid = true;
+
+	if (m_cells == NULL)
+		return;
+
+	Coord2D origin;
+	origin.x = m_worldExtents.lo.x;
+	origin.y = m_worldExtents.lo.y;
+
+	// First pass counts the entries of each cell, second pass fills them in trigger list order.
+	m_triggerAreaCellStart.resize(m_totalCellCount + 1, 0);
+	PolygonTrigger *pTrig;
+	for (pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext())
+	{
+		pTrig->updateCellMask(origin, m_cellSize, m_cellCountX, m_cellCountY);
+		const IRegion2D &region = pTrig->getCellMaskRegion();
+		for (Int y = region.lo.y; y <= region.hi.y; ++y)
+		{
+			for (Int x = region.lo.x; x <= region.hi.x; ++x)
+			{
+				if (pTrig->getCellCoverage(x, y) != PolygonTrigger::CELL_OUTSIDE)
+					++m_triggerAreaCellStart[y * m_cellCountX + x + 1];
+			}
+		}
+	}
+
+	Int i;
+	for (i = 0; i < m_totalCellCount; ++i)
+		m_triggerAreaCellStart[i + 1] += m_triggerAreaCellStart[i];
+
+	m_triggerAreaCellEntries.resize(m_triggerAreaCellStart[m_totalCellCount]);
+	std::vector<Int> fill(m_triggerAreaCellStart.begin(), m_triggerAreaCellStart.end() - 1);
+	for (pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext())
+	{
+		const IRegion2D &region = pTrig->getCellMaskRegion();
+		for (Int y = region.lo.y; y <= region.hi.y; ++y)
+		{
+			for (Int x = region.lo.x; x <= region.hi.x; ++x)
+			{
+				const PolygonTrigger::CellCoverage coverage = pTrig->getCellCoverage(x, y);
+				if (coverage == PolygonTrigger::CELL_OUTSIDE)
+					continue;
+				TriggerAreaCellEntry &entry = m_triggerAreaCellEntries[fill[y * m_cellCountX + x]++];
+				entry.m_trigger = pTrig;
+				entry.m_inside = (coverage == PolygonTrigger::CELL_INSIDE);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+const PartitionManager::TriggerAreaCellEntry *PartitionManager::getTriggerAreasInCell(const ICoord3D &pos, Int &count)
+{
+	count = 0;
+	if (m_cells == NULL)
+		return NULL;
+
+	if (!m_triggerAreaIndexValid || m_triggerAreaGeneration != PolygonTrigger::getTriggerGeneration())
+		buildTriggerAreaIndex();
+
+	Int cx, cy;
+	worldToCell((Real)pos.x, (Real)pos.y, &cx, &cy);
+	if (cx < 0 || cy < 0 || cx >= m_cellCountX || cy >= m_cellCountY)
+		return NULL;
+
+	const Int cellIndex = cy * m_cellCountX + cx;
+	const Int start = m_triggerAreaCellStart[cellIndex];
+	count = m_triggerAreaCellStart[cellIndex + 1] - start;
+	// Return a valid pointer even for empty cells, because NULL means the caller must test all triggers.
+	static const TriggerAreaCellEntry s_emptyEntry = { NULL, false };
+	return count > 0 ? &m_triggerAreaCellEntries[start] : &s_emptyEntry;
+}
+
 //-----------------------------------------------------------------------------
 //DECLARE_PERF_TIMER(PartitionManager_update)
 void PartitionManager::update()
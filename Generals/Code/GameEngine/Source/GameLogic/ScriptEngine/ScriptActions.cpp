@@ -353,9 +353,9 @@ void ScriptActions::doPlaySoundEffect(const AsciiString& sound)
 //-------------------------------------------------------------------------------------------------
 /** doPlaySoundEffectAt */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doPlaySoundEffectAt(const AsciiString& sound, const AsciiString& waypoint)
+void ScriptActions::doPlaySoundEffectAt(const AsciiString& sound, const Parameter *pWaypointParm)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypoint);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointParm);
 	if (!way) {
 		return;
 	}
@@ -369,9 +369,9 @@ void ScriptActions::doPlaySoundEffectAt(const AsciiString& sound, const AsciiStr
 //-------------------------------------------------------------------------------------------------
 /** doDamageTeamMembers */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doDamageTeamMembers(const AsciiString& team, Real amount)
+void ScriptActions::doDamageTeamMembers(const Parameter *pTeamParm, Real amount)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (theTeam) {
@@ -382,9 +382,9 @@ void ScriptActions::doDamageTeamMembers(const AsciiString& team, Real amount)
 //-------------------------------------------------------------------------------------------------
 /** doMoveToWaypoint */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doMoveToWaypoint(const AsciiString& team, const AsciiString& waypoint)
+void ScriptActions::doMoveToWaypoint(const Parameter *pTeamParm, const Parameter *pWaypointParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
@@ -398,7 +398,7 @@ void ScriptActions::doMoveToWaypoint(const AsciiString& team, const AsciiString&
 #else
 		theTeam->getTeamAsAIGroup(theGroup.Peek());
 #endif
-		Waypoint *way = TheTerrainLogic->getWaypointByName(waypoint);
+		Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointParm);
 		if (way) {
 			Coord3D destination = *way->getLocation();
 			//DEBUG_LOG(("Moving team to waypoint %f, %f, %f", destination.x, destination.y, destination.z));
@@ -410,12 +410,12 @@ void ScriptActions::doMoveToWaypoint(const AsciiString& team, const AsciiString&
 //-------------------------------------------------------------------------------------------------
 /** doNamedMoveToWaypoint */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedMoveToWaypoint(const AsciiString& unit, const AsciiString& waypoint)
+void ScriptActions::doNamedMoveToWaypoint(const Parameter *pUnitParm, const Parameter *pWaypointParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
-		Waypoint *way = TheTerrainLogic->getWaypointByName(waypoint);
+		Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointParm);
 		if (!way) {
 			return;
 		}
@@ -438,9 +438,9 @@ void ScriptActions::doNamedMoveToWaypoint(const AsciiString& unit, const AsciiSt
 //-------------------------------------------------------------------------------------------------
 /** doCameraFollowNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doCameraFollowNamed(const AsciiString& unit, Bool snapToUnit)
+void ScriptActions::doCameraFollowNamed(const Parameter *pUnitParm, Bool snapToUnit)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
 		TheTacticalView->setCameraLock(theObj->getID());
@@ -462,9 +462,9 @@ void ScriptActions::doStopCameraFollowUnit(void)
 //-------------------------------------------------------------------------------------------------
 /** doSetTeamState */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSetTeamState(const AsciiString& team, const AsciiString& state)
+void ScriptActions::doSetTeamState(const Parameter *pTeamParm, const AsciiString& state)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (theTeam) {
@@ -474,7 +474,7 @@ void ScriptActions::doSetTeamState(const AsciiString& team, const AsciiString& s
 
 /** doCreateReinforcements */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doCreateReinforcements(const AsciiString& team, const AsciiString& waypoint)
+void ScriptActions::doCreateReinforcements(const AsciiString& team, const Parameter *pWaypointParm)
 {
 	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototype( team );
 	Coord3D destination;
@@ -482,7 +482,7 @@ void ScriptActions::doCreateReinforcements(const AsciiString& team, const AsciiS
 
 	Bool needToMoveToDestination = false;
 	//Validate the waypoint
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypoint);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointParm);
 	if (way==NULL)
 	{
 		return;
@@ -818,12 +818,12 @@ void ScriptActions::doOversizeTheTerrain(Int amount)
 //-------------------------------------------------------------------------------------------------
 /** doSetupCamera */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSetupCamera(const AsciiString& waypoint, Real zoom, Real pitch, const AsciiString& lookAtWaypoint)
+void ScriptActions::doSetupCamera(const Parameter *pWaypointParm, Real zoom, Real pitch, const Parameter *pLookAtWaypointParm)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypoint);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointParm);
 	if (way==NULL) return;
 	Coord3D	pos = *way->getLocation();
-	Waypoint *lookat = TheTerrainLogic->getWaypointByName(lookAtWaypoint);
+	Waypoint *lookat = TheScriptEngine->getWaypointByName(pLookAtWaypointParm);
 	if (lookat==NULL) return;
 	Coord3D destination = *lookat->getLocation();
 	TheTacticalView->moveCameraTo(&pos, 0, 0, true);
@@ -914,9 +914,9 @@ void ScriptActions::doRotateCamera(Real rotations, Real sec)
 //-------------------------------------------------------------------------------------------------
 /** doRotateCameraTowardObject */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doRotateCameraTowardObject(const AsciiString& unitName, Real sec, Real holdSec)
+void ScriptActions::doRotateCameraTowardObject(const Parameter *pUnitNameParm, Real sec, Real holdSec)
 {
-	const Object *unit = TheScriptEngine->getUnitNamed(unitName);
+	const Object *unit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!unit)
 		return;
 	TheTacticalView->rotateCameraTowardObject(unit->getID(), sec*1000, holdSec*1000);
@@ -925,9 +925,9 @@ void ScriptActions::doRotateCameraTowardObject(const AsciiString& unitName, Real
 //-------------------------------------------------------------------------------------------------
 /** doRotateCameraTowardWaypoint */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doRotateCameraTowardWaypoint(const AsciiString& waypointName, Real sec)
+void ScriptActions::doRotateCameraTowardWaypoint(const Parameter *pWaypointNameParm, Real sec)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypointName);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointNameParm);
 	if (way==NULL) return;
 	TheTacticalView->rotateCameraTowardPosition(way->getLocation(), sec*1000);
 }
@@ -948,8 +948,9 @@ void ScriptActions::doMoveCameraAlongWaypointPath(const AsciiString& waypoint, R
 //-------------------------------------------------------------------------------------------------
 /** doCreateObject */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doCreateObject(const AsciiString& objectName, const AsciiString& thingName, const AsciiString& teamName, Coord3D *pos, Real angle )
+void ScriptActions::doCreateObject(const AsciiString& objectName, const AsciiString& thingName, const Parameter *pTeamNameParm, Coord3D *pos, Real angle )
 {
+	const AsciiString& teamName = pTeamNameParm->getString();
 	Object* pOldObj = NULL;
 
 	if (objectName != m_unnamedUnit) {
@@ -965,7 +966,7 @@ void ScriptActions::doCreateObject(const AsciiString& objectName, const AsciiStr
 		}
 	}
 
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (theTeam==NULL) {
@@ -1006,12 +1007,12 @@ void ScriptActions::doCreateObject(const AsciiString& objectName, const AsciiStr
 //-------------------------------------------------------------------------------------------------
 /** doAttack */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doAttack(const AsciiString& attackerName, const AsciiString& victimName)
+void ScriptActions::doAttack(const Parameter *pAttackerNameParm, const Parameter *pVictimNameParm)
 {
-	Team *attackingTeam = TheScriptEngine->getTeamNamed( attackerName );
+	Team *attackingTeam = TheScriptEngine->getTeamNamed( pAttackerNameParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
-	const Team *victimTeam = TheScriptEngine->getTeamNamed( victimName );
+	const Team *victimTeam = TheScriptEngine->getTeamNamed( pVictimNameParm );
 
 	// sanity
 	if( attackingTeam == NULL || victimTeam == NULL )
@@ -1034,12 +1035,12 @@ void ScriptActions::doAttack(const AsciiString& attackerName, const AsciiString&
 //-------------------------------------------------------------------------------------------------
 /** doNamedAttack */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedAttack(const AsciiString& attackerName, const AsciiString& victimName)
+void ScriptActions::doNamedAttack(const Parameter *pAttackerNameParm, const Parameter *pVictimNameParm)
 {
 	/// @todo Implement me (MSB)
 
-	Object *attackingObj = TheScriptEngine->getUnitNamed( attackerName );
-	Object *victimObj = TheScriptEngine->getUnitNamed( victimName );
+	Object *attackingObj = TheScriptEngine->getUnitNamed( pAttackerNameParm );
+	Object *victimObj = TheScriptEngine->getUnitNamed( pVictimNameParm );
 
 	if (!attackingObj || !victimObj) {
 		return;
@@ -1122,8 +1123,9 @@ void ScriptActions::doBuildBaseStructure(const AsciiString& buildingType, Bool f
 //-------------------------------------------------------------------------------------------------
 /** createUnitOnTeamAt */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::createUnitOnTeamAt(const AsciiString& unitName, const AsciiString& objType, const AsciiString& teamName, const AsciiString& waypoint)
+void ScriptActions::createUnitOnTeamAt(const AsciiString& unitName, const AsciiString& objType, const Parameter *pTeamNameParm, const Parameter *pWaypointParm)
 {
+	const AsciiString& teamName = pTeamNameParm->getString();
 	Object* pOldObj = TheScriptEngine->getUnitNamed(unitName);
 
 	if (pOldObj && !pOldObj->isEffectivelyDead()) {
@@ -1135,7 +1137,7 @@ void ScriptActions::createUnitOnTeamAt(const AsciiString& unitName, const AsciiS
 		return;
 	}
 
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (theTeam==NULL) {
@@ -1165,7 +1167,7 @@ void ScriptActions::createUnitOnTeamAt(const AsciiString& unitName, const AsciiS
 				}
 			}
 
-			Waypoint *way = TheTerrainLogic->getWaypointByName( waypoint );
+			Waypoint *way = TheScriptEngine->getWaypointByName( pWaypointParm );
 			if (way)
 			{
 				Coord3D destination = *way->getLocation();
@@ -1180,9 +1182,9 @@ void ScriptActions::createUnitOnTeamAt(const AsciiString& unitName, const AsciiS
 //-------------------------------------------------------------------------------------------------
 /** updateNamedAttackPrioritySet */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::updateNamedAttackPrioritySet(const AsciiString& unitName, const AsciiString& attackPrioritySet)
+void ScriptActions::updateNamedAttackPrioritySet(const Parameter *pUnitNameParm, const AsciiString& attackPrioritySet)
 {
-	Object *theSrcUnit = TheScriptEngine->getUnitNamed(unitName);
+	Object *theSrcUnit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!theSrcUnit) {
 		return;
 	}
@@ -1201,9 +1203,9 @@ void ScriptActions::updateNamedAttackPrioritySet(const AsciiString& unitName, co
 //-------------------------------------------------------------------------------------------------
 /** updateTeamAttackPrioritySet */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::updateTeamAttackPrioritySet(const AsciiString& teamName, const AsciiString& attackPrioritySet)
+void ScriptActions::updateTeamAttackPrioritySet(const Parameter *pTeamNameParm, const AsciiString& attackPrioritySet)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -1241,9 +1243,9 @@ void ScriptActions::updateBaseConstructionSpeed(const AsciiString& playerName, I
 //-------------------------------------------------------------------------------------------------
 /** updateNamedSetAttitude */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::updateNamedSetAttitude(const AsciiString& unitName, Int attitude)
+void ScriptActions::updateNamedSetAttitude(const Parameter *pUnitNameParm, Int attitude)
 {
-	Object *theSrcUnit = TheScriptEngine->getUnitNamed(unitName);
+	Object *theSrcUnit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!theSrcUnit) {
 		return;
 	}
@@ -1259,9 +1261,9 @@ void ScriptActions::updateNamedSetAttitude(const AsciiString& unitName, Int atti
 //-------------------------------------------------------------------------------------------------
 /** updateTeamSetAttitude */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::updateTeamSetAttitude(const AsciiString& teamName, Int attitude)
+void ScriptActions::updateTeamSetAttitude(const Parameter *pTeamNameParm, Int attitude)
 {
-	Team *theSrcTeam = TheScriptEngine->getTeamNamed(teamName);
+	Team *theSrcTeam = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!theSrcTeam) {
 		return;
 	}
@@ -1282,9 +1284,9 @@ void ScriptActions::updateTeamSetAttitude(const AsciiString& teamName, Int attit
 //-------------------------------------------------------------------------------------------------
 /** doNamedSetRepulsor */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedSetRepulsor(const AsciiString& unitName, Bool repulsor)
+void ScriptActions::doNamedSetRepulsor(const Parameter *pUnitNameParm, Bool repulsor)
 {
-	Object *theSrcUnit = TheScriptEngine->getUnitNamed(unitName);
+	Object *theSrcUnit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!theSrcUnit) {
 		return;
 	}
@@ -1294,9 +1296,9 @@ void ScriptActions::doNamedSetRepulsor(const AsciiString& unitName, Bool repulso
 //-------------------------------------------------------------------------------------------------
 /** doTeamSetRepulsor */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamSetRepulsor(const AsciiString& teamName, Bool repulsor)
+void ScriptActions::doTeamSetRepulsor(const Parameter *pTeamNameParm, Bool repulsor)
 {
-	Team *theSrcTeam = TheScriptEngine->getTeamNamed(teamName);
+	Team *theSrcTeam = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!theSrcTeam) {
 		return;
 	}
@@ -1319,14 +1321,14 @@ void ScriptActions::doTeamSetRepulsor(const AsciiString& teamName, Bool repulsor
 //-------------------------------------------------------------------------------------------------
 /** doNamedAttackArea */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedAttackArea(const AsciiString& unitName, const AsciiString& areaName)
+void ScriptActions::doNamedAttackArea(const Parameter *pUnitNameParm, const Parameter *pAreaNameParm)
 {
-	Object *theSrcUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theSrcUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theSrcUnit) {
 		return;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(areaName);
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pAreaNameParm);
 	if (!pTrig) {
 		return;
 	}
@@ -1345,14 +1347,14 @@ void ScriptActions::doNamedAttackArea(const AsciiString& unitName, const AsciiSt
 //-------------------------------------------------------------------------------------------------
 /** doNamedAttackTeam */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedAttackTeam(const AsciiString& unitName, const AsciiString& teamName)
+void ScriptActions::doNamedAttackTeam(const Parameter *pUnitNameParm, const Parameter *pTeamNameParm)
 {
-	Object *theSrcUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theSrcUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theSrcUnit) {
 		return;
 	}
 
-	const Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	const Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -1370,9 +1372,9 @@ void ScriptActions::doNamedAttackTeam(const AsciiString& unitName, const AsciiSt
 //-------------------------------------------------------------------------------------------------
 /** doTeamAttackArea */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamAttackArea(const AsciiString& teamName, const AsciiString& areaName)
+void ScriptActions::doTeamAttackArea(const Parameter *pTeamNameParm, const Parameter *pAreaNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (!theTeam) {
@@ -1390,7 +1392,7 @@ void ScriptActions::doTeamAttackArea(const AsciiString& teamName, const AsciiStr
 	theTeam->getTeamAsAIGroup(theGroup.Peek());
 #endif
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(areaName);
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pAreaNameParm);
 	if (!pTrig) {
 		return;
 	}
@@ -1401,16 +1403,16 @@ void ScriptActions::doTeamAttackArea(const AsciiString& teamName, const AsciiStr
 //-------------------------------------------------------------------------------------------------
 /** doTeamAttackNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamAttackNamed(const AsciiString& teamName, const AsciiString& unitName)
+void ScriptActions::doTeamAttackNamed(const Parameter *pTeamNameParm, const Parameter *pUnitNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (!theTeam) {
 		return;
 	}
 
-	Object *theVictim = TheScriptEngine->getUnitNamed( unitName );
+	Object *theVictim = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theVictim) {
 		return;
 	}
@@ -1431,9 +1433,9 @@ void ScriptActions::doTeamAttackNamed(const AsciiString& teamName, const AsciiSt
 //-------------------------------------------------------------------------------------------------
 /** doLoadAllTransports */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doLoadAllTransports(const AsciiString& teamName)
+void ScriptActions::doLoadAllTransports(const Parameter *pTeamNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if (!theTeam) {
@@ -1490,14 +1492,14 @@ void ScriptActions::doLoadAllTransports(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doNamedEnterNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedEnterNamed(const AsciiString& unitSrcName, const AsciiString& unitDestName)
+void ScriptActions::doNamedEnterNamed(const Parameter *pUnitSrcNameParm, const Parameter *pUnitDestNameParm)
 {
-	Object *theSrcUnit = TheScriptEngine->getUnitNamed( unitSrcName );
+	Object *theSrcUnit = TheScriptEngine->getUnitNamed( pUnitSrcNameParm );
 	if (!theSrcUnit) {
 		return;
 	}
 
-	Object *theTransport = TheScriptEngine->getUnitNamed( unitDestName );
+	Object *theTransport = TheScriptEngine->getUnitNamed( pUnitDestNameParm );
 	if (!theTransport) {
 		return;
 	}
@@ -1514,14 +1516,14 @@ void ScriptActions::doNamedEnterNamed(const AsciiString& unitSrcName, const Asci
 //-------------------------------------------------------------------------------------------------
 /** doTeamEnterNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamEnterNamed(const AsciiString& teamName, const AsciiString& unitDestName)
+void ScriptActions::doTeamEnterNamed(const Parameter *pTeamNameParm, const Parameter *pUnitDestNameParm)
 {
-	Team *theSrcTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theSrcTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theSrcTeam) {
 		return;
 	}
 
-	Object *theTransport = TheScriptEngine->getUnitNamed( unitDestName );
+	Object *theTransport = TheScriptEngine->getUnitNamed( pUnitDestNameParm );
 	if (!theTransport) {
 		return;
 	}
@@ -1539,9 +1541,9 @@ void ScriptActions::doTeamEnterNamed(const AsciiString& teamName, const AsciiStr
 //-------------------------------------------------------------------------------------------------
 /** doNamedExitAll */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedExitAll(const AsciiString& unitName)
+void ScriptActions::doNamedExitAll(const Parameter *pUnitNameParm)
 {
-	Object *theTransport = TheScriptEngine->getUnitNamed( unitName );
+	Object *theTransport = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theTransport) {
 		return;
 	}
@@ -1559,9 +1561,9 @@ void ScriptActions::doNamedExitAll(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamExitAll */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamExitAll(const AsciiString& teamName)
+void ScriptActions::doTeamExitAll(const Parameter *pTeamNameParm)
 {
-	Team *theTeamOfTransports = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeamOfTransports = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeamOfTransports) {
 		return;
 	}
@@ -1579,9 +1581,9 @@ void ScriptActions::doTeamExitAll(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doNamedFollowWaypoints */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFollowWaypoints(const AsciiString& unitName, const AsciiString& waypointPathLabel)
+void ScriptActions::doNamedFollowWaypoints(const Parameter *pUnitNameParm, const AsciiString& waypointPathLabel)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -1606,9 +1608,9 @@ void ScriptActions::doNamedFollowWaypoints(const AsciiString& unitName, const As
 //-------------------------------------------------------------------------------------------------
 /** doNamedFollowWaypointsExact */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFollowWaypointsExact(const AsciiString& unitName, const AsciiString& waypointPathLabel)
+void ScriptActions::doNamedFollowWaypointsExact(const Parameter *pUnitNameParm, const AsciiString& waypointPathLabel)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -1633,9 +1635,9 @@ void ScriptActions::doNamedFollowWaypointsExact(const AsciiString& unitName, con
 //-------------------------------------------------------------------------------------------------
 /** doTeamFollowSkirmishApproachPath */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamFollowSkirmishApproachPath(const AsciiString& teamName, const AsciiString& waypointPathLabel, Bool asTeam)
+void ScriptActions::doTeamFollowSkirmishApproachPath(const Parameter *pTeamNameParm, const AsciiString& waypointPathLabel, Bool asTeam)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -1700,9 +1702,9 @@ void ScriptActions::doTeamFollowSkirmishApproachPath(const AsciiString& teamName
 //-------------------------------------------------------------------------------------------------
 /** doTeamFollowSkirmishApproachPath */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamMoveToSkirmishApproachPath(const AsciiString& teamName, const AsciiString& waypointPathLabel)
+void ScriptActions::doTeamMoveToSkirmishApproachPath(const Parameter *pTeamNameParm, const AsciiString& waypointPathLabel)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -1752,9 +1754,9 @@ void ScriptActions::doTeamMoveToSkirmishApproachPath(const AsciiString& teamName
 //-------------------------------------------------------------------------------------------------
 /** doTeamFollowWaypoints */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamFollowWaypoints(const AsciiString& teamName, const AsciiString& waypointPathLabel, Bool asTeam)
+void ScriptActions::doTeamFollowWaypoints(const Parameter *pTeamNameParm, const AsciiString& waypointPathLabel, Bool asTeam)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -1803,9 +1805,9 @@ void ScriptActions::doTeamFollowWaypoints(const AsciiString& teamName, const Asc
 //-------------------------------------------------------------------------------------------------
 /** doTeamFollowWaypointsExact */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamFollowWaypointsExact(const AsciiString& teamName, const AsciiString& waypointPathLabel, Bool asTeam)
+void ScriptActions::doTeamFollowWaypointsExact(const Parameter *pTeamNameParm, const AsciiString& waypointPathLabel, Bool asTeam)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -1854,9 +1856,9 @@ void ScriptActions::doTeamFollowWaypointsExact(const AsciiString& teamName, cons
 //-------------------------------------------------------------------------------------------------
 /** doNamedGuard */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedGuard(const AsciiString& unitName)
+void ScriptActions::doNamedGuard(const Parameter *pUnitNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -1875,9 +1877,9 @@ void ScriptActions::doNamedGuard(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamGuard */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGuard(const AsciiString& teamName)
+void ScriptActions::doTeamGuard(const Parameter *pTeamNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -1898,10 +1900,10 @@ void ScriptActions::doTeamGuard(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamGuardPosition */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGuardPosition(const AsciiString& teamName, const AsciiString& waypointName)
+void ScriptActions::doTeamGuardPosition(const Parameter *pTeamNameParm, const Parameter *pWaypointNameParm)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypointName);
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointNameParm);
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam || !way) {
 		return;
 	}
@@ -1923,10 +1925,10 @@ void ScriptActions::doTeamGuardPosition(const AsciiString& teamName, const Ascii
 //-------------------------------------------------------------------------------------------------
 /** doTeamGuardObject */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGuardObject(const AsciiString& teamName, const AsciiString& unitName)
+void ScriptActions::doTeamGuardObject(const Parameter *pTeamNameParm, const Parameter *pUnitNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam || !theUnit) {
 		return;
 	}
@@ -1946,10 +1948,10 @@ void ScriptActions::doTeamGuardObject(const AsciiString& teamName, const AsciiSt
 //-------------------------------------------------------------------------------------------------
 /** doTeamGuardArea */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGuardArea(const AsciiString& teamName, const AsciiString& areaName)
+void ScriptActions::doTeamGuardArea(const Parameter *pTeamNameParm, const Parameter *pAreaNameParm)
 {
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(areaName);
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pAreaNameParm);
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam || !pTrig) {
 		return;
 	}
@@ -1969,9 +1971,9 @@ void ScriptActions::doTeamGuardArea(const AsciiString& teamName, const AsciiStri
 //-------------------------------------------------------------------------------------------------
 /** doNamedHunt */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedHunt(const AsciiString& unitName)
+void ScriptActions::doNamedHunt(const Parameter *pUnitNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -1988,9 +1990,9 @@ void ScriptActions::doNamedHunt(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamHunt */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamHunt(const AsciiString& teamName)
+void ScriptActions::doTeamHunt(const Parameter *pTeamNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -2009,9 +2011,9 @@ void ScriptActions::doTeamHunt(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamHunt */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamHuntWithCommandButton(const AsciiString& teamName, const AsciiString& ability)
+void ScriptActions::doTeamHuntWithCommandButton(const Parameter *pTeamNameParm, const AsciiString& ability)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -2243,14 +2245,14 @@ void ScriptActions::doPlayerEnableFactories(const AsciiString& playerName, const
 //-------------------------------------------------------------------------------------------------
 /** doPlayerRepairStructure */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doPlayerRepairStructure(const AsciiString& playerName, const AsciiString& structureName)
+void ScriptActions::doPlayerRepairStructure(const AsciiString& playerName, const Parameter *pStructureNameParm)
 {
 	Player* pPlayer = TheScriptEngine->getPlayerFromAsciiString(playerName);
 
 	if (!pPlayer) {
 		return;
 	}
-	Object *pStructure = TheScriptEngine->getUnitNamed(structureName);
+	Object *pStructure = TheScriptEngine->getUnitNamed(pStructureNameParm);
 
 	if (!pStructure) {
 		return;
@@ -2311,9 +2313,9 @@ void ScriptActions::doRecruitTeam(const AsciiString& teamName, Real recruitRadiu
 //-------------------------------------------------------------------------------------------------
 /** doNamedDamage */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedDamage(const AsciiString& unitName, Int damageAmt)
+void ScriptActions::doNamedDamage(const Parameter *pUnitNameParm, Int damageAmt)
 {
-	Object *pUnit = TheScriptEngine->getUnitNamed(unitName);
+	Object *pUnit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 
 	if (!pUnit) {
 		return;
@@ -2329,9 +2331,9 @@ void ScriptActions::doNamedDamage(const AsciiString& unitName, Int damageAmt)
 //-------------------------------------------------------------------------------------------------
 /** doNamedDelete */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedDelete(const AsciiString& unitName)
+void ScriptActions::doNamedDelete(const Parameter *pUnitNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -2342,9 +2344,9 @@ void ScriptActions::doNamedDelete(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamDelete */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamDelete(const AsciiString& teamName, Bool ignoreDead)
+void ScriptActions::doTeamDelete(const Parameter *pTeamNameParm, Bool ignoreDead)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2356,9 +2358,9 @@ void ScriptActions::doTeamDelete(const AsciiString& teamName, Bool ignoreDead)
 //-------------------------------------------------------------------------------------------------
 /** doTeamWander */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamWander(const AsciiString& teamName, const AsciiString& waypointPathLabel)
+void ScriptActions::doTeamWander(const Parameter *pTeamNameParm, const AsciiString& waypointPathLabel)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2385,9 +2387,10 @@ void ScriptActions::doTeamWander(const AsciiString& teamName, const AsciiString&
 //-------------------------------------------------------------------------------------------------
 /** doTeamIncreasePriority */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamIncreasePriority(const AsciiString& teamName)
+void ScriptActions::doTeamIncreasePriority(const Parameter *pTeamNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	const AsciiString& teamName = pTeamNameParm->getString();
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2407,9 +2410,10 @@ void ScriptActions::doTeamIncreasePriority(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamDecreasePriority */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamDecreasePriority(const AsciiString& teamName)
+void ScriptActions::doTeamDecreasePriority(const Parameter *pTeamNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	const AsciiString& teamName = pTeamNameParm->getString();
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2429,9 +2433,9 @@ void ScriptActions::doTeamDecreasePriority(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamWanderInPlace */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamWanderInPlace(const AsciiString& teamName)
+void ScriptActions::doTeamWanderInPlace(const Parameter *pTeamNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2453,9 +2457,9 @@ void ScriptActions::doTeamWanderInPlace(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamPanic */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamPanic(const AsciiString& teamName, const AsciiString& waypointPathLabel)
+void ScriptActions::doTeamPanic(const Parameter *pTeamNameParm, const AsciiString& waypointPathLabel)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2482,9 +2486,9 @@ void ScriptActions::doTeamPanic(const AsciiString& teamName, const AsciiString&
 //-------------------------------------------------------------------------------------------------
 /** doNamedKill */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedKill(const AsciiString& unitName)
+void ScriptActions::doNamedKill(const Parameter *pUnitNameParm)
 {
-	Object *pUnit = TheScriptEngine->getUnitNamed(unitName);
+	Object *pUnit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 
 	if (!pUnit) {
 		return;
@@ -2495,9 +2499,9 @@ void ScriptActions::doNamedKill(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamKill */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamKill(const AsciiString& teamName)
+void ScriptActions::doTeamKill(const Parameter *pTeamNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -2623,10 +2627,10 @@ void ScriptActions::doCameoFlash(const AsciiString& name, Int timeInSeconds)
 //-------------------------------------------------------------------------------------------------
 /** doNamedCustomColor */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedCustomColor(const AsciiString& unitName, Color c)
+void ScriptActions::doNamedCustomColor(const Parameter *pUnitNameParm, Color c)
 {
 	//sanity
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if ( !obj )
 	{
 		return;
@@ -2637,14 +2641,14 @@ void ScriptActions::doNamedCustomColor(const AsciiString& unitName, Color c)
 //-------------------------------------------------------------------------------------------------
 /** doNamedFlash */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFlash(const AsciiString& unitName, Int timeInSeconds, const RGBColor *color)
+void ScriptActions::doNamedFlash(const Parameter *pUnitNameParm, Int timeInSeconds, const RGBColor *color)
 {
 	/** This is called the first time this unit is told by the script to flash. timeInSeconds will tell the drawable
 	how long to flash for.  Sets drawable to start flashing but only allows drawable's update to
 	call the actual flash method */
 
 	//sanity
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if ( !obj )
 	{
 		return;
@@ -2674,9 +2678,9 @@ void ScriptActions::doNamedFlash(const AsciiString& unitName, Int timeInSeconds,
 //-------------------------------------------------------------------------------------------------
 /** doTeamFlash */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamFlash(const AsciiString& teamName, Int timeInSeconds, const RGBColor *color)
+void ScriptActions::doTeamFlash(const Parameter *pTeamNameParm, Int timeInSeconds, const RGBColor *color)
 {
-	Team *team = TheScriptEngine->getTeamNamed( teamName );
+	Team *team = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (team == NULL || !team->hasAnyObjects())
 		return;
 
@@ -2723,9 +2727,9 @@ void ScriptActions::doMoviePlayRadar(const AsciiString& movieName)
 //-------------------------------------------------------------------------------------------------
 /** doSoundPlayFromNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSoundPlayFromNamed(const AsciiString& soundName, const AsciiString& unitName)
+void ScriptActions::doSoundPlayFromNamed(const AsciiString& soundName, const Parameter *pUnitNameParm)
 {
-	Object *pUnit = TheScriptEngine->getUnitNamed(unitName);
+	Object *pUnit = TheScriptEngine->getUnitNamed(pUnitNameParm);
 
 	if (!pUnit) {
 		return;
@@ -2766,9 +2770,9 @@ void ScriptActions::doPlayerTransferAssetsToPlayer(const AsciiString& playerSrcN
 //-------------------------------------------------------------------------------------------------
 /** doNamedTransferAssetsToPlayer */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedTransferAssetsToPlayer(const AsciiString& unitName, const AsciiString& playerDstName)
+void ScriptActions::doNamedTransferAssetsToPlayer(const Parameter *pUnitNameParm, const AsciiString& playerDstName)
 {
-	Object *pObj = TheScriptEngine->getUnitNamed(unitName);
+	Object *pObj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	Player *pPlayer = TheScriptEngine->getPlayerFromAsciiString(playerDstName);
 
 	if (!pObj || !pPlayer) {
@@ -2831,10 +2835,10 @@ void ScriptActions::doRadarCreateEvent(Coord3D *pos, Int eventType)
 //-------------------------------------------------------------------------------------------------
 /** doObjectRadarCreateEvent */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doObjectRadarCreateEvent(const AsciiString& unitName, Int eventType)
+void ScriptActions::doObjectRadarCreateEvent(const Parameter *pUnitNameParm, Int eventType)
 {
 	// get the building
-	Object *theBuilding = TheScriptEngine->getUnitNamed( unitName );
+	Object *theBuilding = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theBuilding)
 		return;
 
@@ -2850,10 +2854,10 @@ void ScriptActions::doObjectRadarCreateEvent(const AsciiString& unitName, Int ev
 //-------------------------------------------------------------------------------------------------
 /** doTeamRadarCreateEvent */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamRadarCreateEvent(const AsciiString& teamName, Int eventType)
+void ScriptActions::doTeamRadarCreateEvent(const Parameter *pTeamNameParm, Int eventType)
 {
 	// get the team
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam)
 		return;
 	if (!theTeam->hasAnyUnits())
@@ -2887,9 +2891,9 @@ void ScriptActions::doRadarEnable(void)
 //-------------------------------------------------------------------------------------------------
 /** doCameraMotionBlurJump - zoom in at the current location, jump to waypoint, and zoom out.*/
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doCameraMotionBlurJump(const AsciiString& waypointName, Bool saturate)
+void ScriptActions::doCameraMotionBlurJump(const Parameter *pWaypointNameParm, Bool saturate)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypointName);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointNameParm);
 	if (!way) {
 		return;
 	}
@@ -2975,9 +2979,9 @@ static PlayerMaskType getHumanPlayerMask( void )
 //-------------------------------------------------------------------------------------------------
 /** doRevealMapAtWaypoint */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doRevealMapAtWaypoint(const AsciiString& waypointName, Real radiusToReveal, const AsciiString& playerName)
+void ScriptActions::doRevealMapAtWaypoint(const Parameter *pWaypointNameParm, Real radiusToReveal, const AsciiString& playerName)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypointName);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointNameParm);
 	if (!way) {
 		return;
 	}
@@ -3000,9 +3004,9 @@ void ScriptActions::doRevealMapAtWaypoint(const AsciiString& waypointName, Real
 //-------------------------------------------------------------------------------------------------
 /** doRevealMapAtWaypoint */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doShroudMapAtWaypoint(const AsciiString& waypointName, Real radiusToShroud, const AsciiString& playerName)
+void ScriptActions::doShroudMapAtWaypoint(const Parameter *pWaypointNameParm, Real radiusToShroud, const AsciiString& playerName)
 {
-	Waypoint *way = TheTerrainLogic->getWaypointByName(waypointName);
+	Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointNameParm);
 	if (!way) {
 		return;
 	}
@@ -3103,9 +3107,9 @@ void ScriptActions::doShroudMapEntire(const AsciiString& playerName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamAvailableForRecruitment */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamAvailableForRecruitment(const AsciiString& teamName, Bool availability)
+void ScriptActions::doTeamAvailableForRecruitment(const Parameter *pTeamNameParm, Bool availability)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(teamName);
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!theTeam) {
 		return;
 	}
@@ -3280,14 +3284,14 @@ void ScriptActions::doMusicTrackChange(const AsciiString& newTrackName, Bool fad
 //-------------------------------------------------------------------------------------------------
 /** doTeamGarrisonSpecificBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGarrisonSpecificBuilding(const AsciiString& teamName, const AsciiString& buildingName)
+void ScriptActions::doTeamGarrisonSpecificBuilding(const Parameter *pTeamNameParm, const Parameter *pBuildingNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
 
-	Object *theBuilding = TheScriptEngine->getUnitNamed(buildingName);
+	Object *theBuilding = TheScriptEngine->getUnitNamed(pBuildingNameParm);
 	if (!theBuilding) {
 		return;
 	}
@@ -3319,9 +3323,9 @@ void ScriptActions::doTeamGarrisonSpecificBuilding(const AsciiString& teamName,
 //-------------------------------------------------------------------------------------------------
 /** doExitSpecificBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doExitSpecificBuilding(const AsciiString& buildingName)
+void ScriptActions::doExitSpecificBuilding(const Parameter *pBuildingNameParm)
 {
-	Object *theBuilding = TheScriptEngine->getUnitNamed(buildingName);
+	Object *theBuilding = TheScriptEngine->getUnitNamed(pBuildingNameParm);
 	if (!theBuilding)
 	{
 		return;
@@ -3350,9 +3354,9 @@ void ScriptActions::doExitSpecificBuilding(const AsciiString& buildingName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamGarrisonNearestBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGarrisonNearestBuilding(const AsciiString& teamName)
+void ScriptActions::doTeamGarrisonNearestBuilding(const Parameter *pTeamNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -3400,9 +3404,9 @@ void ScriptActions::doTeamGarrisonNearestBuilding(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamExitAllBuildings */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamExitAllBuildings(const AsciiString& teamName)
+void ScriptActions::doTeamExitAllBuildings(const Parameter *pTeamNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (!theTeam) {
 		return;
 	}
@@ -3426,14 +3430,14 @@ void ScriptActions::doTeamExitAllBuildings(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doUnitGarrisonSpecificBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitGarrisonSpecificBuilding(const AsciiString& unitName, const AsciiString& buildingName)
+void ScriptActions::doUnitGarrisonSpecificBuilding(const Parameter *pUnitNameParm, const Parameter *pBuildingNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
 
-	Object *theBuilding = TheScriptEngine->getUnitNamed(buildingName);
+	Object *theBuilding = TheScriptEngine->getUnitNamed(pBuildingNameParm);
 	if (!theBuilding) {
 		return;
 	}
@@ -3462,9 +3466,9 @@ void ScriptActions::doUnitGarrisonSpecificBuilding(const AsciiString& unitName,
 //-------------------------------------------------------------------------------------------------
 /** doUnitGarrisonNearestBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitGarrisonNearestBuilding(const AsciiString& unitName)
+void ScriptActions::doUnitGarrisonNearestBuilding(const Parameter *pUnitNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -3503,9 +3507,9 @@ void ScriptActions::doUnitGarrisonNearestBuilding(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doNamedEnableStealth */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedEnableStealth( const AsciiString& unitName, Bool enabled )
+void ScriptActions::doNamedEnableStealth( const Parameter *pUnitNameParm, Bool enabled )
 {
-	Object *self = TheScriptEngine->getUnitNamed( unitName );
+	Object *self = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if( self )
 	{
 		self->setScriptStatus( OBJECT_STATUS_SCRIPT_UNSTEALTHED, !enabled );
@@ -3515,9 +3519,9 @@ void ScriptActions::doNamedEnableStealth( const AsciiString& unitName, Bool enab
 //-------------------------------------------------------------------------------------------------
 /** doTeamEnableStealth */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamEnableStealth( const AsciiString& teamName, Bool enabled )
+void ScriptActions::doTeamEnableStealth( const Parameter *pTeamNameParm, Bool enabled )
 {
-	Team *team = TheScriptEngine->getTeamNamed( teamName );
+	Team *team = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if( !team )
 	{
 		return;
@@ -3536,9 +3540,9 @@ void ScriptActions::doTeamEnableStealth( const AsciiString& teamName, Bool enabl
 //-------------------------------------------------------------------------------------------------
 /** doUnitExitBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitExitBuilding(const AsciiString& unitName)
+void ScriptActions::doUnitExitBuilding(const Parameter *pUnitNameParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( unitName );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theUnit) {
 		return;
 	}
@@ -3674,9 +3678,9 @@ void ScriptActions::doCameraSetAudibleDistance(Real audibleDistance)
 //-------------------------------------------------------------------------------------------------
 /** doSetStoppingDistance */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSetStoppingDistance(const AsciiString& team, Real stoppingDistance)
+void ScriptActions::doSetStoppingDistance(const Parameter *pTeamParm, Real stoppingDistance)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 
 	if (theTeam)
 	{
@@ -3700,9 +3704,9 @@ void ScriptActions::doSetStoppingDistance(const AsciiString& team, Real stopping
 //-------------------------------------------------------------------------------------------------
 /** doNamedSetHeld */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedSetHeld(const AsciiString& unit, Bool held)
+void ScriptActions::doNamedSetHeld(const Parameter *pUnitParm, Bool held)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
 		theObj->setDisabledUntil( DISABLED_HELD, held ? FOREVER : NEVER );
@@ -3712,9 +3716,9 @@ void ScriptActions::doNamedSetHeld(const AsciiString& unit, Bool held)
 //-------------------------------------------------------------------------------------------------
 /** doNamedSetStoppingDistance */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedSetStoppingDistance(const AsciiString& unit, Real stoppingDistance)
+void ScriptActions::doNamedSetStoppingDistance(const Parameter *pUnitParm, Real stoppingDistance)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
 		AIUpdateInterface *aiUpdate = theObj->getAIUpdateInterface();
@@ -3748,9 +3752,9 @@ void ScriptActions::doEnableSpecialPowerDisplay(void)
 //-------------------------------------------------------------------------------------------------
 /** doNamedHideSpecialPowerDisplay */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedHideSpecialPowerDisplay(const AsciiString& unit)
+void ScriptActions::doNamedHideSpecialPowerDisplay(const Parameter *pUnitParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
 		TheInGameUI->hideObjectSuperweaponDisplayByScript(theObj);
@@ -3760,9 +3764,9 @@ void ScriptActions::doNamedHideSpecialPowerDisplay(const AsciiString& unit)
 //-------------------------------------------------------------------------------------------------
 /** doNamedShowSpecialPowerDisplay */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedShowSpecialPowerDisplay(const AsciiString& unit)
+void ScriptActions::doNamedShowSpecialPowerDisplay(const Parameter *pUnitParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
 		TheInGameUI->showObjectSuperweaponDisplayByScript(theObj);
@@ -3787,10 +3791,10 @@ void ScriptActions::doAudioSetVolume(AudioAffect whichToAffect, Real newVolumeLe
 //-------------------------------------------------------------------------------------------------
 /** doTransferTeamToPlayer */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTransferTeamToPlayer(const AsciiString& teamName, const AsciiString& playerName)
+void ScriptActions::doTransferTeamToPlayer(const Parameter *pTeamNameParm, const AsciiString& playerName)
 {
 
-	Team *theTeam = TheScriptEngine->getTeamNamed(teamName);
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	Player* playerDest = TheScriptEngine->getPlayerFromAsciiString(playerName);
 	if (!(theTeam && playerDest)) {
 		return;
@@ -3893,9 +3897,9 @@ void ScriptActions::doEnableCountdownTimerDisplay(void)
 //-------------------------------------------------------------------------------------------------
 /** doNamedStopSpecialPowerCountdown */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedStopSpecialPowerCountdown(const AsciiString& unit, const AsciiString& specialPower, Bool stop)
+void ScriptActions::doNamedStopSpecialPowerCountdown(const Parameter *pUnitParm, const AsciiString& specialPower, Bool stop)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	const SpecialPowerTemplate *power = TheSpecialPowerStore->findSpecialPowerTemplate(specialPower);
 	if (theObj && power)
 	{
@@ -3910,9 +3914,9 @@ void ScriptActions::doNamedStopSpecialPowerCountdown(const AsciiString& unit, co
 //-------------------------------------------------------------------------------------------------
 /** doNamedSetSpecialPowerCountdown */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedSetSpecialPowerCountdown( const AsciiString& unit, const AsciiString& specialPower, Int seconds )
+void ScriptActions::doNamedSetSpecialPowerCountdown( const Parameter *pUnitParm, const AsciiString& specialPower, Int seconds )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	const SpecialPowerTemplate *power = TheSpecialPowerStore->findSpecialPowerTemplate(specialPower);
 	if (theObj && power)
 	{
@@ -3928,9 +3932,9 @@ void ScriptActions::doNamedSetSpecialPowerCountdown( const AsciiString& unit, co
 //-------------------------------------------------------------------------------------------------
 /** doNamedAddSpecialPowerCountdown */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedAddSpecialPowerCountdown( const AsciiString& unit, const AsciiString& specialPower, Int seconds )
+void ScriptActions::doNamedAddSpecialPowerCountdown( const Parameter *pUnitParm, const AsciiString& specialPower, Int seconds )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	const SpecialPowerTemplate *power = TheSpecialPowerStore->findSpecialPowerTemplate(specialPower);
 	if (theObj && power)
 	{
@@ -3946,16 +3950,16 @@ void ScriptActions::doNamedAddSpecialPowerCountdown( const AsciiString& unit, co
 //-------------------------------------------------------------------------------------------------
 /** doNamedFireSpecialPowerAtArea */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFireSpecialPowerAtWaypoint( const AsciiString& unit, const AsciiString& specialPower, const AsciiString& waypoint )
+void ScriptActions::doNamedFireSpecialPowerAtWaypoint( const Parameter *pUnitParm, const AsciiString& specialPower, const Parameter *pWaypointParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	const SpecialPowerTemplate *power = TheSpecialPowerStore->findSpecialPowerTemplate(specialPower);
 	if (theObj && power)
 	{
 		SpecialPowerModuleInterface *mod = theObj->getSpecialPowerModule(power);
 		if (mod)
 		{
-			Waypoint *way = TheTerrainLogic->getWaypointByName(waypoint);
+			Waypoint *way = TheScriptEngine->getWaypointByName(pWaypointParm);
 			if (!way) {
 				return;
 			}
@@ -4013,10 +4017,10 @@ void ScriptActions::doSkirmishFireSpecialPowerAtMostCost( const AsciiString &pla
 //-------------------------------------------------------------------------------------------------
 /** doNamedFireSpecialPowerAtNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFireSpecialPowerAtNamed( const AsciiString& unit, const AsciiString& specialPower, const AsciiString& target )
+void ScriptActions::doNamedFireSpecialPowerAtNamed( const Parameter *pUnitParm, const AsciiString& specialPower, const Parameter *pTargetParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
-	Object *theTarget = TheScriptEngine->getUnitNamed( target );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
+	Object *theTarget = TheScriptEngine->getUnitNamed( pTargetParm );
 	const SpecialPowerTemplate *power = TheSpecialPowerStore->findSpecialPowerTemplate(specialPower);
 	if (theObj && power && theTarget)
 	{
@@ -4029,9 +4033,9 @@ void ScriptActions::doNamedFireSpecialPowerAtNamed( const AsciiString& unit, con
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedUseCommandButtonAbility( const AsciiString& unit, const AsciiString& ability )
+void ScriptActions::doNamedUseCommandButtonAbility( const Parameter *pUnitParm, const AsciiString& ability )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 
 	//Sanity check
 	if( !theObj )
@@ -4062,10 +4066,10 @@ void ScriptActions::doNamedUseCommandButtonAbility( const AsciiString& unit, con
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedUseCommandButtonAbilityOnNamed( const AsciiString& unit, const AsciiString& ability, const AsciiString& target )
+void ScriptActions::doNamedUseCommandButtonAbilityOnNamed( const Parameter *pUnitParm, const AsciiString& ability, const Parameter *pTargetParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
-	Object *theTarget = TheScriptEngine->getUnitNamed( target );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
+	Object *theTarget = TheScriptEngine->getUnitNamed( pTargetParm );
 
 	//Sanity check
 	if( !theObj || !theTarget )
@@ -4096,10 +4100,10 @@ void ScriptActions::doNamedUseCommandButtonAbilityOnNamed( const AsciiString& un
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedUseCommandButtonAbilityAtWaypoint( const AsciiString& unit, const AsciiString& ability, const AsciiString& waypoint )
+void ScriptActions::doNamedUseCommandButtonAbilityAtWaypoint( const Parameter *pUnitParm, const AsciiString& ability, const Parameter *pWaypointParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
-	Waypoint *pWaypoint = TheTerrainLogic->getWaypointByName( waypoint );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
+	Waypoint *pWaypoint = TheScriptEngine->getWaypointByName( pWaypointParm );
 
 	//Sanity check
 	if( !theObj || !pWaypoint )
@@ -4130,9 +4134,9 @@ void ScriptActions::doNamedUseCommandButtonAbilityAtWaypoint( const AsciiString&
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonAbility( const AsciiString& team, const AsciiString& ability )
+void ScriptActions::doTeamUseCommandButtonAbility( const Parameter *pTeamParm, const AsciiString& ability )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if( !theTeam )
@@ -4162,9 +4166,9 @@ void ScriptActions::doTeamUseCommandButtonAbility( const AsciiString& team, cons
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonAbilityOnNamed( const AsciiString& team, const AsciiString& ability, const AsciiString& target )
+void ScriptActions::doTeamUseCommandButtonAbilityOnNamed( const Parameter *pTeamParm, const AsciiString& ability, const Parameter *pTargetParm )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if( !theTeam )
@@ -4172,7 +4176,7 @@ void ScriptActions::doTeamUseCommandButtonAbilityOnNamed( const AsciiString& tea
 		return;
 	}
 
-	Object *theObj = TheScriptEngine->getUnitNamed( target );
+	Object *theObj = TheScriptEngine->getUnitNamed( pTargetParm );
 	if( !theObj )
 	{
 		return;
@@ -4200,9 +4204,9 @@ void ScriptActions::doTeamUseCommandButtonAbilityOnNamed( const AsciiString& tea
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonAbilityAtWaypoint( const AsciiString& team, const AsciiString& ability, const AsciiString& waypoint )
+void ScriptActions::doTeamUseCommandButtonAbilityAtWaypoint( const Parameter *pTeamParm, const AsciiString& ability, const Parameter *pWaypointParm )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( team );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// triggered the condition.  jba. :)
 	if( !theTeam )
@@ -4210,7 +4214,7 @@ void ScriptActions::doTeamUseCommandButtonAbilityAtWaypoint( const AsciiString&
 		return;
 	}
 
-	Waypoint *pWaypoint = TheTerrainLogic->getWaypointByName( waypoint );
+	Waypoint *pWaypoint = TheScriptEngine->getWaypointByName( pWaypointParm );
 	if( !pWaypoint )
 	{
 		return;
@@ -4253,9 +4257,9 @@ void ScriptActions::doRadarRefresh( void )
 //-------------------------------------------------------------------------------------------------
 /** doCameraTetherNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doCameraTetherNamed(const AsciiString& unit, Bool snapToUnit, Real play)
+void ScriptActions::doCameraTetherNamed(const Parameter *pUnitParm, Bool snapToUnit, Real play)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unit );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theObj)
 	{
 		TheTacticalView->setCameraLock(theObj->getID());
@@ -4285,9 +4289,9 @@ void ScriptActions::doCameraSetDefault(Real pitch, Real angle, Real maxHeight)
 //-------------------------------------------------------------------------------------------------
 /** doNamedStop */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedStop(const AsciiString& unitName)
+void ScriptActions::doNamedStop(const Parameter *pUnitNameParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( unitName );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!theObj) {
 		return;
 	}
@@ -4303,9 +4307,10 @@ void ScriptActions::doNamedStop(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 /** doTeamStop */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamStop(const AsciiString& teamName, Bool shouldDisband)
+void ScriptActions::doTeamStop(const Parameter *pTeamNameParm, Bool shouldDisband)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(teamName);
+	const AsciiString& teamName = pTeamNameParm->getString();
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!theTeam) {
 		return;
 	}
@@ -4342,10 +4347,10 @@ void ScriptActions::doTeamStop(const AsciiString& teamName, Bool shouldDisband)
 //-------------------------------------------------------------------------------------------------
 /** doTeamSetOverrideRelationToTeam */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamSetOverrideRelationToTeam(const AsciiString& teamName, const AsciiString& otherTeam, Int relation)
+void ScriptActions::doTeamSetOverrideRelationToTeam(const Parameter *pTeamNameParm, const Parameter *pOtherTeamParm, Int relation)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
-	Team *theOtherTeam = TheScriptEngine->getTeamNamed( otherTeam );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
+	Team *theOtherTeam = TheScriptEngine->getTeamNamed( pOtherTeamParm );
 	if (theTeam && theOtherTeam) {
 		theTeam->setOverrideTeamRelationship(theOtherTeam->getID(), (Relationship)relation);
 	}
@@ -4354,10 +4359,10 @@ void ScriptActions::doTeamSetOverrideRelationToTeam(const AsciiString& teamName,
 //-------------------------------------------------------------------------------------------------
 /** doTeamRemoveOverrideRelationToTeam */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamRemoveOverrideRelationToTeam(const AsciiString& teamName, const AsciiString& otherTeam)
+void ScriptActions::doTeamRemoveOverrideRelationToTeam(const Parameter *pTeamNameParm, const Parameter *pOtherTeamParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
-	Team *theOtherTeam = TheScriptEngine->getTeamNamed( otherTeam );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
+	Team *theOtherTeam = TheScriptEngine->getTeamNamed( pOtherTeamParm );
 	if (theTeam && theOtherTeam) {
 		theTeam->removeOverrideTeamRelationship(theOtherTeam->getID());
 	}
@@ -4366,10 +4371,10 @@ void ScriptActions::doTeamRemoveOverrideRelationToTeam(const AsciiString& teamNa
 //-------------------------------------------------------------------------------------------------
 /** doPlayerSetOverrideRelationToTeam */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doPlayerSetOverrideRelationToTeam(const AsciiString& playerName, const AsciiString& otherTeam, Int relation)
+void ScriptActions::doPlayerSetOverrideRelationToTeam(const AsciiString& playerName, const Parameter *pOtherTeamParm, Int relation)
 {
 	Player *thePlayer = ThePlayerList->findPlayerWithNameKey(NAMEKEY(playerName));
-	Team *theOtherTeam = TheScriptEngine->getTeamNamed( otherTeam );
+	Team *theOtherTeam = TheScriptEngine->getTeamNamed( pOtherTeamParm );
 	if (thePlayer && theOtherTeam) {
 		thePlayer->setTeamRelationship(theOtherTeam, (Relationship)relation);
 	}
@@ -4378,10 +4383,10 @@ void ScriptActions::doPlayerSetOverrideRelationToTeam(const AsciiString& playerN
 //-------------------------------------------------------------------------------------------------
 /** doPlayerRemoveOverrideRelationToTeam */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doPlayerRemoveOverrideRelationToTeam(const AsciiString& playerName, const AsciiString& otherTeam)
+void ScriptActions::doPlayerRemoveOverrideRelationToTeam(const AsciiString& playerName, const Parameter *pOtherTeamParm)
 {
 	Player *thePlayer = ThePlayerList->findPlayerWithNameKey(NAMEKEY(playerName));
-	Team *theOtherTeam = TheScriptEngine->getTeamNamed( otherTeam );
+	Team *theOtherTeam = TheScriptEngine->getTeamNamed( pOtherTeamParm );
 	if (thePlayer && theOtherTeam) {
 		thePlayer->removeTeamRelationship(theOtherTeam);
 	}
@@ -4390,9 +4395,9 @@ void ScriptActions::doPlayerRemoveOverrideRelationToTeam(const AsciiString& play
 //-------------------------------------------------------------------------------------------------
 /** doTeamSetOverrideRelationToPlayer */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamSetOverrideRelationToPlayer(const AsciiString& teamName, const AsciiString& otherPlayer, Int relation)
+void ScriptActions::doTeamSetOverrideRelationToPlayer(const Parameter *pTeamNameParm, const AsciiString& otherPlayer, Int relation)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	Player *theOtherPlayer = ThePlayerList->findPlayerWithNameKey(NAMEKEY(otherPlayer));
 	if (theTeam && theOtherPlayer) {
 		theTeam->setOverridePlayerRelationship(theOtherPlayer->getPlayerIndex(), (Relationship)relation);
@@ -4402,9 +4407,9 @@ void ScriptActions::doTeamSetOverrideRelationToPlayer(const AsciiString& teamNam
 //-------------------------------------------------------------------------------------------------
 /** doTeamRemoveOverrideRelationToTeam */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamRemoveOverrideRelationToPlayer(const AsciiString& teamName, const AsciiString& otherPlayer)
+void ScriptActions::doTeamRemoveOverrideRelationToPlayer(const Parameter *pTeamNameParm, const AsciiString& otherPlayer)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	Player *theOtherPlayer = ThePlayerList->findPlayerWithNameKey(NAMEKEY(otherPlayer));
 	if (theTeam && theOtherPlayer) {
 		theTeam->removeOverridePlayerRelationship(theOtherPlayer->getPlayerIndex());
@@ -4414,9 +4419,9 @@ void ScriptActions::doTeamRemoveOverrideRelationToPlayer(const AsciiString& team
 //-------------------------------------------------------------------------------------------------
 /** doTeamRemoveAllOverrideRelations */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamRemoveAllOverrideRelations(const AsciiString& teamName)
+void ScriptActions::doTeamRemoveAllOverrideRelations(const Parameter *pTeamNameParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if (theTeam) {
 		// invalid ID is OK -- it removes all relationships
 		theTeam->removeOverrideTeamRelationship( NULL );
@@ -4426,9 +4431,9 @@ void ScriptActions::doTeamRemoveAllOverrideRelations(const AsciiString& teamName
 //-------------------------------------------------------------------------------------------------
 /** doUnitStartSequentialScript */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitStartSequentialScript(const AsciiString& unitName, const AsciiString& scriptName, Int loopVal)
+void ScriptActions::doUnitStartSequentialScript(const Parameter *pUnitNameParm, const AsciiString& scriptName, Int loopVal)
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -4451,9 +4456,9 @@ void ScriptActions::doUnitStartSequentialScript(const AsciiString& unitName, con
 //-------------------------------------------------------------------------------------------------
 /** doUnitStopSequentialScript */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitStopSequentialScript(const AsciiString& unitName)
+void ScriptActions::doUnitStopSequentialScript(const Parameter *pUnitNameParm)
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -4468,10 +4473,10 @@ void ScriptActions::doUnitStopSequentialScript(const AsciiString& unitName)
 		Orders unit to fire a waypoint following capable weapon to follow a waypoint and attack the
 		final waypoint position. */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFireWeaponFollowingWaypointPath( const AsciiString& unit, const AsciiString& waypointPath )
+void ScriptActions::doNamedFireWeaponFollowingWaypointPath( const Parameter *pUnitParm, const AsciiString& waypointPath )
 {
 	//Get the unit... if it fails, abort.
-	Object *theUnit = TheScriptEngine->getUnitNamed( unit );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if( !theUnit )
 	{
 		return;
@@ -4513,9 +4518,9 @@ void ScriptActions::doNamedFireWeaponFollowingWaypointPath( const AsciiString& u
 //-------------------------------------------------------------------------------------------------
 /** doTeamStartSequentialScript */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamStartSequentialScript(const AsciiString& teamName, const AsciiString& scriptName, Int loopVal)
+void ScriptActions::doTeamStartSequentialScript(const Parameter *pTeamNameParm, const AsciiString& scriptName, Int loopVal)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -4551,9 +4556,9 @@ void ScriptActions::doTeamStartSequentialScript(const AsciiString& teamName, con
 //-------------------------------------------------------------------------------------------------
 /** doTeamStopSequentialScript */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamStopSequentialScript(const AsciiString& teamName)
+void ScriptActions::doTeamStopSequentialScript(const Parameter *pTeamNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -4565,9 +4570,9 @@ void ScriptActions::doTeamStopSequentialScript(const AsciiString& teamName)
 //-------------------------------------------------------------------------------------------------
 /** doUnitGuardForFramecount */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitGuardForFramecount(const AsciiString& unitName, Int framecount)
+void ScriptActions::doUnitGuardForFramecount(const Parameter *pUnitNameParm, Int framecount)
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -4586,9 +4591,9 @@ void ScriptActions::doUnitGuardForFramecount(const AsciiString& unitName, Int fr
 //-------------------------------------------------------------------------------------------------
 /** doUnitIdleForFramecount */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitIdleForFramecount(const AsciiString& unitName, Int framecount)
+void ScriptActions::doUnitIdleForFramecount(const Parameter *pUnitNameParm, Int framecount)
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -4629,9 +4634,9 @@ void ScriptActions::doTeamGuardForFramecount(const AsciiString& teamName, Int fr
 //-------------------------------------------------------------------------------------------------
 /** doTeamIdleForFramecount */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamIdleForFramecount(const AsciiString& teamName, Int framecount)
+void ScriptActions::doTeamIdleForFramecount(const Parameter *pTeamNameParm, Int framecount)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(teamName);
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!theTeam) {
 		return;
 	}
@@ -4716,9 +4721,9 @@ void ScriptActions::doBorderSwitch(Int borderToUse)
 //-------------------------------------------------------------------------------------------------
 /** doForceObjectSelection */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doForceObjectSelection(const AsciiString& teamName, const AsciiString& objectType, Bool centerInView, const AsciiString& audioToPlay)
+void ScriptActions::doForceObjectSelection(const Parameter *pTeamNameParm, const AsciiString& objectType, Bool centerInView, const AsciiString& audioToPlay)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 
 	if (!team) {
 		return;
@@ -4767,9 +4772,9 @@ void* __cdecl killTheObject( Object *obj, void* userObj )
 //-------------------------------------------------------------------------------------------------
 /** doForceObjectSelection */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doDestroyAllContained(const AsciiString& unitName, Int damageType )
+void ScriptActions::doDestroyAllContained(const Parameter *pUnitNameParm, Int damageType )
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -4838,9 +4843,9 @@ static CaveInterface* findCave(Object* obj)
 //-------------------------------------------------------------------------------------------------
 /** doSetCaveIndex */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSetCaveIndex( const AsciiString& caveName, Int caveIndex )
+void ScriptActions::doSetCaveIndex( const Parameter *pCaveNameParm, Int caveIndex )
 {
-	Object *obj = TheScriptEngine->getUnitNamed(caveName);
+	Object *obj = TheScriptEngine->getUnitNamed(pCaveNameParm);
 	if (!obj)
 	{
 		return;
@@ -4856,9 +4861,9 @@ void ScriptActions::doSetCaveIndex( const AsciiString& caveName, Int caveIndex )
 //-------------------------------------------------------------------------------------------------
 /** doSetWarehouseValue */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSetWarehouseValue( const AsciiString& warehouseName, Int cashValue )
+void ScriptActions::doSetWarehouseValue( const Parameter *pWarehouseNameParm, Int cashValue )
 {
-	Object *obj = TheScriptEngine->getUnitNamed(warehouseName);
+	Object *obj = TheScriptEngine->getUnitNamed(pWarehouseNameParm);
 	if (!obj)
 	{
 		return;
@@ -4911,9 +4916,9 @@ void ScriptActions::doSetToppleDirection( const AsciiString& unitName, const Coo
 //-------------------------------------------------------------------------------------------------
 /** doMoveTeamTowardsNearest */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doMoveUnitTowardsNearest( const AsciiString& unitName, const AsciiString& objectType, AsciiString triggerName)
+void ScriptActions::doMoveUnitTowardsNearest( const Parameter *pUnitNameParm, const AsciiString& objectType, const Parameter *pTriggerNameParm)
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -4928,7 +4933,7 @@ void ScriptActions::doMoveUnitTowardsNearest( const AsciiString& unitName, const
 		return;
 	}
 
-	PolygonTrigger *trig = TheScriptEngine->getQualifiedTriggerAreaByName(triggerName);
+	PolygonTrigger *trig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerNameParm);
 	if (!trig) {
 		return;
 	}
@@ -4951,9 +4956,9 @@ void ScriptActions::doMoveUnitTowardsNearest( const AsciiString& unitName, const
 //-------------------------------------------------------------------------------------------------
 /** doMoveTeamTowardsNearest */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doMoveTeamTowardsNearest( const AsciiString& teamName, const AsciiString& objectType, AsciiString triggerName)
+void ScriptActions::doMoveTeamTowardsNearest( const Parameter *pTeamNameParm, const AsciiString& objectType, const Parameter *pTriggerNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -4963,7 +4968,7 @@ void ScriptActions::doMoveTeamTowardsNearest( const AsciiString& teamName, const
 		return;
 	}
 
-	PolygonTrigger *trig = TheScriptEngine->getQualifiedTriggerAreaByName(triggerName);
+	PolygonTrigger *trig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerNameParm);
 	if (!trig) {
 		return;
 	}
@@ -4998,9 +5003,10 @@ void ScriptActions::doMoveTeamTowardsNearest( const AsciiString& teamName, const
 //-------------------------------------------------------------------------------------------------
 /** doUnitReceiveUpgrade */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doUnitReceiveUpgrade( const AsciiString& unitName, const AsciiString& upgradeName )
+void ScriptActions::doUnitReceiveUpgrade( const Parameter *pUnitNameParm, const AsciiString& upgradeName )
 {
-	Object *obj = TheScriptEngine->getUnitNamed(unitName);
+	const AsciiString& unitName = pUnitNameParm->getString();
+	Object *obj = TheScriptEngine->getUnitNamed(pUnitNameParm);
 	if (!obj) {
 		return;
 	}
@@ -5018,9 +5024,9 @@ void ScriptActions::doUnitReceiveUpgrade( const AsciiString& unitName, const Asc
 //-------------------------------------------------------------------------------------------------
 /** doSkirmishAttackNearestGroupWithValue */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSkirmishAttackNearestGroupWithValue( const AsciiString& teamName, Int comparison, Int value )
+void ScriptActions::doSkirmishAttackNearestGroupWithValue( const Parameter *pTeamNameParm, Int comparison, Int value )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5051,9 +5057,9 @@ void ScriptActions::doSkirmishAttackNearestGroupWithValue( const AsciiString& te
 //-------------------------------------------------------------------------------------------------
 /** doSkirmishCommandButtonOnMostValuable */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doSkirmishCommandButtonOnMostValuable( const AsciiString& teamName, const AsciiString& ability, Real range, Bool allTeamMembers)
+void ScriptActions::doSkirmishCommandButtonOnMostValuable( const Parameter *pTeamNameParm, const AsciiString& ability, Real range, Bool allTeamMembers)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5105,9 +5111,9 @@ void ScriptActions::doSkirmishCommandButtonOnMostValuable( const AsciiString& te
 //-------------------------------------------------------------------------------------------------
 /** doTeamSpinForFramecount */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamSpinForFramecount( const AsciiString& teamName, Int waitForFrames )
+void ScriptActions::doTeamSpinForFramecount( const Parameter *pTeamNameParm, Int waitForFrames )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5118,9 +5124,9 @@ void ScriptActions::doTeamSpinForFramecount( const AsciiString& teamName, Int wa
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNamed */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNamed( const AsciiString& teamName, const AsciiString& commandAbility, const AsciiString& unitName )
+void ScriptActions::doTeamUseCommandButtonOnNamed( const Parameter *pTeamNameParm, const AsciiString& commandAbility, const Parameter *pUnitNameParm )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5148,7 +5154,7 @@ void ScriptActions::doTeamUseCommandButtonOnNamed( const AsciiString& teamName,
 		return;
 	}
 
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!obj) {
 		return;
 	}
@@ -5161,9 +5167,9 @@ void ScriptActions::doTeamUseCommandButtonOnNamed( const AsciiString& teamName,
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNearestEnemy */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNearestEnemy( const AsciiString& teamName, const AsciiString& commandAbility )
+void ScriptActions::doTeamUseCommandButtonOnNearestEnemy( const Parameter *pTeamNameParm, const AsciiString& commandAbility )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5211,9 +5217,9 @@ void ScriptActions::doTeamUseCommandButtonOnNearestEnemy( const AsciiString& tea
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNearestGarrisonedBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNearestGarrisonedBuilding( const AsciiString& teamName, const AsciiString& commandAbility )
+void ScriptActions::doTeamUseCommandButtonOnNearestGarrisonedBuilding( const Parameter *pTeamNameParm, const AsciiString& commandAbility )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5263,9 +5269,9 @@ void ScriptActions::doTeamUseCommandButtonOnNearestGarrisonedBuilding( const Asc
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNearestKindof */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNearestKindof( const AsciiString& teamName, const AsciiString& commandAbility, Int kindofBit )
+void ScriptActions::doTeamUseCommandButtonOnNearestKindof( const Parameter *pTeamNameParm, const AsciiString& commandAbility, Int kindofBit )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5314,9 +5320,9 @@ void ScriptActions::doTeamUseCommandButtonOnNearestKindof( const AsciiString& te
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNearestBuilding */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNearestBuilding( const AsciiString& teamName, const AsciiString& commandAbility )
+void ScriptActions::doTeamUseCommandButtonOnNearestBuilding( const Parameter *pTeamNameParm, const AsciiString& commandAbility )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5365,9 +5371,9 @@ void ScriptActions::doTeamUseCommandButtonOnNearestBuilding( const AsciiString&
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNearestBuildingClass */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNearestBuildingClass( const AsciiString& teamName, const AsciiString& commandAbility, Int kindofBit )
+void ScriptActions::doTeamUseCommandButtonOnNearestBuildingClass( const Parameter *pTeamNameParm, const AsciiString& commandAbility, Int kindofBit )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5417,9 +5423,9 @@ void ScriptActions::doTeamUseCommandButtonOnNearestBuildingClass( const AsciiStr
 //-------------------------------------------------------------------------------------------------
 /** doTeamUseCommandButtonOnNearestObjectType */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamUseCommandButtonOnNearestObjectType( const AsciiString& teamName, const AsciiString& commandAbility, const AsciiString& objectType )
+void ScriptActions::doTeamUseCommandButtonOnNearestObjectType( const Parameter *pTeamNameParm, const AsciiString& commandAbility, const AsciiString& objectType )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5473,9 +5479,9 @@ void ScriptActions::doTeamUseCommandButtonOnNearestObjectType( const AsciiString
 //-------------------------------------------------------------------------------------------------
 /** doTeamPartialUseCommandButton */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamPartialUseCommandButton( Real percentage, const AsciiString& teamName, const AsciiString& commandAbility )
+void ScriptActions::doTeamPartialUseCommandButton( Real percentage, const Parameter *pTeamNameParm, const AsciiString& commandAbility )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5512,9 +5518,9 @@ void ScriptActions::doTeamPartialUseCommandButton( Real percentage, const AsciiS
 //-------------------------------------------------------------------------------------------------
 /** doTeamCaptureNearestUnownedFactionUnit */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamCaptureNearestUnownedFactionUnit( const AsciiString& teamName )
+void ScriptActions::doTeamCaptureNearestUnownedFactionUnit( const Parameter *pTeamNameParm )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5545,9 +5551,9 @@ void ScriptActions::doTeamCaptureNearestUnownedFactionUnit( const AsciiString& t
 //-------------------------------------------------------------------------------------------------
 /** doCreateTeamFromCapturedUnits */
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doCreateTeamFromCapturedUnits( const AsciiString& playerName, const AsciiString& teamName )
+void ScriptActions::doCreateTeamFromCapturedUnits( const AsciiString& playerName, const Parameter *pTeamNameParm )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5631,9 +5637,9 @@ void ScriptActions::doPlayerSetScienceAvailability( const AsciiString& playerNam
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamEmoticon(const AsciiString& teamName, const AsciiString& emoticonName, Real duration)
+void ScriptActions::doTeamEmoticon(const Parameter *pTeamNameParm, const AsciiString& emoticonName, Real duration)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( teamName );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamNameParm );
 	if( !theTeam )
 	{
 		return;
@@ -5655,9 +5661,9 @@ void ScriptActions::doTeamEmoticon(const AsciiString& teamName, const AsciiStrin
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedEmoticon(const AsciiString& unitName, const AsciiString& emoticonName, Real duration)
+void ScriptActions::doNamedEmoticon(const Parameter *pUnitNameParm, const AsciiString& emoticonName, Real duration)
 {
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if( obj )
 	{
 		Drawable *draw = obj->getDrawable();
@@ -5733,12 +5739,12 @@ void ScriptActions::doOverrideHulkLifetime( Real seconds )
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFaceNamed( const AsciiString &unitName, const AsciiString &faceUnitName )
+void ScriptActions::doNamedFaceNamed( const Parameter *pUnitNameParm, const Parameter *pFaceUnitNameParm )
 {
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if( obj )
 	{
-		Object *faceObj = TheScriptEngine->getUnitNamed( faceUnitName );
+		Object *faceObj = TheScriptEngine->getUnitNamed( pFaceUnitNameParm );
 		if( faceObj )
 		{
 			AIUpdateInterface *ai = obj->getAI();
@@ -5754,12 +5760,12 @@ void ScriptActions::doNamedFaceNamed( const AsciiString &unitName, const AsciiSt
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doNamedFaceWaypoint( const AsciiString &unitName, const AsciiString &faceWaypointName )
+void ScriptActions::doNamedFaceWaypoint( const Parameter *pUnitNameParm, const Parameter *pFaceWaypointNameParm )
 {
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if( obj )
 	{
-		Waypoint *way = TheTerrainLogic->getWaypointByName( faceWaypointName );
+		Waypoint *way = TheScriptEngine->getWaypointByName( pFaceWaypointNameParm );
 		if( way )
 		{
 			AIUpdateInterface *ai = obj->getAI();
@@ -5775,12 +5781,12 @@ void ScriptActions::doNamedFaceWaypoint( const AsciiString &unitName, const Asci
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamFaceNamed( const AsciiString &teamName, const AsciiString &faceUnitName )
+void ScriptActions::doTeamFaceNamed( const Parameter *pTeamNameParm, const Parameter *pFaceUnitNameParm )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if( team )
 	{
-		Object *faceObj = TheScriptEngine->getUnitNamed( faceUnitName );
+		Object *faceObj = TheScriptEngine->getUnitNamed( pFaceUnitNameParm );
 		if( faceObj )
 		{
 			DLINK_ITERATOR<Object> iter = team->iterate_TeamMemberList();
@@ -5804,12 +5810,12 @@ void ScriptActions::doTeamFaceNamed( const AsciiString &teamName, const AsciiStr
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamFaceWaypoint( const AsciiString &teamName, const AsciiString &faceWaypointName )
+void ScriptActions::doTeamFaceWaypoint( const Parameter *pTeamNameParm, const Parameter *pFaceWaypointNameParm )
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if( team )
 	{
-		Waypoint *way = TheTerrainLogic->getWaypointByName( faceWaypointName );
+		Waypoint *way = TheScriptEngine->getWaypointByName( pFaceWaypointNameParm );
 		if( way )
 		{
 			DLINK_ITERATOR<Object> iter = team->iterate_TeamMemberList();
@@ -5833,9 +5839,9 @@ void ScriptActions::doTeamFaceWaypoint( const AsciiString &teamName, const Ascii
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doAffectObjectPanelFlagsUnit(const AsciiString& unitName, const AsciiString& flagName, Bool enable)
+void ScriptActions::doAffectObjectPanelFlagsUnit(const Parameter *pUnitNameParm, const AsciiString& flagName, Bool enable)
 {
-	Object *obj = TheScriptEngine->getUnitNamed( unitName );
+	Object *obj = TheScriptEngine->getUnitNamed( pUnitNameParm );
 	if (!obj) {
 		return;
 	}
@@ -5844,9 +5850,9 @@ void ScriptActions::doAffectObjectPanelFlagsUnit(const AsciiString& unitName, co
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doAffectObjectPanelFlagsTeam(const AsciiString& teamName, const AsciiString& flagName, Bool enable)
+void ScriptActions::doAffectObjectPanelFlagsTeam(const Parameter *pTeamNameParm, const AsciiString& flagName, Bool enable)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5871,9 +5877,9 @@ void ScriptActions::doAffectPlayerSkillset(const AsciiString& playerName, Int sk
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doGuardSupplyCenter(const AsciiString& teamName, Int supplies)
+void ScriptActions::doGuardSupplyCenter(const Parameter *pTeamNameParm, Int supplies)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -5886,9 +5892,9 @@ void ScriptActions::doGuardSupplyCenter(const AsciiString& teamName, Int supplie
 }
 
 //-------------------------------------------------------------------------------------------------
-void ScriptActions::doTeamGuardInTunnelNetwork(const AsciiString& teamName)
+void ScriptActions::doTeamGuardInTunnelNetwork(const Parameter *pTeamNameParm)
 {
-	Team *team = TheScriptEngine->getTeamNamed(teamName);
+	Team *team = TheScriptEngine->getTeamNamed(pTeamNameParm);
 	if (!team) {
 		return;
 	}
@@ -6025,42 +6031,42 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doDebugMessage(pAction->getParameter(0)->getString(), false);
 			return;
 		case ScriptAction::DAMAGE_MEMBERS_OF_TEAM:
-			doDamageTeamMembers(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal());
+			doDamageTeamMembers(pAction->getParameter(0), pAction->getParameter(1)->getReal());
 			return;
 		case ScriptAction::MOVE_TEAM_TO:
-			doMoveToWaypoint(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doMoveToWaypoint(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::MOVE_NAMED_UNIT_TO:
-			doNamedMoveToWaypoint(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doNamedMoveToWaypoint(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_SET_STATE:
-			doSetTeamState(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doSetTeamState(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::TEAM_FOLLOW_WAYPOINTS:
-			doTeamFollowWaypoints(pAction->getParameter(0)->getString(),
+			doTeamFollowWaypoints(pAction->getParameter(0),
 				pAction->getParameter(1)->getString(),
 				pAction->getParameter(2)->getInt());
 			return;
 		case ScriptAction::TEAM_FOLLOW_WAYPOINTS_EXACT:
-			doTeamFollowWaypointsExact(pAction->getParameter(0)->getString(),
+			doTeamFollowWaypointsExact(pAction->getParameter(0),
 				pAction->getParameter(1)->getString(),
 				pAction->getParameter(2)->getInt());
 			return;
 		case ScriptAction::NAMED_FOLLOW_WAYPOINTS_EXACT:
-			doNamedFollowWaypointsExact(pAction->getParameter(0)->getString(),
+			doNamedFollowWaypointsExact(pAction->getParameter(0),
 				pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::SKIRMISH_FOLLOW_APPROACH_PATH:
-			doTeamFollowSkirmishApproachPath(pAction->getParameter(0)->getString(),
+			doTeamFollowSkirmishApproachPath(pAction->getParameter(0),
 				pAction->getParameter(1)->getString(),
 				pAction->getParameter(2)->getInt());
 			return;
 		case ScriptAction::SKIRMISH_MOVE_TO_APPROACH_PATH:
-			doTeamMoveToSkirmishApproachPath(pAction->getParameter(0)->getString(),
+			doTeamMoveToSkirmishApproachPath(pAction->getParameter(0),
 				pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::CREATE_REINFORCEMENT_TEAM:
-			doCreateReinforcements(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doCreateReinforcements(pAction->getParameter(0)->getString(), pAction->getParameter(1));
 			return;
 		case ScriptAction::SKIRMISH_BUILD_BUILDING:
 			doBuildBuilding(pAction->getParameter(0)->getString());
@@ -6093,7 +6099,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doMoveCameraTo(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getReal());
 			return;
 		case ScriptAction::SETUP_CAMERA:
-			doSetupCamera(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getReal(), pAction->getParameter(3)->getString());
+			doSetupCamera(pAction->getParameter(0), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getReal(), pAction->getParameter(3));
 			return;
 		case ScriptAction::ZOOM_CAMERA:
 			doZoomCamera(pAction->getParameter(0)->getReal(), pAction->getParameter(1)->getReal());
@@ -6102,7 +6108,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doPitchCamera(pAction->getParameter(0)->getReal(), pAction->getParameter(1)->getReal());
 			return;
 		case ScriptAction::CAMERA_FOLLOW_NAMED:
-			doCameraFollowNamed(pAction->getParameter(0)->getString(), (pAction->getParameter(1) && pAction->getParameter(1)->getInt() != 0));
+			doCameraFollowNamed(pAction->getParameter(0), (pAction->getParameter(1) && pAction->getParameter(1)->getInt() != 0));
 			return;
 		case ScriptAction::CAMERA_STOP_FOLLOW:
 			doStopCameraFollowUnit();
@@ -6123,10 +6129,10 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doRotateCamera(pAction->getParameter(0)->getReal(), pAction->getParameter(1)->getReal());
 			return;
 		case ScriptAction::CAMERA_LOOK_TOWARD_OBJECT:
-			doRotateCameraTowardObject(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getReal());
+			doRotateCameraTowardObject(pAction->getParameter(0), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getReal());
 			return;
 		case ScriptAction::CAMERA_LOOK_TOWARD_WAYPOINT:
-			doRotateCameraTowardWaypoint(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal());
+			doRotateCameraTowardWaypoint(pAction->getParameter(0), pAction->getParameter(1)->getReal());
 			return;
 		case ScriptAction::RESET_CAMERA:
 			doResetCamera(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal());
@@ -6162,7 +6168,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			TheAudio->resumeAudio(AudioAffect_Sound);
 			return;
 		case ScriptAction::PLAY_SOUND_EFFECT_AT:
-			doPlaySoundEffectAt(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doPlaySoundEffectAt(pAction->getParameter(0)->getString(), pAction->getParameter(1));
 			return;
 		case ScriptAction::SET_INFANTRY_LIGHTING_OVERRIDE:
 			doSetInfantryLightingOverride(pAction->getParameter(0)->getReal());
@@ -6186,97 +6192,97 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 		{
 			Coord3D pos;
 			pAction->getParameter(2)->getCoord3D(&pos);
-			doCreateObject( m_unnamedUnit, pAction->getParameter(0)->getString(),  pAction->getParameter(1)->getString(), &pos, pAction->getParameter(3)->getReal() );
+			doCreateObject( m_unnamedUnit, pAction->getParameter(0)->getString(),  pAction->getParameter(1), &pos, pAction->getParameter(3)->getReal() );
 			return;
 		}
 
 		case ScriptAction::TEAM_ATTACK_TEAM:
-			doAttack( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
+			doAttack( pAction->getParameter(0), pAction->getParameter(1) );
 			return;
 		case ScriptAction::NAMED_ATTACK_NAMED:
-			doNamedAttack( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
+			doNamedAttack( pAction->getParameter(0), pAction->getParameter(1) );
 			return;
 		case ScriptAction::CREATE_NAMED_ON_TEAM_AT_WAYPOINT:
-			createUnitOnTeamAt( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString(), pAction->getParameter(3)->getString());
+			createUnitOnTeamAt( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2), pAction->getParameter(3));
 			return;
 		case ScriptAction::CREATE_UNNAMED_ON_TEAM_AT_WAYPOINT:
-			createUnitOnTeamAt( AsciiString::TheEmptyString, pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			createUnitOnTeamAt( AsciiString::TheEmptyString, pAction->getParameter(0)->getString(), pAction->getParameter(1), pAction->getParameter(2));
 			return;
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		case ScriptAction::NAMED_APPLY_ATTACK_PRIORITY_SET:
-			updateNamedAttackPrioritySet(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			updateNamedAttackPrioritySet(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::TEAM_APPLY_ATTACK_PRIORITY_SET:
-			updateTeamAttackPrioritySet(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			updateTeamAttackPrioritySet(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::SET_BASE_CONSTRUCTION_SPEED:
 			updateBaseConstructionSpeed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::NAMED_SET_ATTITUDE:
-			updateNamedSetAttitude(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			updateNamedSetAttitude(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::TEAM_SET_ATTITUDE:
-			updateTeamSetAttitude(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			updateTeamSetAttitude(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::NAMED_SET_REPULSOR:
-			doNamedSetRepulsor(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doNamedSetRepulsor(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::TEAM_SET_REPULSOR:
-			doTeamSetRepulsor(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doTeamSetRepulsor(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::NAMED_ATTACK_AREA:
-			doNamedAttackArea(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doNamedAttackArea(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::NAMED_ATTACK_TEAM:
-			doNamedAttackTeam(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doNamedAttackTeam(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_ATTACK_AREA:
-			doTeamAttackArea(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamAttackArea(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_ATTACK_NAMED:
-			doTeamAttackNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamAttackNamed(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_LOAD_TRANSPORTS:
-			doLoadAllTransports(pAction->getParameter(0)->getString());
+			doLoadAllTransports(pAction->getParameter(0));
 			return;
 		case ScriptAction::NAMED_ENTER_NAMED:
-			doNamedEnterNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doNamedEnterNamed(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_ENTER_NAMED:
-			doTeamEnterNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamEnterNamed(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::NAMED_EXIT_ALL:
-			doNamedExitAll(pAction->getParameter(0)->getString());
+			doNamedExitAll(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_EXIT_ALL:
-			doTeamExitAll(pAction->getParameter(0)->getString());
+			doTeamExitAll(pAction->getParameter(0));
 			return;
 		case ScriptAction::NAMED_FOLLOW_WAYPOINTS:
-			doNamedFollowWaypoints(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doNamedFollowWaypoints(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::NAMED_GUARD:
-			doNamedGuard(pAction->getParameter(0)->getString());
+			doNamedGuard(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_GUARD:
-			doTeamGuard(pAction->getParameter(0)->getString());
+			doTeamGuard(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_GUARD_POSITION:
-			doTeamGuardPosition(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamGuardPosition(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_GUARD_OBJECT:
-			doTeamGuardObject(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamGuardObject(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::TEAM_GUARD_AREA:
-			doTeamGuardArea(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamGuardArea(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::NAMED_HUNT:
-			doNamedHunt(pAction->getParameter(0)->getString());
+			doNamedHunt(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_HUNT:
-			doTeamHunt(pAction->getParameter(0)->getString());
+			doTeamHunt(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_HUNT_WITH_COMMAND_BUTTON:
-			doTeamHuntWithCommandButton(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamHuntWithCommandButton(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::PLAYER_HUNT:
 			doPlayerHunt(pAction->getParameter(0)->getString());
@@ -6300,7 +6306,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doPlayerEnableFactories(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
 			return;
 		case ScriptAction::PLAYER_REPAIR_NAMED_STRUCTURE:
-			doPlayerRepairStructure(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
+			doPlayerRepairStructure(pAction->getParameter(0)->getString(), pAction->getParameter(1) );
 			return;
 		case ScriptAction::PLAYER_ENABLE_UNIT_CONSTRUCTION:
 			doPlayerEnableUnitConstruction(pAction->getParameter(0)->getString());
@@ -6312,37 +6318,37 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doBuildTeam(pAction->getParameter(0)->getString());
 			return;
 		case ScriptAction::NAMED_DAMAGE:
-			doNamedDamage(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doNamedDamage(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::NAMED_DELETE:
-			doNamedDelete(pAction->getParameter(0)->getString());
+			doNamedDelete(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_DELETE:
-			doTeamDelete(pAction->getParameter(0)->getString(), FALSE);
+			doTeamDelete(pAction->getParameter(0), FALSE);
 			return;
 		case ScriptAction::TEAM_DELETE_LIVING:
-			doTeamDelete(pAction->getParameter(0)->getString(), TRUE);
+			doTeamDelete(pAction->getParameter(0), TRUE);
 			return;
 		case ScriptAction::TEAM_WANDER:
-			doTeamWander(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamWander(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::TEAM_WANDER_IN_PLACE:
-			doTeamWanderInPlace(pAction->getParameter(0)->getString());
+			doTeamWanderInPlace(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_INCREASE_PRIORITY:
-			doTeamIncreasePriority(pAction->getParameter(0)->getString());
+			doTeamIncreasePriority(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_DECREASE_PRIORITY:
-			doTeamDecreasePriority(pAction->getParameter(0)->getString());
+			doTeamDecreasePriority(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_PANIC:
-			doTeamPanic(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamPanic(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::NAMED_KILL:
-			doNamedKill(pAction->getParameter(0)->getString());
+			doNamedKill(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_KILL:
-			doTeamKill(pAction->getParameter(0)->getString());
+			doTeamKill(pAction->getParameter(0));
 			return;
 		case ScriptAction::PLAYER_KILL:
 			doPlayerKill(pAction->getParameter(0)->getString());
@@ -6372,28 +6378,28 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doCameoFlash(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::NAMED_FLASH:
-			doNamedFlash(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt(), NULL);
+			doNamedFlash(pAction->getParameter(0), pAction->getParameter(1)->getInt(), NULL);
 			return;
 		case ScriptAction::TEAM_FLASH:
-			doTeamFlash(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt(), NULL);
+			doTeamFlash(pAction->getParameter(0), pAction->getParameter(1)->getInt(), NULL);
 			return;
 		case ScriptAction::NAMED_FLASH_WHITE:
 			{
 				RGBColor c;
 				c.red = c.green = c.blue = 1.0f;
-				doNamedFlash(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt(), &c);
+				doNamedFlash(pAction->getParameter(0), pAction->getParameter(1)->getInt(), &c);
 			}
 			return;
 		case ScriptAction::NAMED_CUSTOM_COLOR:
 			{
-				doNamedCustomColor(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+				doNamedCustomColor(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			}
 			return;
 		case ScriptAction::TEAM_FLASH_WHITE:
 			{
 				RGBColor c;
 				c.red = c.green = c.blue = 1.0f;
-				doTeamFlash(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt(), &c);
+				doTeamFlash(pAction->getParameter(0), pAction->getParameter(1)->getInt(), &c);
 			}
 			return;
 		case ScriptAction::MOVIE_PLAY_FULLSCREEN:
@@ -6403,7 +6409,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doMoviePlayRadar(pAction->getParameter(0)->getString());
 			return;
 		case ScriptAction::SOUND_PLAY_NAMED:
-			doSoundPlayFromNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doSoundPlayFromNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1));
 			return;
 		case ScriptAction::SPEECH_PLAY:
 			doSpeechPlay(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
@@ -6412,7 +6418,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doPlayerTransferAssetsToPlayer(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::NAMED_TRANSFER_OWNERSHIP_PLAYER:
-			doNamedTransferAssetsToPlayer(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doNamedTransferAssetsToPlayer(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::PLAYER_EXCLUDE_FROM_SCORE_SCREEN:
 			excludePlayerFromScoreScreen(pAction->getParameter(0)->getString());
@@ -6434,10 +6440,10 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 		}
 		case ScriptAction::OBJECT_CREATE_RADAR_EVENT:
-			doObjectRadarCreateEvent(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doObjectRadarCreateEvent(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::TEAM_CREATE_RADAR_EVENT:
-			doTeamRadarCreateEvent(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doTeamRadarCreateEvent(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::RADAR_DISABLE:
 			doRadarDisable();
@@ -6446,16 +6452,16 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doRadarEnable();
 			return;
 		case ScriptAction::NAMED_SET_STEALTH_ENABLED:
-			doNamedEnableStealth(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doNamedEnableStealth(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::TEAM_SET_STEALTH_ENABLED:
-			doTeamEnableStealth(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doTeamEnableStealth(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::MAP_REVEAL_AT_WAYPOINT:
-			doRevealMapAtWaypoint(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getString());
+			doRevealMapAtWaypoint(pAction->getParameter(0), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getString());
 			return;
 		case ScriptAction::MAP_SHROUD_AT_WAYPOINT:
-			doShroudMapAtWaypoint(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getString());
+			doShroudMapAtWaypoint(pAction->getParameter(0), pAction->getParameter(1)->getReal(), pAction->getParameter(2)->getString());
 			return;
 		case ScriptAction::MAP_REVEAL_ALL:
 			doRevealMapEntire(pAction->getParameter(0)->getString());
@@ -6470,7 +6476,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doShroudMapEntire(pAction->getParameter(0)->getString());
 			return;
 		case ScriptAction::TEAM_AVAILABLE_FOR_RECRUITMENT:
-			doTeamAvailableForRecruitment(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doTeamAvailableForRecruitment(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::TEAM_COLLECT_NEARBY_FOR_TEAM:
 			doCollectNearbyForTeam(pAction->getParameter(0)->getString());
@@ -6506,25 +6512,25 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doMusicTrackChange(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt(), pAction->getParameter(2)->getInt());
 			return;
 		case ScriptAction::TEAM_GARRISON_SPECIFIC_BUILDING:
-			doTeamGarrisonSpecificBuilding(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamGarrisonSpecificBuilding(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::EXIT_SPECIFIC_BUILDING:
-			doExitSpecificBuilding(pAction->getParameter(0)->getString());
+			doExitSpecificBuilding(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_GARRISON_NEAREST_BUILDING:
-			doTeamGarrisonNearestBuilding(pAction->getParameter(0)->getString());
+			doTeamGarrisonNearestBuilding(pAction->getParameter(0));
 			return;
 		case ScriptAction::TEAM_EXIT_ALL_BUILDINGS:
-			doTeamExitAllBuildings(pAction->getParameter(0)->getString());
+			doTeamExitAllBuildings(pAction->getParameter(0));
 			return;
 		case ScriptAction::NAMED_GARRISON_SPECIFIC_BUILDING:
-			doUnitGarrisonSpecificBuilding(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doUnitGarrisonSpecificBuilding(pAction->getParameter(0), pAction->getParameter(1));
 			return;
 		case ScriptAction::NAMED_GARRISON_NEAREST_BUILDING:
-			doUnitGarrisonNearestBuilding(pAction->getParameter(0)->getString());
+			doUnitGarrisonNearestBuilding(pAction->getParameter(0));
 			return;
 		case ScriptAction::NAMED_EXIT_BUILDING:
-			doUnitExitBuilding(pAction->getParameter(0)->getString());
+			doUnitExitBuilding(pAction->getParameter(0));
 			return;
 		case ScriptAction::PLAYER_GARRISON_ALL_BUILDINGS:
 			doPlayerGarrisonAllBuildings(pAction->getParameter(0)->getString());
@@ -6554,7 +6560,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doCameraMotionBlur(pAction->getParameter(0)->getInt(), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::CAMERA_MOTION_BLUR_JUMP:
-			doCameraMotionBlurJump(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doCameraMotionBlurJump(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 		case ScriptAction::CAMERA_MOTION_BLUR_FOLLOW:
 			TheTacticalView->setViewFilterMode((FilterModes)(FM_VIEW_MB_PAN_ALPHA+pAction->getParameter(0)->getInt()));
@@ -6577,7 +6583,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doCameraSetAudibleDistance(pAction->getParameter(0)->getReal());
 			return;
 		case ScriptAction::SET_STOPPING_DISTANCE:
-			doSetStoppingDistance(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal());
+			doSetStoppingDistance(pAction->getParameter(0), pAction->getParameter(1)->getReal());
 			return;
 		case ScriptAction::SET_FPS_LIMIT:
 			if (!pAction->getParameter(0)->getInt())
@@ -6601,19 +6607,19 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::NAMED_HIDE_SPECIAL_POWER_DISPLAY:
-			doNamedHideSpecialPowerDisplay(pAction->getParameter(0)->getString());
+			doNamedHideSpecialPowerDisplay(pAction->getParameter(0));
 			return;
 
 		case ScriptAction::NAMED_SHOW_SPECIAL_POWER_DISPLAY:
-			doNamedShowSpecialPowerDisplay(pAction->getParameter(0)->getString());
+			doNamedShowSpecialPowerDisplay(pAction->getParameter(0));
 			return;
 
 		case ScriptAction::NAMED_SET_STOPPING_DISTANCE:
-			doNamedSetStoppingDistance(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getReal());
+			doNamedSetStoppingDistance(pAction->getParameter(0), pAction->getParameter(1)->getReal());
 			return;
 
 		case ScriptAction::NAMED_SET_HELD:
-			doNamedSetHeld(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doNamedSetHeld(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::MUSIC_SET_VOLUME:
@@ -6629,7 +6635,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::TEAM_TRANSFER_TO_PLAYER:
-			doTransferTeamToPlayer(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTransferTeamToPlayer(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::PLAYER_SET_MONEY:
 			doSetMoney(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
@@ -6663,23 +6669,23 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::NAMED_STOP_SPECIAL_POWER_COUNTDOWN:
-			doNamedStopSpecialPowerCountdown(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), TRUE);
+			doNamedStopSpecialPowerCountdown(pAction->getParameter(0), pAction->getParameter(1)->getString(), TRUE);
 			return;
 
 		case ScriptAction::NAMED_START_SPECIAL_POWER_COUNTDOWN:
-			doNamedStopSpecialPowerCountdown(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), FALSE);
+			doNamedStopSpecialPowerCountdown(pAction->getParameter(0), pAction->getParameter(1)->getString(), FALSE);
 			return;
 
 		case ScriptAction::NAMED_SET_SPECIAL_POWER_COUNTDOWN:
-			doNamedSetSpecialPowerCountdown(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
+			doNamedSetSpecialPowerCountdown(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
 			return;
 
 		case ScriptAction::NAMED_ADD_SPECIAL_POWER_COUNTDOWN:
-			doNamedAddSpecialPowerCountdown(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
+			doNamedAddSpecialPowerCountdown(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
 			return;
 
 		case ScriptAction::NAMED_FIRE_SPECIAL_POWER_AT_WAYPOINT:
-			doNamedFireSpecialPowerAtWaypoint(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doNamedFireSpecialPowerAtWaypoint(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2));
 			return;
 
 		case ScriptAction::SKIRMISH_FIRE_SPECIAL_POWER_AT_MOST_COST:
@@ -6687,7 +6693,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::NAMED_FIRE_SPECIAL_POWER_AT_NAMED:
-			doNamedFireSpecialPowerAtNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doNamedFireSpecialPowerAtNamed(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2));
 			return;
 
 		case ScriptAction::REFRESH_RADAR:
@@ -6695,19 +6701,19 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::NAMED_STOP:
-			doNamedStop(pAction->getParameter(0)->getString());
+			doNamedStop(pAction->getParameter(0));
 			return;
 
 		case ScriptAction::TEAM_STOP:
-			doTeamStop(pAction->getParameter(0)->getString(), FALSE);
+			doTeamStop(pAction->getParameter(0), FALSE);
 			return;
 
 		case ScriptAction::TEAM_STOP_AND_DISBAND:
-			doTeamStop(pAction->getParameter(0)->getString(), TRUE);
+			doTeamStop(pAction->getParameter(0), TRUE);
 			return;
 
 		case ScriptAction::CAMERA_TETHER_NAMED:
-			doCameraTetherNamed(pAction->getParameter(0)->getString(), (Bool)(pAction->getParameter(1)->getInt()), pAction->getParameter(2)->getReal());
+			doCameraTetherNamed(pAction->getParameter(0), (Bool)(pAction->getParameter(1)->getInt()), pAction->getParameter(2)->getReal());
 			return;
 
 		case ScriptAction::CAMERA_STOP_TETHER_NAMED:
@@ -6719,108 +6725,108 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::TEAM_SET_OVERRIDE_RELATION_TO_TEAM:
-			doTeamSetOverrideRelationToTeam(pAction->getParameter(0)->getString(),		// first team
-									pAction->getParameter(1)->getString(),		// second team
+			doTeamSetOverrideRelationToTeam(pAction->getParameter(0),		// first team
+									pAction->getParameter(1),		// second team
 									pAction->getParameter(2)->getInt());				// relation (ENEMIES, etc)
 			return;
 
 		case ScriptAction::TEAM_REMOVE_OVERRIDE_RELATION_TO_TEAM:
-			doTeamRemoveOverrideRelationToTeam(pAction->getParameter(0)->getString(),		// first team
-									pAction->getParameter(1)->getString());		// second team
+			doTeamRemoveOverrideRelationToTeam(pAction->getParameter(0),		// first team
+									pAction->getParameter(1));		// second team
 			return;
 
 		case ScriptAction::TEAM_REMOVE_ALL_OVERRIDE_RELATIONS:
-			doTeamRemoveAllOverrideRelations(pAction->getParameter(0)->getString());		// first team
+			doTeamRemoveAllOverrideRelations(pAction->getParameter(0));		// first team
 			return;
 
 		case ScriptAction::TEAM_SET_OVERRIDE_RELATION_TO_PLAYER:
-			doTeamSetOverrideRelationToPlayer(pAction->getParameter(0)->getString(),		// first team
+			doTeamSetOverrideRelationToPlayer(pAction->getParameter(0),		// first team
 									pAction->getParameter(1)->getString(),			// second player
 									pAction->getParameter(2)->getInt());				// relation (ENEMIES, etc)
 			return;
 
 		case ScriptAction::TEAM_REMOVE_OVERRIDE_RELATION_TO_PLAYER:
-			doTeamRemoveOverrideRelationToPlayer(pAction->getParameter(0)->getString(),		// first team
+			doTeamRemoveOverrideRelationToPlayer(pAction->getParameter(0),		// first team
 									pAction->getParameter(1)->getString());		// second player
 			return;
 
 		case ScriptAction::PLAYER_SET_OVERRIDE_RELATION_TO_TEAM:
 			doPlayerSetOverrideRelationToTeam(pAction->getParameter(0)->getString(),		// first player
-									pAction->getParameter(1)->getString(),		// second team
+									pAction->getParameter(1),		// second team
 									pAction->getParameter(2)->getInt());				// relation (ENEMIES, etc)
 			return;
 
 		case ScriptAction::PLAYER_REMOVE_OVERRIDE_RELATION_TO_TEAM:
 			doPlayerRemoveOverrideRelationToTeam(pAction->getParameter(0)->getString(),		// first player
-									pAction->getParameter(1)->getString());		// second team
+									pAction->getParameter(1));		// second team
 			return;
 
 		case ScriptAction::NAMED_FIRE_WEAPON_FOLLOWING_WAYPOINT_PATH:
-			doNamedFireWeaponFollowingWaypointPath(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
+			doNamedFireWeaponFollowingWaypointPath(pAction->getParameter(0), pAction->getParameter(1)->getString() );
 			return;
 
 		case ScriptAction::NAMED_USE_COMMANDBUTTON_ABILITY:
-			doNamedUseCommandButtonAbility( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
+			doNamedUseCommandButtonAbility( pAction->getParameter(0), pAction->getParameter(1)->getString() );
 			return;
 
 		case ScriptAction::NAMED_USE_COMMANDBUTTON_ABILITY_ON_NAMED:
-			doNamedUseCommandButtonAbilityOnNamed( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString() );
+			doNamedUseCommandButtonAbilityOnNamed( pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2) );
 			return;
 
 		case ScriptAction::NAMED_USE_COMMANDBUTTON_ABILITY_AT_WAYPOINT:
-			doNamedUseCommandButtonAbilityAtWaypoint( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString() );
+			doNamedUseCommandButtonAbilityAtWaypoint( pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2) );
 			return;
 
 		case ScriptAction::TEAM_USE_COMMANDBUTTON_ABILITY:
-			doTeamUseCommandButtonAbility( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString() );
+			doTeamUseCommandButtonAbility( pAction->getParameter(0), pAction->getParameter(1)->getString() );
 			return;
 
 		case ScriptAction::TEAM_USE_COMMANDBUTTON_ABILITY_ON_NAMED:
-			doTeamUseCommandButtonAbilityOnNamed( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString() );
+			doTeamUseCommandButtonAbilityOnNamed( pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2) );
 			return;
 
 		case ScriptAction::TEAM_USE_COMMANDBUTTON_ABILITY_AT_WAYPOINT:
-			doTeamUseCommandButtonAbilityAtWaypoint( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString() );
+			doTeamUseCommandButtonAbilityAtWaypoint( pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2) );
 			return;
 
 		case ScriptAction::UNIT_EXECUTE_SEQUENTIAL_SCRIPT:
-			doUnitStartSequentialScript(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), 0);
+			doUnitStartSequentialScript(pAction->getParameter(0), pAction->getParameter(1)->getString(), 0);
 			return;
 
 		case ScriptAction::UNIT_EXECUTE_SEQUENTIAL_SCRIPT_LOOPING:
-			doUnitStartSequentialScript(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt() - 1);
+			doUnitStartSequentialScript(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt() - 1);
 			return;
 
 		case ScriptAction::UNIT_STOP_SEQUENTIAL_SCRIPT:
-			doUnitStopSequentialScript(pAction->getParameter(0)->getString());
+			doUnitStopSequentialScript(pAction->getParameter(0));
 			return;
 
 		case ScriptAction::TEAM_EXECUTE_SEQUENTIAL_SCRIPT:
-			doTeamStartSequentialScript(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), 0);
+			doTeamStartSequentialScript(pAction->getParameter(0), pAction->getParameter(1)->getString(), 0);
 			return;
 
 		case ScriptAction::TEAM_EXECUTE_SEQUENTIAL_SCRIPT_LOOPING:
-			doTeamStartSequentialScript(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt() - 1);
+			doTeamStartSequentialScript(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt() - 1);
 			return;
 
 		case ScriptAction::TEAM_STOP_SEQUENTIAL_SCRIPT:
-			doTeamStopSequentialScript(pAction->getParameter(0)->getString());
+			doTeamStopSequentialScript(pAction->getParameter(0));
 			return;
 
 		case ScriptAction::UNIT_GUARD_FOR_FRAMECOUNT:
-			doUnitGuardForFramecount(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doUnitGuardForFramecount(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::UNIT_IDLE_FOR_FRAMECOUNT:
-			doUnitIdleForFramecount(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doUnitIdleForFramecount(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::TEAM_GUARD_FOR_FRAMECOUNT:
-			doTeamIdleForFramecount(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doTeamIdleForFramecount(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::TEAM_IDLE_FOR_FRAMECOUNT:
-			doTeamIdleForFramecount(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doTeamIdleForFramecount(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::WATER_CHANGE_HEIGHT:
@@ -6837,13 +6843,13 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::OBJECT_FORCE_SELECT:
-			doForceObjectSelection(pAction->getParameter(0)->getString(),
+			doForceObjectSelection(pAction->getParameter(0),
 														 pAction->getParameter(1)->getString(),
 														 pAction->getParameter(2)->getInt(),
 														 pAction->getParameter(3)->getString());
 			return;
 		case ScriptAction::UNIT_DESTROY_ALL_CONTAINED:
-			doDestroyAllContained(pAction->getParameter(0)->getString(), 0);
+			doDestroyAllContained(pAction->getParameter(0), 0);
 			return;
 
 		case ScriptAction::RADAR_FORCE_ENABLE:
@@ -6864,11 +6870,11 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 
 
 		case ScriptAction::SET_CAVE_INDEX:
-			doSetCaveIndex(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doSetCaveIndex(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::WAREHOUSE_SET_VALUE:
-			doSetWarehouseValue(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doSetWarehouseValue(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::SOUND_DISABLE_TYPE:
@@ -6911,23 +6917,23 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 		}
 
 		case ScriptAction::UNIT_MOVE_TOWARDS_NEAREST_OBJECT_TYPE:
-			doMoveUnitTowardsNearest(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doMoveUnitTowardsNearest(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2));
 			return;
 
 		case ScriptAction::TEAM_MOVE_TOWARDS_NEAREST_OBJECT_TYPE:
-			doMoveTeamTowardsNearest(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doMoveTeamTowardsNearest(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2));
 			return;
 
 		case ScriptAction::NAMED_RECEIVE_UPGRADE:
-			doUnitReceiveUpgrade(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doUnitReceiveUpgrade(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 
 		case ScriptAction::SKIRMISH_ATTACK_NEAREST_GROUP_WITH_VALUE:
-			doSkirmishAttackNearestGroupWithValue(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt(), pAction->getParameter(2)->getInt());
+			doSkirmishAttackNearestGroupWithValue(pAction->getParameter(0), pAction->getParameter(1)->getInt(), pAction->getParameter(2)->getInt());
 			return;
 
 		case ScriptAction::SKIRMISH_PERFORM_COMMANDBUTTON_ON_MOST_VALUABLE_OBJECT:
-			doSkirmishCommandButtonOnMostValuable(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getReal(), pAction->getParameter(3)->getInt());
+			doSkirmishCommandButtonOnMostValuable(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getReal(), pAction->getParameter(3)->getInt());
 			return;
 
 		case ScriptAction::SKIRMISH_WAIT_FOR_COMMANDBUTTON_AVAILABLE_ALL:
@@ -6951,38 +6957,38 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::TEAM_SPIN_FOR_FRAMECOUNT:
-			doTeamSpinForFramecount( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt() );
+			doTeamSpinForFramecount( pAction->getParameter(0), pAction->getParameter(1)->getInt() );
 			return;
 
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NAMED:
-			doTeamUseCommandButtonOnNamed(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doTeamUseCommandButtonOnNamed(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2));
 			return;
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NEAREST_ENEMY_UNIT:
-			doTeamUseCommandButtonOnNearestEnemy(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamUseCommandButtonOnNearestEnemy(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NEAREST_GARRISONED_BUILDING:
-			doTeamUseCommandButtonOnNearestGarrisonedBuilding(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamUseCommandButtonOnNearestGarrisonedBuilding(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NEAREST_KINDOF:
-			doTeamUseCommandButtonOnNearestKindof(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
+			doTeamUseCommandButtonOnNearestKindof(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
 			return;
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NEAREST_ENEMY_BUILDING:
-			doTeamUseCommandButtonOnNearestBuilding(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doTeamUseCommandButtonOnNearestBuilding(pAction->getParameter(0), pAction->getParameter(1)->getString());
 			return;
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NEAREST_ENEMY_BUILDING_CLASS:
-			doTeamUseCommandButtonOnNearestBuildingClass(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
+			doTeamUseCommandButtonOnNearestBuildingClass(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
 			return;
 		case ScriptAction::TEAM_ALL_USE_COMMANDBUTTON_ON_NEAREST_OBJECTTYPE:
-			doTeamUseCommandButtonOnNearestObjectType(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doTeamUseCommandButtonOnNearestObjectType(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
 			return;
 		case ScriptAction::TEAM_PARTIAL_USE_COMMANDBUTTON:
-			doTeamPartialUseCommandButton(pAction->getParameter(0)->getReal(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
+			doTeamPartialUseCommandButton(pAction->getParameter(0)->getReal(), pAction->getParameter(1), pAction->getParameter(2)->getString());
 			return;
 		case ScriptAction::TEAM_CAPTURE_NEAREST_UNOWNED_FACTION_UNIT:
-			doTeamCaptureNearestUnownedFactionUnit(pAction->getParameter(0)->getString());
+			doTeamCaptureNearestUnownedFactionUnit(pAction->getParameter(0));
 			return;
 		case ScriptAction::PLAYER_CREATE_TEAM_FROM_CAPTURED_UNITS:
-			doCreateTeamFromCapturedUnits(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString());
+			doCreateTeamFromCapturedUnits(pAction->getParameter(0)->getString(), pAction->getParameter(1));
 			return;
 		case ScriptAction::PLAYER_ADD_SKILLPOINTS:
 			doPlayerAddSkillPoints(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
@@ -7006,10 +7012,10 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			doPlayerSetScienceAvailability(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString());
 			return;
 		case ScriptAction::TEAM_SET_EMOTICON:
-			doTeamEmoticon( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getReal() );
+			doTeamEmoticon( pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getReal() );
 			return;
 		case ScriptAction::NAMED_SET_EMOTICON:
-			doNamedEmoticon( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getReal() );
+			doNamedEmoticon( pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getReal() );
 			return;
 		case ScriptAction::OBJECTLIST_ADDOBJECTTYPE:
 			doObjectTypeListMaintenance(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), TRUE);
@@ -7041,27 +7047,27 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::NAMED_FACE_NAMED:
-			doNamedFaceNamed( pAction->getParameter( 0 )->getString(), pAction->getParameter( 1 )->getString() );
+			doNamedFaceNamed( pAction->getParameter( 0 ), pAction->getParameter( 1 ) );
 			return;
 
 		case ScriptAction::NAMED_FACE_WAYPOINT:
-			doNamedFaceWaypoint( pAction->getParameter( 0 )->getString(), pAction->getParameter( 1 )->getString() );
+			doNamedFaceWaypoint( pAction->getParameter( 0 ), pAction->getParameter( 1 ) );
 			return;
 
 		case ScriptAction::TEAM_FACE_NAMED:
-			doTeamFaceNamed( pAction->getParameter( 0 )->getString(), pAction->getParameter( 1 )->getString() );
+			doTeamFaceNamed( pAction->getParameter( 0 ), pAction->getParameter( 1 ) );
 			return;
 
 		case ScriptAction::TEAM_FACE_WAYPOINT:
-			doTeamFaceWaypoint( pAction->getParameter( 0 )->getString(), pAction->getParameter( 1 )->getString() );
+			doTeamFaceWaypoint( pAction->getParameter( 0 ), pAction->getParameter( 1 ) );
 			return;
 
 		case ScriptAction::UNIT_AFFECT_OBJECT_PANEL_FLAGS:
-			doAffectObjectPanelFlagsUnit(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
+			doAffectObjectPanelFlagsUnit(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
 			return;
 
 		case ScriptAction::TEAM_AFFECT_OBJECT_PANEL_FLAGS:
-			doAffectObjectPanelFlagsTeam(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
+			doAffectObjectPanelFlagsTeam(pAction->getParameter(0), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getInt());
 			return;
 
 		case ScriptAction::PLAYER_SELECT_SKILLSET:
@@ -7080,7 +7086,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 		{
 			Coord3D pos;
 			pAction->getParameter(3)->getCoord3D(&pos);
-			doCreateObject( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2)->getString(), &pos, pAction->getParameter(4)->getReal() );
+			doCreateObject( pAction->getParameter(0)->getString(), pAction->getParameter(1)->getString(), pAction->getParameter(2), &pos, pAction->getParameter(4)->getReal() );
 			return;
 		}
 
@@ -7089,7 +7095,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::TEAM_GUARD_SUPPLY_CENTER:
-			doGuardSupplyCenter(pAction->getParameter(0)->getString(), pAction->getParameter(1)->getInt());
+			doGuardSupplyCenter(pAction->getParameter(0), pAction->getParameter(1)->getInt());
 			return;
 
 		case ScriptAction::OBJECT_ALLOW_BONUSES:
@@ -7097,7 +7103,7 @@ void ScriptActions::executeAction( ScriptAction *pAction )
 			return;
 
 		case ScriptAction::TEAM_GUARD_IN_TUNNEL_NETWORK:
-			doTeamGuardInTunnelNetwork(pAction->getParameter(0)->getString());
+			doTeamGuardInTunnelNetwork(pAction->getParameter(0));
 			return;
 
 		case ScriptAction::RESIZE_VIEW_GUARDBAND:
@@ -32,6 +32,7 @@
 #include "Common/file.h"
 #include "Common/FileSystem.h"
 #include "Common/FramePacer.h"
+#include "Common/GameEngine.h"
 #include "Common/GameState.h"
 #include "Common/LatchRestore.h"
 #include "Common/MessageStream.h"
@@ -51,9 +52,11 @@
 #include "GameLogic/Module/AIUpdate.h"
 #include "GameLogic/ObjectTypes.h"
 #include "GameLogic/PartitionManager.h"
+#include "GameLogic/PolygonTrigger.h"
 #include "GameLogic/ScriptActions.h"
 #include "GameLogic/ScriptConditions.h"
 #include "GameLogic/ScriptEngine.h"
+#include "GameLogic/ScriptProfiler.h"
 #include "GameLogic/SidesList.h"
 
 
@@ -375,7 +378,10 @@ m_minFade(0.0f),
 m_numAttackInfo(0),
 m_shownMPLocalDefeatWindow(FALSE),
 m_objectsShouldReceiveDifficultyBonus(TRUE),
-m_ChooseVictimAlwaysUsesNormal(false)
+m_ChooseVictimAlwaysUsesNormal(false),
+m_profiler(NULL),
+m_namedObjectsGeneration(0),
+m_objectTypeListsGeneration(0)
 {
 	st_CanAppCont = true;
 	st_LastCurrentFrame = st_CurrentFrame = 0;
@@ -413,6 +419,9 @@ ScriptEngine::~ScriptEngine()
 #endif
 
 	reset(); // just in case.
+
+	delete m_profiler;
+	m_profiler = NULL;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -451,6 +460,10 @@ void ScriptEngine::init( void )
 	_initVTune();
 #endif
 
+	if (TheGlobalData->m_profileScripts && m_profiler == NULL) {
+		m_profiler = new ScriptProfiler;
+	}
+
 #ifdef SPECIAL_SCRIPT_PROFILING
 #ifdef DEBUG_LOGGING
 	m_numFrames=0;
@@ -4628,6 +4641,12 @@ void ScriptEngine::reset( void )
 #endif
 #endif
 
+	// TheSuperHackers @feature Write the script profile of the map that is being unloaded.
+	if (m_profiler && m_profiler->hasSamples()) {
+		m_profiler->writeReport(TheGlobalData->m_mapName);
+		m_profiler->reset();
+	}
+
 	_updateCurrentParticleCap();
 
 	// delete and clear all sequential scripts.
@@ -4649,6 +4668,7 @@ void ScriptEngine::reset( void )
 			removeObjectTypes(*it);
 		} else {
 			m_allObjectTypeLists.erase(it);
+			++m_objectTypeListsGeneration;
 		}
 	}
 	DEBUG_ASSERTCRASH( m_allObjectTypeLists.empty() == TRUE, ("ScriptEngine::reset - m_allObjectTypeLists should be empty but is not!") );
@@ -4658,6 +4678,7 @@ void ScriptEngine::reset( void )
 
 	// Clear the named objects list.
  	m_namedObjects.clear();
+	++m_namedObjectsGeneration;
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -4816,6 +4837,10 @@ void ScriptEngine::update( void )
 		return; // we are just timing down
 	}
 
+	if (m_profiler) {
+		m_profiler->addFrame();
+	}
+
 	if (TheScriptActions) {
 		TheScriptActions->update();
 	}
@@ -4897,6 +4922,14 @@ void ScriptEngine::update( void )
 	_updateVTune();
 #endif
 
+	// TheSuperHackers @feature Stop the game once the requested number of frames has been profiled.
+	// This allows running campaign maps headless as a repeatable script benchmark.
+	if (m_profiler && TheGlobalData->m_profileScriptsFrameLimit > 0
+		&& TheGameLogic->getFrame() >= TheGlobalData->m_profileScriptsFrameLimit) {
+		m_profiler->writeReport(TheGlobalData->m_mapName);
+		m_profiler->reset();
+		TheGameEngine->setQuitting(TRUE);
+	}
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5153,6 +5186,19 @@ ObjectTypes *ScriptEngine::getObjectTypes(const AsciiString& objectTypeList)
 	return NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getObjectTypes */
+//-------------------------------------------------------------------------------------------------
+ObjectTypes *ScriptEngine::getObjectTypes(const Parameter *pTypesParm)
+{
+	void *handle;
+	if (!pTypesParm->getResolvedHandle(Parameter::RESOLVED_OBJECT_TYPES, m_objectTypeListsGeneration, &handle)) {
+		handle = getObjectTypes(pTypesParm->getString());
+		pTypesParm->setResolvedHandle(Parameter::RESOLVED_OBJECT_TYPES, m_objectTypeListsGeneration, handle);
+	}
+	return (ObjectTypes *)handle;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** doObjectTypeListMaintenance */
 /** If addObject is false, remove the object. If it is true, add the object. */
@@ -5165,6 +5211,7 @@ void ScriptEngine::doObjectTypeListMaintenance(const AsciiString& objectTypeList
 	if (!currentObjectTypeVec) {
 		ObjectTypes *newVec = newInstance(ObjectTypes)(objectTypeList);
 		m_allObjectTypeLists.push_back(newVec);
+		++m_objectTypeListsGeneration;
 		currentObjectTypeVec = newVec;
 	}
 
@@ -5230,22 +5277,71 @@ PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( AsciiString name )
 
 
 //-------------------------------------------------------------------------------------------------
-/** getTeamNamed */
+/** Same as above, but caches the trigger area on the parameter. */
 //-------------------------------------------------------------------------------------------------
-Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
+PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( const Parameter *pTriggerParm )
+{
+	const AsciiString& name = pTriggerParm->getString();
+	if (name == MY_INNER_PERIMETER || name == MY_OUTER_PERIMETER ||
+			name == ENEMY_INNER_PERIMETER || name == ENEMY_OUTER_PERIMETER) {
+		// These depend on the current player.
+		return getQualifiedTriggerAreaByName(name);
+	}
+
+	const UnsignedInt generation = PolygonTrigger::getTriggerGeneration();
+	void *handle;
+	if (pTriggerParm->getResolvedHandle(Parameter::RESOLVED_TRIGGER_AREA, generation, &handle)) {
+		return (PolygonTrigger *)handle;
+	}
+
+	PolygonTrigger *trig = getQualifiedTriggerAreaByName(name);
+	if (trig) {
+		// Missing areas are not cached, so that the warning keeps being reported.
+		pTriggerParm->setResolvedHandle(Parameter::RESOLVED_TRIGGER_AREA, generation, trig);
+	}
+	return trig;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getWaypointByName */
+//-------------------------------------------------------------------------------------------------
+Waypoint *ScriptEngine::getWaypointByName( const Parameter *pWaypointParm )
+{
+	const UnsignedInt generation = TheTerrainLogic->getWaypointGeneration();
+	void *handle;
+	if (!pWaypointParm->getResolvedHandle(Parameter::RESOLVED_WAYPOINT, generation, &handle)) {
+		handle = TheTerrainLogic->getWaypointByName(pWaypointParm->getString());
+		pWaypointParm->setResolvedHandle(Parameter::RESOLVED_WAYPOINT, generation, handle);
+	}
+	return (Waypoint *)handle;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getContextTeamNamed - Resolves the team names that depend on the calling context.
+Returns false if the name has to be looked up in the team factory. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::getContextTeamNamed(const AsciiString& teamName, Team **team)
 {
 	if (teamName == THIS_TEAM) {
-		if (m_callingTeam)
-			return m_callingTeam;
-		return m_conditionTeam;
+		*team = m_callingTeam ? m_callingTeam : m_conditionTeam;
+		return true;
 	}
 	if (m_callingTeam && m_callingTeam->getName() == teamName) {
-		return m_callingTeam;
+		*team = m_callingTeam;
+		return true;
 	}
 	if (m_conditionTeam && m_conditionTeam->getName() == teamName) {
-		return m_conditionTeam;
+		*team = m_conditionTeam;
+		return true;
 	}
-	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototype( teamName );
+	return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamFromPrototype */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamFromPrototype(const AsciiString& teamName, TeamPrototype *theTeamProto)
+{
 	if (theTeamProto == NULL) return NULL;
 	if (theTeamProto->getIsSingleton()) {
 		Team *theTeam = theTeamProto->getFirstItemIn_TeamInstanceList();
@@ -5266,6 +5362,38 @@ Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 	return theTeamProto->getFirstItemIn_TeamInstanceList();
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamed */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
+{
+	Team *theTeam;
+	if (getContextTeamNamed(teamName, &theTeam)) {
+		return theTeam;
+	}
+	return getTeamFromPrototype(teamName, TheTeamFactory->findTeamPrototype( teamName ));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamed - The team instance can change at any time, so only the prototype is cached. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(const Parameter *pTeamParm)
+{
+	const AsciiString& teamName = pTeamParm->getString();
+	Team *theTeam;
+	if (getContextTeamNamed(teamName, &theTeam)) {
+		return theTeam;
+	}
+
+	const UnsignedInt generation = TheTeamFactory->getPrototypeGeneration();
+	void *handle;
+	if (!pTeamParm->getResolvedHandle(Parameter::RESOLVED_TEAM_PROTOTYPE, generation, &handle)) {
+		handle = TheTeamFactory->findTeamPrototype( teamName );
+		pTeamParm->setResolvedHandle(Parameter::RESOLVED_TEAM_PROTOTYPE, generation, handle);
+	}
+	return getTeamFromPrototype(teamName, (TeamPrototype *)handle);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** getUnitNamed */
 //-------------------------------------------------------------------------------------------------
@@ -5286,6 +5414,24 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 	return NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getUnitNamed */
+//-------------------------------------------------------------------------------------------------
+Object * ScriptEngine::getUnitNamed(const Parameter *pUnitParm)
+{
+	const AsciiString& unitName = pUnitParm->getString();
+	if (unitName == THIS_OBJECT) {
+		return getUnitNamed(unitName);
+	}
+
+	void *handle;
+	if (!pUnitParm->getResolvedHandle(Parameter::RESOLVED_UNIT, m_namedObjectsGeneration, &handle)) {
+		handle = getUnitNamed(unitName);
+		pUnitParm->setResolvedHandle(Parameter::RESOLVED_UNIT, m_namedObjectsGeneration, handle);
+	}
+	return (Object *)handle;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** didUnitExist */
 //-------------------------------------------------------------------------------------------------
@@ -5983,6 +6129,7 @@ void ScriptEngine::removeObjectTypes(ObjectTypes *typesToRemove)
 
 	// remove it from the main array of stuff
 	m_allObjectTypeLists.erase(it);
+	++m_objectTypeListsGeneration;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6257,6 +6404,9 @@ void ScriptEngine::executeScript( Script *pScript )
 #endif
 #endif
 
+	const Int64 profileStartTicks = m_profiler ? ScriptProfiler::getTicks() : 0;
+	Bool profileResult = FALSE;
+
 	Team *pSavConditionTeam = m_conditionTeam;
 	TeamPrototype *pProto = NULL;
 
@@ -6271,6 +6421,7 @@ void ScriptEngine::executeScript( Script *pScript )
 			m_conditionTeam = iter.cur();
 			// If conditions evaluate to true, execute actions.
 			if (evaluateConditions(pScript)) {
+				profileResult = TRUE;
 				// Script Debug window
 				if (pScript->getAction()) {
 					_appendMessage(pScript->getName());
@@ -6294,6 +6445,7 @@ void ScriptEngine::executeScript( Script *pScript )
 		m_conditionTeam = NULL;
 		// If conditions evaluate to true, execute actions.
 		if (evaluateConditions(pScript)) {
+			profileResult = TRUE;
 			if (pScript->getAction()) {
 				// Script Debug window
 				_appendMessage(pScript->getName());
@@ -6323,6 +6475,10 @@ void ScriptEngine::executeScript( Script *pScript )
 #endif
 #endif
 
+	if (m_profiler) {
+		m_profiler->addScript(pScript, profileStartTicks, profileResult);
+	}
+
 	m_conditionTeam = pSavConditionTeam;
 }
 
@@ -6330,6 +6486,20 @@ void ScriptEngine::executeScript( Script *pScript )
 /** Evaluates a condition */
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateCondition( Condition *pCondition )
+{
+	if (m_profiler) {
+		const Int64 startTicks = ScriptProfiler::getTicks();
+		const Bool result = evaluateConditionInternal(pCondition);
+		m_profiler->addCondition(pCondition->getConditionType(), startTicks, result);
+		return result;
+	}
+	return evaluateConditionInternal(pCondition);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Evaluates a condition without profiling */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::evaluateConditionInternal( Condition *pCondition )
 {
 	switch (pCondition->getConditionType()) {
 		default:
@@ -6374,6 +6544,8 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
+	++m_namedObjectsGeneration;
+
 	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
 		if (it->first == objName) {
 			if (it->second == NULL) {
@@ -6413,6 +6585,7 @@ void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
 		if (pDeadObject == (it->second)) {
 			it->second = NULL;	// Don't remove it, cause we want to check whether we ever knew a name later
+			++m_namedObjectsGeneration;
 			break;
 		}
 	}
@@ -6434,6 +6607,8 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 		return;
 	}
 
+	++m_namedObjectsGeneration;
+
 	//John Ahlquist: When transferring an object name, make sure the new object isn't already in
 	//							 the vector. If so, remove it, or it'll end up there twice and cause a crash.
 	if( pNewObject->getName().isNotEmpty() )
@@ -6908,6 +7083,7 @@ void ScriptEngine::executeActions( ScriptAction *pActionHead )
 	ScriptAction *pCurAction;
 	UnicodeString uStr1;
 	for (pCurAction = pActionHead; pCurAction; pCurAction = pCurAction->getNext()) {
+		const Int64 profileStartTicks = m_profiler ? ScriptProfiler::getTicks() : 0;
 		switch (pCurAction->getActionType()) {
 			default: if (TheScriptActions) TheScriptActions->executeAction(pCurAction); break;
 			case ScriptAction::SET_COUNTER: setCounter(pCurAction);	break;
@@ -6941,6 +7117,9 @@ void ScriptEngine::executeActions( ScriptAction *pActionHead )
 
 			case ScriptAction::NO_OP: /* just break. */; break;
 		}
+		if (m_profiler) {
+			m_profiler->addAction(pCurAction->getActionType(), profileStartTicks);
+		}
 	}
 }
 
@@ -6990,6 +7169,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 void ScriptEngine::createNamedCache( void )
 {
 	m_namedObjects.clear();
+	++m_namedObjectsGeneration;
 
 	if( !TheGameLogic )
 	{
@@ -8283,6 +8463,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 		// according to John M., so we're clearing it now
 		//
 		m_namedObjects.clear();
+		++m_namedObjectsGeneration;
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -8550,6 +8731,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 
 				// put on list
 				m_allObjectTypeLists.push_back( objectTypes );
+				++m_objectTypeListsGeneration;
 
 			}
 
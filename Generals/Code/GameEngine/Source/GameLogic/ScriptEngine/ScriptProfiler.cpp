@@ -0,0 +1,204 @@
+/*
+**	Command & Conquer Generals(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: ScriptProfiler.cpp ///////////////////////////////////////////////////////////////////////
+// Accumulates call counts, results and timings of scripts, conditions and actions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/GlobalData.h"
+#include "GameLogic/ScriptEngine.h"
+#include "GameLogic/ScriptProfiler.h"
+
+
+//-------------------------------------------------------------------------------------------------
+ScriptProfiler::ScriptProfiler()
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	m_frequency = freq.QuadPart;
+	m_numFrames = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::reset()
+{
+	m_scripts.clear();
+	Int i;
+	for (i = 0; i < Condition::NUM_ITEMS; ++i)
+		m_conditions[i] = Sample();
+	for (i = 0; i < ScriptAction::NUM_ITEMS; ++i)
+		m_actions[i] = Sample();
+	m_numFrames = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 ScriptProfiler::getTicks()
+{
+	LARGE_INTEGER tick;
+	QueryPerformanceCounter(&tick);
+	return tick.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::addScript(const Script *script, Int64 startTicks, Bool result)
+{
+	const Int64 ticks = getTicks() - startTicks;
+	ScriptSample &sample = m_scripts[script];
+	if (sample.m_calls == 0)
+		sample.m_name = script->getName();
+	sample.add(ticks, result);
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::addCondition(Condition::ConditionType type, Int64 startTicks, Bool result)
+{
+	const Int64 ticks = getTicks() - startTicks;
+	if (type >= 0 && type < Condition::NUM_ITEMS)
+		m_conditions[type].add(ticks, result);
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::addAction(ScriptAction::ScriptActionType type, Int64 startTicks)
+{
+	const Int64 ticks = getTicks() - startTicks;
+	if (type >= 0 && type < ScriptAction::NUM_ITEMS)
+		m_actions[type].add(ticks, TRUE);
+}
+
+//-------------------------------------------------------------------------------------------------
+Real ScriptProfiler::ticksToMilliseconds(Int64 ticks) const
+{
+	return (Real)((double)ticks * 1000.0 / (double)m_frequency);
+}
+
+//-------------------------------------------------------------------------------------------------
+bool ScriptProfiler::isMoreExpensive(const ReportRow& a, const ReportRow& b)
+{
+	return a.m_sample->m_ticks > b.m_sample->m_ticks;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::writeSection(FILE *txt, FILE *csv, const char *category, ReportRows& rows, Bool hasResult) const
+{
+	std::sort(rows.begin(), rows.end(), isMoreExpensive);
+
+	fprintf(txt, "\n%s (sorted by total time)\n", category);
+	if (hasResult)
+		fprintf(txt, "%12s %10s %10s %10s %7s  %s\n", "Total ms", "Avg ms", "Max ms", "Calls", "True %", "Name");
+	else
+		fprintf(txt, "%12s %10s %10s %10s  %s\n", "Total ms", "Avg ms", "Max ms", "Calls", "Name");
+
+	for (ReportRows::const_iterator it = rows.begin(); it != rows.end(); ++it)
+	{
+		const Sample &sample = *it->m_sample;
+		const Real totalMs = ticksToMilliseconds(sample.m_ticks);
+		const Real avgMs = totalMs / sample.m_calls;
+		const Real maxMs = ticksToMilliseconds(sample.m_maxTicks);
+		const Real truePercent = 100.0f * sample.m_trueCount / sample.m_calls;
+
+		if (hasResult)
+			fprintf(txt, "%12.3f %10.4f %10.4f %10u %7.1f  %s\n", totalMs, avgMs, maxMs, sample.m_calls, truePercent, it->m_name.str());
+		else
+			fprintf(txt, "%12.3f %10.4f %10.4f %10u  %s\n", totalMs, avgMs, maxMs, sample.m_calls, it->m_name.str());
+
+		fprintf(csv, "%s,\"%s\",%u,%u,%.6f,%.6f\n", category, it->m_name.str(), sample.m_calls, sample.m_trueCount, totalMs, maxMs);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool ScriptProfiler::writeReport(const AsciiString& mapName) const
+{
+	// Name the report files after the map and the process, so that consecutive games and parallel
+	// replay checks of the same map do not overwrite each other.
+	AsciiString baseName = mapName;
+	const char *leaf = mapName.reverseFind('\\');
+	if (leaf != NULL)
+		baseName = leaf + 1;
+	if (baseName.endsWithNoCase(".map"))
+		baseName.truncateBy(4);
+	if (baseName.isEmpty())
+		baseName = "Unknown";
+
+	AsciiString txtPath;
+	AsciiString csvPath;
+	const unsigned long processId = GetCurrentProcessId();
+	txtPath.format("%sScriptProfile_%s_%lu.txt", TheGlobalData->getPath_UserData().str(), baseName.str(), processId);
+	csvPath.format("%sScriptProfile_%s_%lu.csv", TheGlobalData->getPath_UserData().str(), baseName.str(), processId);
+
+	FILE *txt = fopen(txtPath.str(), "w");
+	if (txt == NULL)
+		return FALSE;
+	FILE *csv = fopen(csvPath.str(), "w");
+	if (csv == NULL)
+	{
+		fclose(txt);
+		return FALSE;
+	}
+
+	ReportRows scriptRows;
+	Int64 totalScriptTicks = 0;
+	for (ScriptSampleMap::const_iterator it = m_scripts.begin(); it != m_scripts.end(); ++it)
+	{
+		ReportRow row;
+		row.m_name = it->second.m_name;
+		row.m_sample = &it->second;
+		scriptRows.push_back(row);
+		totalScriptTicks += it->second.m_ticks;
+	}
+
+	ReportRows conditionRows;
+	Int i;
+	for (i = 0; i < Condition::NUM_ITEMS; ++i)
+	{
+		if (m_conditions[i].m_calls == 0)
+			continue;
+		ReportRow row;
+		row.m_name = TheScriptEngine->getConditionTemplate(i)->m_internalName;
+		row.m_sample = &m_conditions[i];
+		conditionRows.push_back(row);
+	}
+
+	ReportRows actionRows;
+	for (i = 0; i < ScriptAction::NUM_ITEMS; ++i)
+	{
+		if (m_actions[i].m_calls == 0)
+			continue;
+		ReportRow row;
+		row.m_name = TheScriptEngine->getActionTemplate(i)->m_internalName;
+		row.m_sample = &m_actions[i];
+		actionRows.push_back(row);
+	}
+
+	fprintf(txt, "Script profile for map %s\n", mapName.str());
+	fprintf(txt, "Logic frames: %u\n", m_numFrames);
+	// the game can quit before the first logic frame
+	const Real framesForAverage = m_numFrames > 0 ? (Real)m_numFrames : 1.0f;
+	fprintf(txt, "Sum of inclusive script times: %.3f ms (%.4f ms per frame)\n",
+		ticksToMilliseconds(totalScriptTicks), ticksToMilliseconds(totalScriptTicks) / framesForAverage);
+
+	fprintf(csv, "category,name,calls,true,total_ms,max_ms\n");
+	writeSection(txt, csv, "Scripts", scriptRows, TRUE);
+	writeSection(txt, csv, "Conditions", conditionRows, TRUE);
+	writeSection(txt, csv, "Actions", actionRows, FALSE);
+
+	fclose(csv);
+	fclose(txt);
+	return TRUE;
+}
@@ -1729,6 +1729,7 @@ void Parameter::setCoord3D(const Coord3D *pLoc)
 void Parameter::qualify(const AsciiString& qualifier,
 			const AsciiString& playerTemplateName, const AsciiString& newPlayerName)
 {
+	m_resolvedType = RESOLVED_NONE; // the name may change
 	AsciiString tmpString;
 	switch (m_paramType) {
 		case SIDE:
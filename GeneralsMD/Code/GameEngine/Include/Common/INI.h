@@ -336,6 +336,12 @@ public:
 	*/
 	const char* getNextTokenOrNull(const char* seps = NULL);
 
+	/**
+		reentrant replacement of strtok() for the current line. pass the line buffer to get its
+		first token, and NULL to get the following tokens. all INI token functions use this.
+	*/
+	char* tokenize(char* str, const char* seps);
+
 	/**
 		This is called when the next thing you expect is something like:
 
@@ -386,6 +392,9 @@ public:
 
 	static Bool scanBool(const char* token);
 
+	/// the field parse tables that were indexed for lookups so far, for the engine tests
+	static void getIndexedFieldParseTables( std::vector<const FieldParse*>& tables );
+
 protected:
 
 	static Bool isValidINIFilename( const char *filename ); ///< is this a valid .ini filename
@@ -394,6 +403,7 @@ protected:
 	void unPrepFile();
 
 	void readLine( void );
+	unsigned fillReadBuffer( void );
 
 	File *m_file;															///< file pointer of file currently loading
 
@@ -402,6 +412,7 @@ protected:
     INI_READ_BUFFER = 8192                  ///< size of internal read buffer
   };
   char m_readBuffer[INI_READ_BUFFER];       ///< internal read buffer
+  const char *m_readData;                   ///< m_readBuffer, or the file contents if they are in memory
   unsigned m_readBufferNext;                ///< next char in read buffer
   unsigned m_readBufferUsed;                ///< number of bytes in read buffer
 
@@ -415,6 +426,7 @@ protected:
 	const char *m_sepsQuote;									///< token to represent a quoted ascii string
 	const char *m_blockEndToken;							///< token to represent end of data block
 	Bool m_endOfFile;													///< TRUE when we've hit EOF
+	char *m_tokenCursor;											///< next token position in m_buffer, see tokenize()
 #ifdef DEBUG_CRASHING
 	char m_curBlockStart[ INI_MAX_CHARS_PER_LINE+1 ];	///< first line of cur block
 #endif
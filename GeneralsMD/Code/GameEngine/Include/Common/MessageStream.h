@@ -78,15 +78,13 @@ enum GameMessageArgumentDataType CPP_11(: Int)
 	ARGUMENTDATATYPE_UNKNOWN
 };
 
-class GameMessageArgument : public MemoryPoolObject
+// TheSuperHackers @performance An argument is a plain value now. Messages keep their arguments in
+// arrays instead of linked lists of pooled arguments.
+struct GameMessageArgument
 {
-	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(GameMessageArgument, "GameMessageArgument")
-public:
-	GameMessageArgument*				m_next;									///< The next argument
 	GameMessageArgumentType			m_data;									///< The data storage of an argument
 	GameMessageArgumentDataType	m_type;									///< The type of the argument.
 };
-EMPTY_DTOR(GameMessageArgument)
 
 /**
  * A game message that either lives on TheMessageStream or TheCommandList.
@@ -659,7 +657,6 @@ public:
 
 	/**
 	 * Return the given argument union.
-	 * @todo This should be a more list-like interface.  Very inefficient.
 	 */
 	const GameMessageArgumentType *getArgument( Int argIndex ) const;
 	GameMessageArgumentDataType getArgumentDataType( Int argIndex );
@@ -683,9 +680,16 @@ private:
 	/// @todo If a GameMessage needs more than 255 arguments, it needs to be split up into multiple GameMessage's.
 	UnsignedByte m_argCount;										///< The number of arguments of this message
 
-	GameMessageArgument *m_argList, *m_argTail;						///< This message's arguments
+	// TheSuperHackers @performance The arguments are stored in an array instead of a list of pooled
+	// arguments. Most messages fit into the array inside the message and need no allocation at all,
+	// larger ones move their arguments to the heap. Arguments are looked up by index directly.
+	enum { INLINE_ARGUMENT_COUNT = 8 };
+
+	GameMessageArgument *m_args;								///< This message's arguments, m_inlineArgs or an array on the heap
+	UnsignedShort m_argCapacity;								///< The number of arguments that fit into m_args
+	GameMessageArgument m_inlineArgs[INLINE_ARGUMENT_COUNT];
 
-	/// allocate a new argument, add it to list, return pointer to its data
+	/// allocate a new argument at the end of the arguments, return pointer to it
 	GameMessageArgument *allocArg( void );
 
 };
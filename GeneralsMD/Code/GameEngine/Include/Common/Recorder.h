@@ -28,6 +28,7 @@
 #include "GameNetwork/GameInfo.h"
 
 class File;
+class NetEncodingStats;
 
 /**
   * The ReplayGameInfo class holds information about the replay game and
@@ -174,6 +175,8 @@ protected:
 	Int m_originalGameMode; // valid in replays
 
 	UnsignedInt m_nextFrame;												///< The Frame that the next message is to be executed on.  This can be -1.
+
+	NetEncodingStats *m_netEncodingStats;						///< valid during playback with -measureNetEncoding only
 };
 
 extern RecorderClass *TheRecorder;
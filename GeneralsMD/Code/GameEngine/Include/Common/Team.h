@@ -174,6 +174,78 @@ protected:
 
 };
 
+// ------------------------------------------------------------------------
+/**
+	TheSuperHackers @performance Incrementally maintained member counts of a Team. The counts are
+	kept per member ThingTemplate and per KindOf bit, and are updated by Object whenever it joins or
+	leaves a team, or whenever its dead, destroyed or under construction state changes. This allows
+	the count and "has any" queries of Team, TeamPrototype and Player to be answered without walking
+	every team member.
+*/
+class TeamMemberCounts
+{
+public:
+
+	enum
+	{
+		STATE_DEAD								= 0x01,	///< Object::isEffectivelyDead()
+		STATE_DESTROYED						= 0x02,	///< Object::isDestroyed()
+		STATE_UNDER_CONSTRUCTION	= 0x04,	///< OBJECT_STATUS_UNDER_CONSTRUCTION
+
+		NUM_STATES								= 0x08
+	};
+
+	TeamMemberCounts();
+
+	/// return the state bits of an object as they are used for counting
+	static UnsignedByte getState(const Object *obj);
+
+	void clear();
+	void addMember(const ThingTemplate *tmpl, UnsignedByte state) { adjust(tmpl, state, 1); }
+	void removeMember(const ThingTemplate *tmpl, UnsignedByte state) { adjust(tmpl, state, -1); }
+	void changeMemberState(const ThingTemplate *tmpl, UnsignedByte oldState, UnsignedByte newState);
+
+	Int getNumMembers() const { return m_numMembers; }
+	Int getNumDeadMembers() const { return m_numDeadMembers; }
+
+	/// same semantics as Team::countObjectsByThingTemplate
+	void countObjectsByThingTemplate(Int numTmplates, const ThingTemplate* const* things, Bool ignoreDead, Int *counts, Bool ignoreUnderConstruction) const;
+
+	/// count all members, dead or alive, of the given KindOf
+	Int countObjects(KindOfType kindOf) const { return m_kindOfCount[kindOf]; }
+	/// count all members, dead or alive, matching the KindOf masks
+	Int countObjects(const KindOfMaskType& setMask, const KindOfMaskType& clearMask) const;
+
+	/// return true if a member that is neither dead nor destroyed is of the given KindOf
+	Bool hasAnyLiveObjects(KindOfType kindOf) const { return m_liveKindOfCount[kindOf] > 0; }
+	/// return true if a member that is neither dead nor destroyed matches the KindOf masks
+	Bool hasAnyLiveObjects(const KindOfMaskType& setMask, const KindOfMaskType& clearMask) const;
+
+	Bool isEqual(const TeamMemberCounts& that) const;
+
+private:
+
+	struct TemplateCount
+	{
+		const ThingTemplate *m_template;
+		Int m_total;
+		Int m_count[NUM_STATES];
+	};
+
+	typedef std::vector<TemplateCount> TemplateCountVec;
+
+	static Bool isLiveState(UnsignedByte state) { return (state & (STATE_DEAD | STATE_DESTROYED)) == 0; }
+
+	const TemplateCount *findTemplateCount(const ThingTemplate *tmpl) const;
+	void adjust(const ThingTemplate *tmpl, UnsignedByte state, Int delta);
+
+	TemplateCountVec m_templateCounts;	///< one entry per distinct member template, entries are removed when they reach zero
+	Int m_numMembers;
+	Int m_numDeadMembers;
+	Int m_kindOfCount[KINDOF_COUNT];			///< members of each KindOf
+	Int m_liveKindOfCount[KINDOF_COUNT];	///< members of each KindOf that are neither dead nor destroyed
+};
+
 // ------------------------------------------------------------------------
 class Team : public MemoryPoolObject,
 						 public Snapshot
@@ -230,6 +302,8 @@ private:
 
 	std::list< ObjectID > m_xferMemberIDList;			///< list for post processing and restoring object pointers after a load
 
+	TeamMemberCounts m_memberCounts;			///< incrementally maintained counts of the team members
+
 protected:
 
 	// snapshot methods
@@ -237,11 +311,24 @@ protected:
 	virtual void xfer( Xfer *xfer );
 	virtual void loadPostProcess( void );
 
+#if defined(RTS_DEBUG)
+	/// compare the incremental member counts against a full walk of the member list
+	void validateMemberCounts() const;
+#endif
+
 public:
 
 	Team( TeamPrototype *proto, TeamID id );
 	// ~Team();
 
+	// these are intended for use ONLY by class Object, to keep the member counts up to date.
+	void friend_addMemberCount(const Object *obj, UnsignedByte state) { m_memberCounts.addMember(obj->getTemplate(), state); }
+	void friend_removeMemberCount(const Object *obj, UnsignedByte state) { m_memberCounts.removeMember(obj->getTemplate(), state); }
+	void friend_changeMemberCountState(const Object *obj, UnsignedByte oldState, UnsignedByte newState) { m_memberCounts.changeMemberState(obj->getTemplate(), oldState, newState); }
+
+	/// return the number of team members that are not effectively dead.
+	Int getNumLiveMembers() const { return m_memberCounts.getNumMembers() - m_memberCounts.getNumDeadMembers(); }
+
 	/// return the prototype used to create this team
 	const TeamPrototype *getPrototype( void ) { return m_proto; }
 
@@ -696,6 +783,9 @@ public:
 	/// return the TeamPrototype with the given name. if none exists, return null.
 	TeamPrototype *findTeamPrototype(const AsciiString& name);
 
+	/// changes whenever a TeamPrototype is added or removed, so lookups by name can be cached.
+	UnsignedInt getPrototypeGeneration() const { return m_prototypeGeneration; }
+
 	/// return TeamPrototype with matching ID.  if none exists NULL is returned
 	TeamPrototype *findTeamPrototypeByID( TeamPrototypeID id );
 
@@ -737,6 +827,7 @@ private:
 
 	TeamPrototypeMap m_prototypes;
 	TeamPrototypeID m_uniqueTeamPrototypeID;		///< used to assign unique ids to each team prototype
+	UnsignedInt m_prototypeGeneration;					///< see getPrototypeGeneration
 	TeamID m_uniqueTeamID;											///< used to assign unique team ids to each team instance
 
 };
@@ -633,6 +633,7 @@ public:
 protected:
 
 	void setOrRestoreTeam( Team* team, Bool restoring );
+	void updateTeamMemberState();	///< Keep the member counts of our team in sync with our status
 
 	void onDisabledEdge(Bool becomingDisabled);
 	// All of our cheating for radars and power go here.
@@ -662,6 +663,8 @@ protected:
 
 	void updateTriggerAreaFlags(void);
 	void setTriggerAreaFlagsForChangeInPosition(void);
+	Bool hasTriggerAreaInfo(const PolygonTrigger *pTrigger) const;
+	void enterTriggerArea(const PolygonTrigger *pTrigger, UnsignedInt now);
 
 	/// Look and unlook are protected.  They should be called from Object::reasonToLook.  Like Capture, or death.
 	void look();
@@ -807,6 +810,7 @@ private:
 #endif
 	UnsignedByte									m_scriptStatus;					///< status as set by scripting, corresponds to ORed ObjectScriptStatusBits
 	UnsignedByte									m_privateStatus;					///< status bits that are never directly accessible to outside world
+	UnsignedByte									m_teamMemberState;				///< TeamMemberCounts state bits this object is counted with in its team
 	Byte													m_numTriggerAreasActive;
 	Bool													m_singleUseCommandUsed;
 	Bool													m_isReceivingDifficultyBonus;
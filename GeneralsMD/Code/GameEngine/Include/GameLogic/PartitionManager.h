@@ -1227,8 +1227,19 @@ protected:
 class PartitionManager : public SubsystemInterface, public Snapshot
 {
 
+public:
+
+	/// A trigger area that overlaps a partition cell. See getTriggerAreasInCell.
+	struct TriggerAreaCellEntry
+	{
+		const PolygonTrigger *m_trigger;
+		Bool m_inside; ///< If true, every point of the cell is inside m_trigger.
+	};
+
 private:
 
+	typedef std::vector<TriggerAreaCellEntry> TriggerAreaCellEntryVec;
+
 #ifdef FASTER_GCO
 	typedef std::vector<ICoord2D>		OffsetVec;
 	typedef std::vector<OffsetVec>	RadiusVec;
@@ -1248,6 +1259,11 @@ private:
 
 	std::queue<SightingInfo *> m_pendingUndoShroudReveals;	///< Anything can queue up an Undo to happen later. This is a queue, because "later" is a constant
 
+	std::vector<Int>				m_triggerAreaCellStart;		///< First entry in m_triggerAreaCellEntries for each cell, with one extra element at the end.
+	TriggerAreaCellEntryVec	m_triggerAreaCellEntries;	///< Trigger areas of all cells, in the order of the polygon trigger list.
+	UnsignedInt							m_triggerAreaGeneration;	///< PolygonTrigger generation that the index was built for.
+	Bool										m_triggerAreaIndexValid;
+
 #ifdef FASTER_GCO
 	Int							m_maxGcoRadius;
 	RadiusVec				m_radiusVec;
@@ -1302,6 +1318,8 @@ protected:
 	friend void hLineAddValue(Int x1, Int x2, Int y, void *threatValueParms);
 	friend void hLineRemoveValue(Int x1, Int x2, Int y, void *threatValueParms);
 
+	void buildTriggerAreaIndex();
+
 	void processPendingUndoShroudRevealQueue(Bool considerTimestamp = TRUE);				///< keep popping and processing untill you get to one that is in the future
 	void resetPendingUndoShroudRevealQueue();					///< Just delete everything in the queue without doing anything with them
 
@@ -1336,6 +1354,13 @@ public:
 	/// return the number of PartitionCells in the y-dimension.
 	Int getCellCountY() { DEBUG_ASSERTCRASH(m_cellCountY != 0, ("partition not inited")); return m_cellCountY; }
 
+	/**
+		return the trigger areas that can contain points of the cell at the given position, in the order
+		of the polygon trigger list. Trigger areas that are not returned do not contain the position.
+		Returns NULL if the position is outside of the partition grid.
+	*/
+	const TriggerAreaCellEntry *getTriggerAreasInCell(const ICoord3D &pos, Int &count);
+
 	/// return the PartitionCell located at cell coordinates (x,y).
 	PartitionCell *getCellAt(Int x, Int y);
 	const PartitionCell *getCellAt(Int x, Int y) const;
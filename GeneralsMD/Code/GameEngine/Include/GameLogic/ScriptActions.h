@@ -30,6 +30,7 @@
 #pragma once
 
 class ScriptAction;
+class Parameter;
 class GameWindow;
 class	Team;
 class View;
@@ -99,75 +100,75 @@ protected:
 	void doDebugMessage(const AsciiString& msg, Bool pause);
 	void doPlaySoundEffect(const AsciiString& sound);
 	void doMoveCameraTo(const AsciiString& waypoint, Real sec, Real cameraStutterSec, Real easeIn, Real easeOut);
-	void doSetupCamera(const AsciiString& waypoint, Real zoom, Real pitch, const AsciiString& lookAtWaypoint);
+	void doSetupCamera(const Parameter *pWaypointParm, Real zoom, Real pitch, const Parameter *pLookAtWaypointParm);
 	void doRotateCamera(Real rotations, Real sec, Real easeIn, Real easeOut);
-	void doRotateCameraTowardObject(const AsciiString& unitName, Real sec, Real holdSec, Real easeIn, Real easeOut);
-	void doRotateCameraTowardWaypoint(const AsciiString& unitName, Real sec, Real easeIn, Real easeOut, Bool reverseRotation);
+	void doRotateCameraTowardObject(const Parameter *pUnitNameParm, Real sec, Real holdSec, Real easeIn, Real easeOut);
+	void doRotateCameraTowardWaypoint(const Parameter *pUnitNameParm, Real sec, Real easeIn, Real easeOut, Bool reverseRotation);
 	void doPitchCamera(Real pitch, Real sec, Real easeIn, Real easeOut);
 	void doZoomCamera(Real zoom, Real sec, Real easeIn, Real easeOut);
 	void doResetCamera(const AsciiString& waypoint, Real sec, Real easeIn, Real easeOut);
-	void doCameraFollowNamed(const AsciiString& unit, Bool snapToUnit);
+	void doCameraFollowNamed(const Parameter *pUnitParm, Bool snapToUnit);
 	void doStopCameraFollowUnit(void);
 
-	void doCameraTetherNamed(const AsciiString& unit, Bool snapToUnit, Real play);
+	void doCameraTetherNamed(const Parameter *pUnitParm, Bool snapToUnit, Real play);
 	void doCameraStopTetherNamed(void);
 	void doCameraSetDefault(Real pitch, Real angle, Real maxHeight);
 
 	void doOversizeTheTerrain(Int amount);
 	void doMoveCameraAlongWaypointPath(const AsciiString& waypoint, Real sec, Real cameraStutterSec, Real easeIn, Real easeOut);
-	void doPlaySoundEffectAt(const AsciiString& sound, const AsciiString& waypoint);
+	void doPlaySoundEffectAt(const AsciiString& sound, const Parameter *pWaypointParm);
 	void doVictory(void);
 	void doQuickVictory(void);
 	void doSetInfantryLightingOverride(Real setting);
-	void doDamageTeamMembers(const AsciiString& team, Real amount);
+	void doDamageTeamMembers(const Parameter *pTeamParm, Real amount);
 	void doModCameraMoveToSelection(void);
 	void doDefeat(void);
 	void doLocalDefeat(void);
-	void doMoveToWaypoint(const AsciiString& team, const AsciiString& waypoint);
-	void doNamedMoveToWaypoint(const AsciiString& unit, const AsciiString& waypoint);
-	void doSetTeamState(const AsciiString& team, const AsciiString& state);
-	void doCreateReinforcements(const AsciiString& team, const AsciiString& waypoint);
+	void doMoveToWaypoint(const Parameter *pTeamParm, const Parameter *pWaypointParm);
+	void doNamedMoveToWaypoint(const Parameter *pUnitParm, const Parameter *pWaypointParm);
+	void doSetTeamState(const Parameter *pTeamParm, const AsciiString& state);
+	void doCreateReinforcements(const AsciiString& team, const Parameter *pWaypointParm);
 	void doModCameraLookToward(const AsciiString& waypoint);
 	void doModCameraFinalLookToward(const AsciiString& waypoint);
-	void doCreateObject(const AsciiString& objectName, const AsciiString& thingName, const AsciiString& team, Coord3D *pos, Real angle);
-	void doAttack(const AsciiString& attackerName, const AsciiString& victimName);
-	void doNamedAttack(const AsciiString& attackerName, const AsciiString& victimName);
+	void doCreateObject(const AsciiString& objectName, const AsciiString& thingName, const Parameter *pTeamParm, Coord3D *pos, Real angle);
+	void doAttack(const Parameter *pAttackerNameParm, const Parameter *pVictimNameParm);
+	void doNamedAttack(const Parameter *pAttackerNameParm, const Parameter *pVictimNameParm);
 	void doBuildBuilding(const AsciiString& buildingType);
 	void doBuildSupplyCenter(const AsciiString& playerName, const AsciiString& buildingType, Int cash);
-	void doBuildObjectNearestTeam( const AsciiString& playerName, const AsciiString& buildingType, const AsciiString& teamName );
+	void doBuildObjectNearestTeam( const AsciiString& playerName, const AsciiString& buildingType, const Parameter *pTeamNameParm );
 	void doBuildUpgrade(const AsciiString& playerName, const AsciiString& upgrade);
 	void doBuildBaseDefense(Bool flank);
 	void doBuildBaseStructure(const AsciiString& buildingType, Bool flank);
-	void createUnitOnTeamAt(const AsciiString& unitName, const AsciiString& objType, const AsciiString& teamName, const AsciiString& waypoint);
-	void doNamedAttackArea(const AsciiString& unitName, const AsciiString& areaName);
-	void doNamedAttackTeam(const AsciiString& unitName, const AsciiString& teamName);
-	void doTeamAttackArea(const AsciiString& teamName, const AsciiString& areaName);
-	void doTeamAttackNamed(const AsciiString& teamName, const AsciiString& unitName);
-	void doNamedEnterNamed(const AsciiString& unitSrcName, const AsciiString& unitDestName);
-	void doTeamEnterNamed(const AsciiString& teamName, const AsciiString& unitDestName);
-	void doNamedExitAll(const AsciiString& unitName);
-	void doTeamExitAll(const AsciiString& teamName);
-  void doNamedSetGarrisonEvacDisposition(const AsciiString& unitName, UnsignedInt disp );
-	void doNamedFollowWaypoints(const AsciiString& unitName, const AsciiString& waypointName);
-	void doTeamFollowWaypoints(const AsciiString& teamName, const AsciiString& waypointName, Bool asTeam);
-	void doTeamFollowWaypointsExact(const AsciiString& teamName, const AsciiString& waypointName, Bool asTeam);
-	void doNamedFollowWaypointsExact(const AsciiString& unitName, const AsciiString& waypointName);
-	void doTeamFollowSkirmishApproachPath(const AsciiString& teamName, const AsciiString& waypointName, Bool asTeam);
-	void doTeamMoveToSkirmishApproachPath(const AsciiString& teamName, const AsciiString& waypointName);
-	void doNamedHunt(const AsciiString& unitName);
-	void doTeamHunt(const AsciiString& teamName);
-	void doTeamHuntWithCommandButton(const AsciiString& teamName, const AsciiString& commandButton);
+	void createUnitOnTeamAt(const AsciiString& unitName, const AsciiString& objType, const Parameter *pTeamNameParm, const Parameter *pWaypointParm);
+	void doNamedAttackArea(const Parameter *pUnitNameParm, const Parameter *pAreaNameParm);
+	void doNamedAttackTeam(const Parameter *pUnitNameParm, const Parameter *pTeamNameParm);
+	void doTeamAttackArea(const Parameter *pTeamNameParm, const Parameter *pAreaNameParm);
+	void doTeamAttackNamed(const Parameter *pTeamNameParm, const Parameter *pUnitNameParm);
+	void doNamedEnterNamed(const Parameter *pUnitSrcNameParm, const Parameter *pUnitDestNameParm);
+	void doTeamEnterNamed(const Parameter *pTeamNameParm, const Parameter *pUnitDestNameParm);
+	void doNamedExitAll(const Parameter *pUnitNameParm);
+	void doTeamExitAll(const Parameter *pTeamNameParm);
+  void doNamedSetGarrisonEvacDisposition(const Parameter *pUnitNameParm, UnsignedInt disp );
+	void doNamedFollowWaypoints(const Parameter *pUnitNameParm, const AsciiString& waypointName);
+	void doTeamFollowWaypoints(const Parameter *pTeamNameParm, const AsciiString& waypointName, Bool asTeam);
+	void doTeamFollowWaypointsExact(const Parameter *pTeamNameParm, const AsciiString& waypointName, Bool asTeam);
+	void doNamedFollowWaypointsExact(const Parameter *pUnitNameParm, const AsciiString& waypointName);
+	void doTeamFollowSkirmishApproachPath(const Parameter *pTeamNameParm, const AsciiString& waypointName, Bool asTeam);
+	void doTeamMoveToSkirmishApproachPath(const Parameter *pTeamNameParm, const AsciiString& waypointName);
+	void doNamedHunt(const Parameter *pUnitNameParm);
+	void doTeamHunt(const Parameter *pTeamNameParm);
+	void doTeamHuntWithCommandButton(const Parameter *pTeamNameParm, const AsciiString& commandButton);
 	void doPlayerHunt(const AsciiString& playerName);
-	void doNamedDelete(const AsciiString& unitName);
+	void doNamedDelete(const Parameter *pUnitNameParm);
 
-	void doTeamGarrisonSpecificBuilding(const AsciiString& teamName, const AsciiString& buildingName);
-	void doTeamGarrisonNearestBuilding(const AsciiString& teamName);
-	void doTeamExitAllBuildings(const AsciiString& teamName);
-	void doExitSpecificBuilding(const AsciiString& buildingName);
+	void doTeamGarrisonSpecificBuilding(const Parameter *pTeamNameParm, const Parameter *pBuildingNameParm);
+	void doTeamGarrisonNearestBuilding(const Parameter *pTeamNameParm);
+	void doTeamExitAllBuildings(const Parameter *pTeamNameParm);
+	void doExitSpecificBuilding(const Parameter *pBuildingNameParm);
 
-	void doUnitGarrisonSpecificBuilding(const AsciiString& unitName, const AsciiString& buildingName);
-	void doUnitGarrisonNearestBuilding(const AsciiString& unitName);
-	void doUnitExitBuilding(const AsciiString& unitName);
+	void doUnitGarrisonSpecificBuilding(const Parameter *pUnitNameParm, const Parameter *pBuildingNameParm);
+	void doUnitGarrisonNearestBuilding(const Parameter *pUnitNameParm);
+	void doUnitExitBuilding(const Parameter *pUnitNameParm);
 
 	void doPlayerGarrisonAllBuildings(const AsciiString& playerName);
 	void doPlayerExitAllBuildings(const AsciiString& playerName);
@@ -182,30 +183,30 @@ protected:
 	void doMilitaryCaption(const AsciiString& briefing, Int duration);
 	void doCameraSetAudibleDistance(Real audibleDistance);
 
-	void doNamedSetHeld(const AsciiString& unit, Bool held);
+	void doNamedSetHeld(const Parameter *pUnitParm, Bool held);
 
-	void doNamedSetStoppingDistance(const AsciiString& unit, Real stoppingDistance);
-	void doSetStoppingDistance(const AsciiString& team, Real stoppingDistance);
+	void doNamedSetStoppingDistance(const Parameter *pUnitParm, Real stoppingDistance);
+	void doSetStoppingDistance(const Parameter *pTeamParm, Real stoppingDistance);
 
 	void doDisableSpecialPowerDisplay( void );
 	void doEnableSpecialPowerDisplay( void );
-	void doNamedHideSpecialPowerDisplay( const AsciiString& unit );
-	void doNamedShowSpecialPowerDisplay( const AsciiString& unit );
-
-	void doNamedStopSpecialPowerCountdown( const AsciiString& unit, const AsciiString& specialPower, Bool stop );
-	void doNamedSetSpecialPowerCountdown( const AsciiString& unit, const AsciiString& specialPower, Int frames );
-	void doNamedAddSpecialPowerCountdown( const AsciiString& unit, const AsciiString& specialPower, Int frames );
-	void doNamedFireSpecialPowerAtWaypoint( const AsciiString& unit, const AsciiString& specialPower, const AsciiString& waypoint );
-	void doNamedFireSpecialPowerAtNamed( const AsciiString& unit, const AsciiString& specialPower, const AsciiString& target );
+	void doNamedHideSpecialPowerDisplay( const Parameter *pUnitParm );
+	void doNamedShowSpecialPowerDisplay( const Parameter *pUnitParm );
+
+	void doNamedStopSpecialPowerCountdown( const Parameter *pUnitParm, const AsciiString& specialPower, Bool stop );
+	void doNamedSetSpecialPowerCountdown( const Parameter *pUnitParm, const AsciiString& specialPower, Int frames );
+	void doNamedAddSpecialPowerCountdown( const Parameter *pUnitParm, const AsciiString& specialPower, Int frames );
+	void doNamedFireSpecialPowerAtWaypoint( const Parameter *pUnitParm, const AsciiString& specialPower, const Parameter *pWaypointParm );
+	void doNamedFireSpecialPowerAtNamed( const Parameter *pUnitParm, const AsciiString& specialPower, const Parameter *pTargetParm );
 	void doSkirmishFireSpecialPowerAtMostCost( const AsciiString& player, const AsciiString& specialPower );
-	void doNamedFireWeaponFollowingWaypointPath( const AsciiString& unit, const AsciiString& waypointPath );
-	void doNamedUseCommandButtonAbility( const AsciiString& unit, const AsciiString& ability );
-	void doNamedUseCommandButtonAbilityOnNamed( const AsciiString& unit, const AsciiString& ability, const AsciiString& target );
-	void doNamedUseCommandButtonAbilityAtWaypoint( const AsciiString& unit, const AsciiString& ability, const AsciiString& waypoint );
-	void doNamedUseCommandButtonAbilityUsingWaypointPath( const AsciiString& unit, const AsciiString& ability, const AsciiString& waypointPath );
-	void doTeamUseCommandButtonAbility( const AsciiString& team, const AsciiString& ability );
-	void doTeamUseCommandButtonAbilityOnNamed( const AsciiString& team, const AsciiString& ability, const AsciiString& target );
-	void doTeamUseCommandButtonAbilityAtWaypoint( const AsciiString& team, const AsciiString& ability, const AsciiString& waypoint );
+	void doNamedFireWeaponFollowingWaypointPath( const Parameter *pUnitParm, const AsciiString& waypointPath );
+	void doNamedUseCommandButtonAbility( const Parameter *pUnitParm, const AsciiString& ability );
+	void doNamedUseCommandButtonAbilityOnNamed( const Parameter *pUnitParm, const AsciiString& ability, const Parameter *pTargetParm );
+	void doNamedUseCommandButtonAbilityAtWaypoint( const Parameter *pUnitParm, const AsciiString& ability, const Parameter *pWaypointParm );
+	void doNamedUseCommandButtonAbilityUsingWaypointPath( const Parameter *pUnitParm, const AsciiString& ability, const AsciiString& waypointPath );
+	void doTeamUseCommandButtonAbility( const Parameter *pTeamParm, const AsciiString& ability );
+	void doTeamUseCommandButtonAbilityOnNamed( const Parameter *pTeamParm, const AsciiString& ability, const Parameter *pTargetParm );
+	void doTeamUseCommandButtonAbilityAtWaypoint( const Parameter *pTeamParm, const AsciiString& ability, const Parameter *pWaypointParm );
 
 	void doDisplayCountdownTimer(const AsciiString& timerName, const AsciiString& timerText);
 	void doHideCountdownTimer(const AsciiString& timerName);
@@ -217,72 +218,72 @@ protected:
 
 	void doAudioSetVolume(AudioAffect whichToAffect, Real newVolumeLevel);
 
-	void doTransferTeamToPlayer(const AsciiString& teamName, const AsciiString& playerName);
+	void doTransferTeamToPlayer(const Parameter *pTeamNameParm, const AsciiString& playerName);
 
 	void doSetMoney(const AsciiString& playerName, Int money);		// Set a player's cash reserves to a specific value.
 	void doGiveMoney(const AsciiString& playerName, Int money);	// Add/subtract cash from a player's reserves.
 
-	void updateNamedAttackPrioritySet(const AsciiString& unitName, const AsciiString& attackPrioritySet);
-	void updateTeamAttackPrioritySet(const AsciiString& teamName, const AsciiString& attackPrioritySet);
+	void updateNamedAttackPrioritySet(const Parameter *pUnitNameParm, const AsciiString& attackPrioritySet);
+	void updateTeamAttackPrioritySet(const Parameter *pTeamNameParm, const AsciiString& attackPrioritySet);
 	void updateBaseConstructionSpeed(const AsciiString& playerName, Int speed);
-	void updateNamedSetAttitude(const AsciiString& unitName, Int attitude);
-	void updateTeamSetAttitude(const AsciiString& teamName, Int attitude);
-	void doNamedSetRepulsor(const AsciiString& unitName, Bool repulsor);
-	void doTeamSetRepulsor(const AsciiString& teamName, Bool repulsor);
-	void doLoadAllTransports(const AsciiString& teamName);
-	void doNamedGuard(const AsciiString& unitName);
-	void doTeamGuard(const AsciiString& teamName);
-	void doTeamGuardPosition(const AsciiString& teamName, const AsciiString& waypointName);
-	void doTeamGuardObject(const AsciiString& teamName, const AsciiString& unitName);
-	void doTeamGuardArea(const AsciiString& teamName, const AsciiString& areaName);
+	void updateNamedSetAttitude(const Parameter *pUnitNameParm, Int attitude);
+	void updateTeamSetAttitude(const Parameter *pTeamNameParm, Int attitude);
+	void doNamedSetRepulsor(const Parameter *pUnitNameParm, Bool repulsor);
+	void doTeamSetRepulsor(const Parameter *pTeamNameParm, Bool repulsor);
+	void doLoadAllTransports(const Parameter *pTeamNameParm);
+	void doNamedGuard(const Parameter *pUnitNameParm);
+	void doTeamGuard(const Parameter *pTeamNameParm);
+	void doTeamGuardPosition(const Parameter *pTeamNameParm, const Parameter *pWaypointNameParm);
+	void doTeamGuardObject(const Parameter *pTeamNameParm, const Parameter *pUnitNameParm);
+	void doTeamGuardArea(const Parameter *pTeamNameParm, const Parameter *pAreaNameParm);
 	void doPlayerSellEverything(const AsciiString& playerName);
 	void doPlayerDisableBaseConstruction(const AsciiString& playerName);
 	void doPlayerDisableFactories(const AsciiString& playerName, const AsciiString& objectName);
 	void doPlayerDisableUnitConstruction(const AsciiString& playerName);
 	void doPlayerEnableBaseConstruction(const AsciiString& playerName);
 	void doPlayerEnableFactories(const AsciiString& playerName, const AsciiString& objectName);
-	void doPlayerRepairStructure(const AsciiString& playerName, const AsciiString& objectName);
+	void doPlayerRepairStructure(const AsciiString& playerName, const Parameter *pObjectNameParm);
 	void doPlayerEnableUnitConstruction(const AsciiString& playerName);
 	void doCameraMoveHome(void);
 	void doBuildTeam(const AsciiString& teamName);
 	void doRecruitTeam(const AsciiString& teamName, Real recrutiRadius);
-	void doNamedDamage(const AsciiString& unitName, Int damageAmt);
-	void doTeamDelete(const AsciiString& teamName, Bool ignoreDead);
-	void doTeamIncreasePriority(const AsciiString& teamName);
-	void doTeamDecreasePriority(const AsciiString& teamName);
-	void doTeamWander(const AsciiString& teamName, const AsciiString& waypointName);
-	void doTeamPanic(const AsciiString& teamName, const AsciiString& waypointName);
-	void doTeamWanderInPlace(const AsciiString& teamName);
-	void doNamedKill(const AsciiString& unitName);
-	void doTeamKill(const AsciiString& teamName);
+	void doNamedDamage(const Parameter *pUnitNameParm, Int damageAmt);
+	void doTeamDelete(const Parameter *pTeamNameParm, Bool ignoreDead);
+	void doTeamIncreasePriority(const Parameter *pTeamNameParm);
+	void doTeamDecreasePriority(const Parameter *pTeamNameParm);
+	void doTeamWander(const Parameter *pTeamNameParm, const AsciiString& waypointName);
+	void doTeamPanic(const Parameter *pTeamNameParm, const AsciiString& waypointName);
+	void doTeamWanderInPlace(const Parameter *pTeamNameParm);
+	void doNamedKill(const Parameter *pUnitNameParm);
+	void doTeamKill(const Parameter *pTeamNameParm);
 	void doPlayerKill(const AsciiString& playerName);
 	void doDisplayText(const AsciiString& displayText);
 	void doDisplayCinematicText(const AsciiString& displayText, const AsciiString& fontType, Int timeInSeconds);
 	void doCameoFlash(const AsciiString& cameoFlash, Int timeInSeconds);
-	void doNamedFlash(const AsciiString& unitName, Int timeInSeconds, const RGBColor *color);
-	void doNamedCustomColor(const AsciiString& unitName, Color c);
-	void doTeamFlash(const AsciiString& teamName, Int timeInSeconds, const RGBColor *color);
+	void doNamedFlash(const Parameter *pUnitNameParm, Int timeInSeconds, const RGBColor *color);
+	void doNamedCustomColor(const Parameter *pUnitNameParm, Color c);
+	void doTeamFlash(const Parameter *pTeamNameParm, Int timeInSeconds, const RGBColor *color);
 	void doMoviePlayFullScreen(const AsciiString& movieName);
 	void doMoviePlayRadar(const AsciiString& movieName);
-	void doSoundPlayFromNamed(const AsciiString& soundName, const AsciiString& unitName);
+	void doSoundPlayFromNamed(const AsciiString& soundName, const Parameter *pUnitNameParm);
 	void doSpeechPlay(const AsciiString& speechName, Bool allowOverlap);
 	void doPlayerTransferAssetsToPlayer(const AsciiString& playerSrcName, const AsciiString& playerDstName);
-	void doNamedTransferAssetsToPlayer(const AsciiString& unitName, const AsciiString& playerDstName);
+	void doNamedTransferAssetsToPlayer(const Parameter *pUnitNameParm, const AsciiString& playerDstName);
 	void excludePlayerFromScoreScreen(const AsciiString& playerName);
 	void enableScoring(Bool score);
 	void updatePlayerRelationTowardPlayer(const AsciiString& playerSrcName, Int relationType, const AsciiString& playerDestPlayer);
 	void doRadarCreateEvent(Coord3D *pos, Int eventType);
 	void doRadarDisable(void);
 	void doRadarEnable(void);
-	void doNamedEnableStealth(const AsciiString& unitName, Bool enabled);
-	void doTeamEnableStealth(const AsciiString& teamName, Bool enabled);
-	void doNamedSetUnmanned( const AsciiString& unitName );
-	void doTeamSetUnmanned( const AsciiString& teamName );
-	void doNamedSetBoobytrapped( const AsciiString& thingTemplateName, const AsciiString& unitName );
-	void doTeamSetBoobytrapped( const AsciiString& thingTemplateName, const AsciiString& teamName );
-	void doRevealMapAtWaypoint(const AsciiString& waypointName, Real radiusToReveal, const AsciiString& playerName);
-	void doShroudMapAtWaypoint(const AsciiString& waypointName, Real radiusToShroud, const AsciiString& playerName);
-	void doTeamAvailableForRecruitment(const AsciiString& teamName, Bool availability);
+	void doNamedEnableStealth(const Parameter *pUnitNameParm, Bool enabled);
+	void doTeamEnableStealth(const Parameter *pTeamNameParm, Bool enabled);
+	void doNamedSetUnmanned( const Parameter *pUnitNameParm );
+	void doTeamSetUnmanned( const Parameter *pTeamNameParm );
+	void doNamedSetBoobytrapped( const AsciiString& thingTemplateName, const Parameter *pUnitNameParm );
+	void doTeamSetBoobytrapped( const AsciiString& thingTemplateName, const Parameter *pTeamNameParm );
+	void doRevealMapAtWaypoint(const Parameter *pWaypointNameParm, Real radiusToReveal, const AsciiString& playerName);
+	void doShroudMapAtWaypoint(const Parameter *pWaypointNameParm, Real radiusToShroud, const AsciiString& playerName);
+	void doTeamAvailableForRecruitment(const Parameter *pTeamNameParm, Bool availability);
 	void doCollectNearbyForTeam(const AsciiString& teamName);
 	void doMergeTeamIntoTeam(const AsciiString& teamSrcName, const AsciiString& teamDestName);
 	void doIdleAllPlayerUnits(const AsciiString& playerName);
@@ -296,60 +297,60 @@ protected:
 	void doRevealMapEntirePermanently( Bool reveal, const AsciiString& playerName );
 	void doShroudMapEntire(const AsciiString& playerName);
 	void doCameraMotionBlur(Bool zoomIn, Bool saturate);
-	void doCameraMotionBlurJump(const AsciiString& waypointName, Bool saturate);
+	void doCameraMotionBlurJump(const Parameter *pWaypointNameParm, Bool saturate);
 	void doRadarRefresh( void );
-	void doNamedStop(const AsciiString& unitName);
-	void doTeamStop(const AsciiString& teamName, Bool shouldDisband);
-	void doTeamSetOverrideRelationToTeam(const AsciiString& teamName, const AsciiString& otherTeam, Int relation);
-	void doTeamRemoveOverrideRelationToTeam(const AsciiString& teamName, const AsciiString& otherTeam);
-	void doTeamSetOverrideRelationToPlayer(const AsciiString& teamName, const AsciiString& otherPlayer, Int relation);
-	void doTeamRemoveOverrideRelationToPlayer(const AsciiString& teamName, const AsciiString& otherPlayer);
-	void doPlayerSetOverrideRelationToTeam(const AsciiString& playerName, const AsciiString& otherTeam, Int relation);
-	void doPlayerRemoveOverrideRelationToTeam(const AsciiString& playerName, const AsciiString& otherTeam);
-	void doTeamRemoveAllOverrideRelations(const AsciiString& teamName);
-	void doUnitStartSequentialScript(const AsciiString& unitName, const AsciiString& scriptName, Int loopVal);
-	void doUnitStopSequentialScript(const AsciiString& unitName);
-	void doTeamStartSequentialScript(const AsciiString& teamName, const AsciiString& scriptName, Int loopVal);
-	void doTeamStopSequentialScript(const AsciiString& teamName);
-	void doUnitGuardForFramecount(const AsciiString& unitName, Int framecount);
-	void doUnitIdleForFramecount(const AsciiString& unitName, Int framecount);
+	void doNamedStop(const Parameter *pUnitNameParm);
+	void doTeamStop(const Parameter *pTeamNameParm, Bool shouldDisband);
+	void doTeamSetOverrideRelationToTeam(const Parameter *pTeamNameParm, const Parameter *pOtherTeamParm, Int relation);
+	void doTeamRemoveOverrideRelationToTeam(const Parameter *pTeamNameParm, const Parameter *pOtherTeamParm);
+	void doTeamSetOverrideRelationToPlayer(const Parameter *pTeamNameParm, const AsciiString& otherPlayer, Int relation);
+	void doTeamRemoveOverrideRelationToPlayer(const Parameter *pTeamNameParm, const AsciiString& otherPlayer);
+	void doPlayerSetOverrideRelationToTeam(const AsciiString& playerName, const Parameter *pOtherTeamParm, Int relation);
+	void doPlayerRemoveOverrideRelationToTeam(const AsciiString& playerName, const Parameter *pOtherTeamParm);
+	void doTeamRemoveAllOverrideRelations(const Parameter *pTeamNameParm);
+	void doUnitStartSequentialScript(const Parameter *pUnitNameParm, const AsciiString& scriptName, Int loopVal);
+	void doUnitStopSequentialScript(const Parameter *pUnitNameParm);
+	void doTeamStartSequentialScript(const Parameter *pTeamNameParm, const AsciiString& scriptName, Int loopVal);
+	void doTeamStopSequentialScript(const Parameter *pTeamNameParm);
+	void doUnitGuardForFramecount(const Parameter *pUnitNameParm, Int framecount);
+	void doUnitIdleForFramecount(const Parameter *pUnitNameParm, Int framecount);
 	void doTeamGuardForFramecount(const AsciiString& teamName, Int framecount);
-	void doTeamIdleForFramecount(const AsciiString& teamName, Int framecount);
+	void doTeamIdleForFramecount(const Parameter *pTeamNameParm, Int framecount);
 	void doWaterChangeHeight(const AsciiString& waterName, Real newHeight);
 	void doWaterChangeHeightOverTime( const AsciiString& waterName, Real newHeight, Real time, Real damage );
 	void doBorderSwitch(Int borderToUse);
-	void doForceObjectSelection(const AsciiString& teamName, const AsciiString& objectType, Bool centerInView, const AsciiString& audioToPlay);
-	void doDestroyAllContained(const AsciiString& unitName, Int damageType);
+	void doForceObjectSelection(const Parameter *pTeamNameParm, const AsciiString& objectType, Bool centerInView, const AsciiString& audioToPlay);
+	void doDestroyAllContained(const Parameter *pUnitNameParm, Int damageType);
 	void doRadarForceEnable(void);
 	void doRadarRevertNormal(void);
 	void doScreenShake( UnsignedInt intensity );
 	void doModifyBuildableStatus( const AsciiString& objectType, Int buildableStatus );
-	void doSetWarehouseValue( const AsciiString& warehouseName, Int cashValue );
-	void doSetCaveIndex( const AsciiString& caveName, Int caveIndex );
-	void doObjectRadarCreateEvent( const AsciiString& unitName, Int eventType );
-	void doTeamRadarCreateEvent( const AsciiString& teamName, Int eventType );
+	void doSetWarehouseValue( const Parameter *pWarehouseNameParm, Int cashValue );
+	void doSetCaveIndex( const Parameter *pCaveNameParm, Int caveIndex );
+	void doObjectRadarCreateEvent( const Parameter *pUnitNameParm, Int eventType );
+	void doTeamRadarCreateEvent( const Parameter *pTeamNameParm, Int eventType );
 	void doSoundEnableType( const AsciiString& soundEventName, Bool enable );
 	void doSoundRemoveType( const AsciiString& soundEventName );
 	void doSoundRemoveAllDisabled();
 	void doSoundOverrideVolume( const AsciiString& soundEventName, Real newVolume );
 	void doInGamePopupMessage( const AsciiString& message, Int x, Int y, Int width, Bool pause );
 	void doSetToppleDirection( const AsciiString& unitName, const Coord3D* direction);
-	void doMoveUnitTowardsNearest( const AsciiString& unitName, const AsciiString& objectType, AsciiString triggerName);
-	void doMoveTeamTowardsNearest( const AsciiString& teamName, const AsciiString& objectType, AsciiString triggerName);
-	void doUnitReceiveUpgrade( const AsciiString& unitName, const AsciiString& upgradeName );
-	void doSkirmishAttackNearestGroupWithValue( const AsciiString& teamName, Int comparison, Int value );
-	void doSkirmishCommandButtonOnMostValuable( const AsciiString& teamName, const AsciiString& commandButton, Real range, Bool allTeamMembers);
-	void doTeamSpinForFramecount( const AsciiString& teamName, Int waitForFrames );
-	void doTeamUseCommandButtonOnNamed( const AsciiString& teamName, const AsciiString& commandAbility, const AsciiString& unitName );
-	void doTeamUseCommandButtonOnNearestEnemy( const AsciiString& teamName, const AsciiString& commandAbility );
-	void doTeamUseCommandButtonOnNearestGarrisonedBuilding( const AsciiString& teamName, const AsciiString& commandAbility );
-	void doTeamUseCommandButtonOnNearestKindof( const AsciiString& teamName, const AsciiString& commandAbility, Int kindofBit );
-	void doTeamUseCommandButtonOnNearestBuilding( const AsciiString& teamName, const AsciiString& commandAbility );
-	void doTeamUseCommandButtonOnNearestBuildingClass( const AsciiString& teamName, const AsciiString& commandAbility, Int kindofBit );
-	void doTeamUseCommandButtonOnNearestObjectType( const AsciiString& teamName, const AsciiString& commandAbility, const AsciiString& objectType );
-	void doTeamPartialUseCommandButton( Real percentage, const AsciiString& teamName, const AsciiString& commandAbility );
-	void doTeamCaptureNearestUnownedFactionUnit( const AsciiString& teamName );
-	void doCreateTeamFromCapturedUnits( const AsciiString& playerName, const AsciiString& teamName );
+	void doMoveUnitTowardsNearest( const Parameter *pUnitNameParm, const Parameter *pObjectTypeParm, const Parameter *pTriggerNameParm);
+	void doMoveTeamTowardsNearest( const Parameter *pTeamNameParm, const Parameter *pObjectTypeParm, const Parameter *pTriggerNameParm);
+	void doUnitReceiveUpgrade( const Parameter *pUnitNameParm, const AsciiString& upgradeName );
+	void doSkirmishAttackNearestGroupWithValue( const Parameter *pTeamNameParm, Int comparison, Int value );
+	void doSkirmishCommandButtonOnMostValuable( const Parameter *pTeamNameParm, const AsciiString& commandButton, Real range, Bool allTeamMembers);
+	void doTeamSpinForFramecount( const Parameter *pTeamNameParm, Int waitForFrames );
+	void doTeamUseCommandButtonOnNamed( const Parameter *pTeamNameParm, const AsciiString& commandAbility, const Parameter *pUnitNameParm );
+	void doTeamUseCommandButtonOnNearestEnemy( const Parameter *pTeamNameParm, const AsciiString& commandAbility );
+	void doTeamUseCommandButtonOnNearestGarrisonedBuilding( const Parameter *pTeamNameParm, const AsciiString& commandAbility );
+	void doTeamUseCommandButtonOnNearestKindof( const Parameter *pTeamNameParm, const AsciiString& commandAbility, Int kindofBit );
+	void doTeamUseCommandButtonOnNearestBuilding( const Parameter *pTeamNameParm, const AsciiString& commandAbility );
+	void doTeamUseCommandButtonOnNearestBuildingClass( const Parameter *pTeamNameParm, const AsciiString& commandAbility, Int kindofBit );
+	void doTeamUseCommandButtonOnNearestObjectType( const Parameter *pTeamNameParm, const AsciiString& commandAbility, const Parameter *pObjectTypeParm );
+	void doTeamPartialUseCommandButton( Real percentage, const Parameter *pTeamNameParm, const AsciiString& commandAbility );
+	void doTeamCaptureNearestUnownedFactionUnit( const Parameter *pTeamNameParm );
+	void doCreateTeamFromCapturedUnits( const AsciiString& playerName, const Parameter *pTeamNameParm );
 	void doPlayerAddSkillPoints(const AsciiString& playerName, Int delta);
 	void doPlayerAddRankLevels(const AsciiString& playerName, Int delta);
 	void doPlayerSetRankLevel(const AsciiString& playerName, Int level);
@@ -357,8 +358,8 @@ protected:
 	void doPlayerGrantScience(const AsciiString& playerName, const AsciiString& scienceName);
 	void doPlayerPurchaseScience(const AsciiString& playerName, const AsciiString& scienceName);
 	void doPlayerSetScienceAvailability( const AsciiString& playerName, const AsciiString& scienceName, const AsciiString& scienceAvailability );
-	void doTeamEmoticon(const AsciiString& teamName, const AsciiString& emoticonName, Real duration);
-	void doNamedEmoticon(const AsciiString& unitName, const AsciiString& emoticonName, Real duration);
+	void doTeamEmoticon(const Parameter *pTeamNameParm, const AsciiString& emoticonName, Real duration);
+	void doNamedEmoticon(const Parameter *pUnitNameParm, const AsciiString& emoticonName, Real duration);
 	void doObjectTypeListMaintenance(const AsciiString& objectList, const AsciiString& objectType, Bool addObject);
 	void doRevealMapAtWaypointPermanent(const AsciiString& waypointName, Real radiusToReveal, const AsciiString& playerName, const AsciiString& lookName);
 	void doUndoRevealMapAtWaypointPermanent(const AsciiString& lookName);
@@ -368,23 +369,23 @@ protected:
 	void doSetDrawIconUIMode(Bool setEnabled);
 	void doC3CameraDisableSlaveMode( void );
 	void doSetDynamicLODMode(Bool setEnabled);
-	void doAffectObjectPanelFlagsUnit(const AsciiString& unitName, const AsciiString& flagName, Bool enable);
-	void doAffectObjectPanelFlagsTeam(const AsciiString& teamName, const AsciiString& flagName, Bool enable);
-	void doGuardSupplyCenter(const AsciiString& teamName, Int supplies);
-	void doTeamGuardInTunnelNetwork(const AsciiString& teamName);
+	void doAffectObjectPanelFlagsUnit(const Parameter *pUnitNameParm, const AsciiString& flagName, Bool enable);
+	void doAffectObjectPanelFlagsTeam(const Parameter *pTeamNameParm, const AsciiString& flagName, Bool enable);
+	void doGuardSupplyCenter(const Parameter *pTeamNameParm, Int supplies);
+	void doTeamGuardInTunnelNetwork(const Parameter *pTeamNameParm);
 	void doAffectPlayerSkillset(const AsciiString& playerName, Int skillset);
-	void doC3CameraShake( const AsciiString &waypointName, Real amplitude, Real duration_seconds, Real radius );
+	void doC3CameraShake( const Parameter *pWaypointNameParm, Real amplitude, Real duration_seconds, Real radius );
 	void doOverrideHulkLifetime( Real seconds );
-	void doNamedFaceNamed( const AsciiString &unitName, const AsciiString &faceUnitName );
-	void doNamedFaceWaypoint( const AsciiString &unitName, const AsciiString &faceWaypointName );
-	void doTeamFaceNamed( const AsciiString &teamName, const AsciiString &faceUnitName );
-	void doTeamFaceWaypoint( const AsciiString &teamName, const AsciiString &faceWaypointName );
+	void doNamedFaceNamed( const Parameter *pUnitNameParm, const Parameter *pFaceUnitNameParm );
+	void doNamedFaceWaypoint( const Parameter *pUnitNameParm, const Parameter *pFaceWaypointNameParm );
+	void doTeamFaceNamed( const Parameter *pTeamNameParm, const Parameter *pFaceUnitNameParm );
+	void doTeamFaceWaypoint( const Parameter *pTeamNameParm, const Parameter *pFaceWaypointNameParm );
 	void doRemoveCommandBarButton(const AsciiString& commandBarButton, const AsciiString& objectType);
 	void doAddCommandBarButton(const AsciiString& commandBarButton, const AsciiString& objectType, Int slotNum);
 	void doAffectSkillPointsModifier(const AsciiString& playerName, Real newModifier);
 	void doResizeViewGuardband(const Real gbx, const Real gby );
 	void deleteAllUnmanned();
-	void doNamedSetTrainHeld( const AsciiString &locoName, const Bool set );
-  void doEnableObjectSound(const AsciiString& objectName, Bool enable);
+	void doNamedSetTrainHeld( const Parameter *pLocoNameParm, const Bool set );
+  void doEnableObjectSound(const Parameter *pObjectNameParm, Bool enable);
 
 };
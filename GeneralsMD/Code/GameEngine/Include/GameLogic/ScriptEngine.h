@@ -41,11 +41,14 @@ class DataChunkInput;
 struct DataChunkInfo;
 class DataChunkOutput;
 class Team;
+class TeamPrototype;
 class Object;
 class ThingTemplate;
 class Player;
 class PolygonTrigger;
+class Waypoint;
 class ObjectTypes;
+class ScriptProfiler;
 
 #ifdef RTS_PROFILE
 #define SPECIAL_SCRIPT_PROFILING
@@ -247,6 +250,7 @@ public:
 	virtual void runScript(const AsciiString& scriptName, Team *pThisTeam=NULL); ///<  Runs a script.
 	virtual void runObjectScript(const AsciiString& scriptName, Object *pThisObject=NULL); ///<  Runs a script attached to this object.
 	virtual Team *getTeamNamed(const AsciiString& teamName); ///<  Gets the named team.  May be null.
+	Team *getTeamNamed(const Parameter *pTeamParm); ///< Same as above, but caches the team prototype lookup on the parameter.
 	virtual Player *getSkirmishEnemyPlayer(void); ///< Gets the ai's enemy Human player. May be null.
 	virtual Player *getCurrentPlayer(void); ///<  Gets the player that owns the current script.  May be null.
 	virtual Player *getPlayerFromAsciiString(const AsciiString& skirmishPlayerString);
@@ -263,10 +267,15 @@ public:
 	// NOTE NOTE NOTE: do not store of the return value of this call (getObjectTypeList) beyond the life of the
 	// function it will be used in, as it can be deleted from under you if maintenance is performed on the object.
 	virtual ObjectTypes *getObjectTypes(const AsciiString& objectTypeList);
+	ObjectTypes *getObjectTypes(const Parameter *pTypesParm); ///< Same as above, but caches the lookup on the parameter.
 	virtual void doObjectTypeListMaintenance(const AsciiString& objectTypeList, const AsciiString& objectType, Bool addObject);
 
 	/// Return the trigger area with the given name
 	virtual PolygonTrigger *getQualifiedTriggerAreaByName( AsciiString name );
+	PolygonTrigger *getQualifiedTriggerAreaByName( const Parameter *pTriggerParm ); ///< Same as above, but caches the lookup on the parameter.
+
+	/// Return the waypoint named by the parameter, and cache the lookup on the parameter.
+	Waypoint *getWaypointByName( const Parameter *pWaypointParm );
 
 	// For other systems to evaluate Conditions, execute Actions, etc.
 
@@ -275,6 +284,7 @@ public:
 	virtual void friend_executeAction( ScriptAction *pActionHead, Team *pThisTeam = NULL);	///< Use this at yer peril.
 
 	virtual Object *getUnitNamed(const AsciiString& unitName); ///< Gets the named unit. May be null.
+	Object *getUnitNamed(const Parameter *pUnitParm); ///< Same as above, but caches the lookup on the parameter.
 	virtual Bool didUnitExist(const AsciiString& unitName);
 	virtual void addObjectToCache( Object* pNewObject );
 	virtual void removeObjectFromCache( Object* pDeadObject );
@@ -392,6 +402,7 @@ protected:
 	Bool evaluateFlag( Condition *pCondition );
 	Bool evaluateTimer( Condition *pCondition );
 	Bool evaluateCondition( Condition *pCondition );
+	Bool evaluateConditionInternal( Condition *pCondition );
 	void executeActions( ScriptAction *pActionHead );
 
 	void setPriorityThing( ScriptAction *pAction );
@@ -406,6 +417,10 @@ protected:
 
 	AttackPriorityInfo *findAttackInfo(const AsciiString& name, Bool addIfNotFound);
 
+	// Helpers for getTeamNamed.
+	Bool getContextTeamNamed(const AsciiString& teamName, Team **team);
+	Team *getTeamFromPrototype(const AsciiString& teamName, TeamPrototype *teamProto);
+
 protected:
 	/// Stuff to execute scripts sequentially
 	typedef std::vector<SequentialScript*> VecSequentialScriptPtr;
@@ -438,6 +453,7 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+	UnsignedInt				m_namedObjectsGeneration;		///< Changes whenever m_namedObjects changes, see Parameter::getResolvedHandle
 	Bool							m_firstUpdate;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
@@ -478,11 +494,14 @@ protected:
 
 	Bool							m_freezeByScript;
 	AllObjectTypes		m_allObjectTypeLists;
+	UnsignedInt				m_objectTypeListsGeneration;	///< Changes whenever m_allObjectTypeLists changes, see Parameter::getResolvedHandle
 	Bool							m_objectsShouldReceiveDifficultyBonus;
 	Bool							m_ChooseVictimAlwaysUsesNormal;
 
 	Bool							m_shownMPLocalDefeatWindow;
 
+	ScriptProfiler		*m_profiler;			///< Only allocated when script profiling is enabled.
+
 #ifdef SPECIAL_SCRIPT_PROFILING
 #ifdef DEBUG_LOGGING
 	double						m_numFrames;
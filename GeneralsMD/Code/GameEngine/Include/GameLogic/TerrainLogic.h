@@ -259,6 +259,9 @@ public:
 	/// Return the waypoint with the given name
 	virtual Waypoint *getWaypointByName( AsciiString name );
 
+	/// Changes whenever waypoints are added or deleted, see Parameter::getResolvedHandle
+	UnsignedInt getWaypointGeneration(void) const { return m_waypointGeneration; }
+
 	/// Return the waypoint with the given ID
 	virtual Waypoint *getWaypointByID( UnsignedInt id );
 
@@ -345,6 +348,7 @@ protected:
 	Int m_activeBoundary;
 
 	Waypoint *m_waypointListHead;
+	UnsignedInt m_waypointGeneration;
 	Bridge *m_bridgeListHead;
 
 	Bool		m_bridgeDamageStatesChanged;
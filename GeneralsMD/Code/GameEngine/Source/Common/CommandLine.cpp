@@ -458,6 +458,61 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parseProfileScripts(char *args[], int num)
+{
+	TheWritableGlobalData->m_profileScripts = TRUE;
+	return 1;
+}
+
+Int parseProfileScriptsFrames(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_profileScripts = TRUE;
+		TheWritableGlobalData->m_profileScriptsFrameLimit = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseUseBIGIndexCache(char *args[], int num)
+{
+	TheWritableGlobalData->m_useArchiveIndexCache = TRUE;
+	return 1;
+}
+
+Int parsePrefetchArchives(char *args[], int num)
+{
+	TheWritableGlobalData->m_prefetchArchiveFiles = TRUE;
+	return 1;
+}
+
+Int parseStartupTrace(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_startupTraceFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseNetTelemetry(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_netTelemetryFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseMeasureNetEncoding(char *args[], int num)
+{
+	TheWritableGlobalData->m_measureNetEncoding = TRUE;
+	return 1;
+}
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -1163,6 +1218,37 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// TheSuperHackers @feature Collect the time spent in every script, condition type and action type.
+	// The report is written to ScriptProfile_<map>_<process id>.txt and .csv in the user data folder
+	// when the map is unloaded. Combine this with -headless and -replay to profile recorded games.
+	{ "-profileScripts", parseProfileScripts },
+
+	// TheSuperHackers @feature Same as -profileScripts, but quits the game after the given number of logic frames.
+	// Use this together with -file to run a campaign map as a repeatable script benchmark.
+	{ "-profileScriptsFrames", parseProfileScriptsFrames },
+
+	// TheSuperHackers @feature Keep the directories of all BIG files in BIGIndex.cache in the user data folder.
+	// BIG files whose size and time stamp did not change are opened without reading their directory.
+	{ "-useBIGIndexCache", parseUseBIGIndexCache },
+
+	// TheSuperHackers @feature Remember which archived files each map opens while it loads, and read them on worker
+	// threads ahead of the main thread the next time the map loads. The map load time is written to the debug log.
+	{ "-prefetchArchives", parsePrefetchArchives },
+
+	// TheSuperHackers @feature Record the wall time and memory growth of engine initialization, every subsystem,
+	// INI file and BIG archive, and the map load phases, and write them to the given file as a Chrome trace.
+	// Open the file with chrome://tracing or https://ui.perfetto.dev.
+	{ "-startupTrace", parseStartupTrace },
+
+	// TheSuperHackers @feature Append the run ahead, packet arrival cushion, per slot latency, frame rate and
+	// resends, bandwidth and command counts of every executed multiplayer frame to the given CSV file.
+	// Summarize the file with the nettelemetry tool.
+	{ "-netTelemetry", parseNetTelemetry },
+
+	// TheSuperHackers @feature Pack the game commands of the played replays into network packets, in the plain
+	// and in the compact game command encoding, and print the bytes and packets of both. Use with -replay.
+	{ "-measureNetEncoding", parseMeasureNetEncoding },
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
@@ -33,6 +33,7 @@
 
 #include "Common/INI.h"
 #include "Common/INIException.h"
+#include "Common/INITokenIndex.h"
 
 #include "Common/DamageFX.h"
 #include "Common/file.h"
@@ -40,6 +41,7 @@
 #include "Common/GameAudio.h"
 #include "Common/Science.h"
 #include "Common/SpecialPower.h"
+#include "Common/StartupProfiler.h"
 #include "Common/ThingFactory.h"
 #include "Common/ThingTemplate.h"
 #include "Common/Upgrade.h"
@@ -181,6 +183,7 @@ INI::INI( void )
 
 	m_file							= NULL;
   m_readBufferNext=m_readBufferUsed=0;
+  m_readData=m_readBuffer;
 	m_filename					= "None";
 	m_loadType					= INI_LOAD_INVALID;
 	m_lineNum						= 0;
@@ -190,6 +193,7 @@ INI::INI( void )
 	m_sepsQuote					= "\"\n=";				///< stop at " = EOL
 	m_blockEndToken			= "END";
 	m_endOfFile					= FALSE;
+	m_tokenCursor				= NULL;
 	m_buffer[0]					= 0;
 #ifdef DEBUG_CRASHING
 	m_curBlockStart[0]	= 0;
@@ -335,41 +339,65 @@ void INI::unPrepFile()
 	m_file->close();
 	m_file = NULL;
   m_readBufferUsed=m_readBufferNext=0;
+  m_readData=m_readBuffer;
 	m_filename = "None";
 	m_loadType = INI_LOAD_INVALID;
 	m_lineNum = 0;
 	m_endOfFile = FALSE;
+	m_tokenCursor = NULL;
 	s_xfer = NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Hashed lookups of the block and field parse tables, see INITokenIndex */
+//-------------------------------------------------------------------------------------------------
+typedef INITokenIndex<FieldParse> FieldParseIndex;
+typedef std::hash_map< const FieldParse*, FieldParseIndex, rts::hash<const FieldParse*>, rts::equal_to<const FieldParse*> > FieldParseIndexMap;
+
+static INITokenIndex<BlockParse> s_blockParseIndex;
+static FieldParseIndexMap s_fieldParseIndexMap;
+
+//-------------------------------------------------------------------------------------------------
+static const FieldParseIndex& getFieldParseIndex(const FieldParse* parseTable)
+{
+	FieldParseIndex& index = s_fieldParseIndexMap[parseTable];
+	if (!index.isBuilt())
+		index.build(parseTable);
+	return index;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INI::getIndexedFieldParseTables( std::vector<const FieldParse*>& tables )
+{
+	tables.clear();
+	for (FieldParseIndexMap::const_iterator it = s_fieldParseIndexMap.begin(); it != s_fieldParseIndexMap.end(); ++it)
+		tables.push_back(it->first);
+}
+
 //-------------------------------------------------------------------------------------------------
 static INIBlockParse findBlockParse(const char* token)
 {
-	for (const BlockParse* parse = theTypeTable; parse->token; ++parse)
-	{
-		if (strcmp( parse->token, token ) == 0)
-		{
-			return parse->parse;
-		}
-	}
-	return NULL;
+	if (!s_blockParseIndex.isBuilt())
+		s_blockParseIndex.build(theTypeTable);
+
+	const BlockParse* parse = s_blockParseIndex.find(token, hashINIToken(token));
+	return parse ? parse->parse : NULL;
 }
 
 //-------------------------------------------------------------------------------------------------
-static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, int& offset, const void*& userData)
+static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, UnsignedInt tokenHash, int& offset, const void*& userData)
 {
-	const FieldParse* parse = parseTable;
-	for (; parse->token; ++parse)
+	const FieldParseIndex& index = getFieldParseIndex(parseTable);
+	const FieldParse* parse = index.find(token, tokenHash);
+	if (parse)
 	{
-		if (strcmp( parse->token, token ) == 0)
-		{
-			offset = parse->offset;
-			userData = parse->userData;
-			return parse->parse;
-		}
+		offset = parse->offset;
+		userData = parse->userData;
+		return parse->parse;
 	}
 
-	if (!parse->token && parse->parse)
+	parse = index.getTerminator();
+	if (parse->parse)
 	{
 		offset = parse->offset;
 		userData = token;
@@ -386,6 +414,8 @@ static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char
 //-------------------------------------------------------------------------------------------------
 UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 {
+	StartupProfilerScope profileFile("INI", filename.str());
+
 	setFPMode(); // so we have consistent Real values for GameLogic -MDC
 
 	s_xfer = pXfer;
@@ -404,7 +434,7 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 			AsciiString currentLine = m_buffer;
 
 			// the first word is the type of data we're processing
-			const char *token = strtok( m_buffer, m_seps );
+			const char *token = tokenize( m_buffer, m_seps );
 			if( token )
 			{
 				INIBlockParse parse = findBlockParse(token);
@@ -452,6 +482,27 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 	return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Point m_readData at the next chunk of the source file and return its size, 0 at the end */
+//-------------------------------------------------------------------------------------------------
+unsigned INI::fillReadBuffer( void )
+{
+	// TheSuperHackers @performance Files that are already in memory are read in place in one go.
+	Int viewSize = 0;
+	const char *view = m_file->getView(viewSize);
+	if (view != NULL)
+	{
+		const Int pos = m_file->position();
+		m_file->seek(0, File::END);
+		m_readData = view + pos;
+		return (unsigned)(viewSize - pos);
+	}
+
+	m_readData = m_readBuffer;
+	const Int bytesRead = m_file->read(m_readBuffer, INI_READ_BUFFER);
+	return bytesRead > 0 ? (unsigned)bytesRead : 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Read a line from the already open file.  Any comments will be removed and
 	* therefore ignored from any given line */
@@ -473,7 +524,7 @@ void INI::readLine( void )
       {
         // refill buffer
         m_readBufferNext=0;
-        m_readBufferUsed=m_file->read(m_readBuffer,INI_READ_BUFFER);
+        m_readBufferUsed=fillReadBuffer();
 
         // EOF?
         if (!m_readBufferUsed)
@@ -483,7 +534,7 @@ void INI::readLine( void )
           break;
         }
       }
-      *p=m_readBuffer[m_readBufferNext++];
+      *p=m_readData[m_readBufferNext++];
 
       // CR?
       if (*p=='\n')
@@ -814,7 +865,7 @@ AsciiString INI::getNextAsciiString()
 		}
 		else
 		{
-			static char buff[INI_MAX_CHARS_PER_LINE];
+			char buff[INI_MAX_CHARS_PER_LINE];
 			buff[0] = 0;
 			if (strlen(token) > 1)
 			{
@@ -1526,7 +1577,7 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 		readLine();
 
 		// check for end token
-		const char* field = strtok( m_buffer, INI::getSeps() );
+		const char* field = tokenize( m_buffer, INI::getSeps() );
 		if( field )
 		{
 
@@ -1537,11 +1588,12 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 			else
 			{
 				Bool found = false;
+				const UnsignedInt fieldHash = hashINIToken(field);
 				for (int ptIdx = 0; ptIdx < parseTableList.getCount(); ++ptIdx)
 				{
 					int offset = 0;
 					const void* userData = 0;
-					INIFieldParseProc parse = findFieldParse(parseTableList.getNthFieldParse(ptIdx), field, offset, userData);
+					INIFieldParseProc parse = findFieldParse(parseTableList.getNthFieldParse(ptIdx), field, fieldHash, offset, userData);
 					if (parse)
 					{
 						// parse this block and check for parse errors
@@ -1590,11 +1642,39 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 
 }
 
+//-------------------------------------------------------------------------------------------------
+char* INI::tokenize(char* str, const char* seps)
+{
+	// same semantics as strtok, but the position is kept per INI instead of per process
+	char *token = str ? str : m_tokenCursor;
+	if (token == NULL)
+		return NULL;
+
+	token += strspn(token, seps);
+	if (*token == '\0')
+	{
+		m_tokenCursor = token;
+		return NULL;
+	}
+
+	char *end = token + strcspn(token, seps);
+	if (*end == '\0')
+	{
+		m_tokenCursor = end;
+	}
+	else
+	{
+		*end = '\0';
+		m_tokenCursor = end + 1;
+	}
+	return token;
+}
+
 //-------------------------------------------------------------------------------------------------
 /*static*/ const char* INI::getNextToken(const char* seps)
 {
 	if (!seps) seps = getSeps();
-	const char *token = ::strtok(NULL, seps);
+	const char *token = tokenize(NULL, seps);
 	if (!token)
 		throw INI_INVALID_DATA;
 	return token;
@@ -1604,7 +1684,7 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 /*static*/ const char* INI::getNextTokenOrNull(const char* seps)
 {
 	if (!seps) seps = getSeps();
-	const char *token = ::strtok(NULL, seps);
+	const char *token = tokenize(NULL, seps);
 	return token;
 }
 
@@ -26,6 +26,7 @@
 // ----------------------------------------------------------------------------
 #include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
 
+#include "Common/StartupProfiler.h"
 #include "Common/SubsystemInterface.h"
 #include "Common/Xfer.h"
 
@@ -153,6 +154,8 @@ void SubsystemInterfaceList::removeSubsystem(SubsystemInterface* sys)
 //-----------------------------------------------------------------------------
 void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char* path1, const char* path2, Xfer *pXfer, AsciiString name)
 {
+	StartupProfilerScope profileSubsystem("Subsystem", name.str());
+
 	sys->setName(name);
 	sys->init();
 
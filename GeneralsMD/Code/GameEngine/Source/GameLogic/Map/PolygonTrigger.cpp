@@ -38,6 +38,7 @@
 /* ********* PolygonTrigger class ****************************/
 PolygonTrigger *PolygonTrigger::ThePolygonTriggerListPtr = NULL;
 Int PolygonTrigger::s_currentID = 1;
+UnsignedInt PolygonTrigger::s_triggerGeneration = 0;
 /**
  PolygonTrigger - Constructor.
 */
@@ -60,6 +61,9 @@ m_riverStart(0)
 
 	m_waterHandle.m_polygon = this;
 
+	m_cellMaskRegion.lo.x = m_cellMaskRegion.lo.y = 0;
+	m_cellMaskRegion.hi.x = m_cellMaskRegion.hi.y = -1;
+
 }
 
 
@@ -301,6 +305,7 @@ void PolygonTrigger::addPolygonTrigger(PolygonTrigger *pTrigger)
 	}
 	pTrigger->m_nextPolygonTrigger = ThePolygonTriggerListPtr;
 	ThePolygonTriggerListPtr = pTrigger;
+	++s_triggerGeneration;
 }
 
 /**
@@ -326,6 +331,7 @@ void PolygonTrigger::removePolygonTrigger(PolygonTrigger *pTrigger)
 		}
 	}
 	pTrigger->m_nextPolygonTrigger = NULL;
+	++s_triggerGeneration;
 }
 
 /**
@@ -336,6 +342,7 @@ void PolygonTrigger::deleteTriggers(void)
 	PolygonTrigger *pList = ThePolygonTriggerListPtr;
 	ThePolygonTriggerListPtr = NULL;
 	s_currentID = 1;
+	++s_triggerGeneration;
 	deleteInstance(pList);
 }
 
@@ -353,6 +360,7 @@ void PolygonTrigger::addPoint(const ICoord3D &point)
 	m_points[m_numPoints] = point;
 	m_numPoints++;
 	m_boundsNeedsUpdate = true;
+	++s_triggerGeneration;
 }
 
 /**
@@ -373,6 +381,7 @@ void PolygonTrigger::setPoint(const ICoord3D &point, Int ndx)
 	}
 	m_points[ndx] = point;
 	m_boundsNeedsUpdate = true;
+	++s_triggerGeneration;
 }
 
 /**
@@ -398,6 +407,7 @@ void PolygonTrigger::insertPoint(const ICoord3D &point, Int ndx)
 	m_points[ndx] = point;
 	m_numPoints++;
 	m_boundsNeedsUpdate = true;
+	++s_triggerGeneration;
 }
 
 /**
@@ -415,6 +425,7 @@ void PolygonTrigger::deletePoint(Int ndx)
 	}
 	m_numPoints--;
 	m_boundsNeedsUpdate = true;
+	++s_triggerGeneration;
 }
 
 void PolygonTrigger::getCenterPoint(Coord3D* pOutCoord)	const
@@ -483,6 +494,118 @@ Bool PolygonTrigger::pointInTrigger(ICoord3D &point) const
 	return inside;
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Returns true if the segment a-b touches the closed rectangle lo-hi. */
+// ------------------------------------------------------------------------------------------------
+static Bool segmentTouchesRect(const ICoord3D &a, const ICoord3D &b, const Coord2D &lo, const Coord2D &hi)
+{
+	if (a.x < lo.x && b.x < lo.x) return false;
+	if (a.x > hi.x && b.x > hi.x) return false;
+	if (a.y < lo.y && b.y < lo.y) return false;
+	if (a.y > hi.y && b.y > hi.y) return false;
+
+	// The segment bounds overlap the rectangle. The segment misses the rectangle only if all
+	// rectangle corners lie strictly on the same side of the line through the segment.
+	const double dx = b.x - a.x;
+	const double dy = b.y - a.y;
+	const double s0 = dx * (lo.y - a.y) - dy * (lo.x - a.x);
+	const double s1 = dx * (lo.y - a.y) - dy * (hi.x - a.x);
+	const double s2 = dx * (hi.y - a.y) - dy * (lo.x - a.x);
+	const double s3 = dx * (hi.y - a.y) - dy * (hi.x - a.x);
+	if (s0 > 0 && s1 > 0 && s2 > 0 && s3 > 0) return false;
+	if (s0 < 0 && s1 < 0 && s2 < 0 && s3 < 0) return false;
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Precompute how the trigger covers each cell of a grid, usually the
+	* partition grid. A cell is only classified inside or outside if no polygon edge comes within one
+	* world unit of it. pointInTrigger then gives the same answer for every point that maps to the cell,
+	* so callers can skip the exact test for those cells and only need it for boundary cells. */
+// ------------------------------------------------------------------------------------------------
+void PolygonTrigger::updateCellMask(const Coord2D &gridOrigin, Real cellSize, Int cellCountX, Int cellCountY)
+{
+	m_cellMask.clear();
+	m_cellMaskRegion.lo.x = m_cellMaskRegion.lo.y = 0;
+	m_cellMaskRegion.hi.x = m_cellMaskRegion.hi.y = -1;
+
+	if (m_numPoints < 1 || cellSize <= 0.0f || cellCountX <= 0 || cellCountY <= 0)
+		return;
+
+	if (m_boundsNeedsUpdate) {
+		updateBounds();
+	}
+
+	// Margin in world units around each cell that must be free of polygon edges.
+	const Real margin = 1.0f;
+	const Real cellSizeInv = 1.0f / cellSize;
+
+	IRegion2D region;
+	region.lo.x = REAL_TO_INT_FLOOR((m_bounds.lo.x - margin - gridOrigin.x) * cellSizeInv);
+	region.lo.y = REAL_TO_INT_FLOOR((m_bounds.lo.y - margin - gridOrigin.y) * cellSizeInv);
+	region.hi.x = REAL_TO_INT_FLOOR((m_bounds.hi.x + margin - gridOrigin.x) * cellSizeInv);
+	region.hi.y = REAL_TO_INT_FLOOR((m_bounds.hi.y + margin - gridOrigin.y) * cellSizeInv);
+	if (region.lo.x < 0) region.lo.x = 0;
+	if (region.lo.y < 0) region.lo.y = 0;
+	if (region.hi.x > cellCountX-1) region.hi.x = cellCountX-1;
+	if (region.hi.y > cellCountY-1) region.hi.y = cellCountY-1;
+	if (region.lo.x > region.hi.x || region.lo.y > region.hi.y)
+		return;
+
+	m_cellMaskRegion = region;
+	m_cellMask.resize((region.hi.x - region.lo.x + 1) * (region.hi.y - region.lo.y + 1), CELL_OUTSIDE);
+
+	Int index = 0;
+	for (Int y = region.lo.y; y <= region.hi.y; ++y)
+	{
+		for (Int x = region.lo.x; x <= region.hi.x; ++x, ++index)
+		{
+			Coord2D lo, hi;
+			lo.x = gridOrigin.x + x * cellSize - margin;
+			lo.y = gridOrigin.y + y * cellSize - margin;
+			hi.x = gridOrigin.x + (x+1) * cellSize + margin;
+			hi.y = gridOrigin.y + (y+1) * cellSize + margin;
+
+			Bool boundary = false;
+			for (Int i = 0; i < m_numPoints; ++i)
+			{
+				const ICoord3D &pt1 = m_points[i];
+				const ICoord3D &pt2 = (i == m_numPoints-1) ? m_points[0] : m_points[i+1];
+				if (segmentTouchesRect(pt1, pt2, lo, hi))
+				{
+					boundary = true;
+					break;
+				}
+			}
+
+			if (boundary)
+			{
+				m_cellMask[index] = CELL_BOUNDARY;
+				continue;
+			}
+
+			// No edge is near this cell, so any point of the cell decides for the whole cell.
+			ICoord3D center;
+			center.x = REAL_TO_INT_FLOOR(gridOrigin.x + (x + 0.5f) * cellSize);
+			center.y = REAL_TO_INT_FLOOR(gridOrigin.y + (y + 0.5f) * cellSize);
+			center.z = 0;
+			m_cellMask[index] = pointInTrigger(center) ? CELL_INSIDE : CELL_OUTSIDE;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+PolygonTrigger::CellCoverage PolygonTrigger::getCellCoverage(Int cellX, Int cellY) const
+{
+	if (cellX < m_cellMaskRegion.lo.x || cellX > m_cellMaskRegion.hi.x ||
+			cellY < m_cellMaskRegion.lo.y || cellY > m_cellMaskRegion.hi.y)
+		return CELL_OUTSIDE;
+
+	const Int width = m_cellMaskRegion.hi.x - m_cellMaskRegion.lo.x + 1;
+	const Int index = (cellY - m_cellMaskRegion.lo.y) * width + (cellX - m_cellMaskRegion.lo.x);
+	return (CellCoverage)m_cellMask[index];
+}
+
 // ------------------------------------------------------------------------------------------------
 const WaterHandle* PolygonTrigger::getWaterHandle(void)	const
 {
@@ -549,6 +672,9 @@ void PolygonTrigger::xfer( Xfer *xfer )
 	// bounds need update
 	xfer->xferBool( &m_boundsNeedsUpdate );
 
+	if( xfer->getXferMode() == XFER_LOAD )
+		++s_triggerGeneration;
+
 }
 
 // ------------------------------------------------------------------------------------------------
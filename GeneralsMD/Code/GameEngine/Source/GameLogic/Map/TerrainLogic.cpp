@@ -974,6 +974,7 @@ TerrainLogic::TerrainLogic()
 	m_numWaterToUpdate = 0;
 
 	m_waypointListHead = NULL;
+	m_waypointGeneration = 0;
 	m_bridgeListHead = NULL;
 	m_mapData = NULL;
 	m_bridgeDamageStatesChanged = FALSE;
@@ -1360,6 +1361,7 @@ void TerrainLogic::addWaypoint(MapObject *pMapObj)
 																&loc, label1, label2, label3, biDirectional);
 	pWay->setNext(m_waypointListHead);
 	m_waypointListHead = pWay;
+	++m_waypointGeneration;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1415,6 +1417,7 @@ void TerrainLogic::deleteWaypoints(void)
 		deleteInstance(pWay);
 	}
 	m_waypointListHead = NULL;
+	++m_waypointGeneration;
 }
 
 //-------------------------------------------------------------------------------------------------
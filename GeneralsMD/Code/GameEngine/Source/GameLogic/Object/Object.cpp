@@ -210,6 +210,7 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_partitionLastValue(NULL),
 	m_smcUntil(NEVER),
 	m_privateStatus(0),
+	m_teamMemberState(0),
 	m_formationID(NO_FORMATION_ID),
 	m_isReceivingDifficultyBonus(FALSE),
 	m_singleUseCommandUsed(FALSE),
@@ -871,6 +872,7 @@ void Object::setOrRestoreTeam( Team* team, Bool restoring )
 		if (m_team->isInList_TeamMemberList(this))
 		{
 			m_team->removeFrom_TeamMemberList(this);
+			m_team->friend_removeMemberCount(this, m_teamMemberState);
 			m_team->getControllingPlayer()->becomingTeamMember(this, false);
 		}
 	}
@@ -884,6 +886,8 @@ void Object::setOrRestoreTeam( Team* team, Bool restoring )
 		if (!m_team->isInList_TeamMemberList(this))
 		{
 			m_team->prependTo_TeamMemberList(this);
+			m_teamMemberState = TeamMemberCounts::getState(this);
+			m_team->friend_addMemberCount(this, m_teamMemberState);
 			m_team->getControllingPlayer()->becomingTeamMember(this, true);
 		}
 
@@ -935,6 +939,20 @@ void Object::setOrRestoreTeam( Team* team, Bool restoring )
 		TheInGameUI->objectChangedTeam(this, oldPlayerIndex, newPlayerIndex);
 }
 
+//=============================================================================
+//=============================================================================
+void Object::updateTeamMemberState()
+{
+	const UnsignedByte state = TeamMemberCounts::getState(this);
+	if (state == m_teamMemberState)
+		return;
+
+	if (m_team && m_team->isInList_TeamMemberList(this))
+		m_team->friend_changeMemberCountState(this, m_teamMemberState, state);
+
+	m_teamMemberState = state;
+}
+
 //=============================================================================
 enum
 {
@@ -995,6 +1013,8 @@ void Object::setStatus( ObjectStatusMaskType objectStatus, Bool set )
 
 	if (m_status != oldStatus)
 	{
+		updateTeamMemberState();
+
 		if( set && objectStatus.test( OBJECT_STATUS_REPULSOR ) && m_repulsorHelper != NULL )
 		{
 			// Damaged repulsable civilians scare (repulse) other civs, but only
@@ -2001,6 +2021,8 @@ void Object::setEffectivelyDead(Bool dead)
 	else
 		BitClear(m_privateStatus, EFFECTIVELY_DEAD);
 
+	updateTeamMemberState();
+
 	if (dead)
 	{
 		if( m_radarData )
@@ -2653,55 +2675,78 @@ void Object::setTriggerAreaFlagsForChangeInPosition()
 
 	m_iPos = iPos;
 
-	for (const PolygonTrigger *pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext())
+	// TheSuperHackers @performance Only visit the trigger areas that overlap the partition cell of the
+	// new position. Cells that are fully inside a trigger area skip the exact polygon test. The trigger
+	// areas are visited in the same order as the full list, so the result is identical.
+	Int numCellTriggers = 0;
+	const PartitionManager::TriggerAreaCellEntry *cellTriggers = ThePartitionManager->getTriggerAreasInCell(m_iPos, numCellTriggers);
+	if (cellTriggers != NULL)
 	{
-		Bool skip = false;
-		for (i = 0; i < m_numTriggerAreasActive; i++)
+		for (i = 0; i < numCellTriggers; ++i)
 		{
-			if (m_triggerInfo[i].pTrigger == pTrig)
-			{
-				// Already handled this one in the check for exited above.
-				skip = true;
-				break;
-			}
+			const PolygonTrigger *pTrig = cellTriggers[i].m_trigger;
+			if (hasTriggerAreaInfo(pTrig))
+				continue; // Already handled this one in the check for exited above.
+			if (cellTriggers[i].m_inside || pTrig->pointInTrigger(m_iPos))
+				enterTriggerArea(pTrig, now);
 		}
-		if (skip)
-			continue;
+		return;
+	}
+
+	for (const PolygonTrigger *pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext())
+	{
+		if (hasTriggerAreaInfo(pTrig))
+			continue; // Already handled this one in the check for exited above.
 		if (pTrig->pointInTrigger(m_iPos))
-		{
-			if (m_numTriggerAreasActive < MAX_TRIGGER_AREA_INFOS)
-			{
-				m_triggerInfo[m_numTriggerAreasActive].isInside = true;
-				m_triggerInfo[m_numTriggerAreasActive].entered = true;
-				m_triggerInfo[m_numTriggerAreasActive].exited = false;
-				m_triggerInfo[m_numTriggerAreasActive].pTrigger = pTrig;
-				m_enteredOrExitedFrame = now;
-				if (m_team)
-					m_team->setEnteredExited();
-				TheGameLogic->updateObjectsChangedTriggerAreas();
-				++m_numTriggerAreasActive;
+			enterTriggerArea(pTrig, now);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns true if the trigger area is in the list of active trigger areas. */
+//-------------------------------------------------------------------------------------------------
+Bool Object::hasTriggerAreaInfo(const PolygonTrigger *pTrigger) const
+{
+	for (Int i = 0; i < m_numTriggerAreasActive; i++)
+	{
+		if (m_triggerInfo[i].pTrigger == pTrigger)
+			return true;
+	}
+	return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Records that the object entered the trigger area. */
+//-------------------------------------------------------------------------------------------------
+void Object::enterTriggerArea(const PolygonTrigger *pTrigger, UnsignedInt now)
+{
+	if (m_numTriggerAreasActive < MAX_TRIGGER_AREA_INFOS)
+	{
+		m_triggerInfo[m_numTriggerAreasActive].isInside = true;
+		m_triggerInfo[m_numTriggerAreasActive].entered = true;
+		m_triggerInfo[m_numTriggerAreasActive].exited = false;
+		m_triggerInfo[m_numTriggerAreasActive].pTrigger = pTrigger;
+		m_enteredOrExitedFrame = now;
+		if (m_team)
+			m_team->setEnteredExited();
+		TheGameLogic->updateObjectsChangedTriggerAreas();
+		++m_numTriggerAreasActive;
 #ifdef RTS_DEBUG
-				//TheScriptEngine->AppendDebugMessage("Object entered.", false);
+		//TheScriptEngine->AppendDebugMessage("Object entered.", false);
 #endif
-			}
-			else
-			{
-				// Shouldn't happen.
-				static Bool didWarn = false;
-				if (!didWarn)
-				{
-					didWarn = true;
-					TheScriptEngine->AppendDebugMessage("***WARNING - Too many nested trigger areas. ***", true);
-				}
-			}
+	}
+	else
+	{
+		// Shouldn't happen.
+		static Bool didWarn = false;
+		if (!didWarn)
+		{
+			didWarn = true;
+			TheScriptEngine->AppendDebugMessage("***WARNING - Too many nested trigger areas. ***", true);
 		}
-
 	}
-
 }
 
-
-
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
 Bool Object::isInList(Object **pListHead) const
@@ -4115,6 +4160,10 @@ void Object::xfer( Xfer *xfer )
 	// private status
 	xfer->xferUnsignedByte( &m_privateStatus );
 
+	// the status bits were loaded directly, so recount ourselves in the team we may already be on
+	if( xfer->getXferMode() == XFER_LOAD )
+		updateTeamMemberState();
+
 	// OK, now that we have xferred our status bits, it's safe to set the team...
 	if( xfer->getXferMode() == XFER_LOAD )
 	{
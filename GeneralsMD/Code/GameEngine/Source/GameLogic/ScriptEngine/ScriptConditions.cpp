@@ -205,7 +205,7 @@ void ScriptConditions::objectTypesFromParam(Parameter *pTypeParm, ObjectTypes *o
 		return;
 	}
 
-	ObjectTypes *types = TheScriptEngine->getObjectTypes(str);
+	ObjectTypes *types = TheScriptEngine->getObjectTypes(pTypeParm);
 	if (!types) {
 		(*outObjectTypes).addObjectType(str);
 	} else {
@@ -243,7 +243,7 @@ Bool ScriptConditions::evaluateAllBuildFacilitiesDestroyed(Parameter *pSideParm
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateIsDestroyed(Parameter *pTeamParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	if (theTeam) {
@@ -261,7 +261,7 @@ Bool ScriptConditions::evaluateBridgeBroken(Parameter *pBridgeParm)
 		// Don't bother checking if no bridges changed damage states.
 		return false;
 	}
-	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm->getString() );
+	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm );
 	if (theBridge) {
 		return (TheTerrainLogic->isBridgeBroken(theBridge));
 	}
@@ -277,7 +277,7 @@ Bool ScriptConditions::evaluateBridgeRepaired(Parameter *pBridgeParm)
 		// Don't bother checking if no bridges changed damage states.
 		return false;
 	}
-	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm->getString() );
+	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm );
 	if (theBridge) {
 		return (TheTerrainLogic->isBridgeRepaired(theBridge));
 	}
@@ -289,7 +289,7 @@ Bool ScriptConditions::evaluateBridgeRepaired(Parameter *pBridgeParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitDestroyed(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit)
 	{
 		return theUnit->isEffectivelyDead();
@@ -306,7 +306,7 @@ Bool ScriptConditions::evaluateNamedUnitDestroyed(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitExists(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit)
 	{
 		return !theUnit->isEffectivelyDead();
@@ -320,7 +320,7 @@ Bool ScriptConditions::evaluateNamedUnitExists(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitDying(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit)
 	{
 		return theUnit->isEffectivelyDead();
@@ -338,7 +338,7 @@ Bool ScriptConditions::evaluateNamedUnitDying(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitTotallyDead(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit) {
 		return false; // if the unit still exists, it isn't totally dead.
 	}
@@ -393,11 +393,11 @@ Bool ScriptConditions::evaluateHasUnits(Parameter *pTeamParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamInsideAreaPartially(Parameter *pTeamParm, Parameter *pTriggerAreaParm, Parameter *pTypeParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString triggerName = pTriggerAreaParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm);
 
 	if (pTrig == NULL) return false;
 	if (theTeam) {
@@ -412,14 +412,14 @@ Bool ScriptConditions::evaluateTeamInsideAreaPartially(Parameter *pTeamParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedInsideArea(Parameter *pUnitParm, Parameter *pTriggerAreaParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 
 	if (!theObj) {
 		return false;
 	}
 
 	AsciiString triggerName = pTriggerAreaParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm);
 	if (pTrig == NULL) return false;
 	if (theObj) {
 		Coord3D pCoord = *theObj->getPosition();
@@ -436,7 +436,7 @@ Bool ScriptConditions::evaluateNamedInsideArea(Parameter *pUnitParm, Parameter *
 Bool ScriptConditions::evaluatePlayerHasUnitTypeInArea(Condition *pCondition, Parameter *pPlayerParm, Parameter *pComparisonParm, Parameter *pCountParm, Parameter *pTypeParm, Parameter *pTriggerParm )
 {
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (pTrig == NULL) return false;
 
 	Player* pPlayer = playerFromParam(pPlayerParm);
@@ -529,7 +529,7 @@ Bool ScriptConditions::evaluatePlayerHasUnitTypeInArea(Condition *pCondition, Pa
 Bool ScriptConditions::evaluatePlayerHasUnitKindInArea(Condition *pCondition, Parameter *pPlayerParm, Parameter *pComparisonParm, Parameter *pCountParm, Parameter *pKindParm, Parameter *pTriggerParm )
 {
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (pTrig == NULL) return false;
 
 	KindOfType kind = (KindOfType)pKindParm->getInt();
@@ -609,7 +609,7 @@ Bool ScriptConditions::evaluatePlayerHasUnitKindInArea(Condition *pCondition, Pa
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamStateIs(Parameter *pTeamParm, Parameter *pStateParm )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString stateName = pStateParm->getString();
@@ -625,7 +625,7 @@ Bool ScriptConditions::evaluateTeamStateIs(Parameter *pTeamParm, Parameter *pSta
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamStateIsNot(Parameter *pTeamParm, Parameter *pStateParm )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString stateName = pStateParm->getString();
@@ -649,11 +649,11 @@ Bool ScriptConditions::evaluateNamedOutsideArea(Parameter *pUnitParm, Parameter
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamInsideAreaEntirely(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {// This is actually TeamInside(...)
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (pTrig == NULL)
 		return false;
@@ -678,7 +678,7 @@ Bool ScriptConditions::evaluateTeamOutsideAreaEntirely(Parameter *pTeamParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedAttackedByType(Parameter *pUnitParm, Parameter *pTypeParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -730,7 +730,7 @@ Bool ScriptConditions::evaluateNamedAttackedByType(Parameter *pUnitParm, Paramet
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamAttackedByType(Parameter *pTeamParm, Parameter *pTypeParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!theTeam) {
 		return FALSE;
 	}
@@ -794,7 +794,7 @@ Bool ScriptConditions::evaluateTeamAttackedByType(Parameter *pTeamParm, Paramete
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedAttackedByPlayer(Parameter *pUnitParm, Parameter *pPlayerParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -832,7 +832,7 @@ Bool ScriptConditions::evaluateNamedAttackedByPlayer(Parameter *pUnitParm, Param
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamAttackedByPlayer(Parameter *pTeamParm, Parameter *pPlayerParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!theTeam) {
 		return false;
 	}
@@ -919,7 +919,7 @@ Bool ScriptConditions::evaluateNamedCreated(Parameter* pUnitParm)
 {
 	// This is actually evaluateNamedExists(...)
 	///@todo - evaluate created, not exists...
-	return (TheScriptEngine->getUnitNamed(pUnitParm->getString()) != NULL);
+	return (TheScriptEngine->getUnitNamed(pUnitParm) != NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -927,7 +927,7 @@ Bool ScriptConditions::evaluateNamedCreated(Parameter* pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamCreated(Parameter* pTeamParm)
 {
-	Team *pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team *pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (pTeam) {
 		return pTeam->isCreated();
 	}
@@ -939,7 +939,7 @@ Bool ScriptConditions::evaluateTeamCreated(Parameter* pTeamParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateUnitHealth(Parameter *pUnitParm, Parameter* pComparisonParm, Parameter *pHealthPercent)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -992,7 +992,7 @@ Bool ScriptConditions::evaluatePlayerHasCredits(Parameter *pCreditsParm, Paramet
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateBuildingEntered( Parameter *pPlayerParm, Parameter *pItemParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1024,7 +1024,7 @@ Bool ScriptConditions::evaluateBuildingEntered( Parameter *pPlayerParm, Paramete
 Bool ScriptConditions::evaluateIsBuildingEmpty( Parameter *pItemParm )
 {
 
-	Object *theBuilding = TheScriptEngine->getUnitNamed(pItemParm->getString());
+	Object *theBuilding = TheScriptEngine->getUnitNamed(pItemParm);
 	if (!theBuilding) {
 		return false;
 	}
@@ -1045,7 +1045,7 @@ Bool ScriptConditions::evaluateIsBuildingEmpty( Parameter *pItemParm )
 Bool ScriptConditions::evaluateEnemySighted(Parameter *pItemParm, Parameter *pAllianceParm, Parameter* pPlayerParm)
 {
 
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1106,7 +1106,7 @@ Bool ScriptConditions::evaluateEnemySighted(Parameter *pItemParm, Parameter *pAl
 Bool ScriptConditions::evaluateTypeSighted(Parameter *pItemParm, Parameter *pTypeParm, Parameter* pPlayerParm)
 {
 
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1151,7 +1151,7 @@ Bool ScriptConditions::evaluateTypeSighted(Parameter *pItemParm, Parameter *pTyp
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedDiscovered(Parameter *pItemParm, Parameter* pPlayerParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1183,7 +1183,7 @@ Bool ScriptConditions::evaluateNamedDiscovered(Parameter *pItemParm, Parameter*
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamDiscovered(Parameter *pTeamParm, Parameter *pPlayerParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -1242,7 +1242,7 @@ Bool ScriptConditions::evaluateNamedOwnedByPlayer(Parameter *pUnitParm, Paramete
 		return false;
 	}
 
-	Object* pObj = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pObj = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pObj) {
 		return false;
 	}
@@ -1260,7 +1260,7 @@ Bool ScriptConditions::evaluateTeamOwnedByPlayer(Parameter *pTeamParm, Parameter
 		return false;
 	}
 
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
@@ -1320,7 +1320,7 @@ Bool ScriptConditions::evaluatePlayerHasPower(Parameter *pPlayerParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedReachedWaypointsEnd(Parameter *pUnitParm, Parameter* pWaypointPathParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1347,7 +1347,7 @@ Bool ScriptConditions::evaluateNamedReachedWaypointsEnd(Parameter *pUnitParm, Pa
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamReachedWaypointsEnd(Parameter *pTeamParm, Parameter* pWaypointPathParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -1466,7 +1466,7 @@ Bool ScriptConditions::evaluatePlayerSpecialPowerFromUnitTriggered(Parameter *pP
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1491,7 +1491,7 @@ Bool ScriptConditions::evaluatePlayerSpecialPowerFromUnitMidway(Parameter *pPlay
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1516,7 +1516,7 @@ Bool ScriptConditions::evaluatePlayerSpecialPowerFromUnitComplete(Parameter *pPl
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1541,7 +1541,7 @@ Bool ScriptConditions::evaluateUpgradeFromUnitComplete(Parameter *pPlayerParm, P
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1608,7 +1608,7 @@ Bool ScriptConditions::evaluateSciencePurchasePoints(Parameter *pPlayerParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedHasFreeContainerSlots(Parameter *pUnitParm)
 {
-	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pUnit) {
 		return false;
 	}
@@ -1633,7 +1633,7 @@ Bool ScriptConditions::evaluateNamedHasFreeContainerSlots(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedEnteredArea(Parameter *pUnitParm, Parameter *pTriggerParm)
 {
-	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pUnit) {
 		return false;
 	}
@@ -1642,7 +1642,7 @@ Bool ScriptConditions::evaluateNamedEnteredArea(Parameter *pUnitParm, Parameter
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1656,12 +1656,12 @@ Bool ScriptConditions::evaluateNamedEnteredArea(Parameter *pUnitParm, Parameter
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedExitedArea(Parameter *pUnitParm, Parameter *pTriggerParm)
 {
-	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pUnit) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1675,12 +1675,12 @@ Bool ScriptConditions::evaluateNamedExitedArea(Parameter *pUnitParm, Parameter *
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamEnteredAreaEntirely(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (pTrig) {
 		return pTeam->didAllEnter(pTrig, (UnsignedInt)pTypeParm->getInt());
@@ -1694,12 +1694,12 @@ Bool ScriptConditions::evaluateTeamEnteredAreaEntirely(Parameter *pTeamParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamEnteredAreaPartially(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (pTrig) {
 		return pTeam->didPartialEnter(pTrig, (UnsignedInt)pTypeParm->getInt());
@@ -1713,12 +1713,12 @@ Bool ScriptConditions::evaluateTeamEnteredAreaPartially(Parameter *pTeamParm, Pa
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamExitedAreaEntirely(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1732,12 +1732,12 @@ Bool ScriptConditions::evaluateTeamExitedAreaEntirely(Parameter *pTeamParm, Para
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamExitedAreaPartially(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1964,7 +1964,7 @@ Bool ScriptConditions::evaluatePlayerDestroyedNOrMoreBuildings(Parameter *pPlaye
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateUnitHasEmptied(Parameter *pUnitParm)
 {
-	Object *object = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object *object = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!object) {
 		return false;
 	}
@@ -2013,7 +2013,7 @@ Bool ScriptConditions::evaluateUnitHasEmptied(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamIsContained(Parameter *pTeamParm, Bool allContained)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
@@ -2058,7 +2058,7 @@ Bool ScriptConditions::evaluateTeamIsContained(Parameter *pTeamParm, Bool allCon
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateUnitHasObjectStatus(Parameter *pUnitParm, Parameter *pObjectStatus)
 {
-	Object *object = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object *object = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!object) {
 		return false;
 	}
@@ -2069,7 +2069,7 @@ Bool ScriptConditions::evaluateUnitHasObjectStatus(Parameter *pUnitParm, Paramet
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamHasObjectStatus(Parameter *pTeamParm, Parameter *pObjectStatus, Bool entireTeam)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -2113,7 +2113,7 @@ Bool ScriptConditions::evaluateSkirmishValueInArea(Condition *pCondition, Parame
 	}
 
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -2209,7 +2209,7 @@ Bool ScriptConditions::evaluateSkirmishSuppliesWithinDistancePerimeter(Parameter
 		return false;
 	}
 
-	PolygonTrigger *trigger = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm->getString());
+	PolygonTrigger *trigger = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm);
 	if (!trigger) {
 		return false;
 	}
@@ -2260,7 +2260,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerTechBuildingWithinDistancePerimeter
 	if (pCondition->getCustomData()==1) return true;
 	if (pCondition->getCustomData()==-1) return false;
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm);
 	if (!pTrig) {
 		return false;
 	}
@@ -2289,7 +2289,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerTechBuildingWithinDistancePerimeter
 Bool ScriptConditions::evaluateSkirmishCommandButtonIsReady( Parameter * /* pSkirmishPlayerParm */, Parameter *pTeamParm, Parameter *pCommandButtonParm, Bool allReady )
 {
 	// In this one case, the pSkirmishPlayerParm isn't used.
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -2484,7 +2484,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerHasComparisonCapturedUnits(Paramete
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateSkirmishNamedAreaExists(Parameter *, Parameter *pTriggerParm)
 {
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	return (pTrig != NULL);
 }
 
@@ -2492,7 +2492,7 @@ Bool ScriptConditions::evaluateSkirmishNamedAreaExists(Parameter *, Parameter *p
 Bool ScriptConditions::evaluateSkirmishPlayerHasUnitsInArea(Condition *pCondition, Parameter *pSkirmishPlayerParm, Parameter *pTriggerParm )
 {
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (pTrig == NULL) return false;
 
 	Player* pPlayer = playerFromParam(pSkirmishPlayerParm);
@@ -2632,7 +2632,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerIsOutsideArea(Condition *pCondition
 		return FALSE;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (!pTrig) {
 		return FALSE;
 	}
@@ -32,6 +32,7 @@
 #include "Common/file.h"
 #include "Common/FileSystem.h"
 #include "Common/FramePacer.h"
+#include "Common/GameEngine.h"
 #include "Common/GameState.h"
 #include "Common/LatchRestore.h"
 #include "Common/MessageStream.h"
@@ -52,9 +53,11 @@
 #include "GameLogic/Module/AIUpdate.h"
 #include "GameLogic/ObjectTypes.h"
 #include "GameLogic/PartitionManager.h"
+#include "GameLogic/PolygonTrigger.h"
 #include "GameLogic/ScriptActions.h"
 #include "GameLogic/ScriptConditions.h"
 #include "GameLogic/ScriptEngine.h"
+#include "GameLogic/ScriptProfiler.h"
 #include "GameLogic/SidesList.h"
 
 
@@ -458,7 +461,10 @@ m_minFade(0.0f),
 m_numAttackInfo(0),
 m_shownMPLocalDefeatWindow(FALSE),
 m_objectsShouldReceiveDifficultyBonus(TRUE),
-m_ChooseVictimAlwaysUsesNormal(false)
+m_ChooseVictimAlwaysUsesNormal(false),
+m_profiler(NULL),
+m_namedObjectsGeneration(0),
+m_objectTypeListsGeneration(0)
 {
 	st_CanAppCont = true;
 	st_LastCurrentFrame = st_CurrentFrame = 0;
@@ -496,6 +502,10 @@ ScriptEngine::~ScriptEngine()
 #endif
 
 	reset(); // just in case.
+
+	delete m_profiler;
+	m_profiler = NULL;
+
 #ifdef COUNT_SCRIPT_USAGE
 	Int i;
 	for (i=0; i<ScriptAction::NUM_ITEMS; i++) {
@@ -548,6 +558,10 @@ void ScriptEngine::init( void )
 	_initVTune();
 #endif
 
+	if (TheGlobalData->m_profileScripts && m_profiler == NULL) {
+		m_profiler = new ScriptProfiler;
+	}
+
 #ifdef SPECIAL_SCRIPT_PROFILING
 #ifdef DEBUG_LOGGING
 	m_numFrames=0;
@@ -5363,6 +5377,12 @@ void ScriptEngine::reset( void )
 #endif
 #endif
 
+	// TheSuperHackers @feature Write the script profile of the map that is being unloaded.
+	if (m_profiler && m_profiler->hasSamples()) {
+		m_profiler->writeReport(TheGlobalData->m_mapName);
+		m_profiler->reset();
+	}
+
 	_updateCurrentParticleCap();
 
 	// delete and clear all sequential scripts.
@@ -5384,6 +5404,7 @@ void ScriptEngine::reset( void )
 			removeObjectTypes(*it);
 		} else {
 			m_allObjectTypeLists.erase(it);
+			++m_objectTypeListsGeneration;
 		}
 	}
 	DEBUG_ASSERTCRASH( m_allObjectTypeLists.empty() == TRUE, ("ScriptEngine::reset - m_allObjectTypeLists should be empty but is not!") );
@@ -5393,6 +5414,7 @@ void ScriptEngine::reset( void )
 
 	// Clear the named objects list.
  	m_namedObjects.clear();
+	++m_namedObjectsGeneration;
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -5551,6 +5573,10 @@ void ScriptEngine::update( void )
 		return; // we are just timing down
 	}
 
+	if (m_profiler) {
+		m_profiler->addFrame();
+	}
+
 	if (TheScriptActions) {
 		TheScriptActions->update();
 	}
@@ -5632,6 +5658,14 @@ void ScriptEngine::update( void )
 	_updateVTune();
 #endif
 
+	// TheSuperHackers @feature Stop the game once the requested number of frames has been profiled.
+	// This allows running campaign maps headless as a repeatable script benchmark.
+	if (m_profiler && TheGlobalData->m_profileScriptsFrameLimit > 0
+		&& TheGameLogic->getFrame() >= TheGlobalData->m_profileScriptsFrameLimit) {
+		m_profiler->writeReport(TheGlobalData->m_mapName);
+		m_profiler->reset();
+		TheGameEngine->setQuitting(TRUE);
+	}
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5869,6 +5903,19 @@ ObjectTypes *ScriptEngine::getObjectTypes(const AsciiString& objectTypeList)
 	return NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getObjectTypes */
+//-------------------------------------------------------------------------------------------------
+ObjectTypes *ScriptEngine::getObjectTypes(const Parameter *pTypesParm)
+{
+	void *handle;
+	if (!pTypesParm->getResolvedHandle(Parameter::RESOLVED_OBJECT_TYPES, m_objectTypeListsGeneration, &handle)) {
+		handle = getObjectTypes(pTypesParm->getString());
+		pTypesParm->setResolvedHandle(Parameter::RESOLVED_OBJECT_TYPES, m_objectTypeListsGeneration, handle);
+	}
+	return (ObjectTypes *)handle;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** doObjectTypeListMaintenance */
 /** If addObject is false, remove the object. If it is true, add the object. */
@@ -5881,6 +5928,7 @@ void ScriptEngine::doObjectTypeListMaintenance(const AsciiString& objectTypeList
 	if (!currentObjectTypeVec) {
 		ObjectTypes *newVec = newInstance(ObjectTypes)(objectTypeList);
 		m_allObjectTypeLists.push_back(newVec);
+		++m_objectTypeListsGeneration;
 		currentObjectTypeVec = newVec;
 	}
 
@@ -5946,27 +5994,78 @@ PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( AsciiString name )
 
 
 //-------------------------------------------------------------------------------------------------
-/** getTeamNamed */
+/** Same as above, but caches the trigger area on the parameter. */
 //-------------------------------------------------------------------------------------------------
-Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
+PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( const Parameter *pTriggerParm )
+{
+	const AsciiString& name = pTriggerParm->getString();
+	if (name == MY_INNER_PERIMETER || name == MY_OUTER_PERIMETER ||
+			name == ENEMY_INNER_PERIMETER || name == ENEMY_OUTER_PERIMETER) {
+		// These depend on the current player.
+		return getQualifiedTriggerAreaByName(name);
+	}
+
+	const UnsignedInt generation = PolygonTrigger::getTriggerGeneration();
+	void *handle;
+	if (pTriggerParm->getResolvedHandle(Parameter::RESOLVED_TRIGGER_AREA, generation, &handle)) {
+		return (PolygonTrigger *)handle;
+	}
+
+	PolygonTrigger *trig = getQualifiedTriggerAreaByName(name);
+	if (trig) {
+		// Missing areas are not cached, so that the warning keeps being reported.
+		pTriggerParm->setResolvedHandle(Parameter::RESOLVED_TRIGGER_AREA, generation, trig);
+	}
+	return trig;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getWaypointByName */
+//-------------------------------------------------------------------------------------------------
+Waypoint *ScriptEngine::getWaypointByName( const Parameter *pWaypointParm )
+{
+	const UnsignedInt generation = TheTerrainLogic->getWaypointGeneration();
+	void *handle;
+	if (!pWaypointParm->getResolvedHandle(Parameter::RESOLVED_WAYPOINT, generation, &handle)) {
+		handle = TheTerrainLogic->getWaypointByName(pWaypointParm->getString());
+		pWaypointParm->setResolvedHandle(Parameter::RESOLVED_WAYPOINT, generation, handle);
+	}
+	return (Waypoint *)handle;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getContextTeamNamed - Resolves the team names that depend on the calling context.
+Returns false if the name has to be looked up in the team factory. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::getContextTeamNamed(const AsciiString& teamName, Team **team)
 {
 	Bool is_GeneralsChallengeContext = TheCampaignManager->getCurrentCampaign() && TheCampaignManager->getCurrentCampaign()->m_isChallengeCampaign;
-	if (teamName == TEAM_THE_PLAYER && is_GeneralsChallengeContext)
+	if (teamName == TEAM_THE_PLAYER && is_GeneralsChallengeContext) {
 		// Designers have built their Generals' Challenge maps, referencing "teamThePlayer" meaning the local player's default (parent) team.
 		// However, they've also built many of their single player maps with this string, where "teamThePlayer" is not intended as an alias.
-		return ThePlayerList->getLocalPlayer()->getDefaultTeam();
+		*team = ThePlayerList->getLocalPlayer()->getDefaultTeam();
+		return true;
+	}
 	if (teamName == THIS_TEAM) {
-		if (m_callingTeam)
-			return m_callingTeam;
-		return m_conditionTeam;
+		*team = m_callingTeam ? m_callingTeam : m_conditionTeam;
+		return true;
 	}
 	if (m_callingTeam && m_callingTeam->getName() == teamName) {
-		return m_callingTeam;
+		*team = m_callingTeam;
+		return true;
 	}
 	if (m_conditionTeam && m_conditionTeam->getName() == teamName) {
-		return m_conditionTeam;
+		*team = m_conditionTeam;
+		return true;
 	}
-	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototype( teamName );
+	return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamFromPrototype */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamFromPrototype(const AsciiString& teamName, TeamPrototype *theTeamProto)
+{
 	if (theTeamProto == NULL) return NULL;
 	if (theTeamProto->getIsSingleton()) {
 		Team *theTeam = theTeamProto->getFirstItemIn_TeamInstanceList();
@@ -5987,6 +6086,38 @@ Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 	return theTeamProto->getFirstItemIn_TeamInstanceList();
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamed */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
+{
+	Team *theTeam;
+	if (getContextTeamNamed(teamName, &theTeam)) {
+		return theTeam;
+	}
+	return getTeamFromPrototype(teamName, TheTeamFactory->findTeamPrototype( teamName ));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamed - The team instance can change at any time, so only the prototype is cached. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(const Parameter *pTeamParm)
+{
+	const AsciiString& teamName = pTeamParm->getString();
+	Team *theTeam;
+	if (getContextTeamNamed(teamName, &theTeam)) {
+		return theTeam;
+	}
+
+	const UnsignedInt generation = TheTeamFactory->getPrototypeGeneration();
+	void *handle;
+	if (!pTeamParm->getResolvedHandle(Parameter::RESOLVED_TEAM_PROTOTYPE, generation, &handle)) {
+		handle = TheTeamFactory->findTeamPrototype( teamName );
+		pTeamParm->setResolvedHandle(Parameter::RESOLVED_TEAM_PROTOTYPE, generation, handle);
+	}
+	return getTeamFromPrototype(teamName, (TeamPrototype *)handle);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** getUnitNamed */
 //-------------------------------------------------------------------------------------------------
@@ -6007,6 +6138,24 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 	return NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getUnitNamed */
+//-------------------------------------------------------------------------------------------------
+Object * ScriptEngine::getUnitNamed(const Parameter *pUnitParm)
+{
+	const AsciiString& unitName = pUnitParm->getString();
+	if (unitName == THIS_OBJECT) {
+		return getUnitNamed(unitName);
+	}
+
+	void *handle;
+	if (!pUnitParm->getResolvedHandle(Parameter::RESOLVED_UNIT, m_namedObjectsGeneration, &handle)) {
+		handle = getUnitNamed(unitName);
+		pUnitParm->setResolvedHandle(Parameter::RESOLVED_UNIT, m_namedObjectsGeneration, handle);
+	}
+	return (Object *)handle;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** didUnitExist */
 //-------------------------------------------------------------------------------------------------
@@ -6704,6 +6853,7 @@ void ScriptEngine::removeObjectTypes(ObjectTypes *typesToRemove)
 
 	// remove it from the main array of stuff
 	m_allObjectTypeLists.erase(it);
+	++m_objectTypeListsGeneration;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6978,6 +7128,9 @@ void ScriptEngine::executeScript( Script *pScript )
 #endif
 #endif
 
+	const Int64 profileStartTicks = m_profiler ? ScriptProfiler::getTicks() : 0;
+	Bool profileResult = FALSE;
+
 	Team *pSavConditionTeam = m_conditionTeam;
 	TeamPrototype *pProto = NULL;
 
@@ -6992,6 +7145,7 @@ void ScriptEngine::executeScript( Script *pScript )
 			m_conditionTeam = iter.cur();
 			// If conditions evaluate to true, execute actions.
 			if (evaluateConditions(pScript)) {
+				profileResult = TRUE;
 				// Script Debug window
 				if (pScript->getAction()) {
 					_appendMessage(pScript->getName());
@@ -7015,6 +7169,7 @@ void ScriptEngine::executeScript( Script *pScript )
 		m_conditionTeam = NULL;
 		// If conditions evaluate to true, execute actions.
 		if (evaluateConditions(pScript)) {
+			profileResult = TRUE;
 			if (pScript->getAction()) {
 				// Script Debug window
 				_appendMessage(pScript->getName());
@@ -7044,6 +7199,10 @@ void ScriptEngine::executeScript( Script *pScript )
 #endif
 #endif
 
+	if (m_profiler) {
+		m_profiler->addScript(pScript, profileStartTicks, profileResult);
+	}
+
 	m_conditionTeam = pSavConditionTeam;
 }
 
@@ -7051,6 +7210,20 @@ void ScriptEngine::executeScript( Script *pScript )
 /** Evaluates a condition */
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateCondition( Condition *pCondition )
+{
+	if (m_profiler) {
+		const Int64 startTicks = ScriptProfiler::getTicks();
+		const Bool result = evaluateConditionInternal(pCondition);
+		m_profiler->addCondition(pCondition->getConditionType(), startTicks, result);
+		return result;
+	}
+	return evaluateConditionInternal(pCondition);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Evaluates a condition without profiling */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::evaluateConditionInternal( Condition *pCondition )
 {
 	switch (pCondition->getConditionType()) {
 		default:
@@ -7095,6 +7268,8 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
+	++m_namedObjectsGeneration;
+
 	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
 		if (it->first == objName) {
 			if (it->second == NULL) {
@@ -7134,6 +7309,7 @@ void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
 		if (pDeadObject == (it->second)) {
 			it->second = NULL;	// Don't remove it, cause we want to check whether we ever knew a name later
+			++m_namedObjectsGeneration;
 			break;
 		}
 	}
@@ -7155,6 +7331,8 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 		return;
 	}
 
+	++m_namedObjectsGeneration;
+
 	//John Ahlquist: When transferring an object name, make sure the new object isn't already in
 	//							 the vector. If so, remove it, or it'll end up there twice and cause a crash.
 	if( pNewObject->getName().isNotEmpty() )
@@ -7629,6 +7807,7 @@ void ScriptEngine::executeActions( ScriptAction *pActionHead )
 	ScriptAction *pCurAction;
 	UnicodeString uStr1;
 	for (pCurAction = pActionHead; pCurAction; pCurAction = pCurAction->getNext()) {
+		const Int64 profileStartTicks = m_profiler ? ScriptProfiler::getTicks() : 0;
 		switch (pCurAction->getActionType()) {
 			default: if (TheScriptActions) TheScriptActions->executeAction(pCurAction); break;
 			case ScriptAction::SET_COUNTER: setCounter(pCurAction);	break;
@@ -7662,6 +7841,9 @@ void ScriptEngine::executeActions( ScriptAction *pActionHead )
 
 			case ScriptAction::NO_OP: /* just break. */; break;
 		}
+		if (m_profiler) {
+			m_profiler->addAction(pCurAction->getActionType(), profileStartTicks);
+		}
 	}
 }
 
@@ -7711,6 +7893,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 void ScriptEngine::createNamedCache( void )
 {
 	m_namedObjects.clear();
+	++m_namedObjectsGeneration;
 
 	if( !TheGameLogic )
 	{
@@ -9006,6 +9189,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 		// according to John M., so we're clearing it now
 		//
 		m_namedObjects.clear();
+		++m_namedObjectsGeneration;
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -9273,6 +9457,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 
 				// put on list
 				m_allObjectTypeLists.push_back( objectTypes );
+				++m_objectTypeListsGeneration;
 
 			}
 
@@ -31,6 +31,7 @@
 
 #include "Common/AudioAffect.h"
 #include "Common/AudioHandleSpecialValues.h"
+#include "Common/ArchivePrefetcher.h"
 #include "Common/BuildAssistant.h"
 #include "Common/CRCDebug.h"
 #include "Common/FramePacer.h"
@@ -51,6 +52,7 @@
 #include "Common/Radar.h"
 #include "Common/RandomValue.h"
 #include "Common/Recorder.h"
+#include "Common/StartupProfiler.h"
 #include "Common/StatsCollector.h"
 #include "Common/ThingFactory.h"
 #include "Common/Team.h"
@@ -1147,6 +1149,9 @@ void GameLogic::setGameMode( GameMode mode )
 // ------------------------------------------------------------------------------------------------
 void GameLogic::startNewGame( Bool loadingSaveGame )
 {
+	StartupProfilerScope profileGame("Map", "GameLogic::startNewGame", TRUE);
+	StartupProfilerScope profilePhase("MapPhase", "Setup");
+	ArchivePrefetchScope prefetchMap(TheGlobalData->m_mapName);
 
 	#ifdef DUMP_PERF_STATS
 	__int64 startTime64;
@@ -1336,9 +1341,11 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 
 	DEBUG_ASSERTCRASH(m_frame == 0, ("framecounter expected to be 0 here"));
 
+	profilePhase.next("Map INI");
 	// before loading the map, load the map.ini file in the same directory.
 	loadMapINI( TheGlobalData->m_mapName );
 
+	profilePhase.next("Load map");
 	// load a map
 	TheTerrainLogic->loadMap( TheGlobalData->m_mapName, false );
 	// anytime the world's size changes, must reset the partition mgr
@@ -1347,6 +1354,8 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_LOAD_MAP);
 
+	profilePhase.next("Sides and players");
+
 	#ifdef DUMP_PERF_STATS
 	GetPrecisionTimer(&endTime64);
 	char Buf[256];
@@ -1543,12 +1552,15 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_PLAYER_LIST_RESET);
 
+	profilePhase.next("Script engine");
 	// Tell the script engine that a newe set of scripts is loaded.
 	TheScriptEngine->newMap();
 
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_SCRIPT_ENGINE_NEW_MAP);
 
+	profilePhase.next("Teams and victory conditions");
+
 	if (TheGameEngine->isMultiplayerSession() || isSkirmishOrSkirmishReplay)
 	{
 		// if there are no other teams (happens for debugging) don't end the game immediately
@@ -1715,12 +1727,15 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_GHOST_OBJECT_MANAGER_RESET);
 
+	profilePhase.next("Terrain logic");
 	// update the terrain logic now that all is loaded
 	TheTerrainLogic->newMap( loadingSaveGame );
 
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_TERRAIN_LOGIC_NEW_MAP);
 
+	profilePhase.next("Bridges and pathfinder");
+
 	#ifdef DUMP_PERF_STATS
 	GetPrecisionTimer(&endTime64);
 	sprintf(Buf,"After terrainlogic->newmap=%f",((double)(endTime64-startTime64)/(double)(freq64)*1000.0));
@@ -1783,6 +1798,8 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_PATHFINDER_NEW_MAP);
 
+	profilePhase.next("Map objects");
+
 	// reveal the map for the permanent observer
 	ThePartitionManager->revealMapForPlayerPermanently( observerPlayer->getPlayerIndex() );
 	DEBUG_LOG(("Reveal shroud for %ls whose index is %d", observerPlayer->getPlayerDisplayName().str(), observerPlayer->getPlayerIndex()));
@@ -2049,6 +2066,8 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_INITIAL_NETWORK_BUILDINGS);
 
+	profilePhase.next("Preload assets");
+
 	//
 	// tell the client to pre-load some assets that we will use such as faction things we
 	// will build and various damage states for all the structures on the map so that we
@@ -2073,6 +2092,8 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	// update the loadscreen
 	updateLoadProgress(LOAD_PROGRESS_POST_PRELOAD_ASSETS);
 
+	profilePhase.next("Camera and finish");
+
 	TheTacticalView->setAngleAndPitchToDefault();
 	TheTacticalView->setZoomToDefault();
 